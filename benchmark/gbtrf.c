@@ -0,0 +1,133 @@
+/*********************************************************************/
+/* Copyright 2009, 2010 The University of Texas at Austin.           */
+/* All rights reserved.                                              */
+/*                                                                   */
+/* Redistribution and use in source and binary forms, with or        */
+/* without modification, are permitted provided that the following   */
+/* conditions are met:                                               */
+/*                                                                   */
+/*   1. Redistributions of source code must retain the above         */
+/*      copyright notice, this list of conditions and the following  */
+/*      disclaimer.                                                  */
+/*                                                                   */
+/*   2. Redistributions in binary form must reproduce the above      */
+/*      copyright notice, this list of conditions and the following  */
+/*      disclaimer in the documentation and/or other materials       */
+/*      provided with the distribution.                              */
+/*                                                                   */
+/*    THIS  SOFTWARE IS PROVIDED  BY THE  UNIVERSITY OF  TEXAS AT    */
+/*    AUSTIN  ``AS IS''  AND ANY  EXPRESS OR  IMPLIED WARRANTIES,    */
+/*    INCLUDING, BUT  NOT LIMITED  TO, THE IMPLIED  WARRANTIES OF    */
+/*    MERCHANTABILITY  AND FITNESS FOR  A PARTICULAR  PURPOSE ARE    */
+/*    DISCLAIMED.  IN  NO EVENT SHALL THE UNIVERSITY  OF TEXAS AT    */
+/*    AUSTIN OR CONTRIBUTORS BE  LIABLE FOR ANY DIRECT, INDIRECT,    */
+/*    INCIDENTAL,  SPECIAL, EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES    */
+/*    (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF SUBSTITUTE    */
+/*    GOODS  OR  SERVICES; LOSS  OF  USE,  DATA,  OR PROFITS;  OR    */
+/*    BUSINESS INTERRUPTION) HOWEVER CAUSED  AND ON ANY THEORY OF    */
+/*    LIABILITY, WHETHER  IN CONTRACT, STRICT  LIABILITY, OR TORT    */
+/*    (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT    */
+/*    OF  THE  USE OF  THIS  SOFTWARE,  EVEN  IF ADVISED  OF  THE    */
+/*    POSSIBILITY OF SUCH DAMAGE.                                    */
+/*                                                                   */
+/* The views and conclusions contained in the software and           */
+/* documentation are those of the authors and should not be          */
+/* interpreted as representing official policies, either expressed   */
+/* or implied, of The University of Texas at Austin.                 */
+/*********************************************************************/
+
+#include "bench.h"
+
+#undef GBTRF
+
+#ifdef DOUBLE
+#define GBTRF   BLASFUNC(dgbtrf)
+#else
+#define GBTRF   BLASFUNC(sgbtrf)
+#endif
+
+/*
+ * Sweeps the bandwidth KL = KU from .. to for a band matrix of order
+ * OPENBLAS_BAND_N (default 100000).
+ */
+int main(int argc, char *argv[]){
+
+  FLOAT *a;
+  blasint *ipiv;
+  blasint n, k, ldab, info;
+  long i, len;
+
+  int from =  200;
+  int to   = 2000;
+  int step =  200;
+  int loops =   1;
+  int l;
+
+  double time1, timeg;
+
+  char *p;
+
+  argc--;argv++;
+
+  if (argc > 0) { from     = atol(*argv);		argc--; argv++;}
+  if (argc > 0) { to       = MAX(atol(*argv), from);	argc--; argv++;}
+  if (argc > 0) { step     = atol(*argv);		argc--; argv++;}
+
+  n = 100000;
+  if ((p = getenv("OPENBLAS_BAND_N"))) n = atol(p);
+  if ((p = getenv("OPENBLAS_LOOPS"))) loops = atoi(p);
+
+  fprintf(stderr, "From : %3d  To : %3d Step = %3d  N = %d\n", from, to, step, (int)n);
+
+  len = (long)(3 * to + 1) * (long)n;
+
+  if (( a = (FLOAT *)malloc(sizeof(FLOAT) * len)) == NULL){
+    fprintf(stderr,"Out of Memory!!\n");exit(1);
+  }
+
+  if (( ipiv = (blasint *)malloc(sizeof(blasint) * n)) == NULL){
+    fprintf(stderr,"Out of Memory!!\n");exit(1);
+  }
+
+#ifdef __linux
+  srandom(getpid());
+#endif
+
+  fprintf(stderr, "   BAND           FLops           Time\n");
+
+  for(k = from; k <= to; k += step){
+
+    ldab = 3 * k + 1;
+    timeg = 0.;
+
+    fprintf(stderr, " %6d : ", (int)k);
+
+    for (l = 0; l < loops; l++) {
+
+      for (i = 0; i < (long)ldab * (long)n; i++) a[i] = ((FLOAT) rand() / (FLOAT) RAND_MAX) - 0.5;
+
+      begin();
+
+      GBTRF (&n, &n, &k, &k, a, &ldab, ipiv, &info);
+
+      end();
+
+      if (info) {
+	fprintf(stderr, "Matrix is singular .. %d\n", info);
+	exit(1);
+      }
+
+      timeg += getsec();
+    }
+
+    time1 = timeg / (double)loops;
+
+    fprintf(stderr,
+	    " %10.2f MFlops : %10.2f Sec\n",
+	    2. * (double)n * (double)k * (double)(2 * k) / time1 * 1.e-6, time1);
+  }
+
+  return 0;
+}
+
+// void main(int argc, char *argv[]) __attribute__((weak, alias("MAIN__")));
@@ -60,7 +60,8 @@ int main(int argc, char *argv[]){
   if ((p = getenv("OPENBLAS_UPLO"))) uplo=*p;
   if ((p = getenv("OPENBLAS_TRANS"))) trans=*p;
 
-  blasint m, i, j, l;
+  blasint m, k, lda, i, j, l;
+  int has_param_k = 0;
 
   int from =   1;
   int to   = 200;
@@ -77,10 +78,18 @@ int main(int argc, char *argv[]){
   if (argc > 0) { to       = MAX(atol(*argv), from);	argc--; argv++;}
   if (argc > 0) { step     = atol(*argv);		argc--; argv++;}
 
+  /* a fixed rank for the update, e.g. OPENBLAS_PARAM_K=64, instead of k = n */
+  if ((p = getenv("OPENBLAS_PARAM_K"))) {
+    k = atoi(p);
+    has_param_k = 1;
+  } else {
+    k = to;
+  }
+
   fprintf(stderr, "From : %3d  To : %3d Step = %3d Uplo = %c Trans = %c Loops = %d\n", from, to, step,uplo,trans,loops);
 
 
-  if (( a = (FLOAT *)malloc(sizeof(FLOAT) * to * to * COMPSIZE)) == NULL){
+  if (( a = (FLOAT *)malloc(sizeof(FLOAT) * to * MAX(to, k) * COMPSIZE)) == NULL){
     fprintf(stderr,"Out of Memory!!\n");exit(1);
   }
 
@@ -100,20 +109,26 @@ int main(int argc, char *argv[]){
   {
     timeg = 0.;
 
+    if (!has_param_k) k = m;
+    lda = ((trans == 'N') || (trans == 'n')) ? m : k;
+
     fprintf(stderr, " %6d : ", (int)m);
 
     for(l = 0; l < loops; l++) {
 
+    for(i = 0; i < m * k * COMPSIZE; i++){
+      a[i] = ((FLOAT) rand() / (FLOAT) RAND_MAX) - 0.5;
+    }
+
     for(j = 0; j < m; j++){
       for(i = 0; i < m * COMPSIZE; i++){
-	a[(long)i + (long)j * (long)m * COMPSIZE] = ((FLOAT) rand() / (FLOAT) RAND_MAX) - 0.5;
 	c[(long)i + (long)j * (long)m * COMPSIZE] = ((FLOAT) rand() / (FLOAT) RAND_MAX) - 0.5;
       }
     }
 
     begin();
 
-    SYRK (&uplo, &trans, &m, &m, alpha, a, &m, beta, c, &m );
+    SYRK (&uplo, &trans, &m, &k, alpha, a, &lda, beta, c, &m );
 
     end();
 
@@ -123,7 +138,7 @@ int main(int argc, char *argv[]){
     time1 = timeg / (double)loops;
     fprintf(stderr,
 	    " %10.2f MFlops\n",
-	    COMPSIZE * COMPSIZE * 1. * (double)m * (double)m * (double)m / time1 * 1.e-6);
+	    COMPSIZE * COMPSIZE * 1. * (double)m * (double)m * (double)k / time1 * 1.e-6);
 
   }
 
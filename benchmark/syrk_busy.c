@@ -0,0 +1,278 @@
+/***************************************************************************
+Copyright (c) 2024 The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+/* SYRK throughput plus the CPU time each thread of the process spent in
+   the calls (Linux only). Server threads are read from
+   /proc/self/task/<tid>/schedstat, the calling thread from its own clock.
+
+   Idle server threads spin for 2^OPENBLAS_THREAD_TIMEOUT cycles before
+   they sleep, and that spin counts as CPU time. Run with
+   OPENBLAS_THREAD_TIMEOUT=4 so that a worker's time is the time it was
+   busy. The calling thread waits for the workers by spinning, so its
+   time includes that wait; it is reported apart from the workers.
+
+   The imbalance is the busiest worker's time over the workers' mean. */
+
+#include "bench.h"
+
+#undef SYRK
+
+#ifndef COMPLEX
+
+#ifdef DOUBLE
+#define SYRK   BLASFUNC(dsyrk)
+#else
+#define SYRK   BLASFUNC(ssyrk)
+#endif
+
+#else
+
+#ifdef DOUBLE
+#define SYRK   BLASFUNC(zsyrk)
+#else
+#define SYRK   BLASFUNC(csyrk)
+#endif
+
+#endif
+
+#ifdef __linux
+
+#include <dirent.h>
+
+#define MAX_TASKS 512
+
+typedef struct {
+  long tid;
+  double sec;
+} task_time_t;
+
+/* CPU time of every thread of the process; returns the number found */
+static int task_times(task_time_t *tasks){
+
+  DIR *dir;
+  struct dirent *entry;
+  FILE *fp;
+  char path[300];
+  unsigned long long ns;
+  int num = 0;
+
+  if ((dir = opendir("/proc/self/task")) == NULL) return -1;
+
+  while ((entry = readdir(dir)) != NULL && num < MAX_TASKS) {
+
+    if (entry -> d_name[0] == '.') continue;
+
+    snprintf(path, sizeof(path), "/proc/self/task/%s/schedstat", entry -> d_name);
+
+    if ((fp = fopen(path, "r")) == NULL) continue;
+
+    if (fscanf(fp, "%llu", &ns) == 1) {
+      tasks[num].tid = atol(entry -> d_name);
+      tasks[num].sec = (double)ns * 1.e-9;
+      num ++;
+    }
+
+    fclose(fp);
+  }
+
+  closedir(dir);
+
+  return num;
+}
+
+/* /proc lags for a running thread, so the caller reads its own clock */
+static double caller_time(void){
+
+  struct timespec ts;
+
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1.e-9;
+}
+
+static double task_lookup(task_time_t *tasks, int num, long tid){
+
+  int i;
+
+  for (i = 0; i < num; i++) if (tasks[i].tid == tid) return tasks[i].sec;
+
+  return 0.;
+}
+
+#endif
+
+int main(int argc, char *argv[]){
+
+  FLOAT *a, *c;
+  FLOAT alpha[] = {1.0, 1.0};
+  FLOAT beta [] = {1.0, 1.0};
+  char *p;
+
+  char uplo='U';
+  char trans='N';
+
+  if ((p = getenv("OPENBLAS_UPLO"))) uplo=*p;
+  if ((p = getenv("OPENBLAS_TRANS"))) trans=*p;
+
+  blasint m, k, lda, i, j, l;
+  int has_param_k = 0;
+
+  int from =   1;
+  int to   = 200;
+  int step =   1;
+  int loops =  1;
+
+  if ((p = getenv("OPENBLAS_LOOPS"))) loops=atoi(p);
+
+  double time1,timeg;
+
+#ifdef __linux
+  static task_time_t before[MAX_TASKS], after[MAX_TASKS];
+  int num_before, num_after, workers;
+  long self = getpid();
+  double busy, busy_max, busy_sum, caller;
+#endif
+
+  argc--;argv++;
+
+  if (argc > 0) { from     = atol(*argv);		argc--; argv++;}
+  if (argc > 0) { to       = MAX(atol(*argv), from);	argc--; argv++;}
+  if (argc > 0) { step     = atol(*argv);		argc--; argv++;}
+
+  /* a fixed rank for the update, e.g. OPENBLAS_PARAM_K=64, instead of k = n */
+  if ((p = getenv("OPENBLAS_PARAM_K"))) {
+    k = atoi(p);
+    has_param_k = 1;
+  } else {
+    k = to;
+  }
+
+  fprintf(stderr, "From : %3d  To : %3d Step = %3d Uplo = %c Trans = %c Loops = %d\n", from, to, step,uplo,trans,loops);
+
+#ifndef __linux
+  fprintf(stderr, "Per-thread busy time needs /proc/self/task; reporting MFlops only.\n");
+#else
+  if (getenv("OPENBLAS_THREAD_TIMEOUT") == NULL)
+    fprintf(stderr, "OPENBLAS_THREAD_TIMEOUT is not set; worker times include their idle spin.\n");
+#endif
+
+  if (( a = (FLOAT *)malloc(sizeof(FLOAT) * to * MAX(to, k) * COMPSIZE)) == NULL){
+    fprintf(stderr,"Out of Memory!!\n");exit(1);
+  }
+
+  if (( c = (FLOAT *)malloc(sizeof(FLOAT) * to * to * COMPSIZE)) == NULL){
+    fprintf(stderr,"Out of Memory!!\n");exit(1);
+  }
+
+#ifdef __linux
+  srandom(getpid());
+#endif
+
+  fprintf(stderr, "   SIZE       Flops         Caller[s]  Workers busy[s]  Imbalance\n");
+
+  for(m = from; m <= to; m += step)
+  {
+    timeg = 0.;
+
+    if (!has_param_k) k = m;
+    lda = ((trans == 'N') || (trans == 'n')) ? m : k;
+
+    fprintf(stderr, " %6d : ", (int)m);
+
+    for(i = 0; i < m * k * COMPSIZE; i++){
+      a[i] = ((FLOAT) rand() / (FLOAT) RAND_MAX) - 0.5;
+    }
+
+    for(j = 0; j < m; j++){
+      for(i = 0; i < m * COMPSIZE; i++){
+	c[(long)i + (long)j * (long)m * COMPSIZE] = ((FLOAT) rand() / (FLOAT) RAND_MAX) - 0.5;
+      }
+    }
+
+    /* the first call starts the server threads */
+    SYRK (&uplo, &trans, &m, &k, alpha, a, &lda, beta, c, &m );
+
+#ifdef __linux
+    num_before = task_times(before);
+    caller     = caller_time();
+#endif
+
+    for(l = 0; l < loops; l++) {
+
+    begin();
+
+    SYRK (&uplo, &trans, &m, &k, alpha, a, &lda, beta, c, &m );
+
+    end();
+
+    timeg += getsec();
+
+    } //loops
+
+    time1 = timeg / (double)loops;
+    fprintf(stderr,
+	    " %10.2f MFlops",
+	    COMPSIZE * COMPSIZE * 1. * (double)m * (double)m * (double)k / time1 * 1.e-6);
+
+#ifdef __linux
+    caller    = (caller_time() - caller) / (double)loops;
+    num_after = task_times(after);
+
+    if (num_before < 0 || num_after < 0) {
+      fprintf(stderr, "  (no /proc/self/task)\n");
+      continue;
+    }
+
+    fprintf(stderr, "  %10.6f  ", caller);
+
+    workers  = 0;
+    busy_max = 0.;
+    busy_sum = 0.;
+
+    for (i = 0; i < num_after; i++) {
+      if (after[i].tid == self) continue;
+      busy = (after[i].sec - task_lookup(before, num_before, after[i].tid)) / (double)loops;
+      fprintf(stderr, " %10.6f", busy);
+      busy_max  = MAX(busy_max, busy);
+      busy_sum += busy;
+      workers ++;
+    }
+
+    if (workers > 0 && busy_sum > 0.)
+      fprintf(stderr, "  %6.3f", busy_max * (double)workers / busy_sum);
+
+    fprintf(stderr, "\n");
+#else
+    fprintf(stderr, "\n");
+#endif
+
+  }
+
+  return 0;
+}
+
+// void main(int argc, char *argv[]) __attribute__((weak, alias("MAIN__")));
@@ -165,6 +165,20 @@ if (${CORE} STREQUAL SAPPHIRERAPIDS)
   endif ()
 endif ()
 
+if (${CORE} STREQUAL ZEN4)
+  if (NOT DYNAMIC_ARCH)
+    if (NOT NO_AVX512)
+      if (${GCC_VERSION} VERSION_GREATER 13.0 OR ${GCC_VERSION} VERSION_EQUAL 13.0)
+        set (CCOMMON_OPT  "${CCOMMON_OPT} -march=znver4")
+      elseif (${GCC_VERSION} VERSION_GREATER 10.1 OR ${GCC_VERSION} VERSION_EQUAL 10.1)
+        set (CCOMMON_OPT  "${CCOMMON_OPT} -march=cooperlake")
+      else ()
+        set (CCOMMON_OPT "${CCOMMON_OPT} -march=skylake-avx512")
+      endif()
+    endif ()
+  endif ()
+endif ()
+
 if (${CORE} STREQUAL ZEN)
   if (HAVE_AVX512VL)
     if (NOT DYNAMIC_ARCH)
@@ -117,6 +117,8 @@ macro(SetDefaultL1)
   SetFallback(ZSUMKERNEL zsum.S)
   SetFallback(QSUMKERNEL sum.S)
   SetFallback(XSUMKERNEL zsum.S)
+  SetFallback(TOHF16KERNEL ../x86_64/tohf16.c)
+  SetFallback(HF16TOKERNEL ../x86_64/hf16to.c)
 if (BUILD_BFLOAT16)
   SetFallback(SHAMINKERNEL ../arm/amin.c)
   SetFallback(SHAMAXKERNEL ../arm/amax.c)
@@ -201,6 +203,15 @@ macro(SetDefaultL3)
   SetFallback(DGEADD_KERNEL ../generic/geadd.c)
   SetFallback(CGEADD_KERNEL ../generic/zgeadd.c)
   SetFallback(ZGEADD_KERNEL ../generic/zgeadd.c)
+  SetFallback(I8GEMMKERNEL ../generic/i8gemm_kernel.c)
+  SetFallback(I8GEMMINCOPY ../generic/i8gemm_copy.c)
+  SetFallback(I8GEMMITCOPY ../generic/i8gemm_copy.c)
+  SetFallback(I8GEMMONCOPY ../generic/i8gemm_copy.c)
+  SetFallback(I8GEMMOTCOPY ../generic/i8gemm_copy.c)
+  SetFallback(SHGEMMINCOPY ../generic/shgemm_copy.c)
+  SetFallback(SHGEMMITCOPY ../generic/shgemm_copy.c)
+  SetFallback(SHGEMMONCOPY ../generic/shgemm_copy.c)
+  SetFallback(SHGEMMOTCOPY ../generic/shgemm_copy.c)
 if (BUILD_BFLOAT16)
   SetFallback(SHGEADD_KERNEL ../generic/geadd.c)
   SetFallback(SBGEMMKERNEL ../generic/gemmkernel_2x2.c)
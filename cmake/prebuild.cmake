@@ -497,6 +497,58 @@ if (DEFINED CORE AND CMAKE_CROSSCOMPILING AND NOT (${HOST_OS} STREQUAL "WINDOWSS
       set(CGEMM3M_UNROLL_N 4)
       set(ZGEMM3M_UNROLL_M 4)
       set(ZGEMM3M_UNROLL_N 4)
+  elseif ("${TCORE}" STREQUAL "ZEN4")
+    file(APPEND ${TARGET_CONF_TEMP}
+      "#define L1_DATA_SIZE\t32768\n"
+      "#define L1_DATA_LINESIZE\t64\n"
+      "#define L2_SIZE\t1048576\n"
+      "#define L2_LINESIZE\t64\n"
+      "#define DTB_DEFAULT_ENTRIES\t64\n"
+      "#define DTB_SIZE\t4096\n"
+      "#define HAVE_CMOV\n"
+      "#define HAVE_MMX\n"
+      "#define HAVE_SSE\n"
+      "#define HAVE_SSE2\n"
+      "#define HAVE_SSE3\n"
+      "#define HAVE_SSSE3\n"
+      "#define HAVE_SSE4_1\n"
+      "#define HAVE_SSE4_2\n"
+      "#define HAVE_AVX\n"
+      "#define HAVE_AVX2\n"
+      "#define HAVE_FMA3\n"
+      "#define HAVE_AVX512VL\n"
+      "#define HAVE_AVX512BF16\n"
+      "#define SLOCAL_BUFFER_SIZE\t20480\n"
+      "#define DLOCAL_BUFFER_SIZE\t12288\n"
+      "#define CLOCAL_BUFFER_SIZE\t12288\n"
+      "#define ZLOCAL_BUFFER_SIZE\t8192\n")
+      set(HAVE_CMOV 1)
+      set(HAVE_MMX 1)
+      set(HAVE_SSE 1)
+      set(HAVE_SSE2 1)
+      set(HAVE_SSE3 1)
+      set(HAVE_SSSE3 1)
+      set(HAVE_SSE4_1 1)
+      set(HAVE_SSE4_2 1)
+      set(HAVE_AVX 1)
+      set(HAVE_AVX2 1)
+      set(HAVE_FMA3 1)
+      set(HAVE_AVX512VL 1)
+      set(HAVE_AVX512BF16 1)
+      set(SBGEMM_UNROLL_M 16)
+      set(SBGEMM_UNROLL_N 4)
+      set(SGEMM_UNROLL_M 16)
+      set(SGEMM_UNROLL_N 4)
+      set(DGEMM_UNROLL_M 16)
+      set(DGEMM_UNROLL_N 2)
+      set(CGEMM_UNROLL_M 8)
+      set(CGEMM_UNROLL_N 2)
+      set(ZGEMM_UNROLL_M 4)
+      set(ZGEMM_UNROLL_N 2)
+      set(CGEMM3M_UNROLL_M 8)
+      set(CGEMM3M_UNROLL_N 4)
+      set(ZGEMM3M_UNROLL_M 4)
+      set(ZGEMM3M_UNROLL_N 4)
   elseif ("${TCORE}" STREQUAL "OPTERON")
     file(APPEND ${TARGET_CONF_TEMP}
       "#define L1_DATA_SIZE\t65536\n"
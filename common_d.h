@@ -158,6 +158,7 @@
 #define DGEADD_K                dgeadd_k 
 
 #define DGEMM_SMALL_MATRIX_PERMIT	dgemm_small_matrix_permit
+#define DGEMM_SMALL_KERNEL_FIXED	dgemm_small_kernel_fixed
 
 #else
 
@@ -284,6 +285,7 @@
 #define DGEADD_K                gotoblas -> dgeadd_k 
 
 #define DGEMM_SMALL_MATRIX_PERMIT	gotoblas -> dgemm_small_matrix_permit
+#define DGEMM_SMALL_KERNEL_FIXED	gotoblas -> dgemm_small_kernel_fixed
 
 #endif
 
@@ -337,6 +339,30 @@
 #define	DSYRK_KERNEL_U		dsyrk_kernel_U
 #define	DSYRK_KERNEL_L		dsyrk_kernel_L
 
+#define	DGEMMT_UNN		dgemmt_UNN
+#define	DGEMMT_UNT		dgemmt_UNT
+#define	DGEMMT_UTN		dgemmt_UTN
+#define	DGEMMT_UTT		dgemmt_UTT
+#define	DGEMMT_LNN		dgemmt_LNN
+#define	DGEMMT_LNT		dgemmt_LNT
+#define	DGEMMT_LTN		dgemmt_LTN
+#define	DGEMMT_LTT		dgemmt_LTT
+
+#define	DGEMM_EPILOGUE		dgemm_epilogue_k
+#define	DGEMM_EPILOGUE_NN	dgemm_epilogue_nn
+#define	DGEMM_EPILOGUE_NT	dgemm_epilogue_nt
+#define	DGEMM_EPILOGUE_TN	dgemm_epilogue_tn
+#define	DGEMM_EPILOGUE_TT	dgemm_epilogue_tt
+#define	DGEMM_EPILOGUE_THREAD_NN	dgemm_epilogue_thread_nn
+#define	DGEMM_EPILOGUE_THREAD_NT	dgemm_epilogue_thread_nt
+#define	DGEMM_EPILOGUE_THREAD_TN	dgemm_epilogue_thread_tn
+#define	DGEMM_EPILOGUE_THREAD_TT	dgemm_epilogue_thread_tt
+
+#define	DGEMM_STRASSEN		dgemm_strassen
+#define	DGEMM_STRASSEN_RELEASE	dgemm_strassen_release
+
+#define	DIMATCOPY_INPLACE	dimatcopy_inplace
+
 #define	DHERK_UN		dsyrk_UN
 #define	DHERK_LN		dsyrk_LN
 #define	DHERK_UC		dsyrk_UT
@@ -441,6 +467,7 @@
 #define	DGEMM_THREAD_RT		dgemm_thread_nt
 #define	DGEMM_THREAD_RC		dgemm_thread_nt
 #define	DGEMM_THREAD_RR		dgemm_thread_nn
+#define	DGEMM_SPLIT_K		dgemm_split_k
 
 #define	DSYMM_THREAD_LU		dsymm_thread_LU
 #define	DSYMM_THREAD_LL		dsymm_thread_LL
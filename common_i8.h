@@ -0,0 +1,33 @@
+#ifndef COMMON_I8_H
+#define COMMON_I8_H
+
+/*
+ * int8 x uint8 -> int32 GEMM.  The kernel and the packing routines come
+ * from the gotoblas table; the drivers are built once and pick them up
+ * through these macros.
+ */
+
+#ifndef DYNAMIC_ARCH
+
+#define	I8GEMM_KERNEL		i8gemm_kernel
+#define	I8GEMM_INCOPY		i8gemm_incopy
+#define	I8GEMM_ITCOPY		i8gemm_itcopy
+#define	I8GEMM_ONCOPY		i8gemm_oncopy
+#define	I8GEMM_OTCOPY		i8gemm_otcopy
+
+#else
+
+#define	I8GEMM_KERNEL		gotoblas -> i8gemm_kernel
+#define	I8GEMM_INCOPY		gotoblas -> i8gemm_incopy
+#define	I8GEMM_ITCOPY		gotoblas -> i8gemm_itcopy
+#define	I8GEMM_ONCOPY		gotoblas -> i8gemm_oncopy
+#define	I8GEMM_OTCOPY		gotoblas -> i8gemm_otcopy
+
+#endif
+
+#define	I8GEMM_NN		i8gemm_nn
+#define	I8GEMM_TN		i8gemm_tn
+#define	I8GEMM_NT		i8gemm_nt
+#define	I8GEMM_TT		i8gemm_tt
+
+#endif
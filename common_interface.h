@@ -65,6 +65,11 @@ void   BLASFUNC(sbdtobf16) (blasint *, double *,   blasint *, bfloat16 *, blasin
 void   BLASFUNC(sbf16tos)  (blasint *, bfloat16 *, blasint *, float *,    blasint *);
 void   BLASFUNC(dbf16tod)  (blasint *, bfloat16 *, blasint *, double *,   blasint *);
 
+void   BLASFUNC(shstohf16) (blasint *, float *,    blasint *, hfloat16 *, blasint *);
+void   BLASFUNC(shdtohf16) (blasint *, double *,   blasint *, hfloat16 *, blasint *);
+void   BLASFUNC(shf16tos)  (blasint *, hfloat16 *, blasint *, float *,    blasint *);
+void   BLASFUNC(dhf16tod)  (blasint *, hfloat16 *, blasint *, double *,   blasint *);
+
 #ifdef RETURN_BY_STRUCT
 typedef struct {
   float r, i;
@@ -257,6 +262,8 @@ void BLASFUNC(xgerc)(blasint *,    blasint *, xdouble *, xdouble *, blasint *,
 
 void BLASFUNC(sbgemv)(char *, blasint *, blasint *, float  *, bfloat16 *, blasint *,
             bfloat16  *, blasint *, float  *, float  *, blasint *);
+void BLASFUNC(shgemv)(char *, blasint *, blasint *, float  *, hfloat16 *, blasint *,
+            hfloat16  *, blasint *, float  *, float  *, blasint *);
 void BLASFUNC(sgemv)(char *, blasint *, blasint *, float  *, float  *, blasint *,
 		    float  *, blasint *, float  *, float  *, blasint *);
 void BLASFUNC(dgemv)(char *, blasint *, blasint *, double *, double *, blasint *,
@@ -483,6 +490,8 @@ void BLASFUNC(xhbmv)(char *, blasint *, blasint *, xdouble *, xdouble *, blasint
 
 void BLASFUNC(sbgemm)(char *, char *, blasint *, blasint *, blasint *, float *,
 	   bfloat16 *, blasint *, bfloat16 *, blasint *, float *, float *, blasint *);
+void BLASFUNC(shgemm)(char *, char *, blasint *, blasint *, blasint *, float *,
+	   hfloat16 *, blasint *, hfloat16 *, blasint *, float *, float *, blasint *);
 void BLASFUNC(sgemm)(char *, char *, blasint *, blasint *, blasint *, float *,
 	   float  *, blasint *, float  *, blasint *, float  *, float  *, blasint *);
 void BLASFUNC(dgemm)(char *, char *, blasint *, blasint *, blasint *, double *,
@@ -688,6 +697,61 @@ int BLASFUNC(cgetrf)(blasint *, blasint *, float  *, blasint *, blasint *, blasi
 int BLASFUNC(zgetrf)(blasint *, blasint *, double *, blasint *, blasint *, blasint *);
 int BLASFUNC(xgetrf)(blasint *, blasint *, xdouble *, blasint *, blasint *, blasint *);
 
+int BLASFUNC(sgetri)(blasint *, float  *, blasint *, blasint *, float  *, blasint *, blasint *);
+int BLASFUNC(dgetri)(blasint *, double *, blasint *, blasint *, double *, blasint *, blasint *);
+int BLASFUNC(cgetri)(blasint *, float  *, blasint *, blasint *, float  *, blasint *, blasint *);
+int BLASFUNC(zgetri)(blasint *, double *, blasint *, blasint *, double *, blasint *, blasint *);
+
+int BLASFUNC(dsgesv)(blasint *, blasint *, double *, blasint *, blasint *, double *, blasint *,
+		     double *, blasint *, double *, float *, blasint *, blasint *);
+int BLASFUNC(dsbgesv)(blasint *, blasint *, double *, blasint *, blasint *, double *, blasint *,
+		      double *, blasint *, double *, float *, blasint *, blasint *);
+int BLASFUNC(dsposv)(char *, blasint *, blasint *, double *, blasint *, double *, blasint *,
+		     double *, blasint *, double *, float *, blasint *, blasint *);
+
+int BLASFUNC(sgetrf_batch)(blasint *, blasint *, float  **, blasint *, blasint **, blasint *, blasint *, blasint *);
+int BLASFUNC(sgetrf_batch_strided)(blasint *, blasint *, float  *, blasint *, blasint *, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(spotrf_batch)(char *, blasint *, float  **, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(spotrf_batch_strided)(char *, blasint *, float  *, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(sgetrs_batch)(char *, blasint *, blasint *, float  **, blasint *, blasint **, float  **, blasint *,
+			  blasint *, blasint *, blasint *);
+int BLASFUNC(sgetrs_batch_strided)(char *, blasint *, blasint *, float  *, blasint *, blasint *, blasint *, blasint *,
+				  float  *, blasint *, blasint *, blasint *, blasint *);
+
+int BLASFUNC(dgetrf_batch)(blasint *, blasint *, double **, blasint *, blasint **, blasint *, blasint *, blasint *);
+int BLASFUNC(dgetrf_batch_strided)(blasint *, blasint *, double *, blasint *, blasint *, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(dpotrf_batch)(char *, blasint *, double **, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(dpotrf_batch_strided)(char *, blasint *, double *, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(dgetrs_batch)(char *, blasint *, blasint *, double **, blasint *, blasint **, double **, blasint *,
+			  blasint *, blasint *, blasint *);
+int BLASFUNC(dgetrs_batch_strided)(char *, blasint *, blasint *, double *, blasint *, blasint *, blasint *, blasint *,
+				  double *, blasint *, blasint *, blasint *, blasint *);
+
+int BLASFUNC(sgeqrf)(blasint *, blasint *, float  *, blasint *, float  *, float  *, blasint *, blasint *);
+int BLASFUNC(dgeqrf)(blasint *, blasint *, double *, blasint *, double *, double *, blasint *, blasint *);
+int BLASFUNC(sormqr)(char *, char *, blasint *, blasint *, blasint *, float  *, blasint *, float  *,
+		     float  *, blasint *, float  *, blasint *, blasint *);
+int BLASFUNC(dormqr)(char *, char *, blasint *, blasint *, blasint *, double *, blasint *, double *,
+		     double *, blasint *, double *, blasint *, blasint *);
+int BLASFUNC(ssyevd)(char *, char *, blasint *, float  *, blasint *, float  *, float  *, blasint *,
+		     blasint *, blasint *, blasint *);
+int BLASFUNC(dsyevd)(char *, char *, blasint *, double *, blasint *, double *, double *, blasint *,
+		     blasint *, blasint *, blasint *);
+
+int BLASFUNC(ssytrf)(char *, blasint *, float  *, blasint *, blasint *, float  *, blasint *, blasint *);
+int BLASFUNC(dsytrf)(char *, blasint *, double *, blasint *, blasint *, double *, blasint *, blasint *);
+
+int BLASFUNC(sgbtrf)(blasint *, blasint *, blasint *, blasint *, float  *, blasint *, blasint *, blasint *);
+int BLASFUNC(dgbtrf)(blasint *, blasint *, blasint *, blasint *, double *, blasint *, blasint *, blasint *);
+
+int BLASFUNC(spbtrf)(char *, blasint *, blasint *, float  *, blasint *, blasint *);
+int BLASFUNC(dpbtrf)(char *, blasint *, blasint *, double *, blasint *, blasint *);
+
+int BLASFUNC(slaed3)(blasint *, blasint *, blasint *, float  *, float  *, blasint *, float  *, float  *, float  *,
+		     blasint *, blasint *, float  *, float  *, blasint *);
+int BLASFUNC(dlaed3)(blasint *, blasint *, blasint *, double *, double *, blasint *, double *, double *, double *,
+		     blasint *, blasint *, double *, double *, blasint *);
+
 int BLASFUNC(slaswp)(blasint *, float  *, blasint *, blasint *, blasint *, blasint *, blasint *);
 int BLASFUNC(dlaswp)(blasint *, double *, blasint *, blasint *, blasint *, blasint *, blasint *);
 int BLASFUNC(qlaswp)(blasint *, xdouble *, blasint *, blasint *, blasint *, blasint *, blasint *);
@@ -796,6 +860,16 @@ void    BLASFUNC(dgeadd) (blasint *, blasint *, double *, double *, blasint *, d
 void    BLASFUNC(cgeadd) (blasint *, blasint *, float *, float *, blasint *, float *, float *, blasint*); 
 void    BLASFUNC(zgeadd) (blasint *, blasint *, double *, double *, blasint *, double *, double *, blasint*); 
 
+void    BLASFUNC(sgescal) (blasint *, blasint *, float *, float *, blasint *);
+void    BLASFUNC(dgescal) (blasint *, blasint *, double *, double *, blasint *);
+void    BLASFUNC(cgescal) (blasint *, blasint *, float *, float *, blasint *);
+void    BLASFUNC(zgescal) (blasint *, blasint *, double *, double *, blasint *);
+
+void    BLASFUNC(sgeset) (blasint *, blasint *, float *, float *, blasint *);
+void    BLASFUNC(dgeset) (blasint *, blasint *, double *, double *, blasint *);
+void    BLASFUNC(cgeset) (blasint *, blasint *, float *, float *, blasint *);
+void    BLASFUNC(zgeset) (blasint *, blasint *, double *, double *, blasint *);
+
 
 #ifdef __cplusplus
 }
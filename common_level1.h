@@ -53,6 +53,11 @@ void   sbdtobf16_k(BLASLONG, double   *, BLASLONG, bfloat16 *, BLASLONG);
 void   sbf16tos_k (BLASLONG, bfloat16 *, BLASLONG, float    *, BLASLONG);
 void   dbf16tod_k (BLASLONG, bfloat16 *, BLASLONG, double   *, BLASLONG);
 
+void   shstohf16_k(BLASLONG, float    *, BLASLONG, hfloat16 *, BLASLONG);
+void   shdtohf16_k(BLASLONG, double   *, BLASLONG, hfloat16 *, BLASLONG);
+void   shf16tos_k (BLASLONG, hfloat16 *, BLASLONG, float    *, BLASLONG);
+void   dhf16tod_k (BLASLONG, hfloat16 *, BLASLONG, double   *, BLASLONG);
+
 openblas_complex_float cdotc_k (BLASLONG, float  *, BLASLONG, float  *, BLASLONG);
 openblas_complex_float cdotu_k (BLASLONG, float  *, BLASLONG, float  *, BLASLONG);
 openblas_complex_double zdotc_k (BLASLONG, double *, BLASLONG, double *, BLASLONG);
@@ -40,6 +40,8 @@
 #define COMMON_MACRO
 
 #include "common_sb.h"
+#include "common_sh.h"
+#include "common_i8.h"
 #include "common_s.h"
 #include "common_d.h"
 #include "common_q.h"
@@ -207,6 +209,15 @@
 #define	SYRK_KERNEL_U		QSYRK_KERNEL_U
 #define	SYRK_KERNEL_L		QSYRK_KERNEL_L
 
+#define	GEMMT_UNN		QGEMMT_UNN
+#define	GEMMT_UNT		QGEMMT_UNT
+#define	GEMMT_UTN		QGEMMT_UTN
+#define	GEMMT_UTT		QGEMMT_UTT
+#define	GEMMT_LNN		QGEMMT_LNN
+#define	GEMMT_LNT		QGEMMT_LNT
+#define	GEMMT_LTN		QGEMMT_LTN
+#define	GEMMT_LTT		QGEMMT_LTT
+
 #define	HERK_UN			QSYRK_UN
 #define	HERK_LN			QSYRK_LN
 #define	HERK_UC			QSYRK_UT
@@ -498,6 +509,28 @@
 #define	SYRK_KERNEL_U		DSYRK_KERNEL_U
 #define	SYRK_KERNEL_L		DSYRK_KERNEL_L
 
+#define	GEMMT_UNN		DGEMMT_UNN
+#define	GEMMT_UNT		DGEMMT_UNT
+#define	GEMMT_UTN		DGEMMT_UTN
+#define	GEMMT_UTT		DGEMMT_UTT
+#define	GEMMT_LNN		DGEMMT_LNN
+#define	GEMMT_LNT		DGEMMT_LNT
+#define	GEMMT_LTN		DGEMMT_LTN
+#define	GEMMT_LTT		DGEMMT_LTT
+
+#define	GEMM_EPILOGUE		DGEMM_EPILOGUE
+#define	GEMM_EPILOGUE_NN	DGEMM_EPILOGUE_NN
+#define	GEMM_EPILOGUE_NT	DGEMM_EPILOGUE_NT
+#define	GEMM_EPILOGUE_TN	DGEMM_EPILOGUE_TN
+#define	GEMM_EPILOGUE_TT	DGEMM_EPILOGUE_TT
+#define	GEMM_EPILOGUE_THREAD_NN	DGEMM_EPILOGUE_THREAD_NN
+#define	GEMM_EPILOGUE_THREAD_NT	DGEMM_EPILOGUE_THREAD_NT
+#define	GEMM_EPILOGUE_THREAD_TN	DGEMM_EPILOGUE_THREAD_TN
+#define	GEMM_EPILOGUE_THREAD_TT	DGEMM_EPILOGUE_THREAD_TT
+
+#define	GEMM_STRASSEN		DGEMM_STRASSEN
+#define	GEMM_STRASSEN_RELEASE	DGEMM_STRASSEN_RELEASE
+
 #define	HERK_UN			DSYRK_UN
 #define	HERK_LN			DSYRK_LN
 #define	HERK_UC			DSYRK_UT
@@ -602,6 +635,7 @@
 #define	GEMM_THREAD_RT		DGEMM_THREAD_NT
 #define	GEMM_THREAD_RC		DGEMM_THREAD_NT
 #define	GEMM_THREAD_RR		DGEMM_THREAD_NN
+#define	GEMM_SPLIT_K		DGEMM_SPLIT_K
 
 #define	SYMM_THREAD_LU		DSYMM_THREAD_LU
 #define	SYMM_THREAD_LL		DSYMM_THREAD_LL
@@ -641,6 +675,7 @@
 #define IMATCOPY_K_RN		DIMATCOPY_K_RN
 #define IMATCOPY_K_CT		DIMATCOPY_K_CT
 #define IMATCOPY_K_RT		DIMATCOPY_K_RT
+#define IMATCOPY_INPLACE	DIMATCOPY_INPLACE
 
 #define GEADD_K                 DGEADD_K
 
@@ -655,6 +690,8 @@
 #define GEMM_SMALL_KERNEL_B0_TN    DGEMM_SMALL_KERNEL_B0_TN
 #define GEMM_SMALL_KERNEL_B0_TT    DGEMM_SMALL_KERNEL_B0_TT
 
+#define GEMM_SMALL_KERNEL_FIXED    DGEMM_SMALL_KERNEL_FIXED
+
 #elif defined(BFLOAT16)
 
 #define D_TO_BF16_K     SBDTOBF16_K
@@ -939,6 +976,7 @@
 #define IMATCOPY_K_RN		SIMATCOPY_K_RN
 #define IMATCOPY_K_CT		SIMATCOPY_K_CT
 #define IMATCOPY_K_RT		SIMATCOPY_K_RT
+#define IMATCOPY_INPLACE	SIMATCOPY_INPLACE
 
 #define GEADD_K 		SGEADD_K
 
@@ -998,10 +1036,17 @@
 #define	SYMV_THREAD_U		SSYMV_THREAD_U
 #define	SYMV_THREAD_L		SSYMV_THREAD_L
 
+#ifdef HFLOAT16
+#define	GEMM_ONCOPY		SHGEMM_ONCOPY
+#define	GEMM_OTCOPY		SHGEMM_OTCOPY
+#define	GEMM_INCOPY		SHGEMM_INCOPY
+#define	GEMM_ITCOPY		SHGEMM_ITCOPY
+#else
 #define	GEMM_ONCOPY		SGEMM_ONCOPY
 #define	GEMM_OTCOPY		SGEMM_OTCOPY
 #define	GEMM_INCOPY		SGEMM_INCOPY
 #define	GEMM_ITCOPY		SGEMM_ITCOPY
+#endif
 
 #ifdef UNIT
 
@@ -1075,6 +1120,24 @@
 #define SYMM_OUTCOPY		SSYMM_OUTCOPY
 #define SYMM_OLTCOPY		SSYMM_OLTCOPY
 
+#ifdef HFLOAT16
+#define	GEMM_NN			SHGEMM_NN
+#define	GEMM_CN			SHGEMM_TN
+#define	GEMM_TN			SHGEMM_TN
+#define	GEMM_NC			SHGEMM_NT
+#define	GEMM_NT			SHGEMM_NT
+#define	GEMM_CC			SHGEMM_TT
+#define	GEMM_CT			SHGEMM_TT
+#define	GEMM_TC			SHGEMM_TT
+#define	GEMM_TT			SHGEMM_TT
+#define	GEMM_NR			SHGEMM_NN
+#define	GEMM_TR			SHGEMM_TN
+#define	GEMM_CR			SHGEMM_TN
+#define	GEMM_RN			SHGEMM_NN
+#define	GEMM_RT			SHGEMM_NT
+#define	GEMM_RC			SHGEMM_NT
+#define	GEMM_RR			SHGEMM_NN
+#else
 #define	GEMM_NN			SGEMM_NN
 #define	GEMM_CN			SGEMM_TN
 #define	GEMM_TN			SGEMM_TN
@@ -1091,6 +1154,7 @@
 #define	GEMM_RT			SGEMM_NT
 #define	GEMM_RC			SGEMM_NT
 #define	GEMM_RR			SGEMM_NN
+#endif
 
 #define	SYMM_LU			SSYMM_LU
 #define	SYMM_LL			SSYMM_LL
@@ -1114,6 +1178,28 @@
 #define	SYRK_KERNEL_U		SSYRK_KERNEL_U
 #define	SYRK_KERNEL_L		SSYRK_KERNEL_L
 
+#define	GEMMT_UNN		SGEMMT_UNN
+#define	GEMMT_UNT		SGEMMT_UNT
+#define	GEMMT_UTN		SGEMMT_UTN
+#define	GEMMT_UTT		SGEMMT_UTT
+#define	GEMMT_LNN		SGEMMT_LNN
+#define	GEMMT_LNT		SGEMMT_LNT
+#define	GEMMT_LTN		SGEMMT_LTN
+#define	GEMMT_LTT		SGEMMT_LTT
+
+#define	GEMM_EPILOGUE		SGEMM_EPILOGUE
+#define	GEMM_EPILOGUE_NN	SGEMM_EPILOGUE_NN
+#define	GEMM_EPILOGUE_NT	SGEMM_EPILOGUE_NT
+#define	GEMM_EPILOGUE_TN	SGEMM_EPILOGUE_TN
+#define	GEMM_EPILOGUE_TT	SGEMM_EPILOGUE_TT
+#define	GEMM_EPILOGUE_THREAD_NN	SGEMM_EPILOGUE_THREAD_NN
+#define	GEMM_EPILOGUE_THREAD_NT	SGEMM_EPILOGUE_THREAD_NT
+#define	GEMM_EPILOGUE_THREAD_TN	SGEMM_EPILOGUE_THREAD_TN
+#define	GEMM_EPILOGUE_THREAD_TT	SGEMM_EPILOGUE_THREAD_TT
+
+#define	GEMM_STRASSEN		SGEMM_STRASSEN
+#define	GEMM_STRASSEN_RELEASE	SGEMM_STRASSEN_RELEASE
+
 #define	HERK_UN			SSYRK_UN
 #define	HERK_LN			SSYRK_LN
 #define	HERK_UC			SSYRK_UT
@@ -1202,6 +1288,24 @@
 #define	TRSM_RCLU		STRSM_RTLU
 #define	TRSM_RCLN		STRSM_RTLN
 
+#ifdef HFLOAT16
+#define	GEMM_THREAD_NN		SHGEMM_THREAD_NN
+#define	GEMM_THREAD_CN		SHGEMM_THREAD_TN
+#define	GEMM_THREAD_TN		SHGEMM_THREAD_TN
+#define	GEMM_THREAD_NC		SHGEMM_THREAD_NT
+#define	GEMM_THREAD_NT		SHGEMM_THREAD_NT
+#define	GEMM_THREAD_CC		SHGEMM_THREAD_TT
+#define	GEMM_THREAD_CT		SHGEMM_THREAD_TT
+#define	GEMM_THREAD_TC		SHGEMM_THREAD_TT
+#define	GEMM_THREAD_TT		SHGEMM_THREAD_TT
+#define	GEMM_THREAD_NR		SHGEMM_THREAD_NN
+#define	GEMM_THREAD_TR		SHGEMM_THREAD_TN
+#define	GEMM_THREAD_CR		SHGEMM_THREAD_TN
+#define	GEMM_THREAD_RN		SHGEMM_THREAD_NN
+#define	GEMM_THREAD_RT		SHGEMM_THREAD_NT
+#define	GEMM_THREAD_RC		SHGEMM_THREAD_NT
+#define	GEMM_THREAD_RR		SHGEMM_THREAD_NN
+#else
 #define	GEMM_THREAD_NN		SGEMM_THREAD_NN
 #define	GEMM_THREAD_CN		SGEMM_THREAD_TN
 #define	GEMM_THREAD_TN		SGEMM_THREAD_TN
@@ -1218,6 +1322,8 @@
 #define	GEMM_THREAD_RT		SGEMM_THREAD_NT
 #define	GEMM_THREAD_RC		SGEMM_THREAD_NT
 #define	GEMM_THREAD_RR		SGEMM_THREAD_NN
+#define	GEMM_SPLIT_K		SGEMM_SPLIT_K
+#endif
 
 #define	SYMM_THREAD_LU		SSYMM_THREAD_LU
 #define	SYMM_THREAD_LL		SSYMM_THREAD_LL
@@ -1257,6 +1363,7 @@
 #define IMATCOPY_K_RN		SIMATCOPY_K_RN
 #define IMATCOPY_K_CT		SIMATCOPY_K_CT
 #define IMATCOPY_K_RT		SIMATCOPY_K_RT
+#define IMATCOPY_INPLACE	SIMATCOPY_INPLACE
 
 #define GEADD_K 		SGEADD_K
 
@@ -1272,6 +1379,8 @@
 #define GEMM_SMALL_KERNEL_B0_TN    SGEMM_SMALL_KERNEL_B0_TN
 #define GEMM_SMALL_KERNEL_B0_TT    SGEMM_SMALL_KERNEL_B0_TT
 
+#define GEMM_SMALL_KERNEL_FIXED    SGEMM_SMALL_KERNEL_FIXED
+
 #endif
 #else
 #ifdef XDOUBLE
@@ -1483,6 +1592,46 @@
 #define	SYRK_KERNEL_U		XSYRK_KERNEL_U
 #define	SYRK_KERNEL_L		XSYRK_KERNEL_L
 
+#define	GEMMT_UNN		XGEMMT_UNN
+#define	GEMMT_UNT		XGEMMT_UNT
+#define	GEMMT_UNR		XGEMMT_UNR
+#define	GEMMT_UNC		XGEMMT_UNC
+#define	GEMMT_UTN		XGEMMT_UTN
+#define	GEMMT_UTT		XGEMMT_UTT
+#define	GEMMT_UTR		XGEMMT_UTR
+#define	GEMMT_UTC		XGEMMT_UTC
+#define	GEMMT_URN		XGEMMT_URN
+#define	GEMMT_URT		XGEMMT_URT
+#define	GEMMT_URR		XGEMMT_URR
+#define	GEMMT_URC		XGEMMT_URC
+#define	GEMMT_UCN		XGEMMT_UCN
+#define	GEMMT_UCT		XGEMMT_UCT
+#define	GEMMT_UCR		XGEMMT_UCR
+#define	GEMMT_UCC		XGEMMT_UCC
+#define	GEMMT_LNN		XGEMMT_LNN
+#define	GEMMT_LNT		XGEMMT_LNT
+#define	GEMMT_LNR		XGEMMT_LNR
+#define	GEMMT_LNC		XGEMMT_LNC
+#define	GEMMT_LTN		XGEMMT_LTN
+#define	GEMMT_LTT		XGEMMT_LTT
+#define	GEMMT_LTR		XGEMMT_LTR
+#define	GEMMT_LTC		XGEMMT_LTC
+#define	GEMMT_LRN		XGEMMT_LRN
+#define	GEMMT_LRT		XGEMMT_LRT
+#define	GEMMT_LRR		XGEMMT_LRR
+#define	GEMMT_LRC		XGEMMT_LRC
+#define	GEMMT_LCN		XGEMMT_LCN
+#define	GEMMT_LCT		XGEMMT_LCT
+#define	GEMMT_LCR		XGEMMT_LCR
+#define	GEMMT_LCC		XGEMMT_LCC
+
+#define	GEMMT_KERNEL_U_L	XGEMMT_KERNEL_U_L
+#define	GEMMT_KERNEL_U_R	XGEMMT_KERNEL_U_R
+#define	GEMMT_KERNEL_U_B	XGEMMT_KERNEL_U_B
+#define	GEMMT_KERNEL_L_L	XGEMMT_KERNEL_L_L
+#define	GEMMT_KERNEL_L_R	XGEMMT_KERNEL_L_R
+#define	GEMMT_KERNEL_L_B	XGEMMT_KERNEL_L_B
+
 #define	HERK_UN			XHERK_UN
 #define	HERK_LN			XHERK_LN
 #define	HERK_UC			XHERK_UC
@@ -1885,6 +2034,46 @@
 #define	SYRK_KERNEL_U		ZSYRK_KERNEL_U
 #define	SYRK_KERNEL_L		ZSYRK_KERNEL_L
 
+#define	GEMMT_UNN		ZGEMMT_UNN
+#define	GEMMT_UNT		ZGEMMT_UNT
+#define	GEMMT_UNR		ZGEMMT_UNR
+#define	GEMMT_UNC		ZGEMMT_UNC
+#define	GEMMT_UTN		ZGEMMT_UTN
+#define	GEMMT_UTT		ZGEMMT_UTT
+#define	GEMMT_UTR		ZGEMMT_UTR
+#define	GEMMT_UTC		ZGEMMT_UTC
+#define	GEMMT_URN		ZGEMMT_URN
+#define	GEMMT_URT		ZGEMMT_URT
+#define	GEMMT_URR		ZGEMMT_URR
+#define	GEMMT_URC		ZGEMMT_URC
+#define	GEMMT_UCN		ZGEMMT_UCN
+#define	GEMMT_UCT		ZGEMMT_UCT
+#define	GEMMT_UCR		ZGEMMT_UCR
+#define	GEMMT_UCC		ZGEMMT_UCC
+#define	GEMMT_LNN		ZGEMMT_LNN
+#define	GEMMT_LNT		ZGEMMT_LNT
+#define	GEMMT_LNR		ZGEMMT_LNR
+#define	GEMMT_LNC		ZGEMMT_LNC
+#define	GEMMT_LTN		ZGEMMT_LTN
+#define	GEMMT_LTT		ZGEMMT_LTT
+#define	GEMMT_LTR		ZGEMMT_LTR
+#define	GEMMT_LTC		ZGEMMT_LTC
+#define	GEMMT_LRN		ZGEMMT_LRN
+#define	GEMMT_LRT		ZGEMMT_LRT
+#define	GEMMT_LRR		ZGEMMT_LRR
+#define	GEMMT_LRC		ZGEMMT_LRC
+#define	GEMMT_LCN		ZGEMMT_LCN
+#define	GEMMT_LCT		ZGEMMT_LCT
+#define	GEMMT_LCR		ZGEMMT_LCR
+#define	GEMMT_LCC		ZGEMMT_LCC
+
+#define	GEMMT_KERNEL_U_L	ZGEMMT_KERNEL_U_L
+#define	GEMMT_KERNEL_U_R	ZGEMMT_KERNEL_U_R
+#define	GEMMT_KERNEL_U_B	ZGEMMT_KERNEL_U_B
+#define	GEMMT_KERNEL_L_L	ZGEMMT_KERNEL_L_L
+#define	GEMMT_KERNEL_L_R	ZGEMMT_KERNEL_L_R
+#define	GEMMT_KERNEL_L_B	ZGEMMT_KERNEL_L_B
+
 #define	HERK_UN			ZHERK_UN
 #define	HERK_LN			ZHERK_LN
 #define	HERK_UC			ZHERK_UC
@@ -1990,6 +2179,7 @@
 #define	GEMM_THREAD_RT		ZGEMM_THREAD_RT
 #define	GEMM_THREAD_RC		ZGEMM_THREAD_RC
 #define	GEMM_THREAD_RR		ZGEMM_THREAD_RR
+#define	GEMM_SPLIT_K		ZGEMM_SPLIT_K
 
 #define	SYMM_THREAD_LU		ZSYMM_THREAD_LU
 #define	SYMM_THREAD_LL		ZSYMM_THREAD_LL
@@ -2096,6 +2286,7 @@
 #define IMATCOPY_K_RNC		ZIMATCOPY_K_RNC
 #define IMATCOPY_K_CTC		ZIMATCOPY_K_CTC
 #define IMATCOPY_K_RTC		ZIMATCOPY_K_RTC
+#define IMATCOPY_INPLACE	ZIMATCOPY_INPLACE
 
 #define GEADD_K                 ZGEADD_K
 
@@ -2350,6 +2541,46 @@
 #define	SYRK_KERNEL_U		CSYRK_KERNEL_U
 #define	SYRK_KERNEL_L		CSYRK_KERNEL_L
 
+#define	GEMMT_UNN		CGEMMT_UNN
+#define	GEMMT_UNT		CGEMMT_UNT
+#define	GEMMT_UNR		CGEMMT_UNR
+#define	GEMMT_UNC		CGEMMT_UNC
+#define	GEMMT_UTN		CGEMMT_UTN
+#define	GEMMT_UTT		CGEMMT_UTT
+#define	GEMMT_UTR		CGEMMT_UTR
+#define	GEMMT_UTC		CGEMMT_UTC
+#define	GEMMT_URN		CGEMMT_URN
+#define	GEMMT_URT		CGEMMT_URT
+#define	GEMMT_URR		CGEMMT_URR
+#define	GEMMT_URC		CGEMMT_URC
+#define	GEMMT_UCN		CGEMMT_UCN
+#define	GEMMT_UCT		CGEMMT_UCT
+#define	GEMMT_UCR		CGEMMT_UCR
+#define	GEMMT_UCC		CGEMMT_UCC
+#define	GEMMT_LNN		CGEMMT_LNN
+#define	GEMMT_LNT		CGEMMT_LNT
+#define	GEMMT_LNR		CGEMMT_LNR
+#define	GEMMT_LNC		CGEMMT_LNC
+#define	GEMMT_LTN		CGEMMT_LTN
+#define	GEMMT_LTT		CGEMMT_LTT
+#define	GEMMT_LTR		CGEMMT_LTR
+#define	GEMMT_LTC		CGEMMT_LTC
+#define	GEMMT_LRN		CGEMMT_LRN
+#define	GEMMT_LRT		CGEMMT_LRT
+#define	GEMMT_LRR		CGEMMT_LRR
+#define	GEMMT_LRC		CGEMMT_LRC
+#define	GEMMT_LCN		CGEMMT_LCN
+#define	GEMMT_LCT		CGEMMT_LCT
+#define	GEMMT_LCR		CGEMMT_LCR
+#define	GEMMT_LCC		CGEMMT_LCC
+
+#define	GEMMT_KERNEL_U_L	CGEMMT_KERNEL_U_L
+#define	GEMMT_KERNEL_U_R	CGEMMT_KERNEL_U_R
+#define	GEMMT_KERNEL_U_B	CGEMMT_KERNEL_U_B
+#define	GEMMT_KERNEL_L_L	CGEMMT_KERNEL_L_L
+#define	GEMMT_KERNEL_L_R	CGEMMT_KERNEL_L_R
+#define	GEMMT_KERNEL_L_B	CGEMMT_KERNEL_L_B
+
 #define	HERK_UN			CHERK_UN
 #define	HERK_LN			CHERK_LN
 #define	HERK_UC			CHERK_UC
@@ -2455,6 +2686,7 @@
 #define	GEMM_THREAD_RT		CGEMM_THREAD_RT
 #define	GEMM_THREAD_RC		CGEMM_THREAD_RC
 #define	GEMM_THREAD_RR		CGEMM_THREAD_RR
+#define	GEMM_SPLIT_K		CGEMM_SPLIT_K
 
 #define	SYMM_THREAD_LU		CSYMM_THREAD_LU
 #define	SYMM_THREAD_LL		CSYMM_THREAD_LL
@@ -2561,6 +2793,7 @@
 #define IMATCOPY_K_RNC		CIMATCOPY_K_RNC
 #define IMATCOPY_K_CTC		CIMATCOPY_K_CTC
 #define IMATCOPY_K_RTC		CIMATCOPY_K_RTC
+#define IMATCOPY_INPLACE	CIMATCOPY_INPLACE
 
 #define GEADD_K                 CGEADD_K
 
@@ -2638,6 +2871,36 @@ extern BLASLONG xgemm_q;
 extern BLASLONG xgemm_r;
 #endif
 
+/* bias, activation and clamp applied to C by the ?gemm_epilogue drivers,
+   with the bias direction taken relative to the column major C */
+typedef struct {
+  void *bias;
+  int bias_type, activation, clamp;
+  double clamp_min, clamp_max;
+} gemm_epilogue_t;
+
+#define EPILOGUE_BIAS_ROW	1
+#define EPILOGUE_BIAS_COL	2
+
+#define EPILOGUE_RELU		1
+#define EPILOGUE_GELU		2
+#define EPILOGUE_GELU_TANH	3
+
+/* integer offsets of the int8 gemm, C := alpha*(A+ao)*(B+bo) + beta*C + co,
+   with co holding one, m or n values depending on co_type.  A stays int8 and
+   B uint8 in either storage order, so a row major C is flagged here instead
+   of being turned into the transposed product. */
+typedef struct {
+  int ao, bo;
+  int *co;
+  int co_type;
+  int c_rowmajor;
+} i8gemm_offset_t;
+
+#define I8GEMM_OFFSET_FIX	0
+#define I8GEMM_OFFSET_ROW	1
+#define I8GEMM_OFFSET_COL	2
+
 typedef struct {
   void *a, *b, *c, *d, *alpha, *beta;
   BLASLONG	m, n, k, lda, ldb, ldc, ldd;
@@ -2660,7 +2923,18 @@ typedef struct {
   void * routine;
   int routine_mode;
 
+  //for gemm epilogues
+  gemm_epilogue_t * epilogue;
+
+  //for the int8 gemm
+  i8gemm_offset_t * offset;
+
 } blas_arg_t;
+
+/* level 3 drivers passed to other drivers; kept out of the prototypes
+   because the kernel headers of DYNAMIC_ARCH rename every "(" */
+typedef int (*sgemm_driver_t)(blas_arg_t *, BLASLONG *, BLASLONG *, float  *, float  *, BLASLONG);
+typedef int (*dgemm_driver_t)(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
 #endif
 
 #ifdef SMALL_MATRIX_OPT
@@ -2984,6 +3258,10 @@ typedef struct {
 #define GETRS_T		DGETRS_T
 #define GETRF_SINGLE	dgetrf_single
 #define GETRF_PARALLEL	dgetrf_parallel
+#define GETRI_SINGLE	dgetri_single
+#define GETRI_PARALLEL	dgetri_parallel
+#define GEQRF_SINGLE	dgeqrf_single
+#define GEQRF_PARALLEL	dgeqrf_parallel
 #define NEG_TCOPY	DNEG_TCOPY
 #define	LARF_L		DLARF_L
 #define	LARF_R		DLARF_R
@@ -3005,6 +3283,10 @@ typedef struct {
 #define GETRS_T		SGETRS_T
 #define GETRF_SINGLE	sgetrf_single
 #define GETRF_PARALLEL	sgetrf_parallel
+#define GETRI_SINGLE	sgetri_single
+#define GETRI_PARALLEL	sgetri_parallel
+#define GEQRF_SINGLE	sgeqrf_single
+#define GEQRF_PARALLEL	sgeqrf_parallel
 #define NEG_TCOPY	SNEG_TCOPY
 #define	LARF_L		SLARF_L
 #define	LARF_R		SLARF_R
@@ -3049,6 +3331,8 @@ typedef struct {
 #define GETRS_T		ZGETRS_T
 #define GETRF_SINGLE	zgetrf_single
 #define GETRF_PARALLEL	zgetrf_parallel
+#define GETRI_SINGLE	zgetri_single
+#define GETRI_PARALLEL	zgetri_parallel
 #define NEG_TCOPY	ZNEG_TCOPY
 #define	LARF_L		ZLARF_L
 #define	LARF_R		ZLARF_R
@@ -3070,6 +3354,8 @@ typedef struct {
 #define GETRS_T		CGETRS_T
 #define GETRF_SINGLE	cgetrf_single
 #define GETRF_PARALLEL	cgetrf_parallel
+#define GETRI_SINGLE	cgetri_single
+#define GETRI_PARALLEL	cgetri_parallel
 #define NEG_TCOPY	CNEG_TCOPY
 #define	LARF_L		CLARF_L
 #define	LARF_R		CLARF_R
@@ -3127,6 +3413,42 @@ typedef struct {
 #define  TRTRI_UN_PARALLEL dtrtri_UN_parallel
 #define  TRTRI_LU_PARALLEL dtrtri_LU_parallel
 #define  TRTRI_LN_PARALLEL dtrtri_LN_parallel
+#define  SYTRF_U_SINGLE dsytrf_U_single
+#define  SYTRF_L_SINGLE dsytrf_L_single
+#define  SYTRF_U_PARALLEL dsytrf_U_parallel
+#define  SYTRF_L_PARALLEL dsytrf_L_parallel
+#define  LAED3_SINGLE dlaed3_single
+#define  LAED3_PARALLEL dlaed3_parallel
+#define  GETRF_BATCH_SINGLE dgetrf_batch_single
+#define  GETRF_BATCH_PARALLEL dgetrf_batch_parallel
+#define  POTRF_U_BATCH_SINGLE dpotrf_U_batch_single
+#define  POTRF_L_BATCH_SINGLE dpotrf_L_batch_single
+#define  POTRF_U_BATCH_PARALLEL dpotrf_U_batch_parallel
+#define  POTRF_L_BATCH_PARALLEL dpotrf_L_batch_parallel
+#define  GETRS_N_BATCH_SINGLE dgetrs_N_batch_single
+#define  GETRS_T_BATCH_SINGLE dgetrs_T_batch_single
+#define  GETRS_N_BATCH_PARALLEL dgetrs_N_batch_parallel
+#define  GETRS_T_BATCH_PARALLEL dgetrs_T_batch_parallel
+#define  GBTRF_SINGLE dgbtrf_single
+#define  GBTRF_PARALLEL dgbtrf_parallel
+#define  PBTRF_U_SINGLE dpbtrf_U_single
+#define  PBTRF_L_SINGLE dpbtrf_L_single
+#define  PBTRF_U_PARALLEL dpbtrf_U_parallel
+#define  PBTRF_L_PARALLEL dpbtrf_L_parallel
+#define  ORMQR_LN_SINGLE dormqr_LN_single
+#define  ORMQR_LT_SINGLE dormqr_LT_single
+#define  ORMQR_RN_SINGLE dormqr_RN_single
+#define  ORMQR_RT_SINGLE dormqr_RT_single
+#define  ORMQR_LN_PARALLEL dormqr_LN_parallel
+#define  ORMQR_LT_PARALLEL dormqr_LT_parallel
+#define  ORMQR_RN_PARALLEL dormqr_RN_parallel
+#define  ORMQR_RT_PARALLEL dormqr_RT_parallel
+#define  SYTRD_SY2SB_SINGLE dsytrd_sy2sb_single
+#define  SYTRD_SY2SB_PARALLEL dsytrd_sy2sb_parallel
+#define  SYTRD_SB2ST_SINGLE dsytrd_sb2st_single
+#define  SYTRD_SB2ST_PARALLEL dsytrd_sb2st_parallel
+#define  SYTRD_Q2_SINGLE dsytrd_q2_single
+#define  SYTRD_Q2_PARALLEL dsytrd_q2_parallel
 #else
 #define  POTF2_U  spotf2_U
 #define  POTF2_L  spotf2_L
@@ -3152,6 +3474,42 @@ typedef struct {
 #define  TRTRI_UN_PARALLEL strtri_UN_parallel
 #define  TRTRI_LU_PARALLEL strtri_LU_parallel
 #define  TRTRI_LN_PARALLEL strtri_LN_parallel
+#define  SYTRF_U_SINGLE ssytrf_U_single
+#define  SYTRF_L_SINGLE ssytrf_L_single
+#define  SYTRF_U_PARALLEL ssytrf_U_parallel
+#define  SYTRF_L_PARALLEL ssytrf_L_parallel
+#define  LAED3_SINGLE slaed3_single
+#define  LAED3_PARALLEL slaed3_parallel
+#define  GETRF_BATCH_SINGLE sgetrf_batch_single
+#define  GETRF_BATCH_PARALLEL sgetrf_batch_parallel
+#define  POTRF_U_BATCH_SINGLE spotrf_U_batch_single
+#define  POTRF_L_BATCH_SINGLE spotrf_L_batch_single
+#define  POTRF_U_BATCH_PARALLEL spotrf_U_batch_parallel
+#define  POTRF_L_BATCH_PARALLEL spotrf_L_batch_parallel
+#define  GETRS_N_BATCH_SINGLE sgetrs_N_batch_single
+#define  GETRS_T_BATCH_SINGLE sgetrs_T_batch_single
+#define  GETRS_N_BATCH_PARALLEL sgetrs_N_batch_parallel
+#define  GETRS_T_BATCH_PARALLEL sgetrs_T_batch_parallel
+#define  GBTRF_SINGLE sgbtrf_single
+#define  GBTRF_PARALLEL sgbtrf_parallel
+#define  PBTRF_U_SINGLE spbtrf_U_single
+#define  PBTRF_L_SINGLE spbtrf_L_single
+#define  PBTRF_U_PARALLEL spbtrf_U_parallel
+#define  PBTRF_L_PARALLEL spbtrf_L_parallel
+#define  ORMQR_LN_SINGLE sormqr_LN_single
+#define  ORMQR_LT_SINGLE sormqr_LT_single
+#define  ORMQR_RN_SINGLE sormqr_RN_single
+#define  ORMQR_RT_SINGLE sormqr_RT_single
+#define  ORMQR_LN_PARALLEL sormqr_LN_parallel
+#define  ORMQR_LT_PARALLEL sormqr_LT_parallel
+#define  ORMQR_RN_PARALLEL sormqr_RN_parallel
+#define  ORMQR_RT_PARALLEL sormqr_RT_parallel
+#define  SYTRD_SY2SB_SINGLE ssytrd_sy2sb_single
+#define  SYTRD_SY2SB_PARALLEL ssytrd_sy2sb_parallel
+#define  SYTRD_SB2ST_SINGLE ssytrd_sb2st_single
+#define  SYTRD_SB2ST_PARALLEL ssytrd_sb2st_parallel
+#define  SYTRD_Q2_SINGLE ssytrd_q2_single
+#define  SYTRD_Q2_PARALLEL ssytrd_q2_parallel
 #endif
 #else
 #ifdef XDOUBLE
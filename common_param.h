@@ -244,6 +244,8 @@ BLASLONG (*ismin_k) (BLASLONG, float *, BLASLONG);
   int    (*sgemm_small_kernel_b0_nt )(BLASLONG m, BLASLONG n, BLASLONG k, float * A, BLASLONG lda, float alpha, float * B, BLASLONG ldb, float * C, BLASLONG ldc);
   int    (*sgemm_small_kernel_b0_tn )(BLASLONG m, BLASLONG n, BLASLONG k, float * A, BLASLONG lda, float alpha, float * B, BLASLONG ldb, float * C, BLASLONG ldc);
   int    (*sgemm_small_kernel_b0_tt )(BLASLONG m, BLASLONG n, BLASLONG k, float * A, BLASLONG lda, float alpha, float * B, BLASLONG ldb, float * C, BLASLONG ldc);
+
+  int    (*sgemm_small_kernel_fixed )(int transa, int transb, BLASLONG m, BLASLONG n, BLASLONG k, float * A, BLASLONG lda, float alpha, float * B, BLASLONG ldb, float beta, float * C, BLASLONG ldc);
 #endif
 
   int    (*strsm_kernel_LN)(BLASLONG, BLASLONG, BLASLONG, float, float *, float *, float *, BLASLONG, BLASLONG);
@@ -364,6 +366,8 @@ BLASLONG (*idmin_k) (BLASLONG, double *, BLASLONG);
   int    (*dgemm_small_kernel_b0_nt )(BLASLONG m, BLASLONG n, BLASLONG k, double * A, BLASLONG lda, double alpha, double * B, BLASLONG ldb, double * C, BLASLONG ldc);
   int    (*dgemm_small_kernel_b0_tn )(BLASLONG m, BLASLONG n, BLASLONG k, double * A, BLASLONG lda, double alpha, double * B, BLASLONG ldb, double * C, BLASLONG ldc);
   int    (*dgemm_small_kernel_b0_tt )(BLASLONG m, BLASLONG n, BLASLONG k, double * A, BLASLONG lda, double alpha, double * B, BLASLONG ldb, double * C, BLASLONG ldc);
+
+  int    (*dgemm_small_kernel_fixed )(int transa, int transb, BLASLONG m, BLASLONG n, BLASLONG k, double * A, BLASLONG lda, double alpha, double * B, BLASLONG ldb, double beta, double * C, BLASLONG ldc);
 #endif
 #endif
 #if (BUILD_DOUBLE==1)
@@ -1208,6 +1212,27 @@ BLASLONG (*ixamin_k)(BLASLONG, xdouble *, BLASLONG);
 #if (BUILD_COMPLEX16==1)
   int    (*zgeadd_k) (BLASLONG, BLASLONG, double, double, double *, BLASLONG, double, double, double *, BLASLONG); 
 #endif
+
+#if (BUILD_SINGLE==1)
+  int i8gemm_p, i8gemm_q, i8gemm_r;
+  int i8gemm_unroll_m, i8gemm_unroll_n;
+
+  int    (*i8gemm_kernel   )(BLASLONG, BLASLONG, BLASLONG, int8_t *, uint8_t *, int32_t *, BLASLONG);
+  int    (*i8gemm_incopy   )(BLASLONG, BLASLONG, int8_t *, BLASLONG, int8_t *);
+  int    (*i8gemm_itcopy   )(BLASLONG, BLASLONG, int8_t *, BLASLONG, int8_t *);
+  int    (*i8gemm_oncopy   )(BLASLONG, BLASLONG, uint8_t *, BLASLONG, uint8_t *);
+  int    (*i8gemm_otcopy   )(BLASLONG, BLASLONG, uint8_t *, BLASLONG, uint8_t *);
+
+  void   (*shstohf16_k) (BLASLONG, float    *, BLASLONG, hfloat16 *, BLASLONG);
+  void   (*shdtohf16_k) (BLASLONG, double   *, BLASLONG, hfloat16 *, BLASLONG);
+  void   (*shf16tos_k)  (BLASLONG, hfloat16 *, BLASLONG, float    *, BLASLONG);
+  void   (*dhf16tod_k)  (BLASLONG, hfloat16 *, BLASLONG, double   *, BLASLONG);
+
+  int    (*shgemm_incopy   )(BLASLONG, BLASLONG, hfloat16 *, BLASLONG, float *);
+  int    (*shgemm_itcopy   )(BLASLONG, BLASLONG, hfloat16 *, BLASLONG, float *);
+  int    (*shgemm_oncopy   )(BLASLONG, BLASLONG, hfloat16 *, BLASLONG, float *);
+  int    (*shgemm_otcopy   )(BLASLONG, BLASLONG, hfloat16 *, BLASLONG, float *);
+#endif
 } gotoblas_t;
 
 extern gotoblas_t *gotoblas;
@@ -1230,6 +1255,14 @@ extern gotoblas_t *gotoblas;
 #define	SBGEMM_UNROLL_MN	gotoblas -> sbgemm_unroll_mn
 #endif
 
+#if (BUILD_SINGLE==1)
+#define	I8GEMM_P		gotoblas -> i8gemm_p
+#define	I8GEMM_Q		gotoblas -> i8gemm_q
+#define	I8GEMM_R		gotoblas -> i8gemm_r
+#define	I8GEMM_UNROLL_M	gotoblas -> i8gemm_unroll_m
+#define	I8GEMM_UNROLL_N	gotoblas -> i8gemm_unroll_n
+#endif
+
 #if (BUILD_SINGLE==1)
 #define	SGEMM_P		gotoblas -> sgemm_p
 #define	SGEMM_Q		gotoblas -> sgemm_q
@@ -1362,6 +1395,12 @@ extern gotoblas_t *gotoblas;
 #endif
 #endif
 
+#define	I8GEMM_P		I8GEMM_DEFAULT_P
+#define	I8GEMM_Q		I8GEMM_DEFAULT_Q
+#define	I8GEMM_R		I8GEMM_DEFAULT_R
+#define I8GEMM_UNROLL_M	I8GEMM_DEFAULT_UNROLL_M
+#define I8GEMM_UNROLL_N	I8GEMM_DEFAULT_UNROLL_N
+
 #define	SGEMM_P		SGEMM_DEFAULT_P
 #define	SGEMM_Q		SGEMM_DEFAULT_Q
 #define	SGEMM_R		SGEMM_DEFAULT_R
@@ -1509,6 +1548,18 @@ extern gotoblas_t *gotoblas;
 #define GEMM_DEFAULT_R		SBGEMM_DEFAULT_R
 #define GEMM_DEFAULT_UNROLL_M	SBGEMM_DEFAULT_UNROLL_M
 #define GEMM_DEFAULT_UNROLL_N	SBGEMM_DEFAULT_UNROLL_N
+#elif defined(HFLOAT16)
+#define GEMM_P			SGEMM_P
+#define GEMM_Q			SHGEMM_Q
+#define GEMM_R			SGEMM_R
+#define GEMM_UNROLL_M		SGEMM_UNROLL_M
+#define GEMM_UNROLL_N		SGEMM_UNROLL_N
+#define GEMM_UNROLL_MN		SGEMM_UNROLL_MN
+#define GEMM_DEFAULT_P		SGEMM_DEFAULT_P
+#define GEMM_DEFAULT_Q		SGEMM_DEFAULT_Q
+#define GEMM_DEFAULT_R		SGEMM_DEFAULT_R
+#define GEMM_DEFAULT_UNROLL_M	SGEMM_DEFAULT_UNROLL_M
+#define GEMM_DEFAULT_UNROLL_N	SGEMM_DEFAULT_UNROLL_N
 #else
 #define GEMM_P			SGEMM_P
 #define GEMM_Q			SGEMM_Q
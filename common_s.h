@@ -165,6 +165,7 @@
 #define SGEADD_K                sgeadd_k 
 
 #define SGEMM_SMALL_MATRIX_PERMIT	sgemm_small_matrix_permit
+#define SGEMM_SMALL_KERNEL_FIXED	sgemm_small_kernel_fixed
 
 #else
 
@@ -302,6 +303,7 @@
 #define SGEADD_K                gotoblas -> sgeadd_k 
 
 #define SGEMM_SMALL_MATRIX_PERMIT	gotoblas -> sgemm_small_matrix_permit
+#define SGEMM_SMALL_KERNEL_FIXED	gotoblas -> sgemm_small_kernel_fixed
 
 #endif
 
@@ -355,6 +357,30 @@
 #define	SSYRK_KERNEL_U		ssyrk_kernel_U
 #define	SSYRK_KERNEL_L		ssyrk_kernel_L
 
+#define	SGEMMT_UNN		sgemmt_UNN
+#define	SGEMMT_UNT		sgemmt_UNT
+#define	SGEMMT_UTN		sgemmt_UTN
+#define	SGEMMT_UTT		sgemmt_UTT
+#define	SGEMMT_LNN		sgemmt_LNN
+#define	SGEMMT_LNT		sgemmt_LNT
+#define	SGEMMT_LTN		sgemmt_LTN
+#define	SGEMMT_LTT		sgemmt_LTT
+
+#define	SGEMM_EPILOGUE		sgemm_epilogue_k
+#define	SGEMM_EPILOGUE_NN	sgemm_epilogue_nn
+#define	SGEMM_EPILOGUE_NT	sgemm_epilogue_nt
+#define	SGEMM_EPILOGUE_TN	sgemm_epilogue_tn
+#define	SGEMM_EPILOGUE_TT	sgemm_epilogue_tt
+#define	SGEMM_EPILOGUE_THREAD_NN	sgemm_epilogue_thread_nn
+#define	SGEMM_EPILOGUE_THREAD_NT	sgemm_epilogue_thread_nt
+#define	SGEMM_EPILOGUE_THREAD_TN	sgemm_epilogue_thread_tn
+#define	SGEMM_EPILOGUE_THREAD_TT	sgemm_epilogue_thread_tt
+
+#define	SGEMM_STRASSEN		sgemm_strassen
+#define	SGEMM_STRASSEN_RELEASE	sgemm_strassen_release
+
+#define	SIMATCOPY_INPLACE	simatcopy_inplace
+
 #define	SHERK_UN		ssyrk_UN
 #define	SHERK_LN		ssyrk_LN
 #define	SHERK_UC		ssyrk_UT
@@ -459,6 +485,7 @@
 #define	SGEMM_THREAD_RT		sgemm_thread_nt
 #define	SGEMM_THREAD_RC		sgemm_thread_nt
 #define	SGEMM_THREAD_RR		sgemm_thread_nn
+#define	SGEMM_SPLIT_K		sgemm_split_k
 
 #define	SSYMM_THREAD_LU		ssymm_thread_LU
 #define	SSYMM_THREAD_LL		ssymm_thread_LL
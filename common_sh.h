@@ -0,0 +1,82 @@
+#ifndef COMMON_SH_H
+#define COMMON_SH_H
+
+/*
+ * IEEE half precision (hfloat16) inputs with single precision results.
+ * There are no half precision microkernels: the conversion kernels and
+ * the widening packers come from the kernel directory, and the drivers
+ * run the single precision kernels on the widened panels.
+ */
+
+/* float stage of the widening packers, one SGEMM_UNROLL_MN wide strip */
+#define SHGEMM_STAGE_SIZE	8192
+
+/* caps the panel depth so that a strip always fits the stage */
+#define SHGEMM_Q		MIN(SGEMM_Q, SHGEMM_STAGE_SIZE / SGEMM_UNROLL_MN - SGEMM_UNROLL_M)
+
+#ifndef DYNAMIC_ARCH
+
+#define SHSTOHF16_K		shstohf16_k
+#define SHDTOHF16_K		shdtohf16_k
+#define SHF16TOS_K		shf16tos_k
+#define DHF16TOD_K		dhf16tod_k
+
+#define	SHGEMM_ONCOPY		shgemm_oncopy
+#define	SHGEMM_OTCOPY		shgemm_otcopy
+#define	SHGEMM_INCOPY		shgemm_incopy
+#define	SHGEMM_ITCOPY		shgemm_itcopy
+
+#else
+
+#define SHSTOHF16_K		gotoblas -> shstohf16_k
+#define SHDTOHF16_K		gotoblas -> shdtohf16_k
+#define SHF16TOS_K		gotoblas -> shf16tos_k
+#define DHF16TOD_K		gotoblas -> dhf16tod_k
+
+#define	SHGEMM_ONCOPY		gotoblas -> shgemm_oncopy
+#define	SHGEMM_OTCOPY		gotoblas -> shgemm_otcopy
+#define	SHGEMM_INCOPY		gotoblas -> shgemm_incopy
+#define	SHGEMM_ITCOPY		gotoblas -> shgemm_itcopy
+
+#endif
+
+#define SHGEMV_N		shgemv_n
+#define SHGEMV_T		shgemv_t
+#define SHGEMV_THREAD_N		shgemv_thread_n
+#define SHGEMV_THREAD_T		shgemv_thread_t
+
+#define	SHGEMM_NN		shgemm_nn
+#define	SHGEMM_CN		shgemm_tn
+#define	SHGEMM_TN		shgemm_tn
+#define	SHGEMM_NC		shgemm_nt
+#define	SHGEMM_NT		shgemm_nt
+#define	SHGEMM_CC		shgemm_tt
+#define	SHGEMM_CT		shgemm_tt
+#define	SHGEMM_TC		shgemm_tt
+#define	SHGEMM_TT		shgemm_tt
+#define	SHGEMM_NR		shgemm_nn
+#define	SHGEMM_TR		shgemm_tn
+#define	SHGEMM_CR		shgemm_tn
+#define	SHGEMM_RN		shgemm_nn
+#define	SHGEMM_RT		shgemm_nt
+#define	SHGEMM_RC		shgemm_nt
+#define	SHGEMM_RR		shgemm_nn
+
+#define	SHGEMM_THREAD_NN		shgemm_thread_nn
+#define	SHGEMM_THREAD_CN		shgemm_thread_tn
+#define	SHGEMM_THREAD_TN		shgemm_thread_tn
+#define	SHGEMM_THREAD_NC		shgemm_thread_nt
+#define	SHGEMM_THREAD_NT		shgemm_thread_nt
+#define	SHGEMM_THREAD_CC		shgemm_thread_tt
+#define	SHGEMM_THREAD_CT		shgemm_thread_tt
+#define	SHGEMM_THREAD_TC		shgemm_thread_tt
+#define	SHGEMM_THREAD_TT		shgemm_thread_tt
+#define	SHGEMM_THREAD_NR		shgemm_thread_nn
+#define	SHGEMM_THREAD_TR		shgemm_thread_tn
+#define	SHGEMM_THREAD_CR		shgemm_thread_tn
+#define	SHGEMM_THREAD_RN		shgemm_thread_nn
+#define	SHGEMM_THREAD_RT		shgemm_thread_nt
+#define	SHGEMM_THREAD_RC		shgemm_thread_nt
+#define	SHGEMM_THREAD_RR		shgemm_thread_nn
+
+#endif
@@ -92,6 +92,9 @@ extern int blas_omp_linked;
 #define BLAS_UPLO       0x0800U
 #define BLAS_UPLO_SHIFT      11
 
+/* With BLAS_NODE: place each job of the queue on the next node */
+#define BLAS_NODE_SPREAD 0x10000U
+
 #define BLAS_STATUS_NOTYET	0
 #define BLAS_STATUS_QUEUED	1
 #define BLAS_STATUS_RUNNING	2
@@ -204,6 +207,9 @@ int gemm_thread_mn(int mode, blas_arg_t *, BLASLONG *, BLASLONG *, int (*functio
 
 int gemm_thread_variable(int mode, blas_arg_t *, BLASLONG *, BLASLONG *, int (*function)(blas_arg_t*, BLASLONG*, BLASLONG*,FLOAT *, FLOAT *, BLASLONG), void *, void *, BLASLONG, BLASLONG);
 
+int gemm_thread_numa(int mode, blas_arg_t *, BLASLONG *, BLASLONG *, int (*function)(blas_arg_t*, BLASLONG*, BLASLONG*,FLOAT *, FLOAT *, BLASLONG), void *, void *, BLASLONG);
+int gemm_numa_nodes(BLASLONG);
+
 int trsm_thread(int mode, BLASLONG m, BLASLONG n,
 		double alpha_r, double alpha_i,
 		void *a, BLASLONG lda,
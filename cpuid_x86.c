@@ -1675,9 +1675,10 @@ int get_cpuname(void){
 	    return CPUTYPE_BARCELONA;
         }
       case 10: // Zen3/4
+      case 11: // Zen5
 #ifndef NO_AVX512
           if(support_avx512_bf16())
-            return CPUTYPE_COOPERLAKE;
+            return CPUTYPE_ZEN4;
           if(support_avx512())
             return CPUTYPE_SKYLAKEX;
 #endif
@@ -1870,6 +1871,7 @@ static char *cpuname[] = {
   "DHYANA",
   "COOPERLAKE",
   "SAPPHIRERAPIDS",
+  "ZEN4",
 };
 
 static char *lowercpuname[] = {
@@ -1928,6 +1930,7 @@ static char *lowercpuname[] = {
   "dhyana",
   "cooperlake",
   "sapphirerapids",
+  "zen4",
 };
 
 static char *corename[] = {
@@ -1963,6 +1966,7 @@ static char *corename[] = {
   "DHYANA",
   "COOPERLAKE",
   "SAPPHIRERAPIDS",
+  "ZEN4",
 };
 
 static char *corename_lower[] = {
@@ -1998,6 +2002,7 @@ static char *corename_lower[] = {
   "dhyana",
   "cooperlake",
   "sapphirerapids",
+  "zen4",
 };
 
 
@@ -2450,7 +2455,7 @@ int get_coretype(void){
 	  }
 	  break;
 	}
-      } else if (exfamily == 8 || exfamily == 10) {
+      } else if (exfamily == 8 || exfamily == 10 || exfamily == 11) {
 	switch (model) {
 	case 1:
 	  // AMD Ryzen
@@ -2460,7 +2465,7 @@ int get_coretype(void){
 	  // Matisse,Renoir Ryzen2 models		
 #ifndef NO_AVX512
           if(support_avx512_bf16())
-            return CORE_COOPERLAKE;
+            return CORE_ZEN4;
           if(support_avx512())
             return CORE_SKYLAKEX;
 #endif
@@ -62,36 +62,19 @@
 #endif
 #endif
 
-#ifndef thread_local
-# if __STDC_VERSION__ >= 201112 && !defined __STDC_NO_THREADS__
-#  define thread_local _Thread_local
-# elif defined _WIN32 && ( \
-       defined _MSC_VER || \
-       defined __ICL || \
-       defined __DMC__ || \
-       defined __BORLANDC__ )
-#  define thread_local __declspec(thread) 
-/* note that ICC (linux) and Clang are covered by __GNUC__ */
-# elif (defined __GNUC__ || \
-       defined __SUNPRO_C || \
-       defined __xlC__) && !defined(__APPLE__)
-#  define thread_local __thread
-# else
-# define UNSAFE
-#endif
-#endif
-#if defined USE_OPENMP
-#undef UNSAFE
+#ifndef TRANSA
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE 8
 #endif
 
-#if !defined(TRANSA) && !defined(UNSAFE)
-#define Y_DUMMY_NUM 1024
-#if defined(USE_OPENMP)
-static FLOAT y_dummy[Y_DUMMY_NUM];
-#pragma omp threadprivate(y_dummy)
-# else
-static thread_local FLOAT y_dummy[Y_DUMMY_NUM];
-# endif
+/* Column split of GEMV_N: the first thread accumulates straight into y,
+   the others into partial sums kept in their own thread buffers behind the
+   kernel's workspace.  The first thread adds them into y once they are
+   ready and only then lets the others return their buffers. */
+typedef struct {
+  FLOAT * volatile partial[MAX_CPU_NUMBER];
+  volatile BLASLONG working[MAX_CPU_NUMBER][CACHE_LINE_SIZE];
+} job_t;
 #endif
 
 static int gemv_kernel(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *dummy1, FLOAT *buffer, BLASLONG pos){
@@ -99,6 +82,11 @@ static int gemv_kernel(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, F
   FLOAT *a, *x, *y;
   BLASLONG lda, incx, incy;
   BLASLONG m_from, m_to, n_from, n_to;
+#ifndef TRANSA
+  job_t *job = (job_t *)args -> common;
+  BLASLONG i, j;
+  FLOAT *yp;
+#endif
 
   a = (FLOAT *)args -> a;
   x = (FLOAT *)args -> b;
@@ -132,12 +120,14 @@ static int gemv_kernel(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, F
 #ifdef TRANSA
     y += n_from * incy * COMPSIZE;
 #else
-# ifndef UNSAFE
     //for split matrix row (n) direction and vector x of gemv_n
     x += n_from * incx * COMPSIZE;
-    //store partial result for every thread
-    y += (m_to - m_from) * 1 * COMPSIZE * pos;
-# endif
+    //the first slice accumulates straight into y, the others into partial sums
+    if (pos > 0) {
+      y    = buffer + (((m_to - m_from + n_to - n_from) * COMPSIZE + 288 / sizeof(FLOAT) + 3) & ~3);
+      incy = 1;
+      for (i = 0; i < (m_to - m_from) * COMPSIZE; i++) y[i] = ZERO;
+    }
 #endif
   }
 
@@ -150,6 +140,37 @@ static int gemv_kernel(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, F
 #endif
        a, lda, x, incx, y, incy, buffer);
 
+#ifndef TRANSA
+  if (range_n) {
+    if (pos > 0) {
+      job -> partial[pos] = y;
+      WMB;
+      job -> working[pos][0] = 1;
+
+      //keep the partial sums alive until the first thread has added them
+      while (job -> working[0][0] == 0) {YIELDING;};
+    } else {
+      for (i = 1; i < args -> nthreads; i++) {
+	while (job -> working[i][0] == 0) {YIELDING;};
+      }
+      MB;
+
+      for (i = 1; i < args -> nthreads; i++) {
+	yp = job -> partial[i];
+	for (j = 0; j < m_to - m_from; j++) {
+	  y[j * incy * COMPSIZE] += yp[j * COMPSIZE];
+#ifdef COMPLEX
+	  y[j * incy * COMPSIZE + 1] += yp[j * COMPSIZE + 1];
+#endif
+	}
+      }
+
+      WMB;
+      job -> working[0][0] = 1;
+    }
+  }
+#endif
+
   return 0;
 }
 
@@ -165,8 +186,8 @@ int CNAME(BLASLONG m, BLASLONG n, FLOAT *alpha, FLOAT *a, BLASLONG lda, FLOAT *x
 
   BLASLONG width, i, num_cpu;
 
-#if !defined(TRANSA) && !defined(UNSAFE)
-  int split_x=0;
+#ifndef TRANSA
+  job_t job;
 #endif
 
 #ifdef SMP
@@ -241,28 +262,23 @@ int CNAME(BLASLONG m, BLASLONG n, FLOAT *alpha, FLOAT *a, BLASLONG lda, FLOAT *x
     i -= width;
   }
 
-#if !defined(TRANSA) && !defined(UNSAFE) 
+#ifndef TRANSA
   //try to split matrix on row direction and x.
   //Then, reduction.
   if (num_cpu < nthreads) {
 
-    //too small to split or bigger than the y_dummy buffer.
+    //too small to split.
     double MN = (double) m * (double) n;
-    if ( MN <= (24.0 * 24.0  * (double) (GEMM_MULTITHREAD_THRESHOLD*GEMM_MULTITHREAD_THRESHOLD))
-	 || m*COMPSIZE*nthreads > Y_DUMMY_NUM)
+    if ( MN <= (24.0 * 24.0  * (double) (GEMM_MULTITHREAD_THRESHOLD*GEMM_MULTITHREAD_THRESHOLD)))
       goto Outer;
 
     num_cpu  = 0;
     range[0] = 0;
 
-    memset(y_dummy, 0, sizeof(FLOAT) * m * COMPSIZE * nthreads);
-
-    args.ldc = 1;
-    args.c = (void *)y_dummy;
+    args.common = (void *)&job;
 
     //split on row (n) and x
     i=n;
-    split_x=1;
     while (i > 0){
 
       width  = blas_quickdivide(i + nthreads - num_cpu - 1, nthreads - num_cpu);
@@ -276,6 +292,7 @@ int CNAME(BLASLONG m, BLASLONG n, FLOAT *alpha, FLOAT *a, BLASLONG lda, FLOAT *x
       queue[num_cpu].args    = &args;
 
       queue[num_cpu].position = num_cpu;
+      job.working[num_cpu][0] = 0;
 
       queue[num_cpu].range_m = NULL;
       queue[num_cpu].range_n = &range[num_cpu];
@@ -288,6 +305,7 @@ int CNAME(BLASLONG m, BLASLONG n, FLOAT *alpha, FLOAT *a, BLASLONG lda, FLOAT *x
       i -= width;
     }
 
+    args.nthreads = num_cpu;
   }
 
   Outer:
@@ -301,21 +319,5 @@ int CNAME(BLASLONG m, BLASLONG n, FLOAT *alpha, FLOAT *a, BLASLONG lda, FLOAT *x
     exec_blas(num_cpu, queue);
   }
 
-#if !defined(TRANSA) && !defined(UNSAFE)
-  if(split_x==1){
-    //reduction
-    for(i=0; i<num_cpu; i++){
-
-      int j;
-      for(j=0; j<m; j++){
-	y[j*incy*COMPSIZE] +=y_dummy[i*m*COMPSIZE + j*COMPSIZE];
-#ifdef COMPLEX
-	y[j*incy*COMPSIZE+1] +=y_dummy[i*m*COMPSIZE + j*COMPSIZE+1];
-#endif
-      }
-    }
-  }
-#endif
-
   return 0;
 }
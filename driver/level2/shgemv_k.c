@@ -0,0 +1,85 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include "common.h"
+
+/*
+ * Half precision GEMV on top of the single precision kernels.
+ *
+ * A is widened to float one SHGEMV_P x SHGEMV_Q block at a time (together
+ * with the matching slice of x) and handed to SGEMV, so every element of A
+ * is converted exactly once and the block stays cache resident while the
+ * float kernel runs over it.
+ */
+
+#define SHGEMV_P 256
+#define SHGEMV_Q 256
+
+int CNAME(BLASLONG m, BLASLONG n, float alpha, hfloat16 *a, BLASLONG lda,
+          hfloat16 *x, BLASLONG incx, float *y, BLASLONG incy, float *buffer)
+{
+  float *ab, *xb, *gemvbuffer;
+  BLASLONG is, js, j, min_i, min_j;
+
+  ab = buffer;
+  xb = ab + SHGEMV_P * SHGEMV_Q;
+  gemvbuffer = (float *)(((BLASLONG)(xb + MAX(SHGEMV_P, SHGEMV_Q)) + GEMM_ALIGN) & ~GEMM_ALIGN);
+
+#ifndef TRANSA
+  for (js = 0; js < n; js += SHGEMV_Q) {
+    min_j = MIN(n - js, SHGEMV_Q);
+
+    SHF16TOS_K(min_j, x + js * incx, incx, xb, 1);
+
+    for (is = 0; is < m; is += SHGEMV_P) {
+      min_i = MIN(m - is, SHGEMV_P);
+
+      for (j = 0; j < min_j; j++)
+        SHF16TOS_K(min_i, a + is + (js + j) * lda, 1, ab + j * min_i, 1);
+
+      SGEMV_N(min_i, min_j, 0, alpha, ab, min_i, xb, 1, y + is * incy, incy, gemvbuffer);
+    }
+  }
+#else
+  for (is = 0; is < m; is += SHGEMV_P) {
+    min_i = MIN(m - is, SHGEMV_P);
+
+    SHF16TOS_K(min_i, x + is * incx, incx, xb, 1);
+
+    for (js = 0; js < n; js += SHGEMV_Q) {
+      min_j = MIN(n - js, SHGEMV_Q);
+
+      for (j = 0; j < min_j; j++)
+        SHF16TOS_K(min_i, a + is + (js + j) * lda, 1, ab + j * min_i, 1);
+
+      SGEMV_T(min_i, min_j, 0, alpha, ab, min_i, xb, 1, y + js * incy, incy, gemvbuffer);
+    }
+  }
+#endif
+
+  return 0;
+}
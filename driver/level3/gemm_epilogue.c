@@ -0,0 +1,101 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+#include <math.h>
+#include "common.h"
+
+/*
+ * Epilogue of the ?gemm_epilogue drivers, applied to an m x n tile of C
+ * that starts at row offset_m and column offset_n of the full matrix:
+ *
+ *   C := clamp(activation(C + bias))
+ *
+ * The drivers call it on each tile right after the kernel has added the
+ * last block of K to it, while the tile is still in cache.  Each step is
+ * a separate stride-one loop over a column, so that the bias, ReLU and
+ * clamp steps vectorize.
+ */
+
+#ifdef DOUBLE
+#define ERF(x)	erf(x)
+#define TANH(x)	tanh(x)
+#else
+#define ERF(x)	erff(x)
+#define TANH(x)	tanhf(x)
+#endif
+
+int CNAME(BLASLONG m, BLASLONG n, BLASLONG offset_m, BLASLONG offset_n,
+	  FLOAT *c, BLASLONG ldc, gemm_epilogue_t *epilogue){
+
+  BLASLONG i, j;
+  FLOAT *cc, *bias = (FLOAT *)epilogue -> bias;
+  FLOAT lower = (FLOAT)epilogue -> clamp_min;
+  FLOAT upper = (FLOAT)epilogue -> clamp_max;
+  FLOAT x, b;
+
+  for (j = 0; j < n; j++) {
+
+    cc = c + j * ldc;
+
+    if (epilogue -> bias_type == EPILOGUE_BIAS_ROW) {
+      for (i = 0; i < m; i++) cc[i] += bias[offset_m + i];
+    } else if (epilogue -> bias_type == EPILOGUE_BIAS_COL) {
+      b = bias[offset_n + j];
+      for (i = 0; i < m; i++) cc[i] += b;
+    }
+
+    switch (epilogue -> activation) {
+    case EPILOGUE_RELU:
+      for (i = 0; i < m; i++) cc[i] = (cc[i] > ZERO) ? cc[i] : ZERO;
+      break;
+
+    case EPILOGUE_GELU:
+      for (i = 0; i < m; i++) {
+	x = cc[i];
+	cc[i] = (FLOAT)0.5 * x * (ONE + ERF(x * (FLOAT)0.70710678118654752440));
+      }
+      break;
+
+    case EPILOGUE_GELU_TANH:
+      for (i = 0; i < m; i++) {
+	x = cc[i];
+	cc[i] = (FLOAT)0.5 * x * (ONE + TANH((FLOAT)0.79788456080286535588 * (x + (FLOAT)0.044715 * x * x * x)));
+      }
+      break;
+    }
+
+    if (epilogue -> clamp) {
+      for (i = 0; i < m; i++) {
+	x = (cc[i] < lower) ? lower : cc[i];
+	cc[i] = (x > upper) ? upper : x;
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,203 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+/*
+ * Threaded GEMM that splits K instead of C.
+ *
+ * When M and N are small and K is long, splitting C gives every thread a
+ * thin panel and the threads spend most of their time packing and waiting
+ * on each other.  Here each thread runs the serial driver on its own slice
+ * of K and writes alpha * op(A) * op(B) for that slice into a private
+ * M x N buffer placed after the packed B panel in its sb.  Once every
+ * thread is done, each thread applies beta to a slice of the columns of C
+ * and adds all partial results into it, in thread order.
+ *
+ * Returns -1 without touching C when the partial result does not fit into
+ * the thread buffers; the caller then falls back to the regular drivers.
+ */
+
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE 8
+#endif
+
+/* Bytes of sb that the serial driver can use for the packed B panel */
+#define SB_PANEL_SIZE(N) \
+	((GEMM_Q * (MIN(N, GEMM_R) + GEMM_UNROLL_N) * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)
+
+typedef struct {
+  int (*function)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG);
+  int transa, transb;
+  BLASLONG nthreads;
+  BLASLONG range_k[MAX_CPU_NUMBER + 1];
+  BLASLONG range_n[MAX_CPU_NUMBER + 1];
+  FLOAT * volatile partial[MAX_CPU_NUMBER];
+  volatile BLASLONG working[MAX_CPU_NUMBER][CACHE_LINE_SIZE];
+} job_t;
+
+static FLOAT dm0[2] = {ZERO, ZERO};
+
+static void wait_all(job_t *job, BLASLONG stage) {
+
+  BLASLONG i;
+
+  for (i = 0; i < job -> nthreads; i++) {
+    while (job -> working[i][0] < stage) {YIELDING;};
+  }
+  MB;
+}
+
+static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  job_t *job = (job_t *)args -> common;
+  blas_arg_t newarg;
+  BLASLONG m = args -> m;
+  BLASLONG k_from = job -> range_k[mypos];
+  BLASLONG n_from = job -> range_n[mypos];
+  BLASLONG n_to   = job -> range_n[mypos + 1];
+  BLASLONG ldc    = args -> ldc;
+  FLOAT *beta = (FLOAT *)args -> beta;
+  FLOAT *c    = (FLOAT *)args -> c;
+  FLOAT *partial;
+  BLASLONG i, j;
+
+  partial = (FLOAT *)((BLASLONG)sb + SB_PANEL_SIZE(args -> n));
+
+  newarg         = *args;
+  newarg.a       = (FLOAT *)args -> a + ((job -> transa & 1) ? k_from : k_from * args -> lda) * COMPSIZE;
+  newarg.b       = (FLOAT *)args -> b + ((job -> transb & 1) ? k_from * args -> ldb : k_from) * COMPSIZE;
+  newarg.k       = job -> range_k[mypos + 1] - k_from;
+  newarg.c       = partial;
+  newarg.ldc     = m;
+  newarg.beta    = dm0;
+  newarg.common  = NULL;
+  newarg.nthreads = 1;
+
+  (job -> function)(&newarg, NULL, NULL, sa, sb, 0);
+
+  job -> partial[mypos] = partial;
+  WMB;
+  job -> working[mypos][0] = 1;
+
+  wait_all(job, 1);
+
+  if (n_to > n_from) {
+
+    if ((beta[0] != ONE)
+#ifdef COMPLEX
+	|| (beta[1] != ZERO)
+#endif
+	) {
+      GEMM_BETA(m, n_to - n_from, 0, beta[0],
+#ifdef COMPLEX
+		beta[1],
+#endif
+		NULL, 0, NULL, 0, c + n_from * ldc * COMPSIZE, ldc);
+    }
+
+    for (i = 0; i < job -> nthreads; i++) {
+      for (j = n_from; j < n_to; j++) {
+	AXPYU_K(m, 0, 0, ONE,
+#ifdef COMPLEX
+		ZERO,
+#endif
+		job -> partial[i] + j * m * COMPSIZE, 1, c + j * ldc * COMPSIZE, 1, NULL, 0);
+      }
+    }
+  }
+
+  /* The other threads may still be reading this thread's partial result */
+  WMB;
+  job -> working[mypos][0] = 2;
+
+  wait_all(job, 2);
+
+  return 0;
+}
+
+int CNAME(int mode, blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, int (*function)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG), FLOAT *sa, FLOAT *sb, BLASLONG nthreads) {
+
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  blas_arg_t newarg;
+  job_t job;
+
+  BLASLONG i, width, num_cpu;
+  BLASLONG m = args -> m;
+  BLASLONG n = args -> n;
+  BLASLONG k = args -> k;
+
+  if (nthreads > MAX_CPU_NUMBER) nthreads = MAX_CPU_NUMBER;
+  if (nthreads > k) nthreads = k;
+  if (nthreads < 2) return -1;
+
+  if (GEMM_OFFSET_A + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN) + GEMM_OFFSET_B
+      + SB_PANEL_SIZE(n) + (double)m * (double)n * COMPSIZE * SIZE > BUFFER_SIZE) return -1;
+
+  job.function = function;
+  job.transa   = (mode & BLAS_TRANSA) >> BLAS_TRANSA_SHIFT;
+  job.transb   = (mode & BLAS_TRANSB) >> BLAS_TRANSB_SHIFT;
+  job.nthreads = nthreads;
+
+  newarg        = *args;
+  newarg.common = (void *)&job;
+
+  job.range_k[0] = 0;
+  job.range_n[0] = 0;
+
+  for (num_cpu = 0; num_cpu < nthreads; num_cpu++) {
+
+    width = blas_quickdivide(k - job.range_k[num_cpu] + nthreads - num_cpu - 1, nthreads - num_cpu);
+    job.range_k[num_cpu + 1] = job.range_k[num_cpu] + width;
+
+    width = blas_quickdivide(n - job.range_n[num_cpu] + nthreads - num_cpu - 1, nthreads - num_cpu);
+    job.range_n[num_cpu + 1] = job.range_n[num_cpu] + width;
+
+    job.partial[num_cpu]       = NULL;
+    job.working[num_cpu][0]    = 0;
+
+    queue[num_cpu].mode    = mode;
+    queue[num_cpu].routine = inner_thread;
+    queue[num_cpu].args    = &newarg;
+    queue[num_cpu].range_m = NULL;
+    queue[num_cpu].range_n = NULL;
+    queue[num_cpu].sa      = NULL;
+    queue[num_cpu].sb      = NULL;
+    queue[num_cpu].next    = &queue[num_cpu + 1];
+  }
+
+  queue[0].sa = sa;
+  queue[0].sb = sb;
+  queue[num_cpu - 1].next = NULL;
+
+  exec_blas(num_cpu, queue);
+
+  return 0;
+}
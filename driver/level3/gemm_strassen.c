@@ -0,0 +1,415 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+/*
+ * Strassen-Winograd GEMM for very large real matrices.
+ *
+ * C += alpha * op(A) * op(B) is split into 2 x 2 blocks and computed with
+ * Winograd's variant of Strassen's algorithm, which needs seven products
+ * of half size and fifteen block additions instead of eight products.
+ * The products recurse while every dimension is at least twice the
+ * crossover and are then handed to the regular serial or threaded
+ * driver.  An odd last row, column or inner index is peeled off and
+ * added with a thin driver call.
+ *
+ * The sums of blocks of A and B are formed in the storage order of A and
+ * B, so every product keeps the caller's transposes.  Each level needs
+ * one block of op(A), one of op(B) and one of C as scratch space.  The
+ * blocks of all levels are carved from a single pooled workspace, which
+ * is kept for the next call so that repeated calls do not fault in
+ * hundreds of megabytes again.  A call that finds it in use, or needs
+ * more than GEMM_STRASSEN_POOL_SIZE bytes, allocates a workspace of its
+ * own.  blas_shutdown() releases the pool through ?gemm_strassen_release.
+ *
+ * Every level saves 1/8 of the flops of the level below, but the error
+ * bound becomes normwise instead of componentwise and grows by a factor
+ * of about 18 per level, so the mode is only used on request.
+ *
+ * Returns -1 without touching C when the problem is too small for one
+ * level or the workspace cannot be allocated; the caller then falls back
+ * to the regular drivers.
+ */
+
+#ifndef GEMM_STRASSEN_CROSSOVER
+#define GEMM_STRASSEN_CROSSOVER 1536
+#endif
+
+/* Largest workspace kept between calls */
+#ifndef GEMM_STRASSEN_POOL_SIZE
+#define GEMM_STRASSEN_POOL_SIZE (256L << 20)
+#endif
+
+#ifdef SMP
+#ifdef DOUBLE
+#define MODE (BLAS_DOUBLE | BLAS_REAL)
+#else
+#define MODE (BLAS_SINGLE | BLAS_REAL)
+#endif
+
+/* Elements of a block below which the additions are not worth threading */
+#define ADD_THREAD_MIN 65536
+#endif
+
+typedef struct {
+  int (*gemm)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG);
+  blas_arg_t *args;
+  int transa, transb;
+  BLASLONG crossover;
+  FLOAT *sa, *sb;
+} job_t;
+
+static FLOAT dp1 = ONE;
+
+#if   defined(USE_PTHREAD_LOCK)
+static pthread_mutex_t  pool_lock = PTHREAD_MUTEX_INITIALIZER;
+#elif defined(USE_PTHREAD_SPINLOCK)
+static pthread_spinlock_t pool_lock = 0;
+#else
+static volatile BLASULONG pool_lock = 0;
+#endif
+
+static FLOAT *pool      = NULL;
+static BLASLONG pool_size = 0;
+static int pool_busy    = 0;
+
+static FLOAT *workspace_alloc(BLASLONG size) {
+
+  FLOAT *work = NULL;
+
+  LOCK_COMMAND(&pool_lock);
+
+  if (!pool_busy && (size <= GEMM_STRASSEN_POOL_SIZE / (BLASLONG)sizeof(FLOAT))) {
+    if (pool_size < size) {
+      free(pool);
+      pool      = (FLOAT *)malloc(size * sizeof(FLOAT));
+      pool_size = pool ? size : 0;
+    }
+    if (pool) {
+      pool_busy = 1;
+      work      = pool;
+    }
+  }
+
+  UNLOCK_COMMAND(&pool_lock);
+
+  if (work == NULL) work = (FLOAT *)malloc(size * sizeof(FLOAT));
+
+  return work;
+}
+
+static void workspace_free(FLOAT *work) {
+
+  LOCK_COMMAND(&pool_lock);
+
+  if (work == pool) {
+    pool_busy = 0;
+    work      = NULL;
+  }
+
+  UNLOCK_COMMAND(&pool_lock);
+
+  free(work);
+}
+
+/* Drops the pooled workspace; a call still using it frees it on return */
+void GEMM_STRASSEN_RELEASE(void) {
+
+  FLOAT *work = NULL;
+
+  LOCK_COMMAND(&pool_lock);
+
+  if (!pool_busy) work = pool;
+  pool      = NULL;
+  pool_size = 0;
+  pool_busy = 0;
+
+  UNLOCK_COMMAND(&pool_lock);
+
+  free(work);
+}
+
+/* c = a + alpha[0] * b + alpha[1] * d on the columns in range_n, in one pass; b and d may be NULL */
+static int combine_panel(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  BLASLONG i, j;
+  BLASLONG m      = args -> m;
+  BLASLONG n_from = 0;
+  BLASLONG n_to   = args -> n;
+  FLOAT *alpha = (FLOAT *)args -> alpha;
+  FLOAT *a, *b, *c, *d;
+
+  if (range_n) {
+    n_from = range_n[0];
+    n_to   = range_n[1];
+  }
+
+  for (j = n_from; j < n_to; j++) {
+    a = (FLOAT *)args -> a + j * args -> lda;
+    c = (FLOAT *)args -> c + j * args -> ldc;
+
+    if (args -> d) {
+      b = (FLOAT *)args -> b + j * args -> ldb;
+      d = (FLOAT *)args -> d + j * args -> ldd;
+      for (i = 0; i < m; i++) c[i] = a[i] + alpha[0] * b[i] + alpha[1] * d[i];
+    } else if (args -> b) {
+      b = (FLOAT *)args -> b + j * args -> ldb;
+      for (i = 0; i < m; i++) c[i] = a[i] + alpha[0] * b[i];
+    } else {
+      for (i = 0; i < m; i++) c[i] = a[i];
+    }
+  }
+
+  return 0;
+}
+
+/* c = a + sb * b + sd * d; c may be the same matrix as a or b */
+static void combine(job_t *job, BLASLONG m, BLASLONG n, FLOAT *a, BLASLONG lda,
+		    FLOAT sb, FLOAT *b, BLASLONG ldb, FLOAT sd, FLOAT *d, BLASLONG ldd, FLOAT *c, BLASLONG ldc) {
+
+  blas_arg_t args;
+  FLOAT alpha[2];
+
+  alpha[0] = sb;
+  alpha[1] = sd;
+
+  args.m     = m;
+  args.n     = n;
+  args.a     = (void *)a;
+  args.b     = (void *)b;
+  args.c     = (void *)c;
+  args.d     = (void *)d;
+  args.lda   = lda;
+  args.ldb   = ldb;
+  args.ldc   = ldc;
+  args.ldd   = ldd;
+  args.alpha = (void *)alpha;
+
+#ifdef SMP
+  if ((job -> args -> nthreads > 1) && (m * n >= ADD_THREAD_MIN)) {
+    gemm_thread_n(MODE, &args, NULL, NULL, combine_panel, NULL, NULL, job -> args -> nthreads);
+    return;
+  }
+#endif
+
+  combine_panel(&args, NULL, NULL, NULL, NULL, 0);
+}
+
+/* C += alpha * op(A) * op(B) with the regular driver */
+static void base_gemm(job_t *job, BLASLONG m, BLASLONG n, BLASLONG k, FLOAT alpha,
+		      FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb, FLOAT *c, BLASLONG ldc) {
+
+  blas_arg_t args = *job -> args;
+
+  args.m     = m;
+  args.n     = n;
+  args.k     = k;
+  args.a     = (void *)a;
+  args.b     = (void *)b;
+  args.c     = (void *)c;
+  args.lda   = lda;
+  args.ldb   = ldb;
+  args.ldc   = ldc;
+  args.alpha = (void *)&alpha;
+  args.beta  = (void *)&dp1;
+
+  (job -> gemm)(&args, NULL, NULL, job -> sa, job -> sb, 0);
+}
+
+/* C += alpha * op(A) * op(B), with the scratch blocks of this and all deeper levels in work */
+static void strassen(job_t *job, BLASLONG m, BLASLONG n, BLASLONG k, FLOAT alpha,
+		     FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb, FLOAT *c, BLASLONG ldc, FLOAT *work) {
+
+  BLASLONG mh, nh, kh, sm, sn, tm, tn;
+  FLOAT *a11, *a12, *a21, *a22, *b11, *b12, *b21, *b22, *c11, *c12, *c21, *c22;
+  FLOAT *s, *t, *x;
+
+  if (MIN(m, MIN(n, k)) < 2 * job -> crossover) {
+    base_gemm(job, m, n, k, alpha, a, lda, b, ldb, c, ldc);
+    return;
+  }
+
+  mh = m >> 1;
+  nh = n >> 1;
+  kh = k >> 1;
+
+  /* Blocks of op(A) and op(B); S and T have the shape of a block in storage order */
+  if (job -> transa) {
+    a11 = a;
+    a12 = a + kh;
+    a21 = a + mh * lda;
+    a22 = a21 + kh;
+    sm  = kh;
+    sn  = mh;
+  } else {
+    a11 = a;
+    a12 = a + kh * lda;
+    a21 = a + mh;
+    a22 = a12 + mh;
+    sm  = mh;
+    sn  = kh;
+  }
+
+  if (job -> transb) {
+    b11 = b;
+    b12 = b + nh;
+    b21 = b + kh * ldb;
+    b22 = b21 + nh;
+    tm  = nh;
+    tn  = kh;
+  } else {
+    b11 = b;
+    b12 = b + nh * ldb;
+    b21 = b + kh;
+    b22 = b12 + kh;
+    tm  = kh;
+    tn  = nh;
+  }
+
+  c11 = c;
+  c12 = c + nh * ldc;
+  c21 = c + mh;
+  c22 = c12 + mh;
+
+  s     = work;
+  t     = s + mh * kh;
+  x     = t + kh * nh;
+  work  = x + mh * nh;
+
+  /* C11 += P1 + P2, keeping P1 = A11 * B11 in X */
+  GEMM_BETA(mh, nh, 0, ZERO, NULL, 0, NULL, 0, x, mh);
+  strassen(job, mh, nh, kh, alpha, a11, lda, b11, ldb, x, mh, work);
+  combine(job, mh, nh, c11, ldc, ONE, x, mh, ZERO, NULL, 0, c11, ldc);
+  strassen(job, mh, nh, kh, alpha, a12, lda, b21, ldb, c11, ldc, work);
+
+  /* X += P6 = (A21 + A22 - A11) * (B22 - B12 + B11), and goes into C12, C21 and C22 */
+  combine(job, sm, sn, a21, lda,  ONE, a22, lda, -ONE, a11, lda, s, sm);
+  combine(job, tm, tn, b22, ldb, -ONE, b12, ldb,  ONE, b11, ldb, t, tm);
+  strassen(job, mh, nh, kh, alpha, s, sm, t, tm, x, mh, work);
+  combine(job, mh, nh, c12, ldc, ONE, x, mh, ZERO, NULL, 0, c12, ldc);
+  combine(job, mh, nh, c21, ldc, ONE, x, mh, ZERO, NULL, 0, c21, ldc);
+  combine(job, mh, nh, c22, ldc, ONE, x, mh, ZERO, NULL, 0, c22, ldc);
+
+  /* P7 = (A11 - A21) * (B22 - B12) goes into C21 and C22 */
+  combine(job, sm, sn, a11, lda, -ONE, a21, lda, ZERO, NULL, 0, s, sm);
+  combine(job, tm, tn, b22, ldb, -ONE, b12, ldb, ZERO, NULL, 0, t, tm);
+  GEMM_BETA(mh, nh, 0, ZERO, NULL, 0, NULL, 0, x, mh);
+  strassen(job, mh, nh, kh, alpha, s, sm, t, tm, x, mh, work);
+  combine(job, mh, nh, c21, ldc, ONE, x, mh, ZERO, NULL, 0, c21, ldc);
+  combine(job, mh, nh, c22, ldc, ONE, x, mh, ZERO, NULL, 0, c22, ldc);
+
+  /* P5 = (A21 + A22) * (B12 - B11) goes into C12 and C22 */
+  combine(job, sm, sn, a21, lda,  ONE, a22, lda, ZERO, NULL, 0, s, sm);
+  combine(job, tm, tn, b12, ldb, -ONE, b11, ldb, ZERO, NULL, 0, t, tm);
+  GEMM_BETA(mh, nh, 0, ZERO, NULL, 0, NULL, 0, x, mh);
+  strassen(job, mh, nh, kh, alpha, s, sm, t, tm, x, mh, work);
+  combine(job, mh, nh, c12, ldc, ONE, x, mh, ZERO, NULL, 0, c12, ldc);
+  combine(job, mh, nh, c22, ldc, ONE, x, mh, ZERO, NULL, 0, c22, ldc);
+
+  /* C12 += P3 = (A12 - A21 - A22 + A11) * B22, reusing A21 + A22 from S */
+  combine(job, sm, sn, a12, lda, -ONE, s, sm, ONE, a11, lda, s, sm);
+  strassen(job, mh, nh, kh, alpha, s, sm, b22, ldb, c12, ldc, work);
+
+  /* C21 -= P4 = A22 * (B22 - B12 + B11 - B21), reusing B12 - B11 from T */
+  combine(job, tm, tn, b22, ldb, -ONE, t, tm, -ONE, b21, ldb, t, tm);
+  strassen(job, mh, nh, kh, -alpha, a22, lda, t, tm, c21, ldc, work);
+
+  /* Odd inner index, last column and last row */
+  if (k & 1) {
+    base_gemm(job, mh * 2, nh * 2, 1, alpha,
+	      a + (job -> transa ? k - 1 : (k - 1) * lda), lda,
+	      b + (job -> transb ? (k - 1) * ldb : k - 1), ldb, c, ldc);
+  }
+
+  if (n & 1) {
+    base_gemm(job, mh * 2, 1, k, alpha, a, lda,
+	      b + (job -> transb ? n - 1 : (n - 1) * ldb), ldb, c + (n - 1) * ldc, ldc);
+  }
+
+  if (m & 1) {
+    base_gemm(job, 1, n, k, alpha,
+	      a + (job -> transa ? (m - 1) * lda : m - 1), lda, b, ldb, c + m - 1, ldc);
+  }
+}
+
+/* Elements of scratch space needed by all levels */
+static BLASLONG workspace_size(BLASLONG m, BLASLONG n, BLASLONG k, BLASLONG crossover) {
+
+  BLASLONG size = 0;
+
+  while (MIN(m, MIN(n, k)) >= 2 * crossover) {
+    m >>= 1;
+    n >>= 1;
+    k >>= 1;
+    size += m * k + k * n + m * n;
+  }
+
+  return size;
+}
+
+int CNAME(int transa, int transb, blas_arg_t *args, int (**gemm)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG),
+	  FLOAT *sa, FLOAT *sb, BLASLONG crossover) {
+
+  job_t job;
+  BLASLONG size;
+  FLOAT *alpha = (FLOAT *)args -> alpha;
+  FLOAT *beta  = (FLOAT *)args -> beta;
+  FLOAT *work;
+
+  if (crossover < 2) crossover = GEMM_STRASSEN_CROSSOVER;
+
+  if ((alpha == NULL) || (alpha[0] == ZERO)) return -1;
+
+  size = workspace_size(args -> m, args -> n, args -> k, crossover);
+  if (size == 0) return -1;
+
+  work = workspace_alloc(size);
+  if (work == NULL) return -1;
+
+  job.args      = args;
+  job.transa    = transa;
+  job.transb    = transb;
+  job.gemm      = gemm[(transb << 2) | transa];
+  job.crossover = crossover;
+  job.sa        = sa;
+  job.sb        = sb;
+
+  if (beta && (beta[0] != ONE)) {
+    GEMM_BETA(args -> m, args -> n, 0, beta[0], NULL, 0, NULL, 0, (FLOAT *)args -> c, args -> ldc);
+  }
+
+  strassen(&job, args -> m, args -> n, args -> k, alpha[0],
+	   (FLOAT *)args -> a, args -> lda, (FLOAT *)args -> b, args -> ldb, (FLOAT *)args -> c, args -> ldc, work);
+
+  workspace_free(work);
+
+  return 0;
+}
@@ -0,0 +1,270 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common.h"
+#if defined(OS_LINUX) && !defined(NO_AFFINITY)
+#include <sys/mman.h>
+#endif
+
+/*
+ * NUMA-partitioned threaded GEMM.
+ *
+ * C is cut into one block per node.  Every block goes to a leader thread
+ * on its own node (BLAS_NODE_SPREAD), which copies the rows of op(A) and
+ * the columns of op(B) that its block needs into memory on that node,
+ * with the copy spread over the node's threads so that the pages are
+ * first touched there.  The leader then runs the threaded level3 driver
+ * for its block on the local copies, and the node's threads only pack
+ * from local memory.  C itself is updated in place.
+ *
+ * The mode is off by default, since the copies cost time and memory.
+ * OPENBLAS_GEMM_NUMA=1 enables it when the threads span several nodes of
+ * equal size; a larger value forces that many partitions, which allows
+ * a 2- or 4-node layout to be tried on a single node.
+ */
+
+extern int openblas_gemm_numa(void);
+
+typedef struct {
+  int (*function)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG);
+  int mode;
+} job_t;
+
+int gemm_numa_nodes(BLASLONG nthreads) {
+
+  BLASLONG nodes = openblas_gemm_numa();
+
+  if (nodes <= 0) return 0;
+
+  if (nodes == 1) {
+#if defined(OS_LINUX) && defined(SMP) && !defined(NO_AFFINITY)
+    nodes = get_num_nodes();
+    if (!get_node_equal()) nodes = 1;
+#endif
+  }
+
+  if (nodes > nthreads) nodes = nthreads;
+  while ((nodes > 1) && (nthreads % nodes)) nodes --;
+
+  return (nodes > 1) ? nodes : 0;
+}
+
+static BLASLONG element_size(int mode) {
+
+  BLASLONG size;
+
+  switch (mode & BLAS_PREC) {
+  case BLAS_SINGLE : size = sizeof(float);  break;
+  case BLAS_DOUBLE : size = sizeof(double); break;
+  default : return 0;
+  }
+
+  if (mode & BLAS_COMPLEX) size *= 2;
+
+  return size;
+}
+
+/* Copies columns of args -> m bytes from a (stride lda) to b (stride ldb) */
+static int copy_columns(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  BLASLONG j;
+
+  for (j = range_n[0]; j < range_n[1]; j++)
+    memcpy((char *)args -> b + j * args -> ldb, (char *)args -> a + j * args -> lda, args -> m);
+
+  return 0;
+}
+
+static void copy_panel(int mode, void *src, BLASLONG lda, void *dst, BLASLONG bytes, BLASLONG cols, void *sa, void *sb, BLASLONG nthreads) {
+
+  blas_arg_t args;
+
+  args.a   = src;
+  args.lda = lda;
+  args.b   = dst;
+  args.ldb = bytes;
+  args.m   = bytes;
+  args.n   = cols;
+
+  gemm_thread_n(mode, &args, NULL, NULL, copy_columns, sa, sb, nthreads);
+}
+
+static void *alloc_local(BLASLONG bytes) {
+
+  void *p;
+
+#if defined(OS_LINUX) && !defined(NO_AFFINITY)
+  p = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (p == MAP_FAILED) return NULL;
+  /* Overrides the interleaving set up at init: pages go to the node that touches them first */
+  my_mbind(p, bytes, MPOL_PREFERRED, NULL, 0, 0);
+#else
+  p = malloc(bytes);
+#endif
+
+  return p;
+}
+
+static void free_local(void *p, BLASLONG bytes) {
+
+#if defined(OS_LINUX) && !defined(NO_AFFINITY)
+  munmap(p, bytes);
+#else
+  free(p);
+#endif
+}
+
+static int node_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  job_t *job = (job_t *)args -> common;
+  blas_arg_t newarg;
+  BLASLONG es = element_size(job -> mode);
+  int transa = ((job -> mode & BLAS_TRANSA) >> BLAS_TRANSA_SHIFT) & 1;
+  int transb = ((job -> mode & BLAS_TRANSB) >> BLAS_TRANSB_SHIFT) & 1;
+  int copy_mode = BLAS_NODE | (job -> mode & (BLAS_PREC | BLAS_COMPLEX));
+  BLASLONG m = range_m[1] - range_m[0];
+  BLASLONG n = range_n[1] - range_n[0];
+  BLASLONG k = args -> k;
+  BLASLONG a_bytes, bytes = 0;
+  char *local = NULL;
+
+  newarg        = *args;
+  newarg.m      = m;
+  newarg.n      = n;
+  newarg.a      = (char *)args -> a + (transa ? range_m[0] * args -> lda : range_m[0]) * es;
+  newarg.b      = (char *)args -> b + (transb ? range_n[0] : range_n[0] * args -> ldb) * es;
+  newarg.c      = (char *)args -> c + (range_m[0] + range_n[0] * args -> ldc) * es;
+  newarg.common = NULL;
+
+  if ((m <= 0) || (n <= 0)) return 0;
+
+  if (k > 0) {
+    a_bytes = (m * k * es + GEMM_ALIGN) & ~GEMM_ALIGN;
+    bytes   = a_bytes + n * k * es;
+    local   = (char *)alloc_local(bytes);
+  }
+
+  if (local) {
+
+    /* op(A) is m x k and op(B) is k x n; keep the storage order of the caller */
+    if (!transa) {
+      copy_panel(copy_mode, newarg.a, args -> lda * es, local, m * es, k, sa, sb, args -> nthreads);
+      newarg.lda = m;
+    } else {
+      copy_panel(copy_mode, newarg.a, args -> lda * es, local, k * es, m, sa, sb, args -> nthreads);
+      newarg.lda = k;
+    }
+
+    if (!transb) {
+      copy_panel(copy_mode, newarg.b, args -> ldb * es, local + a_bytes, k * es, n, sa, sb, args -> nthreads);
+      newarg.ldb = k;
+    } else {
+      copy_panel(copy_mode, newarg.b, args -> ldb * es, local + a_bytes, n * es, k, sa, sb, args -> nthreads);
+      newarg.ldb = n;
+    }
+
+    newarg.a = local;
+    newarg.b = local + a_bytes;
+  }
+
+  (job -> function)(&newarg, NULL, NULL, sa, sb, 0);
+
+  if (local) free_local(local, bytes);
+
+  return 0;
+}
+
+int CNAME(int mode, blas_arg_t *arg, BLASLONG *range_m, BLASLONG *range_n, int (*function)(blas_arg_t*, BLASLONG*, BLASLONG*, FLOAT *, FLOAT *, BLASLONG), void *sa, void *sb, BLASLONG nodes) {
+
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  blas_arg_t newarg;
+  job_t job;
+
+  BLASLONG range_M[MAX_CPU_NUMBER + 1], range_N[MAX_CPU_NUMBER + 1];
+  BLASLONG m = arg -> m, n = arg -> n;
+  BLASLONG divM, divN, d, i, j, procs;
+
+  if (nodes > MAX_CPU_NUMBER) nodes = MAX_CPU_NUMBER;
+
+  /* Unknown element size: partition C without copying A and B */
+  if (element_size(mode) == 0)
+    return gemm_thread_mn(mode, arg, range_m, range_n, function, sa, sb, nodes);
+
+  /* Pick the grid with the least data to copy: each node needs m / divM rows of A and n / divN columns of B */
+  divM = 1;
+  divN = nodes;
+  for (d = 2; d <= nodes; d++) {
+    if (nodes % d) continue;
+    if ((double)m / d + (double)n * d / nodes < (double)m / divM + (double)n / divN) {
+      divM = d;
+      divN = nodes / d;
+    }
+  }
+
+  range_M[0] = 0;
+  for (i = 0; i < divM; i++) range_M[i + 1] = range_M[i] + blas_quickdivide(m - range_M[i] + divM - i - 1, divM - i);
+
+  range_N[0] = 0;
+  for (j = 0; j < divN; j++) range_N[j + 1] = range_N[j] + blas_quickdivide(n - range_N[j] + divN - j - 1, divN - j);
+
+  job.function = function;
+  job.mode     = mode;
+
+  newarg        = *arg;
+  newarg.common = (void *)&job;
+
+  procs = 0;
+
+  for (j = 0; j < divN; j++) {
+    for (i = 0; i < divM; i++) {
+
+      queue[procs].mode    = mode | BLAS_NODE | BLAS_NODE_SPREAD;
+      queue[procs].routine = node_thread;
+      queue[procs].args    = &newarg;
+      queue[procs].range_m = &range_M[i];
+      queue[procs].range_n = &range_N[j];
+      queue[procs].sa      = NULL;
+      queue[procs].sb      = NULL;
+      queue[procs].next    = &queue[procs + 1];
+
+      procs ++;
+    }
+  }
+
+  queue[0].sa = sa;
+  queue[0].sb = sb;
+
+  queue[procs - 1].next = NULL;
+
+  exec_blas(procs, queue);
+
+  return 0;
+}
@@ -0,0 +1,137 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+/*
+ * GEMMT: C := alpha * op(A) * op(B) + beta * C, updating only the upper
+ * (default) or lower (LOWER) triangle of C. The operation is selected with
+ * the same NN .. CC defines as gemm.c. Off-diagonal blocks go through the
+ * GEMM kernel, diagonal blocks through the masked SYRK kernel, which only
+ * writes the triangle; the conjugating variants of the latter are built
+ * from syrk_kernel.c as gemmt_kernel_[UL]_[lrb].
+ */
+
+#ifndef ICOPY_OPERATION
+#if defined(NN) || defined(NT) || defined(NC) || defined(NR) || \
+    defined(RN) || defined(RT) || defined(RC) || defined(RR)
+#define ICOPY_OPERATION(M, N, A, LDA, X, Y, BUFFER) GEMM_ITCOPY(M, N, (FLOAT *)(A) + ((Y) + (X) * (LDA)) * COMPSIZE, LDA, BUFFER);
+#else
+#define ICOPY_OPERATION(M, N, A, LDA, X, Y, BUFFER) GEMM_INCOPY(M, N, (FLOAT *)(A) + ((X) + (Y) * (LDA)) * COMPSIZE, LDA, BUFFER);
+#endif
+#endif
+
+#ifndef OCOPY_OPERATION
+#if defined(NN) || defined(TN) || defined(CN) || defined(RN) || \
+    defined(NR) || defined(TR) || defined(CR) || defined(RR)
+#define OCOPY_OPERATION(M, N, A, LDA, X, Y, BUFFER) GEMM_ONCOPY(M, N, (FLOAT *)(A) + ((X) + (Y) * (LDA)) * COMPSIZE, LDA, BUFFER);
+#else
+#define OCOPY_OPERATION(M, N, A, LDA, X, Y, BUFFER) GEMM_OTCOPY(M, N, (FLOAT *)(A) + ((Y) + (X) * (LDA)) * COMPSIZE, LDA, BUFFER);
+#endif
+#endif
+
+#ifndef KERNEL_FUNC
+#ifndef LOWER
+#if defined(NN) || defined(NT) || defined(TN) || defined(TT)
+#define KERNEL_FUNC	SYRK_KERNEL_U
+#endif
+#if defined(CN) || defined(CT) || defined(RN) || defined(RT)
+#define KERNEL_FUNC	GEMMT_KERNEL_U_L
+#endif
+#if defined(NC) || defined(TC) || defined(NR) || defined(TR)
+#define KERNEL_FUNC	GEMMT_KERNEL_U_R
+#endif
+#if defined(CC) || defined(CR) || defined(RC) || defined(RR)
+#define KERNEL_FUNC	GEMMT_KERNEL_U_B
+#endif
+#else
+#if defined(NN) || defined(NT) || defined(TN) || defined(TT)
+#define KERNEL_FUNC	SYRK_KERNEL_L
+#endif
+#if defined(CN) || defined(CT) || defined(RN) || defined(RT)
+#define KERNEL_FUNC	GEMMT_KERNEL_L_L
+#endif
+#if defined(NC) || defined(TC) || defined(NR) || defined(TR)
+#define KERNEL_FUNC	GEMMT_KERNEL_L_R
+#endif
+#if defined(CC) || defined(CR) || defined(RC) || defined(RR)
+#define KERNEL_FUNC	GEMMT_KERNEL_L_B
+#endif
+#endif
+#endif
+
+static __inline int gemmt_beta(BLASLONG m_from, BLASLONG m_to, BLASLONG n_from, BLASLONG n_to, FLOAT *alpha, FLOAT *c, BLASLONG ldc) {
+
+  BLASLONG i;
+
+#ifndef LOWER
+  if (m_from > n_from) n_from = m_from;
+  if (m_to   > n_to  ) m_to   = n_to;
+#else
+  if (m_from < n_from) m_from = n_from;
+  if (m_to   < n_to  ) n_to   = m_to;
+#endif
+
+  c += (m_from + n_from * ldc) * COMPSIZE;
+
+  m_to -= m_from;
+  n_to -= n_from;
+
+  for (i = 0; i < n_to; i++){
+
+#ifndef LOWER
+
+    SCAL_K(MIN(i + n_from - m_from + 1, m_to), 0, 0, alpha[0],
+#ifdef COMPLEX
+	   alpha[1],
+#endif
+	   c, 1, NULL, 0, NULL, 0);
+
+    c += ldc * COMPSIZE;
+
+#else
+
+    SCAL_K(MIN(m_to - i + m_from - n_from, m_to), 0, 0, alpha[0],
+#ifdef COMPLEX
+	 alpha[1],
+#endif
+	 c, 1, NULL, 0, NULL, 0);
+
+    if (i < m_from - n_from) {
+      c += ldc * COMPSIZE;
+    } else {
+      c += (1 + ldc) * COMPSIZE;
+    }
+#endif
+
+  }
+
+  return 0;
+}
+
+#include "level3_gemmt.c"
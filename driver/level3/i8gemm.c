@@ -0,0 +1,239 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+#include <math.h>
+#include "common.h"
+
+/*
+ * Driver of cblas_gemm_s8u8s32,
+ *
+ *   C := alpha * (op(A) + ao) * (op(B) + bo) + beta * C + co
+ *
+ * with int8 A, uint8 B and int32 C.  The kernel only sees the raw bytes
+ * and sums op(A) * op(B) exactly in an int32 block of the work area; the
+ * offsets are folded in when that block is written back to C,
+ *
+ *   (A + ao)(B + bo) = AB + ao * colsum(B) + bo * rowsum(A) + k * ao * bo,
+ *
+ * together with alpha, beta and co, in double precision, and the result
+ * is rounded to the nearest integer and saturated to int32.
+ *
+ * The blocking follows level3.c, except that each P x R block of C is
+ * finished over the whole of K before moving on, so that it is rounded
+ * only once.  The packed B block is kept across the blocks of M when K
+ * fits in one Q panel.  Everything is carved out of sa, so the routine
+ * can be handed directly to gemm_thread_m/n.
+ */
+
+#if defined(NN) || defined(NT)
+#define ICOPY_OPERATION(M, N, A, LDA, X, Y, BUFFER) \
+	I8GEMM_INCOPY(M, N, (int8_t *)(A) + ((Y) + (X) * (LDA)), LDA, BUFFER)
+#define A_ELEMENT(A, LDA, I, L)	(A)[(I) + (L) * (LDA)]
+#else
+#define ICOPY_OPERATION(M, N, A, LDA, X, Y, BUFFER) \
+	I8GEMM_ITCOPY(M, N, (int8_t *)(A) + ((X) + (Y) * (LDA)), LDA, BUFFER)
+#define A_ELEMENT(A, LDA, I, L)	(A)[(L) + (I) * (LDA)]
+#endif
+
+#if defined(NN) || defined(TN)
+#define OCOPY_OPERATION(M, N, B, LDB, X, Y, BUFFER) \
+	I8GEMM_ONCOPY(M, N, (uint8_t *)(B) + ((X) + (Y) * (LDB)), LDB, BUFFER)
+#define B_ELEMENT(B, LDB, L, J)	(B)[(L) + (J) * (LDB)]
+#else
+#define OCOPY_OPERATION(M, N, B, LDB, X, Y, BUFFER) \
+	I8GEMM_OTCOPY(M, N, (uint8_t *)(B) + ((Y) + (X) * (LDB)), LDB, BUFFER)
+#define B_ELEMENT(B, LDB, L, J)	(B)[(J) + (L) * (LDB)]
+#endif
+
+static void store_block(BLASLONG m, BLASLONG n, BLASLONG k, BLASLONG is, BLASLONG js,
+			int32_t *work, BLASLONG ldw, double *sum_a, double *sum_b,
+			double alpha, double beta, i8gemm_offset_t *offset,
+			int32_t *c, BLASLONG ldc){
+
+  BLASLONG i, j;
+  BLASLONG c_rs, c_cs, co_rs, co_cs;
+  int32_t *cc, *co;
+  int32_t zero = 0;
+  double ao, bo, fixed, t;
+
+  ao = (double)offset -> ao;
+  bo = (double)offset -> bo;
+  fixed = (double)k * ao * bo;
+
+  c_rs = 1;
+  c_cs = ldc;
+  if (offset -> c_rowmajor) {
+    c_rs = ldc;
+    c_cs = 1;
+  }
+
+  co    = &zero;
+  co_rs = 0;
+  co_cs = 0;
+  if (offset -> co) {
+    co = (int32_t *)offset -> co;
+    if (offset -> co_type == I8GEMM_OFFSET_ROW) {
+      co   += js;
+      co_cs = 1;
+    }
+    if (offset -> co_type == I8GEMM_OFFSET_COL) {
+      co   += is;
+      co_rs = 1;
+    }
+  }
+
+  for (j = 0; j < n; j++) {
+    cc = c + is * c_rs + (js + j) * c_cs;
+
+    for (i = 0; i < m; i++) {
+      t = (double)work[i + j * ldw];
+      if (sum_b) t += ao * sum_b[j];
+      if (sum_a) t += bo * sum_a[i];
+      t = alpha * (t + fixed);
+
+      if (beta != ZERO) t += beta * (double)*cc;
+      t += (double)co[i * co_rs + j * co_cs];
+
+      t = floor(t + 0.5);
+      if (t >  2147483647.) t =  2147483647.;
+      if (t < -2147483648.) t = -2147483648.;
+
+      *cc = (int32_t)t;
+      cc += c_rs;
+    }
+  }
+}
+
+int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, float *sa, float *sb, BLASLONG dummy){
+
+  BLASLONG k, lda, ldb, ldc;
+  int8_t  *a;
+  uint8_t *b;
+  int32_t *c;
+  double alpha, beta;
+  i8gemm_offset_t *offset;
+
+  BLASLONG m_from, m_to, n_from, n_to;
+  BLASLONG ls, is, js, i, j, l;
+  BLASLONG min_l, min_i, min_j;
+  BLASLONG pad_l, pad_i, pad_j;
+  double s;
+
+  int8_t  *packed_a;
+  uint8_t *packed_b;
+  int32_t *work;
+  double  *sum_a, *sum_b;
+
+  k   = args -> k;
+  a   = (int8_t  *)args -> a;
+  b   = (uint8_t *)args -> b;
+  c   = (int32_t *)args -> c;
+  lda = args -> lda;
+  ldb = args -> ldb;
+  ldc = args -> ldc;
+
+  alpha  = (double)*((float *)args -> alpha);
+  beta   = (double)*((float *)args -> beta);
+  offset = args -> offset;
+
+  m_from = 0;
+  m_to   = args -> m;
+  if (range_m) {
+    m_from = *(((BLASLONG *)range_m) + 0);
+    m_to   = *(((BLASLONG *)range_m) + 1);
+  }
+
+  n_from = 0;
+  n_to   = args -> n;
+  if (range_n) {
+    n_from = *(((BLASLONG *)range_n) + 0);
+    n_to   = *(((BLASLONG *)range_n) + 1);
+  }
+
+  /* the product does not contribute, only beta and co are applied */
+  if (alpha == ZERO) k = 0;
+
+  packed_a = (int8_t  *)sa;
+  packed_b = (uint8_t *)(((BLASLONG)packed_a + I8GEMM_P * I8GEMM_Q + GEMM_ALIGN) & ~GEMM_ALIGN);
+  work     = (int32_t *)(((BLASLONG)packed_b + I8GEMM_Q * I8GEMM_R + GEMM_ALIGN) & ~GEMM_ALIGN);
+  sum_a    = (double  *)(work + I8GEMM_P * I8GEMM_R);
+  sum_b    = sum_a + I8GEMM_P;
+
+  /* the sums are only needed against a nonzero offset of the other side */
+  if ((k == 0) || (offset -> bo == 0)) sum_a = NULL;
+  if ((k == 0) || (offset -> ao == 0)) sum_b = NULL;
+
+  for (js = n_from; js < n_to; js += I8GEMM_R) {
+    min_j = n_to - js;
+    if (min_j > I8GEMM_R) min_j = I8GEMM_R;
+    pad_j = ((min_j + I8GEMM_UNROLL_N - 1) / I8GEMM_UNROLL_N) * I8GEMM_UNROLL_N;
+
+    if (sum_b) {
+      for (j = 0; j < min_j; j++) {
+	s = ZERO;
+	for (l = 0; l < k; l++) s += (double)B_ELEMENT(b, ldb, l, js + j);
+	sum_b[j] = s;
+      }
+    }
+
+    for (is = m_from; is < m_to; is += I8GEMM_P) {
+      min_i = m_to - is;
+      if (min_i > I8GEMM_P) min_i = I8GEMM_P;
+      pad_i = ((min_i + I8GEMM_UNROLL_M - 1) / I8GEMM_UNROLL_M) * I8GEMM_UNROLL_M;
+
+      if (sum_a) {
+	for (i = 0; i < min_i; i++) {
+	  s = ZERO;
+	  for (l = 0; l < k; l++) s += (double)A_ELEMENT(a, lda, is + i, l);
+	  sum_a[i] = s;
+	}
+      }
+
+      for (i = 0; i < pad_i * pad_j; i++) work[i] = 0;
+
+      for (ls = 0; ls < k; ls += I8GEMM_Q) {
+	min_l = k - ls;
+	if (min_l > I8GEMM_Q) min_l = I8GEMM_Q;
+	pad_l = (min_l + 3) & ~3;
+
+	if ((k > I8GEMM_Q) || (is == m_from)) {
+	  OCOPY_OPERATION(min_l, min_j, b, ldb, ls, js, packed_b);
+	}
+
+	ICOPY_OPERATION(min_l, min_i, a, lda, ls, is, packed_a);
+
+	I8GEMM_KERNEL(pad_i, pad_j, pad_l, packed_a, packed_b, work, pad_i);
+      }
+
+      store_block(min_i, min_j, k, is, js, work, pad_i, sum_a, sum_b,
+		  alpha, beta, offset, c, ldc);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,444 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common.h"
+
+/*
+ * In-place ?IMATCOPY for the cases the imatcopy kernels do not cover:
+ * transposes of non-square matrices, and lda != ldb.
+ *
+ * A is rows x cols in column-major order; trans is 0 (N), 1 (T), 2 (C)
+ * or 3 (R).  Padded input (lda > rows) is first packed densely and
+ * padded output (ldb > rows of the result) is spread out at the end,
+ * both in place.
+ *
+ * The dense transpose views A as an m x n row-major matrix (m = cols,
+ * n = rows) and splits the permutation into passes that each move
+ * elements only within a column or only within a row (Catanzaro, Keller
+ * and Garland, "A decomposition for in-place matrix transposition"):
+ *
+ *   1. rotate column j up by j / b                    (only if g > 1)
+ *   2. in row i, move column j to (j * m + i') mod n, i' being the row
+ *      the element started in; alpha is applied here
+ *   3. rotate column j up by j mod m, then move row f(r) to row r with
+ *      f(r) = (r * n - r / a) mod m, the same for every column
+ *
+ * where g = gcd(m, n), a = m / g and b = n / g.  Passes 1 and 3 split
+ * the columns over the threads, pass 2 the rows.  Rotations work on
+ * strips of up to BLOCK columns so that every access touches whole cache
+ * lines, and the row moves of pass 3 copy contiguous strips.
+ *
+ * Scratch is one row per thread of pass 2 plus two bits per row.  If it
+ * cannot be allocated, the permutation is followed cycle by cycle from
+ * the smallest index of each cycle, which needs no memory but is serial.
+ */
+
+#define BLOCK	(256 / (int)(sizeof(FLOAT) * COMPSIZE))
+#define LINE	( 64 / (int)(sizeof(FLOAT) * COMPSIZE))
+
+#ifdef SMP
+#ifndef COMPLEX
+#ifdef XDOUBLE
+#define MODE	(BLAS_XDOUBLE | BLAS_REAL)
+#elif defined(DOUBLE)
+#define MODE	(BLAS_DOUBLE  | BLAS_REAL)
+#else
+#define MODE	(BLAS_SINGLE  | BLAS_REAL)
+#endif
+#else
+#ifdef XDOUBLE
+#define MODE	(BLAS_XDOUBLE | BLAS_COMPLEX)
+#elif defined(DOUBLE)
+#define MODE	(BLAS_DOUBLE  | BLAS_COMPLEX)
+#else
+#define MODE	(BLAS_SINGLE  | BLAS_COMPLEX)
+#endif
+#endif
+#endif
+
+typedef int (*pass_t)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG);
+
+/* d = alpha * op(s); d may equal s */
+static inline void scale(FLOAT *d, FLOAT *s, FLOAT *alpha, int conj)
+{
+#ifndef COMPLEX
+	d[0] = alpha[0] * s[0];
+#else
+	FLOAT xr = s[0], xi = conj ? -s[1] : s[1];
+
+	d[0] = alpha[0] * xr - alpha[1] * xi;
+	d[1] = alpha[0] * xi + alpha[1] * xr;
+#endif
+}
+
+static BLASLONG gcd(BLASLONG x, BLASLONG y)
+{
+	while (y) {
+		BLASLONG t = x % y;
+		x = y;
+		y = t;
+	}
+	return x;
+}
+
+/* Row f(r) ends up in row r in the last pass */
+static inline BLASLONG row_source(BLASLONG r, BLASLONG m, BLASLONG n, BLASLONG a)
+{
+	BLASLONG s = (r * n) % m - r / a;
+
+	return (s < 0) ? s + m : s;
+}
+
+/* Swap the w-wide segments of rows lo .. hi - 1 end for end */
+static void reverse_rows(FLOAT *a, BLASLONG ld, BLASLONG w, BLASLONG lo, BLASLONG hi)
+{
+	BLASLONG i;
+	FLOAT *p, *q, t;
+
+	for (hi--; lo < hi; lo++, hi--) {
+		p = a + lo * ld * COMPSIZE;
+		q = a + hi * ld * COMPSIZE;
+		for (i = 0; i < w * COMPSIZE; i++) {
+			t = p[i];
+			p[i] = q[i];
+			q[i] = t;
+		}
+	}
+}
+
+/*
+ * Rotate the w <= BLOCK columns of a up by shift[0 .. w - 1].  The whole
+ * strip is rotated by shift[0] with three reversals, then each column by
+ * the rest, which is below w for the shifts used here.
+ */
+static void rotate_strip(BLASLONG m, BLASLONG ld, BLASLONG w, FLOAT *a, BLASLONG *shift)
+{
+	FLOAT save[BLOCK * BLOCK * COMPSIZE];
+	BLASLONG rest[BLOCK];
+	BLASLONG base = shift[0], most = 0, t, x, y, src;
+	FLOAT *p;
+
+	for (t = 0; t < w; t++) {
+		rest[t] = shift[t] - base;
+		if (rest[t] < 0) rest[t] += m;
+		most = MAX(most, rest[t]);
+	}
+
+	if (base > 0) {
+		reverse_rows(a, ld, w, 0, base);
+		reverse_rows(a, ld, w, base, m);
+		reverse_rows(a, ld, w, 0, m);
+	}
+
+	if (most == 0) return;
+
+	for (y = 0; y < most; y++)
+		memcpy(save + y * w * COMPSIZE, a + y * ld * COMPSIZE, w * COMPSIZE * sizeof(FLOAT));
+
+	for (x = 0; x < m; x++) {
+		for (t = 0; t < w; t++) {
+			if (rest[t] == 0) continue;
+			src = x + rest[t];
+			p = (src < m) ? a + (src * ld + t) * COMPSIZE : save + ((src - m) * w + t) * COMPSIZE;
+			a[(x * ld + t) * COMPSIZE + 0] = p[0];
+#ifdef COMPLEX
+			a[(x * ld + t) * COMPSIZE + 1] = p[1];
+#endif
+		}
+	}
+}
+
+/* Pass 1: rotate column j up by j / b */
+static int rotate_columns(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos)
+{
+	FLOAT *a = (FLOAT *)args -> a;
+	BLASLONG m = args -> m, n = args -> n, b = args -> ldb;
+	BLASLONG shift[BLOCK];
+	BLASLONG j, t, w;
+
+	for (j = range_n[0]; j < range_n[1]; j += w) {
+		w = MIN(BLOCK, range_n[1] - j);
+		for (t = 0; t < w; t++) shift[t] = (j + t) / b;
+		rotate_strip(m, n, w, a + j * COMPSIZE, shift);
+	}
+
+	return 0;
+}
+
+/* Pass 2: scatter each row to the columns of its elements in the result */
+static int shuffle_rows(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos)
+{
+	FLOAT *a = (FLOAT *)args -> a;
+	FLOAT *alpha = (FLOAT *)args -> alpha;
+	BLASLONG m = args -> m, n = args -> n, b = args -> ldb;
+	BLASLONG step = m % n;
+	BLASLONG i, j, q, jm, src, srcn, c;
+	FLOAT *row;
+	int conj = (int)args -> lda;
+
+	for (i = range_m[0]; i < range_m[1]; i++) {
+		row = a + i * n * COMPSIZE;
+		memcpy(sa, row, n * COMPSIZE * sizeof(FLOAT));
+
+		jm = 0;
+		src = i;
+		srcn = i % n;
+
+		for (j = 0, q = 0; j < n; j++, q++) {
+			if (q == b) {
+				q = 0;
+				src++;
+				if (src == m) src = 0;
+				srcn = src % n;
+			}
+			c = jm + srcn;
+			if (c >= n) c -= n;
+			scale(row + c * COMPSIZE, sa + j * COMPSIZE, alpha, conj);
+			jm += step;
+			if (jm >= n) jm -= n;
+		}
+	}
+
+	return 0;
+}
+
+/* Pass 3: rotate column j up by j mod m, then permute the rows of the strip */
+static int shuffle_columns(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos)
+{
+	FLOAT *a = (FLOAT *)args -> a;
+	unsigned char *leader = (unsigned char *)args -> b;
+	BLASLONG m = args -> m, n = args -> n, ar = args -> ldc;
+	BLASLONG n_from = range_n[0], width = range_n[1] - range_n[0];
+	BLASLONG shift[BLOCK];
+	BLASLONG j, t, w, s, x, y;
+	size_t bytes = width * COMPSIZE * sizeof(FLOAT);
+
+	for (j = n_from; j < range_n[1]; j += w) {
+		w = MIN(BLOCK, range_n[1] - j);
+		shift[0] = j % m;
+		for (t = 1; t < w; t++) shift[t] = (shift[t - 1] + 1 == m) ? 0 : shift[t - 1] + 1;
+		rotate_strip(m, n, w, a + j * COMPSIZE, shift);
+	}
+
+	a += n_from * COMPSIZE;
+
+	for (s = 0; s < m; s++) {
+		if (!(leader[s >> 3] & (1 << (s & 7)))) continue;
+
+		memcpy(sa, a + s * n * COMPSIZE, bytes);
+		x = s;
+		while ((y = row_source(x, m, n, ar)) != s) {
+			memcpy(a + x * n * COMPSIZE, a + y * n * COMPSIZE, bytes);
+			x = y;
+		}
+		memcpy(a + x * n * COMPSIZE, sa, bytes);
+	}
+
+	return 0;
+}
+
+/*
+ * Run a pass with the rows or the columns split over the threads.  A row
+ * pass gets one row of scratch per thread, a column pass the part of one
+ * row under its columns.
+ */
+static void run_pass(pass_t pass, blas_arg_t *args, int split_rows, BLASLONG size, BLASLONG align,
+		     FLOAT *buffer, int nthreads)
+{
+	BLASLONG range[MAX_CPU_NUMBER + 1];
+#ifdef SMP
+	blas_queue_t queue[MAX_CPU_NUMBER];
+	BLASLONG width, i;
+	int num_cpu = 0;
+
+	range[0] = 0;
+	i = size;
+
+	while (i > 0) {
+		width = blas_quickdivide(i + nthreads - num_cpu - 1, nthreads - num_cpu);
+		width = (width + align - 1) / align * align;
+		if (width > i) width = i;
+
+		range[num_cpu + 1] = range[num_cpu] + width;
+
+		queue[num_cpu].mode    = MODE;
+		queue[num_cpu].routine = pass;
+		queue[num_cpu].args    = args;
+		queue[num_cpu].range_m = split_rows ? &range[num_cpu] : NULL;
+		queue[num_cpu].range_n = split_rows ? NULL : &range[num_cpu];
+		queue[num_cpu].sa      = buffer + (split_rows ? num_cpu * args -> n : range[num_cpu]) * COMPSIZE;
+		queue[num_cpu].sb      = NULL;
+		queue[num_cpu].next    = &queue[num_cpu + 1];
+
+		num_cpu++;
+		i -= width;
+	}
+
+	queue[num_cpu - 1].next = NULL;
+
+	exec_blas(num_cpu, queue);
+#else
+	range[0] = 0;
+	range[1] = size;
+
+	pass(args, split_rows ? range : NULL, split_rows ? NULL : range, buffer, NULL, 0);
+#endif
+}
+
+/* Walk every cycle of the permutation from its smallest index */
+static void transpose_cycles(BLASLONG m, BLASLONG n, FLOAT *alpha, FLOAT *a, int conj)
+{
+	BLASLONG size = m * n, s, x, y;
+	FLOAT t[2];
+
+	for (s = 0; s < size; s++) {
+		x = (s % m) * n + s / m;
+		while (x > s) x = (x % m) * n + x / m;
+		if (x < s) continue;
+
+		t[0] = a[s * COMPSIZE + 0];
+#ifdef COMPLEX
+		t[1] = a[s * COMPSIZE + 1];
+#endif
+		x = s;
+		while ((y = (x % m) * n + x / m) != s) {
+			scale(a + x * COMPSIZE, a + y * COMPSIZE, alpha, conj);
+			x = y;
+		}
+		scale(a + x * COMPSIZE, t, alpha, conj);
+	}
+}
+
+/* In-place transpose of a dense m x n row-major matrix */
+static void transpose(BLASLONG m, BLASLONG n, FLOAT *alpha, FLOAT *a, int conj, int nthreads)
+{
+	blas_arg_t args;
+	BLASLONG g = gcd(m, n), bits = (m + 7) / 8;
+	BLASLONG s, x;
+	int row_threads = (int)MIN(nthreads, m);
+	unsigned char *leader, *visited;
+	FLOAT *buffer;
+
+	buffer = (FLOAT *)malloc(row_threads * n * COMPSIZE * sizeof(FLOAT) + 2 * bits);
+	if (buffer == NULL && row_threads > 1) {
+		nthreads = row_threads = 1;
+		buffer = (FLOAT *)malloc(n * COMPSIZE * sizeof(FLOAT) + 2 * bits);
+	}
+	if (buffer == NULL) {
+		transpose_cycles(m, n, alpha, a, conj);
+		return;
+	}
+
+	leader  = (unsigned char *)(buffer + row_threads * n * COMPSIZE);
+	visited = leader + bits;
+	memset(leader, 0, 2 * bits);
+
+	for (s = 0; s < m; s++) {
+		if (visited[s >> 3] & (1 << (s & 7))) continue;
+		x = s;
+		do {
+			visited[x >> 3] |= (unsigned char)(1 << (x & 7));
+			x = row_source(x, m, n, m / g);
+		} while (x != s);
+		if (row_source(s, m, n, m / g) != s) leader[s >> 3] |= (unsigned char)(1 << (s & 7));
+	}
+
+	args.a     = (void *)a;
+	args.b     = (void *)leader;
+	args.alpha = (void *)alpha;
+	args.m     = m;
+	args.n     = n;
+	args.lda   = conj;
+	args.ldb   = n / g;
+	args.ldc   = m / g;
+
+	if (g > 1) run_pass(rotate_columns, &args, 0, n, LINE, buffer, nthreads);
+	run_pass(shuffle_rows,    &args, 1, m, 1,    buffer, row_threads);
+	run_pass(shuffle_columns, &args, 0, n, LINE, buffer, nthreads);
+
+	free(buffer);
+}
+
+int CNAME(BLASLONG rows, BLASLONG cols, FLOAT *alpha, FLOAT *a, BLASLONG lda, BLASLONG ldb, int trans, int nthreads)
+{
+	int transposed = (trans == 1 || trans == 2);
+	int conj = (trans == 2 || trans == 3);
+	BLASLONG out_rows = transposed ? cols : rows;
+	BLASLONG out_cols = transposed ? rows : cols;
+	BLASLONG i, j;
+	FLOAT *p;
+
+	if (rows <= 0 || cols <= 0) return 0;
+
+	if (alpha[0] == ZERO
+#ifdef COMPLEX
+	    && alpha[1] == ZERO
+#endif
+	    ) {
+		for (j = 0; j < out_cols; j++)
+			memset(a + j * ldb * COMPSIZE, 0, out_rows * COMPSIZE * sizeof(FLOAT));
+		return 0;
+	}
+
+	if (!transposed) {
+		/* No transpose: move the columns in the order that does not
+		   overwrite columns that have not been moved yet */
+		if (ldb <= lda) {
+			for (j = 0; j < cols; j++) {
+				p = a + j * ldb * COMPSIZE;
+				memmove(p, a + j * lda * COMPSIZE, rows * COMPSIZE * sizeof(FLOAT));
+				for (i = 0; i < rows; i++) scale(p + i * COMPSIZE, p + i * COMPSIZE, alpha, conj);
+			}
+		} else {
+			for (j = cols - 1; j >= 0; j--) {
+				p = a + j * ldb * COMPSIZE;
+				memmove(p, a + j * lda * COMPSIZE, rows * COMPSIZE * sizeof(FLOAT));
+				for (i = 0; i < rows; i++) scale(p + i * COMPSIZE, p + i * COMPSIZE, alpha, conj);
+			}
+		}
+		return 0;
+	}
+
+	if (lda > rows)
+		for (j = 1; j < cols; j++)
+			memmove(a + j * rows * COMPSIZE, a + j * lda * COMPSIZE, rows * COMPSIZE * sizeof(FLOAT));
+
+	if (rows == 1 || cols == 1) {
+		for (i = 0; i < rows * cols; i++) scale(a + i * COMPSIZE, a + i * COMPSIZE, alpha, conj);
+	} else {
+		transpose(cols, rows, alpha, a, conj, nthreads);
+	}
+
+	if (ldb > cols)
+		for (j = rows - 1; j > 0; j--)
+			memmove(a + j * ldb * COMPSIZE, a + j * cols * COMPSIZE, cols * COMPSIZE * sizeof(FLOAT));
+
+	return 0;
+}
@@ -107,6 +107,13 @@
 #endif
 #endif
 
+/* bias, activation and clamp of the ?gemm_epilogue drivers; applied to a
+   tile of C once the last block of K has been added to it */
+#if defined(EPILOGUE) && !defined(EPILOGUE_OPERATION)
+#define EPILOGUE_OPERATION(M, N, C, LDC, X, Y) \
+	GEMM_EPILOGUE(M, N, X, Y, (FLOAT *)(C) + ((X) + (Y) * (LDC)), LDC, args -> epilogue)
+#endif
+
 #ifndef FUSED_KERNEL_OPERATION
 #if defined(NN) || defined(TN) || defined(CN) || defined(RN) || \
     defined(NR) || defined(TR) || defined(CR) || defined(RR)
@@ -249,6 +256,13 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 	}
   }
 
+#ifdef EPILOGUE
+  if ((k == 0) || (alpha == NULL) || (alpha[0] == ZERO)) {
+    EPILOGUE_OPERATION(m_to - m_from, n_to - n_from, c, ldc, m_from, n_from);
+    return 0;
+  }
+#endif
+
   if ((k == 0) || (alpha == NULL)) return 0;
 
 #if !defined(XDOUBLE) || !defined(QUAD_PRECISION)
@@ -338,11 +352,14 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
       FUSED_KERNEL_OPERATION(min_i, min_j, min_l, alpha,
 			     sa, sb, b, ldb, c, ldc, m_from, js, ls);
 
+#ifdef EPILOGUE
+      if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, min_j, c, ldc, m_from, js);
+#endif
 
 #else
       for(jjs = js; jjs < js + min_j; jjs += min_jj){
 	min_jj = min_j + js - jjs;
-#if defined(SKYLAKEX) || defined(COOPERLAKE) || defined(SAPPHIRERAPIDS)
+#if defined(SKYLAKEX) || defined(COOPERLAKE) || defined(SAPPHIRERAPIDS) || defined(ZEN4)
 	/* the current AVX512 s/d/c/z GEMM kernel requires n>=6*GEMM_UNROLL_N to achieve best performance */
 	if (min_jj >= 6*GEMM_UNROLL_N) min_jj = 6*GEMM_UNROLL_N;
 #else
@@ -374,6 +391,10 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 #endif
 
 	STOP_RPCC(kernelcost);
+
+#ifdef EPILOGUE
+	if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, min_jj, c, ldc, m_from, jjs);
+#endif
       }
 #endif
 
@@ -403,6 +424,10 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 
 	STOP_RPCC(kernelcost);
 
+#ifdef EPILOGUE
+	if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, min_j, c, ldc, is, js);
+#endif
+
       } /* end of is */
     } /* end of js */
   } /* end of ls */
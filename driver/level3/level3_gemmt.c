@@ -0,0 +1,209 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+/* This file is included by gemmt_k.c; it follows level3_syrk.c, except  */
+/* that A and B are different matrices, so the packed panels are never  */
+/* shared between sa and sb.                                             */
+
+#ifndef KERNEL_OPERATION
+#ifndef COMPLEX
+#define KERNEL_OPERATION(M, N, K, ALPHA, SA, SB, C, LDC, X, Y) \
+	KERNEL_FUNC(M, N, K, ALPHA[0], SA, SB, (FLOAT *)(C) + ((X) + (Y) * LDC) * COMPSIZE, LDC, (X) - (Y))
+#else
+#define KERNEL_OPERATION(M, N, K, ALPHA, SA, SB, C, LDC, X, Y) \
+	KERNEL_FUNC(M, N, K, ALPHA[0], ALPHA[1], SA, SB, (FLOAT *)(C) + ((X) + (Y) * LDC) * COMPSIZE, LDC, (X) - (Y))
+#endif
+#endif
+
+#ifndef M
+#define M	args -> n
+#endif
+
+#ifndef N
+#define N	args -> n
+#endif
+
+#ifndef K
+#define K	args -> k
+#endif
+
+#ifndef A
+#define A	args -> a
+#endif
+
+#ifndef B
+#define B	args -> b
+#endif
+
+#ifndef C
+#define C	args -> c
+#endif
+
+#ifndef LDA
+#define LDA	args -> lda
+#endif
+
+#ifndef LDB
+#define LDB	args -> ldb
+#endif
+
+#ifndef LDC
+#define LDC	args -> ldc
+#endif
+
+int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG dummy) {
+
+  BLASLONG m_from, m_to, n_from, n_to, k, lda, ldb, ldc;
+  FLOAT *a, *b, *c, *alpha, *beta;
+
+  BLASLONG ls, is, js;
+  BLASLONG min_l, min_i, min_j;
+  BLASLONG jjs, min_jj;
+  BLASLONG m_start, m_end;
+
+  k = K;
+
+  a = (FLOAT *)A;
+  b = (FLOAT *)B;
+  c = (FLOAT *)C;
+
+  lda = LDA;
+  ldb = LDB;
+  ldc = LDC;
+
+  alpha = (FLOAT *)args -> alpha;
+  beta  = (FLOAT *)args -> beta;
+
+  m_from = 0;
+  m_to   = M;
+
+  if (range_m) {
+    m_from = *(((BLASLONG *)range_m) + 0);
+    m_to   = *(((BLASLONG *)range_m) + 1);
+  }
+
+  n_from = 0;
+  n_to   = N;
+
+  if (range_n) {
+    n_from = *(((BLASLONG *)range_n) + 0);
+    n_to   = *(((BLASLONG *)range_n) + 1);
+  }
+
+  if (beta) {
+#ifndef COMPLEX
+    if (beta[0] != ONE)
+#else
+    if ((beta[0] != ONE) || (beta[1] != ZERO))
+#endif
+      gemmt_beta(m_from, m_to, n_from, n_to, beta, c, ldc);
+  }
+
+  if ((k == 0) || (alpha == NULL)) return 0;
+
+  if (alpha[0] == ZERO
+#ifdef COMPLEX
+      && alpha[1] == ZERO
+#endif
+      ) return 0;
+
+  for(js = n_from; js < n_to; js += GEMM_R){
+    min_j = n_to - js;
+    if (min_j > GEMM_R) min_j = GEMM_R;
+
+#ifndef LOWER
+    m_start = m_from;
+    m_end   = js + min_j;
+    if (m_end > m_to) m_end = m_to;
+#else
+    m_start = m_from;
+    m_end   = m_to;
+    if (m_start < js) m_start = js;
+#endif
+
+    if (m_start >= m_end) continue;
+
+    for(ls = 0; ls < k; ls += min_l){
+      min_l = k - ls;
+      if (min_l >= GEMM_Q * 2) {
+	min_l = GEMM_Q;
+      } else
+	if (min_l > GEMM_Q) {
+	  min_l = (min_l + 1) / 2;
+	}
+
+      min_i = m_end - m_start;
+
+      if (min_i >= GEMM_P * 2) {
+	min_i = GEMM_P;
+      } else
+	if (min_i > GEMM_P) {
+	  min_i = ((min_i / 2 + GEMM_UNROLL_MN - 1)/GEMM_UNROLL_MN) * GEMM_UNROLL_MN;
+	}
+
+      ICOPY_OPERATION(min_l, min_i, a, lda, ls, m_start, sa);
+
+#ifndef LOWER
+      /* only the columns right of the first row block can be touched */
+      for(jjs = MAX(m_start, js); jjs < js + min_j; jjs += min_jj){
+	min_jj = js + min_j - jjs;
+	if (min_jj > GEMM_UNROLL_MN) min_jj = GEMM_UNROLL_MN;
+
+	OCOPY_OPERATION(min_l, min_jj, b, ldb, ls, jjs, sb + min_l * (jjs - js) * COMPSIZE);
+
+	KERNEL_OPERATION(min_i, min_jj, min_l, alpha, sa, sb + min_l * (jjs - js) * COMPSIZE, c, ldc, m_start, jjs);
+      }
+#else
+      /* the first row block already sits below every column of the panel */
+      for(jjs = js; jjs < js + min_j; jjs += min_jj){
+	min_jj = js + min_j - jjs;
+	if (min_jj > GEMM_UNROLL_MN) min_jj = GEMM_UNROLL_MN;
+
+	OCOPY_OPERATION(min_l, min_jj, b, ldb, ls, jjs, sb + min_l * (jjs - js) * COMPSIZE);
+
+	KERNEL_OPERATION(min_i, min_jj, min_l, alpha, sa, sb + min_l * (jjs - js) * COMPSIZE, c, ldc, m_start, jjs);
+      }
+#endif
+
+      for(is = m_start + min_i; is < m_end; is += min_i){
+	min_i = m_end - is;
+	if (min_i >= GEMM_P * 2) {
+	  min_i = GEMM_P;
+	} else
+	  if (min_i > GEMM_P) {
+	    min_i = ((min_i / 2 + GEMM_UNROLL_MN - 1)/GEMM_UNROLL_MN) * GEMM_UNROLL_MN;
+	  }
+
+	ICOPY_OPERATION(min_l, min_i, a, lda, ls, is, sa);
+
+	KERNEL_OPERATION(min_i, min_j, min_l, alpha, sa, sb, c, ldc, is, js);
+      }
+    }
+  }
+
+  return 0;
+}
@@ -560,6 +560,17 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLO
 #endif
 #endif
 
+  /* a rank-k update that fits in one GEMM_Q panel gains little from
+     sharing packed panels, and the static split leaves the threads that
+     own diagonal blocks behind; use the dynamic column panels instead */
+  if (args -> k <= GEMM_Q) {
+#ifdef LOWER
+    mode |= BLAS_UPLO;
+#endif
+    syrk_thread(mode, args, range_m, range_n, SYRK_LOCAL, sa, sb, nthreads);
+    return 0;
+  }
+
   newarg.m        = args -> m;
   newarg.n        = args -> n;
   newarg.k        = args -> k;
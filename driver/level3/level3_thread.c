@@ -55,6 +55,18 @@
 #define USE_ALLOC_HEAP
 #endif
 
+#if defined(EPILOGUE) && !defined(GEMM_LOCAL)
+#if   defined(NN)
+#define GEMM_LOCAL    GEMM_EPILOGUE_NN
+#elif defined(NT)
+#define GEMM_LOCAL    GEMM_EPILOGUE_NT
+#elif defined(TN)
+#define GEMM_LOCAL    GEMM_EPILOGUE_TN
+#elif defined(TT)
+#define GEMM_LOCAL    GEMM_EPILOGUE_TT
+#endif
+#endif
+
 #ifndef GEMM_LOCAL
 #if   defined(NN)
 #define GEMM_LOCAL    GEMM_NN
@@ -154,6 +166,13 @@ typedef struct {
 #endif
 #endif
 
+/* bias, activation and clamp of the ?gemm_epilogue drivers; applied to a
+   tile of C once the last block of K has been added to it */
+#if defined(EPILOGUE) && !defined(EPILOGUE_OPERATION)
+#define EPILOGUE_OPERATION(M, N, C, LDC, X, Y) \
+	GEMM_EPILOGUE(M, N, X, Y, (FLOAT *)(C) + ((X) + (Y) * (LDC)), LDC, args -> epilogue)
+#endif
+
 #ifndef FUSED_KERNEL_OPERATION
 #if defined(NN) || defined(TN) || defined(CN) || defined(RN) || \
   defined(NR) || defined(TR) || defined(CR) || defined(RR)
@@ -216,9 +235,9 @@ typedef struct {
 #define STOP_RPCC(COUNTER)
 #endif
 
-static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, IFLOAT *sa, IFLOAT *sb, BLASLONG mypos){
+static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, XFLOAT *sa, XFLOAT *sb, BLASLONG mypos){
 
-  IFLOAT *buffer[DIVIDE_RATE];
+  XFLOAT *buffer[DIVIDE_RATE];
 
   BLASLONG k, lda, ldb, ldc;
   BLASLONG m_from, m_to, n_from, n_to;
@@ -296,6 +315,14 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
       BETA_OPERATION(m_from, m_to, range_n[mypos_n * nthreads_m], range_n[(mypos_n + 1) * nthreads_m], beta, c, ldc);
   }
 
+#ifdef EPILOGUE
+  if ((k == 0) || (alpha == NULL) || (alpha[0] == ZERO)) {
+    EPILOGUE_OPERATION(m_to - m_from, range_n[(mypos_n + 1) * nthreads_m] - range_n[mypos_n * nthreads_m],
+		       c, ldc, m_from, range_n[mypos_n * nthreads_m]);
+    return 0;
+  }
+#endif
+
   /* Return early if no more computation is needed */
   if ((k == 0) || (alpha == NULL)) return 0;
   if (alpha[0] == ZERO
@@ -369,12 +396,16 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
       FUSED_KERNEL_OPERATION(min_i, MIN(n_to, js + div_n) - js, min_l, alpha,
 			     sa, buffer[bufferside], b, ldb, c, ldc, m_from, js, ls);
 
+#ifdef EPILOGUE
+      if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, MIN(n_to, js + div_n) - js, c, ldc, m_from, js);
+#endif
+
 #else
 
       /* Split local region of B into parts */
       for(jjs = js; jjs < MIN(n_to, js + div_n); jjs += min_jj){
 	min_jj = MIN(n_to, js + div_n) - jjs;
-#if defined(SKYLAKEX) || defined(COOPERLAKE) || defined(SAPPHIRERAPIDS)
+#if defined(SKYLAKEX) || defined(COOPERLAKE) || defined(SAPPHIRERAPIDS) || defined(ZEN4)
 	/* the current AVX512 s/d/c/z GEMM kernel requires n>=6*GEMM_UNROLL_N to achieve the best performance */
 	if (min_jj >= 6*GEMM_UNROLL_N) min_jj = 6*GEMM_UNROLL_N;
 #else
@@ -399,6 +430,10 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 			 c, ldc, m_from, jjs);
 	STOP_RPCC(kernel);
 
+#ifdef EPILOGUE
+	if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, min_jj, c, ldc, m_from, jjs);
+#endif
+
 #ifdef TIMING
         ops += 2 * min_i * min_jj * min_l;
 #endif
@@ -435,10 +470,14 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
           /* Apply kernel with local region of A and part of other region of B */
 	  START_RPCC();
 	  KERNEL_OPERATION(min_i, MIN(range_n[current + 1]  - js,  div_n), min_l, alpha,
-			   sa, (IFLOAT *)job[current].working[mypos][CACHE_LINE_SIZE * bufferside],
+			   sa, (XFLOAT *)job[current].working[mypos][CACHE_LINE_SIZE * bufferside],
 			   c, ldc, m_from, js);
           STOP_RPCC(kernel);
 
+#ifdef EPILOGUE
+	  if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, MIN(range_n[current + 1] - js, div_n), c, ldc, m_from, js);
+#endif
+
 #ifdef TIMING
 	  ops += 2 * min_i * MIN(range_n[current + 1]  - js,  div_n) * min_l;
 #endif
@@ -479,9 +518,13 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
           /* Apply kernel with local region of A and part of region of B */
 	  START_RPCC();
 	  KERNEL_OPERATION(min_i, MIN(range_n[current + 1] - js, div_n), min_l, alpha,
-			   sa, (IFLOAT *)job[current].working[mypos][CACHE_LINE_SIZE * bufferside],
+			   sa, (XFLOAT *)job[current].working[mypos][CACHE_LINE_SIZE * bufferside],
 			   c, ldc, is, js);
           STOP_RPCC(kernel);
+
+#ifdef EPILOGUE
+	  if (ls + min_l >= k) EPILOGUE_OPERATION(min_i, MIN(range_n[current + 1] - js, div_n), c, ldc, is, js);
+#endif
           
 #ifdef TIMING
           ops += 2 * min_i * MIN(range_n[current + 1]  - js, div_n) * min_l;
@@ -542,7 +585,7 @@ static int round_up(int remainder, int width, int multiple)
 
 
 static int gemm_driver(blas_arg_t *args, BLASLONG *range_m, BLASLONG
-		       *range_n, IFLOAT *sa, IFLOAT *sb,
+		       *range_n, XFLOAT *sa, XFLOAT *sb,
                        BLASLONG nthreads_m, BLASLONG nthreads_n) {
 
 #ifdef USE_OPENMP
@@ -664,6 +707,9 @@ static int gemm_driver(blas_arg_t *args, BLASLONG *range_m, BLASLONG
   newarg.beta     = args -> beta;
   newarg.nthreads = args -> nthreads;
   newarg.common   = (void *)job;
+#ifdef EPILOGUE
+  newarg.epilogue = args -> epilogue;
+#endif
 #ifdef PARAMTEST
   newarg.gemm_p   = args -> gemm_p;
   newarg.gemm_q   = args -> gemm_q;
@@ -789,7 +835,7 @@ static int gemm_driver(blas_arg_t *args, BLASLONG *range_m, BLASLONG
   return 0;
 }
 
-int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, IFLOAT *sa, IFLOAT *sb, BLASLONG mypos){
+int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, XFLOAT *sa, XFLOAT *sb, BLASLONG mypos){
 
   BLASLONG m = args -> m;
   BLASLONG n = args -> n;
@@ -41,14 +41,56 @@
 #include <math.h>
 #include "common.h"
 
+#ifdef HAVE_C11
+#define	atomic_fetch_add_long(p, v)	__atomic_fetch_add(p, v, __ATOMIC_RELAXED)
+#elif defined(_MSC_VER)
+#define	atomic_fetch_add_long(p, v)	InterlockedExchangeAdd64((volatile LONG64 *)(p), v)
+#else
+#define	atomic_fetch_add_long(p, v)	__sync_fetch_and_add(p, v)
+#endif
+
+/* column panels per thread; the panels are handed out from a shared
+   counter, heaviest first, so that uneven panels and slow threads are
+   absorbed by whoever finishes early */
+#ifndef SYRK_THREAD_PANELS
+#define SYRK_THREAD_PANELS 8
+#endif
+
+typedef struct {
+  volatile BLASLONG next;
+  BLASLONG n_from, n_to, width, num_panels;
+  int upper;
+  int (*function)(blas_arg_t*, BLASLONG*, BLASLONG*, FLOAT *, FLOAT *, BLASLONG);
+} panel_queue_t;
+
+/* the panel queue travels to the threads in place of range_n */
+static int panel_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos){
+
+  panel_queue_t *panels = (panel_queue_t *)range_n;
+  BLASLONG panel, range[2];
+
+  while ((panel = atomic_fetch_add_long(&panels -> next, 1)) < panels -> num_panels) {
+
+    /* the upper triangle is heaviest in its last columns, the lower
+       triangle in its first ones */
+    if (panels -> upper) panel = panels -> num_panels - 1 - panel;
+
+    range[0] = panels -> n_from + panel * panels -> width;
+    range[1] = MIN(range[0] + panels -> width, panels -> n_to);
+
+    (panels -> function)(args, range_m, range, sa, sb, mypos);
+  }
+
+  return 0;
+}
+
 int CNAME(int mode, blas_arg_t *arg, BLASLONG *range_m, BLASLONG *range_n, int (*function)(blas_arg_t*, BLASLONG*, BLASLONG*, FLOAT *, FLOAT *, BLASLONG), void *sa, void *sb, BLASLONG nthreads) {
 
   blas_queue_t queue[MAX_CPU_NUMBER];
-  BLASLONG range[MAX_CPU_NUMBER + 1];
+  panel_queue_t panels;
 
   BLASLONG width, i;
   BLASLONG n_from, n_to;
-  double dnum, nf, nt, di, dinum;
 
   int num_cpu;
   int mask = 0;
@@ -100,91 +142,30 @@ int CNAME(int mode, blas_arg_t *arg, BLASLONG *range_m, BLASLONG *range_n, int (
     n_to   = *(range_n + 1);
   }
 
-  if (!(mode & BLAS_UPLO)) {
-
-    nf = (double)(n_from);
-    nt = (double)(n_to);
-
-    dnum = (nt * nt - nf * nf) / (double)nthreads;
-
-    num_cpu  = 0;
-
-    range[0] = n_from;
-    i        = n_from;
-
-    while (i < n_to){
-
-      if (nthreads - num_cpu > 1) {
-
-	di = (double)i;
-	dinum = di * di +dnum;
-	if (dinum <0)
-	  width = (BLASLONG)(( - di + mask)/(mask+1)) * (mask+1);
-	else
-	  width = (BLASLONG)(( sqrt(dinum) - di + mask)/(mask+1)) * (mask+1);
-
-	if ((width <= 0) || (width > n_to - i)) width = n_to - i;
-
-      } else {
-	width = n_to - i;
-      }
-
-      range[num_cpu + 1] = range[num_cpu] + width;
-
-      queue[num_cpu].mode    = mode;
-      queue[num_cpu].routine = function;
-      queue[num_cpu].args    = arg;
-      queue[num_cpu].range_m = range_m;
-      queue[num_cpu].range_n = &range[num_cpu];
-      queue[num_cpu].sa      = NULL;
-      queue[num_cpu].sb      = NULL;
-      queue[num_cpu].next    = &queue[num_cpu + 1];
-
-      num_cpu ++;
-      i += width;
-    }
-
-  } else {
-
-    nf = (double)(arg -> n - n_from);
-    nt = (double)(arg -> n - n_to);
-    dnum = (nt * nt - nf * nf) / (double)nthreads;
-    num_cpu  = 0;
-
-    range[0] = n_from;
-    i        = n_from;
-
-    while (i < n_to){
-
-      if (nthreads - num_cpu > 1) {
-
-	di = (double)(arg -> n - i);
-	dinum = di * di + dnum;
-	if (dinum<0)
-	  width = ((BLASLONG)(di + mask)/(mask+1)) * (mask+1);
-	else
-	  width = ((BLASLONG)((-sqrt(dinum) + di) + mask)/(mask+1)) * (mask+1);
-	if ((width <= 0) || (width > n_to - i)) width = n_to - i;
-
-      } else {
-	width = n_to - i;
-      }
-
-      range[num_cpu + 1] = range[num_cpu] + width;
-
-      queue[num_cpu].mode    = mode;
-      queue[num_cpu].routine = function;
-      queue[num_cpu].args    = arg;
-      queue[num_cpu].range_m = range_m;
-      queue[num_cpu].range_n = &range[num_cpu];
-      queue[num_cpu].sa      = NULL;
-      queue[num_cpu].sb      = NULL;
-      queue[num_cpu].next    = &queue[num_cpu + 1];
-
-      num_cpu ++;
-      i += width;
-    }
-
+  if (n_to <= n_from) return 0;
+
+  width = (n_to - n_from + nthreads * SYRK_THREAD_PANELS - 1) / (nthreads * SYRK_THREAD_PANELS);
+  width = ((width + mask) / (mask + 1)) * (mask + 1);
+
+  panels.next       = 0;
+  panels.n_from     = n_from;
+  panels.n_to       = n_to;
+  panels.width      = width;
+  panels.num_panels = (n_to - n_from + width - 1) / width;
+  panels.upper      = !(mode & BLAS_UPLO);
+  panels.function   = function;
+
+  num_cpu = (int)MIN(nthreads, panels.num_panels);
+
+  for (i = 0; i < num_cpu; i++) {
+    queue[i].mode    = mode;
+    queue[i].routine = panel_thread;
+    queue[i].args    = arg;
+    queue[i].range_m = range_m;
+    queue[i].range_n = (BLASLONG *)&panels;
+    queue[i].sa      = NULL;
+    queue[i].sb      = NULL;
+    queue[i].next    = &queue[i + 1];
   }
 
   if (num_cpu) {
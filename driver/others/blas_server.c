@@ -670,6 +670,13 @@ int exec_blas_async(BLASLONG pos, blas_queue_t *queue){
 
       if (queue -> mode & BLAS_NODE) {
 
+	/* The caller runs the first job itself, so the others start on the next node */
+	if (queue -> mode & BLAS_NODE_SPREAD) {
+	  node ++;
+	  if (node >= nodes) node = 0;
+	  i = 0;
+	}
+
 	do {
       
 	  while((thread_status[i].node != node || atomic_load_queue(&thread_status[i].queue)) && (i < blas_num_threads - 1)) i ++;
@@ -922,6 +929,11 @@ void goto_set_num_threads(int num_threads) {
 
   blas_cpu_number  = num_threads;
 
+  // Threads beyond the count seen at init have no buffer yet
+  LOCK_COMMAND(&server_lock);
+  adjust_thread_buffers();
+  UNLOCK_COMMAND(&server_lock);
+
 #if defined(ARCH_MIPS64) || defined(ARCH_LOONGARCH64)
 #ifndef DYNAMIC_ARCH
   //set parameters for different number of threads.
@@ -233,6 +233,23 @@ extern gotoblas_t gotoblas_SAPPHIRERAPIDS;
 #else
 #define gotoblas_SAPPHIRERAPIDS gotoblas_PRESCOTT
 #endif
+#ifdef DYN_ZEN4
+extern gotoblas_t gotoblas_ZEN4;
+#elif defined(DYN_COOPERLAKE)
+#define gotoblas_ZEN4 gotoblas_COOPERLAKE
+#elif defined(DYN_SKYLAKEX)
+#define gotoblas_ZEN4 gotoblas_SKYLAKEX
+#elif defined(DYN_ZEN)
+#define gotoblas_ZEN4 gotoblas_ZEN
+#elif defined(DYN_HASWELL)
+#define gotoblas_ZEN4 gotoblas_HASWELL
+#elif defined(DYN_SANDYBRIDGE)
+#define gotoblas_ZEN4 gotoblas_SANDYBRIDGE
+#elif defined(DYN_NEHALEM)
+#define gotoblas_ZEN4 gotoblas_NEHALEM
+#else
+#define gotoblas_ZEN4 gotoblas_PRESCOTT
+#endif
 
 
 #else // not DYNAMIC_LIST
@@ -276,6 +293,7 @@ extern gotoblas_t  gotoblas_EXCAVATOR;
 #define gotoblas_COOPERLAKE gotoblas_SANDYBRIDGE
 #define gotoblas_ZEN gotoblas_SANDYBRIDGE
 #define gotoblas_SAPPHIRERAPIDS gotoblas_SANDYBRIDGE
+#define gotoblas_ZEN4 gotoblas_SANDYBRIDGE
 #else
 extern gotoblas_t  gotoblas_HASWELL;
 extern gotoblas_t  gotoblas_ZEN;
@@ -283,10 +301,12 @@ extern gotoblas_t  gotoblas_ZEN;
 extern gotoblas_t  gotoblas_SKYLAKEX;
 extern gotoblas_t  gotoblas_COOPERLAKE;
 extern gotoblas_t  gotoblas_SAPPHIRERAPIDS;
+extern gotoblas_t  gotoblas_ZEN4;
 #else
 #define gotoblas_SKYLAKEX gotoblas_HASWELL
 #define gotoblas_COOPERLAKE gotoblas_HASWELL
 #define gotoblas_SAPPHIRERAPIDS gotoblas_HASWELL
+#define gotoblas_ZEN4 gotoblas_ZEN
 #endif
 #endif
 #else
@@ -296,6 +316,7 @@ extern gotoblas_t  gotoblas_SAPPHIRERAPIDS;
 #define gotoblas_SKYLAKEX gotoblas_NEHALEM
 #define gotoblas_COOPERLAKE gotoblas_NEHALEM
 #define gotoblas_SAPPHIRERAPIDS gotoblas_NEHALEM
+#define gotoblas_ZEN4 gotoblas_NEHALEM
 #define gotoblas_BULLDOZER gotoblas_BARCELONA
 #define gotoblas_PILEDRIVER gotoblas_BARCELONA
 #define gotoblas_STEAMROLLER gotoblas_BARCELONA
@@ -900,9 +921,10 @@ static gotoblas_t *get_coretype(void){
 	    openblas_warning(FALLBACK_VERBOSE, BARCELONA_FALLBACK);
 	    return &gotoblas_BARCELONA; //OS doesn't support AVX. Use old kernels.
           }
-      } else if (exfamily == 10) {
+      } else if (exfamily == 10 || exfamily == 11) {
+	  /* Zen 4 / Zen 5 */
 	  if(support_avx512_bf16())
-	    return &gotoblas_COOPERLAKE;
+	    return &gotoblas_ZEN4;
 	  if(support_avx512())
 	    return &gotoblas_SKYLAKEX;
 	  if(support_avx())
@@ -987,7 +1009,8 @@ static char *corename[] = {
     "Zen",
     "SkylakeX",
     "Cooperlake",
-    "SapphireRapids"
+    "SapphireRapids",
+    "Zen4"
 };
 
 char *gotoblas_corename(void) {
@@ -1053,6 +1076,7 @@ char *gotoblas_corename(void) {
   if (gotoblas == &gotoblas_SKYLAKEX)     return corename[24];
   if (gotoblas == &gotoblas_COOPERLAKE)   return corename[25];
   if (gotoblas == &gotoblas_SAPPHIRERAPIDS) return corename[26];
+  if (gotoblas == &gotoblas_ZEN4)         return corename[27];
   return corename[0];
 }
 
@@ -1065,7 +1089,7 @@ static gotoblas_t *force_coretype(char *coretype){
 	char message[128];
 	//char mname[20];
 
-	for ( i=1 ; i <= 25; i++)
+	for ( i=1 ; i <= 27; i++)
 	{
 		if (!strncasecmp(coretype,corename[i],20))
 		{
@@ -1083,6 +1107,8 @@ static gotoblas_t *force_coretype(char *coretype){
 
 	switch (found)
 	{
+		case 27: return (&gotoblas_ZEN4);
+		case 26: return (&gotoblas_SAPPHIRERAPIDS);
 		case 25: return (&gotoblas_COOPERLAKE);
 		case 24: return (&gotoblas_SKYLAKEX);	
 		case 23: return (&gotoblas_ZEN);
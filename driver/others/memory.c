@@ -1378,6 +1378,13 @@ void blas_shutdown(void){
   BLASFUNC(blas_thread_shutdown)();
 #endif
 
+#if (BUILD_SINGLE == 1)
+  sgemm_strassen_release();
+#endif
+#if (BUILD_DOUBLE == 1)
+  dgemm_strassen_release();
+#endif
+
 #ifdef SMP
   /* Only cleanupIf we were built for threading and TLS was initialized */
   if (local_storage_key)
@@ -3222,6 +3229,13 @@ void blas_shutdown(void){
   BLASFUNC(blas_thread_shutdown)();
 #endif
 
+#if (BUILD_SINGLE == 1)
+  sgemm_strassen_release();
+#endif
+#if (BUILD_DOUBLE == 1)
+  dgemm_strassen_release();
+#endif
+
   LOCK_COMMAND(&alloc_lock);
 
   for (pos = 0; pos < release_pos; pos ++) {
@@ -21,7 +21,7 @@
     chbmv,chemm,chemv,cher2,cher2k,cher,cherk,scabs1,scamax,
     chpmv,chpr2,chpr,crotg,cscal,csrot,csscal,cswap,scamin,scasum,scnrm2,
     csymm,csyr2k,csyrk,ctbmv,ctbsv,ctpmv,ctpsv,ctrmm,ctrmv,ctrsm,
-    ctrsv,icamax,icamin,cimatcopy,comatcopy,cgeadd,scsum,cgemmt);
+    ctrsv,icamax,icamin,cimatcopy,comatcopy,cgeadd,scsum,cgemmt,cgescal,cgeset);
     
 @blasobjsd = (
     damax,damin,dasum,daxpy,daxpby,dcabs1,dcopy,ddot,dgbmv,dgemm,
@@ -29,7 +29,7 @@
     dscal,dsdot,dspmv,dspr2,dimatcopy,domatcopy,
     dspr,dswap,dsymm,dsymv,dsyr2,dsyr2k,dsyr,dsyrk,dtbmv,dtbsv,
     dtpmv,dtpsv,dtrmm,dtrmv,dtrsm,dtrsv,
-        idamax,idamin,idmax,idmin,dgeadd,dsum,dgemmt);
+        idamax,idamin,idmax,idmin,dgeadd,dsum,dgemmt,dgescal,dgeset);
     
 @blasobjss = (
     isamax,isamin,ismax,ismin,
@@ -38,7 +38,8 @@
     smax,smin,snrm2,simatcopy,somatcopy,
     srot,srotg,srotm,srotmg,ssbmv,sscal,sspmv,sspr2,sspr,sswap,
     ssymm,ssymv,ssyr2,ssyr2k,ssyr,ssyrk,stbmv,stbsv,stpmv,stpsv,
-    strmm,strmv,strsm,strsv, sgeadd,ssum,sgemmt);
+    strmm,strmv,strsm,strsv, sgeadd,ssum,sgemmt,sgescal,sgeset,
+    shgemm,shgemv,shstohf16,shdtohf16,shf16tos,dhf16tod);
      
 @blasobjsz = (
     izamax,izamin,,
@@ -48,10 +49,11 @@
     zhpr,zrotg,zscal,zswap,zsymm,zsyr2k,zsyrk,ztbmv,
     ztbsv,ztpmv,ztpsv,ztrmm,ztrmv,ztrsm,ztrsv,
     zomatcopy, zimatcopy,dzamax,dzamin,dzasum,dznrm2,
-    zgeadd, dzsum, zgemmt);
+    zgeadd, dzsum, zgemmt, zgescal, zgeset);
 
 @blasobjs = (lsame, xerbla);
 @bfblasobjs = (sbgemm, sbgemv, sbdot, sbstobf16, sbdtobf16, sbf16tos, dbf16tod);
+@bflapackobjsd = (dsbgesv);
 @cblasobjsc = (
     cblas_caxpy, cblas_ccopy, cblas_cdotc, cblas_cdotu, cblas_cgbmv, cblas_cgemm, cblas_cgemv,
     cblas_cgerc, cblas_cgeru, cblas_chbmv, cblas_chemm, cblas_chemv, cblas_cher2, cblas_cher2k,
@@ -60,7 +62,7 @@
     cblas_ctbsv, cblas_ctpmv, cblas_ctpsv, cblas_ctrmm, cblas_ctrmv, cblas_ctrsm, cblas_ctrsv, 
     cblas_scnrm2, cblas_scasum,
     cblas_icamax, cblas_icamin, cblas_icmin, cblas_icmax, cblas_scsum,cblas_cimatcopy,cblas_comatcopy
-    cblas_cgemmt);
+    cblas_cgemmt, cblas_cgescal, cblas_cgeset);
 @cblasobjsd = (
     cblas_dasum, cblas_daxpy, cblas_dcopy, cblas_ddot,
     cblas_dgbmv, cblas_dgemm, cblas_dgemv, cblas_dger, cblas_dnrm2,
@@ -69,7 +71,7 @@
     cblas_dsyr2k, cblas_dsyr, cblas_dsyrk, cblas_dtbmv, cblas_dtbsv, cblas_dtpmv, cblas_dtpsv,
     cblas_dtrmm, cblas_dtrmv, cblas_dtrsm, cblas_dtrsv, cblas_daxpby, cblas_dgeadd,
     cblas_idamax, cblas_idamin, cblas_idmin, cblas_idmax, cblas_dsum,cblas_dimatcopy,cblas_domatcopy
-    cblas_dgemmt);
+    cblas_dgemmt, cblas_dgescal, cblas_dgeset, cblas_dgemm_epilogue, cblas_dgemm_strassen);
     
 @cblasobjss = (
     cblas_sasum, cblas_saxpy, cblas_saxpby,
@@ -80,7 +82,8 @@
     cblas_stbmv, cblas_stbsv, cblas_stpmv, cblas_stpsv, cblas_strmm, cblas_strmv, cblas_strsm,
     cblas_strsv, cblas_sgeadd,
     cblas_isamax, cblas_isamin, cblas_ismin, cblas_ismax, cblas_ssum,cblas_simatcopy,cblas_somatcopy
-    cblas_sgemmt);
+    cblas_sgemmt, cblas_sgescal, cblas_sgeset, cblas_sgemm_epilogue, cblas_sgemm_strassen, cblas_gemm_s8u8s32,
+    cblas_shgemm, cblas_shgemv, cblas_shstohf16, cblas_shdtohf16, cblas_shf16tos, cblas_dhf16tod);
 @cblasobjsz = (
     cblas_dzasum, cblas_dznrm2, cblas_zaxpy, cblas_zcopy, cblas_zdotc, cblas_zdotu, cblas_zdscal,
     cblas_zgbmv, cblas_zgemm, cblas_zgemv, cblas_zgerc, cblas_zgeru, cblas_zhbmv, cblas_zhemm,
@@ -90,7 +93,7 @@
     cblas_ztrsv, cblas_cdotc_sub, cblas_cdotu_sub, cblas_zdotc_sub, cblas_zdotu_sub,
     cblas_zaxpby, cblas_zgeadd,
     cblas_izamax, cblas_izamin, cblas_izmin, cblas_izmax, cblas_dzsum,cblas_zimatcopy,cblas_zomatcopy
-    cblas_zgemmt);
+    cblas_zgemmt, cblas_zgescal, cblas_zgeset);
 
 @cblasobjs = (  cblas_xerbla );
 
@@ -165,6 +168,19 @@
     strti2,
     strtri,
     spotri,
+    sgeqrf,
+    ssytrf,
+    sgetri,
+    sgetrf_batch,
+    sgetrf_batch_strided,
+    spotrf_batch,
+    spotrf_batch_strided,
+    sgetrs_batch,
+    sgetrs_batch_strided,
+    sgbtrf,
+    spbtrf,
+    sormqr,
+    ssyevd,
 );
 
 @lapackobjsd = (
@@ -180,6 +196,21 @@
  dtrti2, 
  dtrtri, 
  dpotri, 
+ dgeqrf,
+ dsytrf,
+ dgetri,
+ dsgesv,
+ dsposv,
+ dgetrf_batch,
+ dgetrf_batch_strided,
+ dpotrf_batch,
+ dpotrf_batch_strided,
+ dgetrs_batch,
+ dgetrs_batch_strided,
+ dgbtrf,
+ dpbtrf,
+ dormqr,
+ dsyevd,
 );
 
 @lapackobjsc = (
@@ -195,6 +226,7 @@ cpotrf,
 ctrti2, 
 ctrtri, 
 cpotri, 
+cgetri,
 );
 
 @lapackobjsz = (
@@ -210,6 +242,7 @@ zpotrf,
 ztrti2,
 ztrtri,
 zpotri,
+zgetri,
 );
 
 
@@ -276,13 +309,13 @@ zpotri,
     # already provided by @lapackobjs:
     #     sgesv, sgetf2, slaswp, slauu2, slauum, spotf2, spotri, strti2, strtri
     sgbbrd, sgbcon, sgbequ, sgbrfs, sgbsv,
-    sgbsvx, sgbtf2, sgbtrf, sgbtrs, sgebak, sgebal, sgebd2,
+    sgbsvx, sgbtf2, sgbtrs, sgebak, sgebal, sgebd2,
     sgebrd, sgecon, sgeequ, sgees,  sgeesx, sgeev,  sgeevx,
     sgehd2, sgehrd, sgelq2, sgelqf,
     sgels,  sgelsd, sgelss, sgelsy, sgeql2, sgeqlf,
-    sgeqp3, sgeqr2, sgeqr2p, sgeqrf, sgeqrfp, sgerfs,
+    sgeqp3, sgeqr2, sgeqr2p, sgeqrfp, sgerfs,
     sgerq2, sgerqf, sgesc2, sgesdd, sgesvd, sgesvx,
-    sgetc2, sgetri,
+    sgetc2,
     sggbak, sggbal, sgges,  sggesx, sggev,  sggevx,
     sggglm, sgghrd, sgglse, sggqrf,
     sggrqf, sgtcon, sgtrfs, sgtsv,
@@ -303,10 +336,10 @@ zpotri,
     sopgtr, sopmtr, sorg2l, sorg2r,
     sorgbr, sorghr, sorgl2, sorglq, sorgql, sorgqr, sorgr2,
     sorgrq, sorgtr, sorm2l, sorm2r,
-    sormbr, sormhr, sorml2, sormlq, sormql, sormqr, sormr2,
+    sormbr, sormhr, sorml2, sormlq, sormql, sormr2,
     sormr3, sormrq, sormrz, sormtr, spbcon, spbequ, spbrfs,
     spbstf, spbsv,  spbsvx,
-    spbtf2, spbtrf, spbtrs, spocon, spoequ, sporfs, sposv,
+    spbtf2, spbtrs, spocon, spoequ, sporfs, sposv,
     sposvx, spstrf, spstf2,
     sppcon, sppequ,
     spprfs, sppsv,  sppsvx, spptrf, spptri, spptrs, sptcon,
@@ -316,9 +349,9 @@ zpotri,
     sspgv,  sspgvd, sspgvx, ssprfs, sspsv,  sspsvx, ssptrd,
     ssptrf, ssptri, ssptrs, sstegr, sstein, sstev,  sstevd, sstevr,
     sstevx,
-    ssycon, ssyev,  ssyevd, ssyevr, ssyevx, ssygs2,
+    ssycon, ssyev,  ssyevr, ssyevx, ssygs2,
     ssygst, ssygv,  ssygvd, ssygvx, ssyrfs, ssysv,  ssysvx,
-    ssytd2, ssytf2, ssytrd, ssytrf, ssytri, ssytri2, ssytri2x,
+    ssytd2, ssytf2, ssytrd, ssytri, ssytri2, ssytri2x,
     ssyswapr, ssytrs, ssytrs2, ssyconv,
     stbcon,
     stbrfs, stbtrs, stgevc, stgex2, stgexc, stgsen,
@@ -358,7 +391,7 @@ zpotri,
     cgels,  cgelsd, cgelss, cgelsy, cgeql2, cgeqlf, cgeqp3,
     cgeqr2, cgeqr2p, cgeqrf, cgeqrfp, cgerfs,
     cgerq2, cgerqf, cgesc2, cgesdd, cgesvd,
-    cgesvx, cgetc2, cgetri,
+    cgesvx, cgetc2,
     cggbak, cggbal, cgges,  cggesx, cggev,  cggevx, cggglm,
     cgghrd, cgglse, cggqrf, cggrqf,
     cgtcon, cgtrfs, cgtsv,  cgtsvx, cgttrf, cgttrs, cgtts2, chbev,
@@ -431,13 +464,13 @@ zpotri,
     #     dgesv, dgetf2, dgetrs, dlaswp, dlauu2, dlauum, dpotf2, dpotrf, dpotri,
     #     dtrti2, dtrtri
     dgbbrd, dgbcon, dgbequ, dgbrfs, dgbsv,
-    dgbsvx, dgbtf2, dgbtrf, dgbtrs, dgebak, dgebal, dgebd2,
+    dgbsvx, dgbtf2, dgbtrs, dgebak, dgebal, dgebd2,
     dgebrd, dgecon, dgeequ, dgees,  dgeesx, dgeev,  dgeevx,
     dgehd2, dgehrd, dgelq2, dgelqf,
     dgels,  dgelsd, dgelss, dgelsy, dgeql2, dgeqlf,
-    dgeqp3, dgeqr2, dgeqr2p, dgeqrf, dgeqrfp, dgerfs,
+    dgeqp3, dgeqr2, dgeqr2p, dgeqrfp, dgerfs,
     dgerq2, dgerqf, dgesc2, dgesdd, dgesvd, dgesvx,
-    dgetc2, dgetri,
+    dgetc2,
     dggbak, dggbal, dgges,  dggesx, dggev,  dggevx,
     dggglm, dgghrd, dgglse, dggqrf,
     dggrqf, dgtcon, dgtrfs, dgtsv,
@@ -458,10 +491,10 @@ zpotri,
     dopgtr, dopmtr, dorg2l, dorg2r,
     dorgbr, dorghr, dorgl2, dorglq, dorgql, dorgqr, dorgr2,
     dorgrq, dorgtr, dorm2l, dorm2r,
-    dormbr, dormhr, dorml2, dormlq, dormql, dormqr, dormr2,
+    dormbr, dormhr, dorml2, dormlq, dormql, dormr2,
     dormr3, dormrq, dormrz, dormtr, dpbcon, dpbequ, dpbrfs,
     dpbstf, dpbsv,  dpbsvx,
-    dpbtf2, dpbtrf, dpbtrs, dpocon, dpoequ, dporfs, dposv,
+    dpbtf2, dpbtrs, dpocon, dpoequ, dporfs, dposv,
     dposvx, dpotrs, dpstrf, dpstf2,
     dppcon, dppequ,
     dpprfs, dppsv,  dppsvx, dpptrf, dpptri, dpptrs, dptcon,
@@ -471,17 +504,17 @@ zpotri,
     dspgv,  dspgvd, dspgvx, dsprfs, dspsv,  dspsvx, dsptrd,
     dsptrf, dsptri, dsptrs, dstegr, dstein, dstev,  dstevd, dstevr,
     dstevx,
-    dsycon, dsyev,  dsyevd, dsyevr,
+    dsycon, dsyev,  dsyevr,
     dsyevx, dsygs2, dsygst, dsygv,  dsygvd, dsygvx, dsyrfs,
     dsysv,  dsysvx,
-    dsytd2, dsytf2, dsytrd, dsytrf, dsytri, dsytri2, dsytri2x,
+    dsytd2, dsytf2, dsytrd, dsytri, dsytri2, dsytri2x,
     dsyswapr, dsytrs, dsytrs2, dsyconv,
     dtbcon, dtbrfs, dtbtrs, dtgevc, dtgex2, dtgexc, dtgsen,
     dtgsja, dtgsna, dtgsy2, dtgsyl, dtpcon, dtprfs, dtptri,
     dtptrs,
     dtrcon, dtrevc, dtrexc, dtrrfs, dtrsen, dtrsna, dtrsyl,
     dtrtrs, dtzrzf, dstemr,
-    dsgesv, dsposv, dlag2s, slag2d, dlat2s,
+    dlag2s, slag2d, dlat2s,
     dlansf, dpftrf, dpftri, dpftrs, dsfrk, dtfsm, dtftri, dtfttp,
     dtfttr, dtpttf, dtpttr, dtrttf, dtrttp,
     dgejsv,  dgesvj,  dgsvj0,  dgsvj1,
@@ -504,7 +537,6 @@ zpotri,
     zgels,  zgelsd, zgelss, zgelsy, zgeql2, zgeqlf, zgeqp3,
     zgeqr2, zgeqr2p, zgeqrf, zgeqrfp, zgerfs, zgerq2, zgerqf,
     zgesc2, zgesdd, zgesvd, zgesvx, zgetc2,
-    zgetri,
     zggbak, zggbal, zgges,  zggesx, zggev,  zggevx, zggglm,
     zgghrd, zgglse, zggqrf, zggrqf,
     zgtcon, zgtrfs, zgtsv,  zgtsvx, zgttrf, zgttrs, zgtts2, zhbev,
@@ -3675,6 +3707,9 @@ if ($ARGV[14] == 1) {
 	@lapacke_deprecated_objs = (@lapacke_deprecated_objs, @lapacke_deprecated_objsd);
 	@lapack_embeded_underscore_objs = (@lapack_embeded_underscore_objs,  @lapack_embeded_underscore_objs_d);
 	@lapackeobjs = (@lapackeobjs, @lapackeobjsd);
+	if ($ARGV[12] == 1) {
+		@lapackobjs = (@lapackobjs, @bflapackobjsd);
+	}
 }
 if ($ARGV[15] == 1) {
 	@blasobjs = (@blasobjs, @blasobjsc);
@@ -48,6 +48,16 @@
 #define ERROR_NAME "SGEADD "
 #endif
 
+#ifdef SMP
+#define MULTI_THREAD_MINIMAL  65536
+
+/* Columns are split across threads; C is passed as b and beta as c */
+static int geadd_thread(BLASLONG m, BLASLONG n, BLASLONG dummy, FLOAT alpha,
+			FLOAT *a, BLASLONG lda, FLOAT *c, BLASLONG ldc, FLOAT *beta, BLASLONG dummy2){
+  return GEADD_K(n, m, alpha, a, lda, *beta, c, ldc);
+}
+#endif
+
 #ifndef CBLAS
 
 void NAME(blasint *M, blasint *N, FLOAT *ALPHA, FLOAT *a, blasint *LDA,
@@ -62,6 +72,9 @@ void NAME(blasint *M, blasint *N, FLOAT *ALPHA, FLOAT *a, blasint *LDA,
   FLOAT beta  = *BETA;
 
   blasint info;
+#ifdef SMP
+  int mode, nthreads;
+#endif
 
   PRINT_DEBUG_NAME;
 
@@ -92,6 +105,9 @@ void CNAME(enum CBLAS_ORDER order,
 	   FLOAT  *c, blasint ldc){ */
 
   blasint info, t;
+#ifdef SMP
+  int mode, nthreads;
+#endif
 
   PRINT_DEBUG_CNAME;
 
@@ -136,8 +152,31 @@ void CNAME(enum CBLAS_ORDER order,
   FUNCTION_PROFILE_START();
 
 
+#ifdef SMP
+  if ((BLASLONG)m * (BLASLONG)n < MULTI_THREAD_MINIMAL)
+    nthreads = 1;
+  else
+    nthreads = num_cpu_avail(3);
+
+  if (nthreads == 1) {
+#endif
+
   GEADD_K(m,n,alpha, a, lda, beta, c, ldc); 
 
+#ifdef SMP
+  } else {
+
+#ifdef DOUBLE
+    mode = BLAS_DOUBLE | BLAS_REAL;
+#else
+    mode = BLAS_SINGLE | BLAS_REAL;
+#endif
+
+    blas_level1_thread(mode, n, m, 0, &alpha, a, lda, c, ldc, &beta, 0,
+		       (int (*)(void))geadd_thread, nthreads);
+  }
+#endif
+
 
   FUNCTION_PROFILE_END(1, 2* m * n ,  2 * m * n);
 
@@ -47,10 +47,16 @@
 #define SMP_THRESHOLD_MIN 65536.0
 #ifdef XDOUBLE
 #define ERROR_NAME "QGEMM "
+#elif defined(DOUBLE) && defined(STRASSEN)
+#define ERROR_NAME "DGEMM_STRASSEN "
 #elif defined(DOUBLE)
 #define ERROR_NAME "DGEMM "
 #elif defined(BFLOAT16)
 #define ERROR_NAME "SBGEMM "
+#elif defined(HFLOAT16)
+#define ERROR_NAME "SHGEMM "
+#elif defined(STRASSEN)
+#define ERROR_NAME "SGEMM_STRASSEN "
 #else
 #define ERROR_NAME "SGEMM "
 #endif
@@ -79,7 +85,20 @@
 #define GEMM_MULTITHREAD_THRESHOLD 4
 #endif
 
-static int (*gemm[])(blas_arg_t *, BLASLONG *, BLASLONG *, IFLOAT *, IFLOAT *, BLASLONG) = {
+#if defined(SMP) && defined(GEMM_SPLIT_K) && !defined(GEMM3M)
+#define USE_SPLIT_K
+/* K has to be this many times max(M, N) before the threads split K instead of C */
+#ifndef GEMM_SPLIT_K_RATIO
+#define GEMM_SPLIT_K_RATIO 16
+#endif
+#endif
+
+#if defined(SMP) && !defined(USE_SIMPLE_THREADED_LEVEL3) && !defined(GEMM3M) \
+    && !defined(XDOUBLE) && !defined(BFLOAT16) && !defined(HFLOAT16)
+#define USE_GEMM_NUMA
+#endif
+
+static int (*gemm[])(blas_arg_t *, BLASLONG *, BLASLONG *, XFLOAT *, XFLOAT *, BLASLONG) = {
 #ifndef GEMM3M
   GEMM_NN, GEMM_TN, GEMM_RN, GEMM_CN,
   GEMM_NT, GEMM_TT, GEMM_RT, GEMM_CT,
@@ -105,7 +124,27 @@ static int (*gemm[])(blas_arg_t *, BLASLONG *, BLASLONG *, IFLOAT *, IFLOAT *, B
 #endif
 };
 
-#if defined(SMALL_MATRIX_OPT) && !defined(GEMM3M) && !defined(XDOUBLE)
+#if !defined(COMPLEX) && !defined(XDOUBLE) && !defined(BFLOAT16) && !defined(HFLOAT16)
+#define USE_STRASSEN
+
+extern int openblas_gemm_strassen(void);
+
+/* OPENBLAS_GEMM_STRASSEN is 0 for off, 1 for the default crossover or the crossover itself;
+   cblas_?gemm_strassen always asks for the fast algorithm */
+#ifdef STRASSEN
+#define STRASSEN_CROSSOVER MAX(openblas_gemm_strassen(), 1)
+#else
+#define STRASSEN_CROSSOVER openblas_gemm_strassen()
+#endif
+
+#if defined(SMP) && !defined(USE_SIMPLE_THREADED_LEVEL3)
+#define STRASSEN_DRIVERS (gemm + ((args.nthreads > 1) ? 16 : 0))
+#else
+#define STRASSEN_DRIVERS gemm
+#endif
+#endif
+
+#if defined(SMALL_MATRIX_OPT) && !defined(GEMM3M) && !defined(XDOUBLE) && !defined(HFLOAT16)
 #define USE_SMALL_MATRIX_OPT 1
 #else
 #define USE_SMALL_MATRIX_OPT 0
@@ -187,12 +226,12 @@ void NAME(char *TRANSA, char *TRANSB,
   blasint info;
 
   char transA, transB;
-  IFLOAT *buffer;
-  IFLOAT *sa, *sb;
+  XFLOAT *buffer;
+  XFLOAT *sa, *sb;
 
 #ifdef SMP
   double MNK;
-#if defined(USE_SIMPLE_THREADED_LEVEL3) || !defined(NO_AFFINITY)
+#if defined(USE_SIMPLE_THREADED_LEVEL3) || !defined(NO_AFFINITY) || defined(USE_SPLIT_K) || defined(USE_GEMM_NUMA)
 #ifndef COMPLEX
 #ifdef XDOUBLE
   int mode  =  BLAS_XDOUBLE | BLAS_REAL;
@@ -213,7 +252,7 @@ void NAME(char *TRANSA, char *TRANSB,
 #endif
 #endif
 
-#if defined(SMP) && !defined(NO_AFFINITY) && !defined(USE_SIMPLE_THREADED_LEVEL3)
+#if defined(SMP) && (!defined(NO_AFFINITY) || defined(USE_GEMM_NUMA)) && !defined(USE_SIMPLE_THREADED_LEVEL3)
   int nodes;
 #endif
 
@@ -316,7 +355,7 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 
 #ifdef SMP
   double MNK;
-#if defined(USE_SIMPLE_THREADED_LEVEL3) || !defined(NO_AFFINITY)
+#if defined(USE_SIMPLE_THREADED_LEVEL3) || !defined(NO_AFFINITY) || defined(USE_SPLIT_K) || defined(USE_GEMM_NUMA)
 #ifndef COMPLEX
 #ifdef XDOUBLE
   int mode  =  BLAS_XDOUBLE | BLAS_REAL;
@@ -337,13 +376,13 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 #endif
 #endif
 
-#if defined(SMP) && !defined(NO_AFFINITY) && !defined(USE_SIMPLE_THREADED_LEVEL3)
+#if defined(SMP) && (!defined(NO_AFFINITY) || defined(USE_GEMM_NUMA)) && !defined(USE_SIMPLE_THREADED_LEVEL3)
   int nodes;
 #endif
 
   PRINT_DEBUG_CNAME;
 
-#if !defined(COMPLEX) && !defined(DOUBLE) && !defined(BFLOAT16) && defined(USE_SGEMM_KERNEL_DIRECT)
+#if !defined(COMPLEX) && !defined(DOUBLE) && !defined(BFLOAT16) && !defined(HFLOAT16) && defined(USE_SGEMM_KERNEL_DIRECT)
 #ifdef DYNAMIC_ARCH
  if (support_avx512() )
 #endif  
@@ -499,6 +538,11 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 
 #if USE_SMALL_MATRIX_OPT
 #if !defined(COMPLEX)
+#ifdef GEMM_SMALL_KERNEL_FIXED
+  /* shapes with a specialised kernel are done without asking the permit function */
+  if(GEMM_SMALL_KERNEL_FIXED(transa, transb, args.m, args.n, args.k, args.a, args.lda, *(FLOAT *)(args.alpha), args.b, args.ldb, *(FLOAT *)(args.beta), args.c, args.ldc))
+	  return;
+#endif
   if(GEMM_SMALL_MATRIX_PERMIT(transa, transb, args.m, args.n, args.k, *(FLOAT *)(args.alpha), *(FLOAT *)(args.beta))){
 	  if(*(FLOAT *)(args.beta) == 0.0){
 		(GEMM_SMALL_KERNEL_B0((transb << 2) | transa))(args.m, args.n, args.k, args.a, args.lda, *(FLOAT *)(args.alpha), args.b, args.ldb, args.c, args.ldc);
@@ -546,7 +590,17 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
   }
 
   args.common = NULL;
+#endif
 
+#ifdef USE_STRASSEN
+  if ((STRASSEN_CROSSOVER > 0)
+      && (GEMM_STRASSEN(transa, transb, &args, STRASSEN_DRIVERS, sa, sb, STRASSEN_CROSSOVER) == 0)) {
+
+	/* C has been updated by the Strassen-Winograd algorithm */
+
+  } else
+#endif
+#ifdef SMP
  if (args.nthreads == 1) {
 #endif
 
@@ -554,6 +608,24 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 
 #ifdef SMP
 
+#ifdef USE_SPLIT_K
+  } else if ((args.k >= GEMM_SPLIT_K_RATIO * MAX(args.m, args.n))
+	     && (args.k >= 2 * GEMM_Q * args.nthreads)
+	     && (GEMM_SPLIT_K(mode | (transa << BLAS_TRANSA_SHIFT) | (transb << BLAS_TRANSB_SHIFT),
+			      &args, NULL, NULL, gemm[(transb << 2) | transa], sa, sb, args.nthreads) == 0)) {
+
+	/* Each thread has worked on a slice of K and C has been reduced */
+
+#endif
+#ifdef USE_GEMM_NUMA
+  } else if ((nodes = gemm_numa_nodes(args.nthreads)) > 1) {
+
+	args.nthreads /= nodes;
+
+	gemm_thread_numa(mode | (transa << BLAS_TRANSA_SHIFT) | (transb << BLAS_TRANSB_SHIFT),
+			 &args, NULL, NULL, gemm[16 | (transb << 2) | transa], sa, sb, nodes);
+
+#endif
   } else {
 
 #ifndef USE_SIMPLE_THREADED_LEVEL3
@@ -0,0 +1,317 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+/*
+ * cblas_?gemm_epilogue: C := clamp(activation(alpha*op(A)*op(B) + beta*C + bias))
+ *
+ * The bias, activation and clamp are applied by the level 3 drivers to
+ * each tile of C as soon as its last block of K is done, rather than in
+ * a second sweep over C after the GEMM has returned.
+ */
+
+#ifdef DOUBLE
+#define ERROR_NAME "DGEMM_EPILOGUE "
+#else
+#define ERROR_NAME "SGEMM_EPILOGUE "
+#endif
+
+#define SMP_THRESHOLD_MIN 65536.0
+
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
+static int (*gemm[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  GEMM_EPILOGUE_NN, GEMM_EPILOGUE_TN, GEMM_EPILOGUE_NT, GEMM_EPILOGUE_TT,
+#if defined(SMP) && !defined(USE_SIMPLE_THREADED_LEVEL3)
+  GEMM_EPILOGUE_THREAD_NN, GEMM_EPILOGUE_THREAD_TN, GEMM_EPILOGUE_THREAD_NT, GEMM_EPILOGUE_THREAD_TT,
+#endif
+};
+
+#if defined(SMALL_MATRIX_OPT)
+#ifndef DYNAMIC_ARCH
+#define SMALL_KERNEL_ADDR(table, idx) ((void *)(table[idx]))
+#else
+#define SMALL_KERNEL_ADDR(table, idx) ((void *)(*(uintptr_t *)((char *)gotoblas + (size_t)(table[idx]))))
+#endif
+
+static size_t gemm_small_kernel[] = {
+	GEMM_SMALL_KERNEL_NN, GEMM_SMALL_KERNEL_TN, 0, 0,
+	GEMM_SMALL_KERNEL_NT, GEMM_SMALL_KERNEL_TT, 0, 0,
+};
+
+static size_t gemm_small_kernel_b0[] = {
+	GEMM_SMALL_KERNEL_B0_NN, GEMM_SMALL_KERNEL_B0_TN, 0, 0,
+	GEMM_SMALL_KERNEL_B0_NT, GEMM_SMALL_KERNEL_B0_TT, 0, 0,
+};
+
+#define GEMM_SMALL_KERNEL_B0(idx) (int (*)(BLASLONG, BLASLONG, BLASLONG, FLOAT *, BLASLONG, FLOAT, FLOAT *, BLASLONG, FLOAT *, BLASLONG)) SMALL_KERNEL_ADDR(gemm_small_kernel_b0, (idx))
+#define GEMM_SMALL_KERNEL(idx) (int (*)(BLASLONG, BLASLONG, BLASLONG, FLOAT *, BLASLONG, FLOAT, FLOAT *, BLASLONG, FLOAT, FLOAT *, BLASLONG)) SMALL_KERNEL_ADDR(gemm_small_kernel, (idx))
+#endif
+
+void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+	   blasint m, blasint n, blasint k,
+	   FLOAT alpha,
+	   FLOAT *a, blasint lda,
+	   FLOAT *b, blasint ldb,
+	   FLOAT beta,
+	   FLOAT *c, blasint ldc,
+	   openblas_gemm_epilogue *epilogue) {
+
+  blas_arg_t args;
+  gemm_epilogue_t epi;
+  int transa, transb;
+  blasint nrowa, nrowb, info;
+
+  FLOAT *buffer;
+  FLOAT *sa, *sb;
+
+#ifdef SMP
+  double MNK;
+#if defined(USE_SIMPLE_THREADED_LEVEL3) || !defined(NO_AFFINITY)
+#ifdef DOUBLE
+  int mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  int mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#endif
+#endif
+
+#if defined(SMP) && !defined(NO_AFFINITY) && !defined(USE_SIMPLE_THREADED_LEVEL3)
+  int nodes;
+#endif
+
+  PRINT_DEBUG_CNAME;
+
+  args.alpha = (void *)&alpha;
+  args.beta  = (void *)&beta;
+
+  epi.bias       = NULL;
+  epi.bias_type  = 0;
+  epi.activation = 0;
+  epi.clamp      = 0;
+  epi.clamp_min  = 0.;
+  epi.clamp_max  = 0.;
+
+  transa = -1;
+  transb = -1;
+  info   =  0;
+
+  if (order == CblasColMajor) {
+    args.m = m;
+    args.n = n;
+    args.k = k;
+
+    args.a = (void *)a;
+    args.b = (void *)b;
+    args.c = (void *)c;
+
+    args.lda = lda;
+    args.ldb = ldb;
+    args.ldc = ldc;
+
+    if (TransA == CblasNoTrans)     transa = 0;
+    if (TransA == CblasTrans)       transa = 1;
+    if (TransA == CblasConjNoTrans) transa = 0;
+    if (TransA == CblasConjTrans)   transa = 1;
+    if (TransB == CblasNoTrans)     transb = 0;
+    if (TransB == CblasTrans)       transb = 1;
+    if (TransB == CblasConjNoTrans) transb = 0;
+    if (TransB == CblasConjTrans)   transb = 1;
+
+    if (epilogue) {
+      if (epilogue -> bias_type == CblasRowBias) epi.bias_type = EPILOGUE_BIAS_ROW;
+      if (epilogue -> bias_type == CblasColBias) epi.bias_type = EPILOGUE_BIAS_COL;
+    }
+  }
+
+  if (order == CblasRowMajor) {
+    args.m = n;
+    args.n = m;
+    args.k = k;
+
+    args.a = (void *)b;
+    args.b = (void *)a;
+    args.c = (void *)c;
+
+    args.lda = ldb;
+    args.ldb = lda;
+    args.ldc = ldc;
+
+    if (TransB == CblasNoTrans)     transa = 0;
+    if (TransB == CblasTrans)       transa = 1;
+    if (TransB == CblasConjNoTrans) transa = 0;
+    if (TransB == CblasConjTrans)   transa = 1;
+    if (TransA == CblasNoTrans)     transb = 0;
+    if (TransA == CblasTrans)       transb = 1;
+    if (TransA == CblasConjNoTrans) transb = 0;
+    if (TransA == CblasConjTrans)   transb = 1;
+
+    /* the rows of a row major C are the columns of the column major C */
+    if (epilogue) {
+      if (epilogue -> bias_type == CblasRowBias) epi.bias_type = EPILOGUE_BIAS_COL;
+      if (epilogue -> bias_type == CblasColBias) epi.bias_type = EPILOGUE_BIAS_ROW;
+    }
+  }
+
+  if (epilogue) {
+    epi.bias = (void *)epilogue -> bias;
+    if (epilogue -> activation == CblasReLU)     epi.activation = EPILOGUE_RELU;
+    if (epilogue -> activation == CblasGELU)     epi.activation = EPILOGUE_GELU;
+    if (epilogue -> activation == CblasGELUTanh) epi.activation = EPILOGUE_GELU_TANH;
+    epi.clamp     = (epilogue -> clamp != 0);
+    epi.clamp_min = epilogue -> clamp_min;
+    epi.clamp_max = epilogue -> clamp_max;
+  }
+
+  if (order == CblasColMajor || order == CblasRowMajor) {
+    nrowa = args.m;
+    if (transa & 1) nrowa = args.k;
+    nrowb = args.k;
+    if (transb & 1) nrowb = args.n;
+
+    info = -1;
+
+    if (epilogue) {
+      if (epilogue -> bias_type != CblasNoBias && epi.bias_type == 0) info = 14;
+      if (epilogue -> bias_type != CblasNoBias && epi.bias == NULL)   info = 14;
+      if (epilogue -> activation != CblasNoActivation && epi.activation == 0) info = 14;
+      if (epi.clamp && !(epi.clamp_min <= epi.clamp_max))             info = 14;
+    }
+    if (args.ldc < args.m) info = 13;
+    if (args.ldb < nrowb)  info = 10;
+    if (args.lda < nrowa)  info =  8;
+    if (args.k < 0)        info =  5;
+    if (args.n < 0)        info =  4;
+    if (args.m < 0)        info =  3;
+    if (transb < 0)        info =  2;
+    if (transa < 0)        info =  1;
+  }
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if ((args.m == 0) || (args.n == 0)) return;
+
+  args.epilogue = &epi;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+#if defined(SMALL_MATRIX_OPT)
+  if(GEMM_SMALL_MATRIX_PERMIT(transa, transb, args.m, args.n, args.k, alpha, beta)){
+	  if(beta == 0.0){
+		(GEMM_SMALL_KERNEL_B0((transb << 2) | transa))(args.m, args.n, args.k, args.a, args.lda, alpha, args.b, args.ldb, args.c, args.ldc);
+	  }else{
+		(GEMM_SMALL_KERNEL((transb << 2) | transa))(args.m, args.n, args.k, args.a, args.lda, alpha, args.b, args.ldb, beta, args.c, args.ldc);
+	  }
+	  GEMM_EPILOGUE(args.m, args.n, 0, 0, (FLOAT *)args.c, args.ldc, &epi);
+	  return;
+  }
+#endif
+
+  buffer = (FLOAT *)blas_memory_alloc(0);
+
+  sa = (FLOAT *)((BLASLONG)buffer +GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+
+#ifdef SMP
+#if defined(USE_SIMPLE_THREADED_LEVEL3) || !defined(NO_AFFINITY)
+  mode |= (transa << BLAS_TRANSA_SHIFT);
+  mode |= (transb << BLAS_TRANSB_SHIFT);
+#endif
+
+  MNK = (double) args.m * (double) args.n * (double) args.k;
+  if ( MNK <= (SMP_THRESHOLD_MIN  * (double) GEMM_MULTITHREAD_THRESHOLD)  )
+	args.nthreads = 1;
+  else {
+	args.nthreads = num_cpu_avail(3);
+	if (MNK/args.nthreads < SMP_THRESHOLD_MIN*(double)GEMM_MULTITHREAD_THRESHOLD)
+		args.nthreads = MNK/(SMP_THRESHOLD_MIN*(double)GEMM_MULTITHREAD_THRESHOLD);
+  }
+
+  args.common = NULL;
+
+ if (args.nthreads == 1) {
+#endif
+
+    (gemm[(transb << 1) | transa])(&args, NULL, NULL, sa, sb, 0);
+
+#ifdef SMP
+
+  } else {
+
+#ifndef USE_SIMPLE_THREADED_LEVEL3
+
+#ifndef NO_AFFINITY
+      nodes = get_num_nodes();
+
+      if ((nodes > 1) && get_node_equal()) {
+
+	args.nthreads /= nodes;
+
+	gemm_thread_mn(mode, &args, NULL, NULL, gemm[4 | (transb << 1) | transa], sa, sb, nodes);
+
+      } else {
+#endif
+
+	(gemm[4 | (transb << 1) | transa])(&args, NULL, NULL, sa, sb, 0);
+
+#else
+
+	GEMM_THREAD(mode, &args, NULL, NULL, gemm[(transb << 1) | transa], sa, sb, args.nthreads);
+
+#endif
+
+#ifndef USE_SIMPLE_THREADED_LEVEL3
+#ifndef NO_AFFINITY
+      }
+#endif
+#endif
+
+  }
+#endif
+
+ blas_memory_free(buffer);
+
+  FUNCTION_PROFILE_END(1, args.m * args.k + args.k * args.n + args.m * args.n, 2 * args.m * args.n * args.k);
+
+  IDEBUG_END;
+
+  return;
+}
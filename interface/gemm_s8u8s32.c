@@ -0,0 +1,218 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+/*
+ * cblas_gemm_s8u8s32: C := alpha*(op(A) + ao)*(op(B) + bo) + beta*C + co
+ *
+ * A is int8, B uint8 and C int32; alpha and beta are applied in floating
+ * point and the result is rounded and saturated back to int32.  co holds
+ * a single value, one value per row of C (CblasColOffset, M entries) or
+ * one per column (CblasRowOffset, N entries); a NULL co adds nothing.
+ *
+ * The operands keep their types in either storage order, so a row major
+ * call is not turned into the transposed product like cblas_sgemm does.
+ * op(A) and op(B) are read through the opposite transpose and the driver
+ * stores to C by rows instead.
+ */
+
+#define ERROR_NAME "GEMM_S8U8S32 "
+
+#define SMP_THRESHOLD_MIN 65536.0
+
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
+static int (*i8gemm[])(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG) = {
+  I8GEMM_NN, I8GEMM_TN, I8GEMM_NT, I8GEMM_TT,
+};
+
+void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+	   enum CBLAS_OFFSET OffsetC,
+	   blasint m, blasint n, blasint k,
+	   float alpha,
+	   void *a, blasint lda, int ao,
+	   void *b, blasint ldb, int bo,
+	   float beta,
+	   int *c, blasint ldc,
+	   int *co) {
+
+  blas_arg_t args;
+  i8gemm_offset_t offset;
+  int transa, transb;
+  blasint nrowa, nrowb, nrowc, info;
+
+  void *buffer;
+  float *sa;
+
+#ifdef SMP
+  double MNK;
+  int mode = BLAS_SINGLE | BLAS_REAL;
+#endif
+
+  PRINT_DEBUG_CNAME;
+
+  args.m = m;
+  args.n = n;
+  args.k = k;
+
+  args.a = a;
+  args.b = b;
+  args.c = (void *)c;
+
+  args.lda = lda;
+  args.ldb = ldb;
+  args.ldc = ldc;
+
+  args.alpha = (void *)&alpha;
+  args.beta  = (void *)&beta;
+
+  offset.ao = ao;
+  offset.bo = bo;
+  offset.co = co;
+  offset.co_type = -1;
+  offset.c_rowmajor = 0;
+
+  if (OffsetC == CblasFixOffset) offset.co_type = I8GEMM_OFFSET_FIX;
+  if (OffsetC == CblasRowOffset) offset.co_type = I8GEMM_OFFSET_ROW;
+  if (OffsetC == CblasColOffset) offset.co_type = I8GEMM_OFFSET_COL;
+
+  transa = -1;
+  transb = -1;
+  nrowc  =  0;
+  info   =  0;
+
+  if (order == CblasColMajor) {
+    if (TransA == CblasNoTrans)     transa = 0;
+    if (TransA == CblasTrans)       transa = 1;
+    if (TransA == CblasConjNoTrans) transa = 0;
+    if (TransA == CblasConjTrans)   transa = 1;
+    if (TransB == CblasNoTrans)     transb = 0;
+    if (TransB == CblasTrans)       transb = 1;
+    if (TransB == CblasConjNoTrans) transb = 0;
+    if (TransB == CblasConjTrans)   transb = 1;
+
+    nrowc = args.m;
+  }
+
+  if (order == CblasRowMajor) {
+    if (TransA == CblasNoTrans)     transa = 1;
+    if (TransA == CblasTrans)       transa = 0;
+    if (TransA == CblasConjNoTrans) transa = 1;
+    if (TransA == CblasConjTrans)   transa = 0;
+    if (TransB == CblasNoTrans)     transb = 1;
+    if (TransB == CblasTrans)       transb = 0;
+    if (TransB == CblasConjNoTrans) transb = 1;
+    if (TransB == CblasConjTrans)   transb = 0;
+
+    offset.c_rowmajor = 1;
+    nrowc = args.n;
+  }
+
+  if (order == CblasColMajor || order == CblasRowMajor) {
+    nrowa = args.m;
+    if (transa & 1) nrowa = args.k;
+    nrowb = args.k;
+    if (transb & 1) nrowb = args.n;
+
+    info = -1;
+
+    if (args.ldc < MAX(1, nrowc)) info = 16;
+    if (args.ldb < MAX(1, nrowb)) info = 12;
+    if (args.lda < MAX(1, nrowa)) info =  9;
+    if (args.k < 0)        info =  6;
+    if (args.n < 0)        info =  5;
+    if (args.m < 0)        info =  4;
+    if (offset.co_type < 0) info = 3;
+    if (transb < 0)        info =  2;
+    if (transa < 0)        info =  1;
+  }
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if ((args.m == 0) || (args.n == 0)) return;
+
+  args.offset = &offset;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+  buffer = blas_memory_alloc(0);
+
+  sa = (float *)((BLASLONG)buffer + GEMM_OFFSET_A);
+
+#ifdef SMP
+  mode |= (transa << BLAS_TRANSA_SHIFT);
+  mode |= (transb << BLAS_TRANSB_SHIFT);
+
+  MNK = (double) args.m * (double) args.n * (double) args.k;
+  if ( MNK <= (SMP_THRESHOLD_MIN  * (double) GEMM_MULTITHREAD_THRESHOLD)  )
+	args.nthreads = 1;
+  else {
+	args.nthreads = num_cpu_avail(3);
+	if (MNK/args.nthreads < SMP_THRESHOLD_MIN*(double)GEMM_MULTITHREAD_THRESHOLD)
+		args.nthreads = MNK/(SMP_THRESHOLD_MIN*(double)GEMM_MULTITHREAD_THRESHOLD);
+  }
+
+  args.common = NULL;
+
+  if (args.nthreads == 1) {
+#endif
+
+    (i8gemm[(transb << 1) | transa])(&args, NULL, NULL, sa, NULL, 0);
+
+#ifdef SMP
+  } else {
+    /* every thread packs its own blocks, so split the wider side of C */
+    if (args.n >= args.m) {
+      gemm_thread_n(mode, &args, NULL, NULL, i8gemm[(transb << 1) | transa], sa, NULL, args.nthreads);
+    } else {
+      gemm_thread_m(mode, &args, NULL, NULL, i8gemm[(transb << 1) | transa], sa, NULL, args.nthreads);
+    }
+  }
+#endif
+
+  blas_memory_free(buffer);
+
+  FUNCTION_PROFILE_END(1, args.m * args.k + args.k * args.n + args.m * args.n, 2 * args.m * args.n * args.k);
+
+  IDEBUG_END;
+
+  return;
+}
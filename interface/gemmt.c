@@ -62,6 +62,24 @@
 #define GEMM_MULTITHREAD_THRESHOLD 4
 #endif
 
+#ifndef COMPLEX
+static int (*gemmt[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  GEMMT_UNN, GEMMT_UTN, GEMMT_UNT, GEMMT_UTT,
+  GEMMT_LNN, GEMMT_LTN, GEMMT_LNT, GEMMT_LTT,
+};
+#else
+static int (*gemmt[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  GEMMT_UNN, GEMMT_UTN, GEMMT_URN, GEMMT_UCN,
+  GEMMT_UNT, GEMMT_UTT, GEMMT_URT, GEMMT_UCT,
+  GEMMT_UNR, GEMMT_UTR, GEMMT_URR, GEMMT_UCR,
+  GEMMT_UNC, GEMMT_UTC, GEMMT_URC, GEMMT_UCC,
+  GEMMT_LNN, GEMMT_LTN, GEMMT_LRN, GEMMT_LCN,
+  GEMMT_LNT, GEMMT_LTT, GEMMT_LRT, GEMMT_LCT,
+  GEMMT_LNR, GEMMT_LTR, GEMMT_LRR, GEMMT_LCR,
+  GEMMT_LNC, GEMMT_LTC, GEMMT_LRC, GEMMT_LCC,
+};
+#endif
+
 #ifndef CBLAS
 
 void NAME(char *UPLO, char *TRANSA, char *TRANSB,
@@ -71,23 +89,37 @@ void NAME(char *UPLO, char *TRANSA, char *TRANSB,
 	  IFLOAT * b, blasint * ldB, FLOAT * Beta, FLOAT * c, blasint * ldC)
 {
 
+	blas_arg_t args;
+
 	blasint m, k;
 	blasint lda, ldb, ldc;
-	int transa, transb, uplo;
+	int transa, transb, uplo, func;
 	blasint info;
 
 	char transA, transB, Uplo;
 	blasint nrowa, nrowb;
-#if defined(COMPLEX)
-	blasint ncolb;
+
+	FLOAT *buffer;
+	FLOAT *sa, *sb;
+
+#ifdef SMP
+#ifndef COMPLEX
+#ifdef XDOUBLE
+	int mode = BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+	int mode = BLAS_DOUBLE  | BLAS_REAL;
+#else
+	int mode = BLAS_SINGLE  | BLAS_REAL;
 #endif
-	IFLOAT *buffer;
-	IFLOAT *aa, *bb;
-	FLOAT *cc;
-#if defined(COMPLEX)
-	FLOAT alpha_r, alpha_i, beta_r, beta_i;
 #else
-	FLOAT alpha, beta;
+#ifdef XDOUBLE
+	int mode = BLAS_XDOUBLE | BLAS_COMPLEX;
+#elif defined(DOUBLE)
+	int mode = BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+	int mode = BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
 #endif
 
 	PRINT_DEBUG_NAME;
@@ -95,18 +127,6 @@ void NAME(char *UPLO, char *TRANSA, char *TRANSB,
 	m = *M;
 	k = *K;
 
-#if defined(COMPLEX)
-	FLOAT *alpha = Alpha;
-	alpha_r = *(Alpha + 0);
-	alpha_i = *(Alpha + 1);
-
-	beta_r = *(Beta + 0);
-	beta_i = *(Beta + 1);
-#else
-	alpha = *Alpha;
-	beta = *Beta;
-#endif
-
 	lda = *ldA;
 	ldb = *ldB;
 	ldc = *ldC;
@@ -158,19 +178,11 @@ void NAME(char *UPLO, char *TRANSA, char *TRANSB,
 		uplo = 0;
 	if (Uplo == 'L')
 		uplo = 1;
-	
+
 	nrowa = m;
 	if (transa & 1) nrowa = k;
 	nrowb = k;
-#if defined(COMPLEX)
-	ncolb = m;
-#endif
-	if (transb & 1) {
-		nrowb = m;
-#if defined(COMPLEX)
-		ncolb = k;
-#endif
-	}
+	if (transb & 1) nrowb = m;
 
 	info = 0;
 
@@ -195,6 +207,21 @@ void NAME(char *UPLO, char *TRANSA, char *TRANSB,
 		BLASFUNC(xerbla) (ERROR_NAME, &info, sizeof(ERROR_NAME));
 		return;
 	}
+
+	args.a = (void *)a;
+	args.b = (void *)b;
+	args.c = (void *)c;
+
+	args.lda = lda;
+	args.ldb = ldb;
+	args.ldc = ldc;
+
+	args.n = m;
+	args.k = k;
+
+	args.alpha = (void *)Alpha;
+	args.beta  = (void *)Beta;
+
 #else
 
 void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
@@ -216,16 +243,35 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
 	FLOAT *B = (FLOAT *) vb;
 	FLOAT *c = (FLOAT *) vc;
 #endif
-	FLOAT *aa, *bb, *cc;
+	blas_arg_t args;
 
-	int transa, transb, uplo;
+	int transa, transb, uplo, func;
 	blasint info;
 	blasint lda, ldb;
 	FLOAT *a, *b;
-#if defined(COMPLEX)
-	blasint nrowb, ncolb;
+
+	FLOAT *buffer;
+	FLOAT *sa, *sb;
+
+#ifdef SMP
+#ifndef COMPLEX
+#ifdef XDOUBLE
+	int mode = BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+	int mode = BLAS_DOUBLE  | BLAS_REAL;
+#else
+	int mode = BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef XDOUBLE
+	int mode = BLAS_XDOUBLE | BLAS_COMPLEX;
+#elif defined(DOUBLE)
+	int mode = BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+	int mode = BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
 #endif
-	XFLOAT *buffer;
 
 	PRINT_DEBUG_CNAME;
 
@@ -276,22 +322,12 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
 
 		info = -1;
 
-		blasint nrowa;
-#if !defined(COMPLEX)
-		blasint nrowb;
-#endif
+		blasint nrowa, nrowb;
+
 		nrowa = m;
 		if (transa & 1) nrowa = k;
 		nrowb = k;
-#if defined(COMPLEX)
-		ncolb = m;
-#endif
-		if (transb & 1) {
-			nrowb = m;
-#if defined(COMPLEX)
-			ncolb = k;
-#endif
-		}
+		if (transb & 1) nrowb = m;
 
 		if (ldc < MAX(1, m))
 			info = 13;
@@ -355,23 +391,12 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
 
 		info = -1;
 
-		blasint ncola; 
-#if !defined(COMPLEX)
-		blasint ncolb;
-#endif
+		blasint ncola, ncolb;
+
 		ncola = m;
 		if (transa & 1) ncola = k;
 		ncolb = k;
-#if defined(COMPLEX)
-		nrowb = m;
-#endif
-
-		if (transb & 1) {
-#if defined(COMPLEX)
-			nrowb = k;
-#endif
-			ncolb = m;
-		}
+		if (transb & 1) ncolb = m;
 
 		if (ldc < MAX(1,m))
 			info = 13;
@@ -395,274 +420,72 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo,
 		BLASFUNC(xerbla) (ERROR_NAME, &info, sizeof(ERROR_NAME));
 		return;
 	}
-#if defined(COMPLEX)
-	FLOAT alpha_r = *(alpha + 0);
-	FLOAT alpha_i = *(alpha + 1);
 
-	FLOAT beta_r = *(beta + 0);
-	FLOAT beta_i = *(beta + 1);
-#endif
-
-#endif
-	int buffer_size;
-	blasint l;
-	blasint i, j;
-
-#ifdef SMP
-	int nthreads;
-#endif
-
-#if defined(COMPLEX)
+	args.a = (void *)a;
+	args.b = (void *)b;
+	args.c = (void *)c;
 
-#ifdef SMP
-	static int (*gemv_thread[]) (BLASLONG, BLASLONG, FLOAT *, FLOAT *,
-				     BLASLONG, FLOAT *, BLASLONG, FLOAT *,
-				     BLASLONG, FLOAT *, int) = {
-#ifdef XDOUBLE
-		xgemv_thread_n, xgemv_thread_t, xgemv_thread_r, xgemv_thread_c,
-		    xgemv_thread_o, xgemv_thread_u, xgemv_thread_s,
-		    xgemv_thread_d,
-#elif defined DOUBLE
-		zgemv_thread_n, zgemv_thread_t, zgemv_thread_r, zgemv_thread_c,
-		    zgemv_thread_o, zgemv_thread_u, zgemv_thread_s,
-		    zgemv_thread_d,
-#else
-		cgemv_thread_n, cgemv_thread_t, cgemv_thread_r, cgemv_thread_c,
-		    cgemv_thread_o, cgemv_thread_u, cgemv_thread_s,
-		    cgemv_thread_d,
-#endif
-	};
-#endif
-
-	int (*gemv[]) (BLASLONG, BLASLONG, BLASLONG, FLOAT, FLOAT, FLOAT *,
-		       BLASLONG, FLOAT *, BLASLONG, FLOAT *, BLASLONG,
-		       FLOAT *) = {
-	GEMV_N, GEMV_T, GEMV_R, GEMV_C, GEMV_O, GEMV_U, GEMV_S, GEMV_D,};
+	args.lda = lda;
+	args.ldb = ldb;
+	args.ldc = ldc;
 
-#else
+	args.n = m;
+	args.k = k;
 
-#ifdef SMP
-	static int (*gemv_thread[]) (BLASLONG, BLASLONG, FLOAT, FLOAT *,
-				     BLASLONG, FLOAT *, BLASLONG, FLOAT *,
-				     BLASLONG, FLOAT *, int) = {
-#ifdef XDOUBLE
-		qgemv_thread_n, qgemv_thread_t,
-#elif defined DOUBLE
-		dgemv_thread_n, dgemv_thread_t,
+#ifndef COMPLEX
+	args.alpha = (void *)&alpha;
+	args.beta  = (void *)&beta;
 #else
-		sgemv_thread_n, sgemv_thread_t,
-#endif
-	};
+	args.alpha = (void *)alpha;
+	args.beta  = (void *)beta;
 #endif
-	int (*gemv[]) (BLASLONG, BLASLONG, BLASLONG, FLOAT, FLOAT *, BLASLONG,
-		       FLOAT *, BLASLONG, FLOAT *, BLASLONG, FLOAT *) = {
-	GEMV_N, GEMV_T,};
 
 #endif
 
-	if (m == 0)
+	if (args.n == 0)
 		return;
 
 	IDEBUG_START;
 
-#if defined(COMPLEX)
-	if (transb > 1){
-#ifndef CBLAS
-		IMATCOPY_K_CNC(nrowb, ncolb, (FLOAT)(1.0), (FLOAT)(0.0), b, ldb);
-#else
-		if (order == CblasColMajor)
-			IMATCOPY_K_CNC(nrowb, ncolb, (FLOAT)(1.0), (FLOAT)(0.0), b, ldb);
-		if (order == CblasRowMajor)
-			IMATCOPY_K_RNC(nrowb, ncolb, (FLOAT)(1.0), (FLOAT)(0.0), b, ldb);
-#endif
-	}
-#endif
+	FUNCTION_PROFILE_START();
 
-	const blasint incb = ((transb & 1) == 0) ? 1 : ldb;
-
-	if (uplo == 1) {
-		for (i = 0; i < m; i++) {
-			j = m - i;
-
-			l = j;
-#if defined(COMPLEX)
-			aa = a + i * 2;
-			bb = b + i * ldb * 2;
-			if (transa & 1) {
-				aa = a + lda * i * 2;
-			}
-			if (transb & 1)
-				bb = b + i * 2;
-			cc = c + i * 2 * ldc + i * 2;
-#else
-			aa = a + i;
-			bb = b + i * ldb;
-			if (transa & 1) {
-				aa = a + lda * i;
-			}
-			if (transb & 1)
-				bb = b + i;
-			cc = c + i * ldc + i;
-#endif
+	buffer = (FLOAT *)blas_memory_alloc(0);
 
-#if defined(COMPLEX)
-			if (beta_r != ONE || beta_i != ZERO)
-				SCAL_K(l, 0, 0, beta_r, beta_i, cc, 1, NULL, 0,
-				       NULL, 0);
+	sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+	sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
 
-			if (alpha_r == ZERO && alpha_i == ZERO)
-				continue;
+#ifndef COMPLEX
+	func = (uplo << 2) | (transb << 1) | transa;
 #else
-			if (beta != ONE)
-				SCAL_K(l, 0, 0, beta, cc, 1, NULL, 0, NULL, 0);
-
-			if (alpha == ZERO)
-				continue;
+	func = (uplo << 4) | (transb << 2) | transa;
 #endif
 
-			IDEBUG_START;
-
-			buffer_size = 2 * (j + k) + 128 / sizeof(FLOAT);
-#ifdef WINDOWS_ABI
-			buffer_size += 160 / sizeof(FLOAT);
-#endif
-			// for alignment
-			buffer_size = (buffer_size + 3) & ~3;
-			STACK_ALLOC(buffer_size, IFLOAT, buffer);
-
-#ifdef SMP
-
-			if (1L * j * k < 2304L * GEMM_MULTITHREAD_THRESHOLD)
-				nthreads = 1;
-			else
-				nthreads = num_cpu_avail(2);
-
-			if (nthreads == 1) {
-#endif
-
-#if defined(COMPLEX)
-				if (!(transa & 1))
-				(gemv[(int)transa]) (j, k, 0, alpha_r, alpha_i,
-						     aa, lda, bb, incb, cc, 1,
-						     buffer);
-				else
-				(gemv[(int)transa]) (k, j, 0, alpha_r, alpha_i,
-						     aa, lda, bb, incb, cc, 1,
-						     buffer);
-#else
-				if (!(transa & 1))
-				(gemv[(int)transa]) (j, k, 0, alpha, aa, lda,
-						     bb, incb, cc, 1, buffer);
-				else
-				(gemv[(int)transa]) (k, j, 0, alpha, aa, lda,
-						     bb, incb, cc, 1, buffer);
-#endif
 #ifdef SMP
-			} else {
-				if (!(transa & 1))
-				(gemv_thread[(int)transa]) (j, k, alpha, aa,
-							    lda, bb, incb, cc,
-							    1, buffer,
-							    nthreads);
-				else
-				(gemv_thread[(int)transa]) (k, j, alpha, aa,
-							    lda, bb, incb, cc,
-							    1, buffer,
-							    nthreads);
-
-			}
-#endif
+	mode |= (uplo << BLAS_UPLO_SHIFT);
 
-			STACK_FREE(buffer);
-		}
-	} else {
+	args.common = NULL;
 
-		for (i = 0; i < m; i++) {
-			j = i + 1;
+	if ((double)(args.n + 1) * (double)args.n * (double)args.k <= SMP_THRESHOLD_MIN * GEMM_MULTITHREAD_THRESHOLD)
+		args.nthreads = 1;
+	else
+		args.nthreads = num_cpu_avail(3);
 
-			l = j;
-#if defined COMPLEX
-			bb = b + i * ldb * 2;
-			if (transb & 1) {
-				bb = b + i * 2;
-			}
-			cc = c + i * 2 * ldc;
-#else
-			bb = b + i * ldb;
-			if (transb & 1) {
-				bb = b + i;
-			}
-			cc = c + i * ldc;
+	if (args.nthreads == 1) {
 #endif
 
-#if defined(COMPLEX)
-			if (beta_r != ONE || beta_i != ZERO)
-				SCAL_K(l, 0, 0, beta_r, beta_i, cc, 1, NULL, 0,
-				       NULL, 0);
-
-			if (alpha_r == ZERO && alpha_i == ZERO)
-				continue;
-#else
-			if (beta != ONE)
-				SCAL_K(l, 0, 0, beta, cc, 1, NULL, 0, NULL, 0);
-
-			if (alpha == ZERO)
-				continue;
-#endif
-			IDEBUG_START;
-
-			buffer_size = 2 * (j + k) + 128 / sizeof(FLOAT);
-#ifdef WINDOWS_ABI
-			buffer_size += 160 / sizeof(FLOAT);
-#endif
-			// for alignment
-			buffer_size = (buffer_size + 3) & ~3;
-			STACK_ALLOC(buffer_size, IFLOAT, buffer);
+		(gemmt[func])(&args, NULL, NULL, sa, sb, 0);
 
 #ifdef SMP
+	} else {
 
-			if (1L * j * k < 2304L * GEMM_MULTITHREAD_THRESHOLD)
-				nthreads = 1;
-			else
-				nthreads = num_cpu_avail(2);
+		syrk_thread(mode, &args, NULL, NULL, gemmt[func], sa, sb, args.nthreads);
 
-			if (nthreads == 1) {
-#endif
-
-#if defined(COMPLEX)
-				if (!(transa & 1))
-				(gemv[(int)transa]) (j, k, 0, alpha_r, alpha_i,
-						     a, lda, bb, incb, cc, 1,
-						     buffer);
-				else
-				(gemv[(int)transa]) (k, j, 0, alpha_r, alpha_i,
-						     a, lda, bb, incb, cc, 1,
-						     buffer);
-#else
-				if (!(transa & 1))
-				(gemv[(int)transa]) (j, k, 0, alpha, a, lda, bb,
-						     incb, cc, 1, buffer);
-				else
-				(gemv[(int)transa]) (k, j, 0, alpha, a, lda, bb,
-						     incb, cc, 1, buffer);
+	}
 #endif
 
-#ifdef SMP
-			} else {
-				if (!(transa & 1))
-				(gemv_thread[(int)transa]) (j, k, alpha, a, lda,
-							    bb, incb, cc, 1,
-							    buffer, nthreads);
-				else
-				(gemv_thread[(int)transa]) (k, j, alpha, a, lda,
-							    bb, incb, cc, 1,
-							    buffer, nthreads);
-			}
-#endif
+	blas_memory_free(buffer);
 
-			STACK_FREE(buffer);
-		}
-	}
+	FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, args.n * args.k * 2 + args.n * args.n / 2, args.n * args.n * args.k);
 
 	IDEBUG_END;
 
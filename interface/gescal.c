@@ -0,0 +1,164 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+/*
+ * A := alpha * A for a general m x n (sub)matrix, using the GEMM_BETA
+ * kernel that the level 3 drivers use to prescale C.
+ */
+
+#if defined(DOUBLE)
+#define ERROR_NAME "DGESCAL"
+#else
+#define ERROR_NAME "SGESCAL"
+#endif
+
+#ifdef SMP
+#define MULTI_THREAD_MINIMAL  65536
+
+static int gescal_thread(BLASLONG m, BLASLONG n, BLASLONG dummy, FLOAT alpha,
+			 FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb, FLOAT *c, BLASLONG ldc){
+  return GEMM_BETA(n, m, 0, alpha, NULL, 0, NULL, 0, a, lda);
+}
+#endif
+
+#ifndef CBLAS
+
+void NAME(blasint *M, blasint *N, FLOAT *ALPHA, FLOAT *a, blasint *LDA)
+{
+
+  blasint m = *M;
+  blasint n = *N;
+  blasint lda = *LDA;
+  FLOAT alpha = *ALPHA;
+
+  blasint info;
+#ifdef SMP
+  int mode, nthreads;
+#endif
+
+  PRINT_DEBUG_NAME;
+
+  info = 0;
+
+  if (lda < MAX(1, m))	info = 5;
+  if (n < 0)		info = 2;
+  if (m < 0)		info = 1;
+
+  if (info != 0){
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+#else
+
+void CNAME(enum CBLAS_ORDER order, blasint m, blasint n, FLOAT alpha, FLOAT *a, blasint lda)
+{
+
+  blasint info, t;
+#ifdef SMP
+  int mode, nthreads;
+#endif
+
+  PRINT_DEBUG_CNAME;
+
+  info  =  0;
+
+  if (order == CblasColMajor) {
+
+    info = -1;
+
+    if (lda < MAX(1, m))  info = 5;
+    if (n < 0)		  info = 2;
+    if (m < 0)		  info = 1;
+
+  }
+
+  if (order == CblasRowMajor) {
+    info = -1;
+
+    t = n;
+    n = m;
+    m = t;
+
+    if (lda < MAX(1, m))  info = 5;
+    if (n < 0)		  info = 1;
+    if (m < 0)		  info = 2;
+  }
+
+  if (info >= 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+#endif
+
+  if ((m == 0) || (n == 0)) return;
+
+  if (alpha == ONE) return;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+#ifdef SMP
+  if ((BLASLONG)m * (BLASLONG)n < MULTI_THREAD_MINIMAL)
+    nthreads = 1;
+  else
+    nthreads = num_cpu_avail(3);
+
+  if (nthreads == 1) {
+#endif
+
+  GEMM_BETA(m, n, 0, alpha, NULL, 0, NULL, 0, a, lda);
+
+#ifdef SMP
+  } else {
+
+#ifdef DOUBLE
+    mode = BLAS_DOUBLE | BLAS_REAL;
+#else
+    mode = BLAS_SINGLE | BLAS_REAL;
+#endif
+
+    blas_level1_thread(mode, n, m, 0, &alpha, a, lda, NULL, 0, NULL, 0,
+		       (int (*)(void))gescal_thread, nthreads);
+  }
+#endif
+
+  FUNCTION_PROFILE_END(1, m * n, m * n);
+
+  IDEBUG_END;
+
+  return;
+
+}
@@ -48,12 +48,13 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define BlasNoTrans  0
 #define BlasTrans    1
 
-#undef malloc
-#undef free
-
 /* Enables the New IMATCOPY code with inplace operation if lda == ldb   */
 #define NEW_IMATCOPY
 
+#ifdef SMP
+#define MULTI_THREAD_MINIMAL  65536
+#endif
+
 #ifndef CBLAS
 void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha, FLOAT *a, blasint *lda, blasint *ldb)
 {
@@ -61,8 +62,7 @@ void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha,
 	char Order, Trans;
 	int order=-1,trans=-1;
 	blasint info = -1;
-	FLOAT *b;
-	size_t msize;
+	int nthreads = 1;
 
 	Order = *ORDER;
 	Trans = *TRANS;
@@ -81,8 +81,7 @@ void CNAME( enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
 {
 	int order=-1,trans=-1;
 	blasint info = -1;
-	FLOAT *b;
-	size_t msize;
+	int nthreads = 1;
 	blasint *lda, *ldb, *rows, *cols; 
 	FLOAT *alpha; 
 
@@ -154,46 +153,17 @@ void CNAME( enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
     }
 #endif
 
-	if ( *rows >  *cols )
-            msize = (size_t)(*rows) * (*ldb)  * sizeof(FLOAT);
-    else
-            msize = (size_t)(*cols) * (*ldb)  * sizeof(FLOAT);
-
-	b = malloc(msize);
-	if ( b == NULL )
-	{
-		printf("Memory alloc failed in imatcopy\n");
-		exit(1);
-	}
+	/* Everything else is done in place as well, without a copy of A */
+#ifdef SMP
+	if ( (BLASLONG)*rows * (BLASLONG)*cols >= MULTI_THREAD_MINIMAL )
+		nthreads = num_cpu_avail(1);
+#endif
 
 	if ( order == BlasColMajor )
-	{
-		if ( trans == BlasNoTrans )
-		{
-			OMATCOPY_K_CN(*rows, *cols, *alpha, a, *lda, b, *rows );
-			OMATCOPY_K_CN(*rows, *cols, (FLOAT) 1.0 , b, *rows, a, *ldb );
-		}
-		else
-		{
-			OMATCOPY_K_CT(*rows, *cols, *alpha, a, *lda, b, *cols );
-			OMATCOPY_K_CN(*cols, *rows, (FLOAT) 1.0, b, *cols, a, *ldb );
-		}
-	}
+		IMATCOPY_INPLACE(*rows, *cols, alpha, a, *lda, *ldb, trans, nthreads);
 	else
-	{
-		if ( trans == BlasNoTrans )
-		{
-			OMATCOPY_K_RN(*rows, *cols, *alpha, a, *lda, b, *cols );
-			OMATCOPY_K_RN(*rows, *cols, (FLOAT) 1.0, b, *cols, a, *ldb );
-		}
-		else
-		{
-			OMATCOPY_K_RT(*rows, *cols, *alpha, a, *lda, b, *rows );
-			OMATCOPY_K_RN(*cols, *rows, (FLOAT) 1.0, b, *rows, a, *ldb );
-		}
-	}
+		IMATCOPY_INPLACE(*cols, *rows, alpha, a, *lda, *ldb, trans, nthreads);
 
-	free(b);
 	return;
 
 }
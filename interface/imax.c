@@ -118,6 +118,118 @@
 
 #endif
 
+#ifdef SMP
+
+/* Each thread must get at least this many elements */
+#define MULTI_THREAD_MINIMAL  100000
+
+#define IMAX_ABS(a)	((a) >= ZERO ? (a) : -(a))
+
+#ifdef USE_ABS
+#ifndef COMPLEX
+#define IMAX_VALUE(x)	IMAX_ABS((x)[0])
+#else
+#define IMAX_VALUE(x)	(IMAX_ABS((x)[0]) + IMAX_ABS((x)[1]))
+#endif
+#else
+#define IMAX_VALUE(x)	((x)[0])
+#endif
+
+#ifdef USE_MIN
+#define IMAX_BETTER(a, b)	((a) < (b))
+#else
+#define IMAX_BETTER(a, b)	((a) > (b))
+#endif
+
+typedef struct {
+  BLASLONG index;
+  FLOAT *x;
+} imax_result_t;
+
+extern int blas_level1_thread_with_return_value(int mode, BLASLONG m, BLASLONG n, BLASLONG k, void *alpha, void *a, BLASLONG lda, void *b, BLASLONG ldb, void *c, BLASLONG ldc, int (*function)(), int nthreads);
+
+#ifndef COMPLEX
+static int imax_thread_function(BLASLONG n, BLASLONG dummy0, BLASLONG dummy1, FLOAT dummy2,
+				FLOAT *x, BLASLONG incx, FLOAT *dummy3, BLASLONG dummy4, void *result, BLASLONG dummy5){
+#else
+static int imax_thread_function(BLASLONG n, BLASLONG dummy0, BLASLONG dummy1, FLOAT dummy2, FLOAT dummy6,
+				FLOAT *x, BLASLONG incx, FLOAT *dummy3, BLASLONG dummy4, void *result, BLASLONG dummy5){
+#endif
+
+  imax_result_t *res = (imax_result_t *)result;
+
+  res -> index = MAX_K(n, x, incx);
+  res -> x     = x;
+
+  if (res -> index > n) res -> index = n;
+
+  return 0;
+}
+
+/* Each thread searches a contiguous chunk of x; the per-chunk winners are
+   then compared in chunk order so that ties resolve to the first index,
+   exactly as in the serial kernels. Returns a one-based index. */
+static BLASLONG imax_threaded(BLASLONG n, FLOAT *x, BLASLONG incx, int nthreads){
+
+  char result[MAX_CPU_NUMBER * sizeof(double) * 2];
+  FLOAT dummy_alpha[2] = {ZERO, ZERO};
+  imax_result_t *res;
+  BLASLONG i, pos, ret = 0;
+  FLOAT *xp, value, best = ZERO;
+  int mode;
+
+#ifdef XDOUBLE
+  mode = BLAS_XDOUBLE;
+#elif defined(DOUBLE)
+  mode = BLAS_DOUBLE;
+#else
+  mode = BLAS_SINGLE;
+#endif
+#ifndef COMPLEX
+  mode |= BLAS_REAL;
+#else
+  mode |= BLAS_COMPLEX;
+#endif
+
+  for (i = 0; i < nthreads; i++) {
+    res = (imax_result_t *)(result + i * sizeof(double) * 2);
+    res -> index = 0;
+    res -> x     = x;
+  }
+
+  blas_level1_thread_with_return_value(mode, n, 0, 0, dummy_alpha, x, incx, NULL, 0, result, 0,
+				       (int (*)(void))imax_thread_function, nthreads);
+
+  for (i = 0; i < nthreads; i++) {
+    res = (imax_result_t *)(result + i * sizeof(double) * 2);
+    if (res -> index <= 0) continue;
+
+    pos = (res -> x - x) / (incx * COMPSIZE) + res -> index - 1;
+    xp  = x + pos * incx * COMPSIZE;
+    value = IMAX_VALUE(xp);
+
+    if ((ret == 0) || IMAX_BETTER(value, best)) {
+      ret  = pos + 1;
+      best = value;
+    }
+  }
+
+  return ret;
+}
+
+static int imax_nthreads(BLASLONG n, BLASLONG incx){
+
+  int nthreads;
+
+  if (incx <= 0 || n < 2 * MULTI_THREAD_MINIMAL) return 1;
+
+  nthreads = num_cpu_avail(1);
+  if (nthreads > n / MULTI_THREAD_MINIMAL) nthreads = n / MULTI_THREAD_MINIMAL;
+
+  return nthreads;
+}
+#endif
+
 #ifndef CBLAS
 
 blasint NAME(blasint *N, FLOAT *x, blasint *INCX){
@@ -125,6 +237,9 @@ blasint NAME(blasint *N, FLOAT *x, blasint *INCX){
   BLASLONG n    = *N;
   BLASLONG incx = *INCX;
   blasint ret;
+#ifdef SMP
+  int nthreads;
+#endif
 
   PRINT_DEBUG_NAME;
 
@@ -134,6 +249,13 @@ blasint NAME(blasint *N, FLOAT *x, blasint *INCX){
 
   FUNCTION_PROFILE_START();
 
+#ifdef SMP
+  nthreads = imax_nthreads(n, incx);
+
+  if (nthreads > 1)
+    ret = (blasint)imax_threaded(n, x, incx, nthreads);
+  else
+#endif
   ret = (blasint)MAX_K(n, x, incx);
 
   if(ret > n) ret=n;
@@ -154,6 +276,9 @@ CBLAS_INDEX CNAME(blasint n, FLOAT *x, blasint incx){
 #endif
 
   CBLAS_INDEX ret;
+#ifdef SMP
+  int nthreads;
+#endif
 
   PRINT_DEBUG_CNAME;
 
@@ -163,6 +288,13 @@ CBLAS_INDEX CNAME(blasint n, FLOAT *x, blasint incx){
 
   FUNCTION_PROFILE_START();
 
+#ifdef SMP
+  nthreads = imax_nthreads(n, incx);
+
+  if (nthreads > 1)
+    ret = imax_threaded(n, x, incx, nthreads);
+  else
+#endif
   ret = MAX_K(n, x, incx);
 
   if (ret > n) ret=n;
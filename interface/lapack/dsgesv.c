@@ -0,0 +1,442 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+/*
+ * DSGESV: solve A * X = B in double precision, factorizing A in single
+ * precision and refining the solution with double precision residuals.
+ *
+ * Built with SBGETRF this becomes the DSBGESV extension, where the trailing
+ * updates of the single precision LU run through SBGEMM on bfloat16 copies
+ * of the panels; the refinement loop is unchanged, so only well-conditioned
+ * systems converge and the others fall back to DGETRF/DGETRS.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <math.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+#ifndef SBGETRF
+#define ERROR_NAME "DSGESV"
+#else
+#define ERROR_NAME "DSBGESV"
+#endif
+
+#define ITERMAX	30
+#define BWDMAX	1.0
+
+#ifndef SBGETRF_NB
+#define SBGETRF_NB 128
+#endif
+
+static double dm1 = -1.;
+
+/* returns non-zero if an entry does not fit into single precision */
+static int lag2s(BLASLONG m, BLASLONG n, double *a, BLASLONG lda, float *sa, BLASLONG ldsa){
+
+  BLASLONG i, j;
+
+  for (j = 0; j < n; j++) {
+    for (i = 0; i < m; i++) {
+      if (a[i + j * lda] < -FLT_MAX || a[i + j * lda] > FLT_MAX) return 1;
+      sa[i + j * ldsa] = (float)a[i + j * lda];
+    }
+  }
+
+  return 0;
+}
+
+static void slag2d(BLASLONG m, BLASLONG n, float *sa, BLASLONG ldsa, double *a, BLASLONG lda){
+
+  BLASLONG i, j;
+
+  for (j = 0; j < n; j++)
+    for (i = 0; i < m; i++)
+      a[i + j * lda] = (double)sa[i + j * ldsa];
+}
+
+static void lacpy(BLASLONG m, BLASLONG n, double *a, BLASLONG lda, double *b, BLASLONG ldb){
+
+  BLASLONG j;
+
+  for (j = 0; j < n; j++) COPY_K(m, a + j * lda, 1, b + j * ldb, 1);
+}
+
+/* R = B - A * X, through GEMV for a single right hand side */
+static void residual(blas_arg_t *args, double *b, BLASLONG ldb, double *x, BLASLONG ldx,
+		     double *r, double *sa, double *sb){
+
+  BLASLONG n    = args -> m;
+  BLASLONG nrhs = args -> n;
+  blas_arg_t gargs;
+
+  lacpy(n, nrhs, b, ldb, r, n);
+
+  if (nrhs == 1) {
+#ifdef SMP
+    if (args -> nthreads > 1) {
+      dgemv_thread_n(n, n, dm1, (double *)args -> a, args -> lda, x, 1, r, 1, sa, args -> nthreads);
+      return;
+    }
+#endif
+    GEMV_N(n, n, 0, dm1, (double *)args -> a, args -> lda, x, 1, r, 1, sa);
+    return;
+  }
+
+  gargs.m     = n;
+  gargs.n     = nrhs;
+  gargs.k     = n;
+  gargs.a     = args -> a;
+  gargs.lda   = args -> lda;
+  gargs.b     = (void *)x;
+  gargs.ldb   = ldx;
+  gargs.c     = (void *)r;
+  gargs.ldc   = n;
+  gargs.alpha = (void *)&dm1;
+  gargs.beta  = NULL;
+#ifdef SMP
+  gargs.common   = NULL;
+  gargs.nthreads = args -> nthreads;
+
+  if (gargs.nthreads > 1) {
+    GEMM_THREAD_NN(&gargs, NULL, NULL, sa, sb, 0);
+    return;
+  }
+#endif
+  GEMM_NN(&gargs, NULL, NULL, sa, sb, 0);
+}
+
+/* every column passes the backward error test of the reference DSGESV */
+static int converged(BLASLONG n, BLASLONG nrhs, double *x, BLASLONG ldx, double *r, double cte){
+
+  BLASLONG i;
+  double xnrm, rnrm;
+
+  for (i = 0; i < nrhs; i++) {
+    xnrm = fabs(x[IAMAX_K(n, x + i * ldx, 1) - 1 + i * ldx]);
+    rnrm = fabs(r[IAMAX_K(n, r + i * n,   1) - 1 + i * n]);
+    if (rnrm > xnrm * cte) return 0;
+  }
+
+  return 1;
+}
+
+#ifdef SBGETRF
+/*
+ * Right-looking single precision LU whose trailing updates take bfloat16
+ * inputs: panels are factorized and U12 is solved in single precision, then
+ * L21 and U12 are rounded to bfloat16 and A22 -= L21 * U12 runs on SBGEMM
+ * with single precision accumulation.
+ */
+static blasint sbgetrf(blas_arg_t *args, float *sa, float *sb){
+
+  BLASLONG n   = args -> n;
+  BLASLONG lda = args -> lda;
+  float   *a   = (float *)args -> a;
+  blasint *ipiv = (blasint *)args -> c;
+
+  BLASLONG i, j, jb, m2, nb;
+  BLASLONG range_N[2];
+  blasint info, iinfo, bm, bn, bk, bld;
+  float  sm1 = -1.f, sp1 = 1.f;
+  blas_arg_t targs;
+  bfloat16 *l21, *u12;
+
+  nb = SBGETRF_NB;
+
+  l21 = (bfloat16 *)malloc(2 * n * nb * sizeof(bfloat16));
+  if (l21 == NULL) {
+#ifdef SMP
+    if (args -> nthreads > 1) return sgetrf_parallel(args, NULL, NULL, sa, sb, 0);
+#endif
+    return sgetrf_single(args, NULL, NULL, sa, sb, 0);
+  }
+  u12 = l21 + n * nb;
+
+  info = 0;
+
+  for (j = 0; j < n; j += nb) {
+    jb = MIN(nb, n - j);
+    m2 = n - j - jb;
+
+    range_N[0] = j;
+    range_N[1] = j + jb;
+
+#ifdef SMP
+    if (args -> nthreads > 1)
+      iinfo = sgetrf_parallel(args, NULL, range_N, sa, sb, 0);
+    else
+#endif
+      iinfo = sgetrf_single(args, NULL, range_N, sa, sb, 0);
+
+    if (iinfo && !info) info = iinfo + j;
+
+    SLASWP_PLUS(j, j + 1, j + jb, ZERO, a, lda, NULL, 0, ipiv, 1);
+
+    if (m2 == 0) continue;
+
+    SLASWP_PLUS(m2, j + 1, j + jb, ZERO, a + (j + jb) * lda, lda, NULL, 0, ipiv, 1);
+
+    targs.m    = jb;
+    targs.n    = m2;
+    targs.a    = (void *)(a + j + j * lda);
+    targs.lda  = lda;
+    targs.b    = (void *)(a + j + (j + jb) * lda);
+    targs.ldb  = lda;
+    targs.beta = (void *)&sp1;
+
+#ifdef SMP
+    if (args -> nthreads > 1) {
+      targs.common   = NULL;
+      targs.nthreads = args -> nthreads;
+      gemm_thread_n(BLAS_SINGLE | BLAS_REAL, &targs, NULL, NULL,
+		    (int (*)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG))strsm_LNLU,
+		    sa, sb, targs.nthreads);
+    } else
+#endif
+      strsm_LNLU(&targs, NULL, NULL, sa, sb, 0);
+
+    for (i = 0; i < jb; i++)
+      SBSTOBF16_K(m2, a + (j + jb) + (j + i) * lda, 1, l21 + i * m2, 1);
+    for (i = 0; i < m2; i++)
+      SBSTOBF16_K(jb, a + j + (j + jb + i) * lda, 1, u12 + i * jb, 1);
+
+    bm  = m2;
+    bn  = m2;
+    bk  = jb;
+    bld = lda;
+    BLASFUNC(sbgemm)("N", "N", &bm, &bn, &bk, &sm1, l21, &bm, u12, &bk, &sp1,
+		     a + (j + jb) + (j + jb) * lda, &bld);
+  }
+
+  free(l21);
+
+  return info;
+}
+#endif
+
+int NAME(blasint *N, blasint *NRHS, double *a, blasint *ldA, blasint *ipiv,
+	 double *b, blasint *ldB, double *x, blasint *ldX, double *work,
+	 float *swork, blasint *Iter, blasint *Info){
+
+  blas_arg_t args, sargs;
+
+  blasint info;
+  BLASLONG n, nrhs, ldb, ldx, i, j, iiter;
+  double anrm, cte, sum;
+  float *sw_a, *sw_x;
+  void *buffer;
+  double *sa, *sb;
+  float *ssb;
+
+  PRINT_DEBUG_NAME;
+
+  n    = *N;
+  nrhs = *NRHS;
+  ldb  = *ldB;
+  ldx  = *ldX;
+
+  args.m    = n;
+  args.n    = nrhs;
+  args.a    = (void *)a;
+  args.lda  = *ldA;
+
+  info  = 0;
+  if (ldx      < MAX(1,n)) info = 9;
+  if (ldb      < MAX(1,n)) info = 7;
+  if (args.lda < MAX(1,n)) info = 4;
+  if (nrhs     < 0)        info = 2;
+  if (n        < 0)        info = 1;
+
+  *Iter = 0;
+
+  if (info) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    *Info = - info;
+    return 0;
+  }
+
+  *Info = 0;
+
+  if (n == 0) return 0;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+  buffer = blas_memory_alloc(1);
+
+  sa  = (double *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb  = (double *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+  ssb = (float  *)(((BLASLONG)sa + ((SGEMM_P * SGEMM_Q * sizeof(float) + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+
+#ifdef SMP
+  args.common = NULL;
+  if (n * n < 10000)
+    args.nthreads = 1;
+  else
+    args.nthreads = num_cpu_avail(4);
+#endif
+
+  sw_a = swork;
+  sw_x = swork + n * n;
+
+  sargs = args;
+  sargs.a   = (void *)sw_a;
+  sargs.lda = n;
+  sargs.b   = (void *)sw_x;
+  sargs.ldb = n;
+  sargs.c   = (void *)ipiv;
+  sargs.alpha = NULL;
+  sargs.beta  = NULL;
+
+  /* infinity norm of A, with WORK holding the row sums */
+  anrm = ZERO;
+  if (nrhs > 0) {
+    for (i = 0; i < n; i++) work[i] = ZERO;
+    for (j = 0; j < n; j++)
+      for (i = 0; i < n; i++) work[i] += fabs(a[i + j * args.lda]);
+    for (i = 0; i < n; i++) {
+      sum = work[i];
+      if (sum > anrm || sum != sum) anrm = sum;
+    }
+  }
+
+  cte = anrm * (DBL_EPSILON * 0.5) * sqrt((double)n) * BWDMAX;
+
+  if (lag2s(n, nrhs, b, ldb, sw_x, n) || lag2s(n, n, a, args.lda, sw_a, n)) {
+    *Iter = -2;
+    goto fallback;
+  }
+
+  sargs.n = n;
+#ifndef SBGETRF
+#ifdef SMP
+  if (args.nthreads > 1)
+    info = sgetrf_parallel(&sargs, NULL, NULL, (float *)sa, ssb, 0);
+  else
+#endif
+    info = sgetrf_single(&sargs, NULL, NULL, (float *)sa, ssb, 0);
+#else
+  info = sbgetrf(&sargs, (float *)sa, ssb);
+#endif
+
+  if (info) {
+    *Iter = -3;
+    goto fallback;
+  }
+
+  sargs.n = nrhs;
+
+  if (nrhs == 0) goto done;
+
+#ifdef SMP
+  if (args.nthreads > 1)
+    sgetrs_N_parallel(&sargs, NULL, NULL, (float *)sa, ssb, 0);
+  else
+#endif
+    sgetrs_N_single(&sargs, NULL, NULL, (float *)sa, ssb, 0);
+
+  slag2d(n, nrhs, sw_x, n, x, ldx);
+
+  residual(&args, b, ldb, x, ldx, work, sa, sb);
+
+  if (converged(n, nrhs, x, ldx, work, cte)) goto done;
+
+  for (iiter = 1; iiter <= ITERMAX; iiter++) {
+
+    if (lag2s(n, nrhs, work, n, sw_x, n)) {
+      *Iter = -2;
+      goto fallback;
+    }
+
+#ifdef SMP
+    if (args.nthreads > 1)
+      sgetrs_N_parallel(&sargs, NULL, NULL, (float *)sa, ssb, 0);
+    else
+#endif
+      sgetrs_N_single(&sargs, NULL, NULL, (float *)sa, ssb, 0);
+
+    slag2d(n, nrhs, sw_x, n, work, n);
+
+    for (i = 0; i < nrhs; i++)
+      AXPYU_K(n, 0, 0, ONE, work + i * n, 1, x + i * ldx, 1, NULL, 0);
+
+    residual(&args, b, ldb, x, ldx, work, sa, sb);
+
+    if (converged(n, nrhs, x, ldx, work, cte)) {
+      *Iter = iiter;
+      goto done;
+    }
+  }
+
+  *Iter = -ITERMAX - 1;
+
+ fallback:
+  /* the double precision solve of DGESV */
+  args.n   = n;
+  args.c   = (void *)ipiv;
+  args.alpha = NULL;
+  args.beta  = NULL;
+
+#ifdef SMP
+  if (args.nthreads > 1)
+    info = GETRF_PARALLEL(&args, NULL, NULL, sa, sb, 0);
+  else
+#endif
+    info = GETRF_SINGLE(&args, NULL, NULL, sa, sb, 0);
+
+  if (info == 0 && nrhs > 0) {
+    lacpy(n, nrhs, b, ldb, x, ldx);
+
+    args.n   = nrhs;
+    args.b   = (void *)x;
+    args.ldb = ldx;
+
+#ifdef SMP
+    if (args.nthreads > 1)
+      GETRS_N_PARALLEL(&args, NULL, NULL, sa, sb, 0);
+    else
+#endif
+      GETRS_N_SINGLE(&args, NULL, NULL, sa, sb, 0);
+  }
+
+  *Info = info;
+
+ done:
+  blas_memory_free(buffer);
+
+  FUNCTION_PROFILE_END(1, n * n, 2. / 3. * n * n * n + 2. * n * n * nrhs);
+
+  IDEBUG_END;
+
+  return 0;
+}
@@ -0,0 +1,410 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+/*
+ * DSPOSV: solve A * X = B for symmetric positive definite A in double
+ * precision, factorizing A in single precision and refining the solution
+ * with double precision residuals.
+ */
+
+#include <stdio.h>
+#include <float.h>
+#include <math.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+#define ERROR_NAME "DSPOSV"
+
+#define ITERMAX	30
+#define BWDMAX	1.0
+
+static double dm1 = -1.;
+static double dp1 =  1.;
+static float  sp1 =  1.f;
+
+static blasint (*spotrf_single[])(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG) = {
+  spotrf_U_single, spotrf_L_single,
+};
+
+static blasint (*dpotrf_single[])(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG) = {
+  dpotrf_U_single, dpotrf_L_single,
+};
+
+#ifdef SMP
+static blasint (*spotrf_parallel[])(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG) = {
+  spotrf_U_parallel, spotrf_L_parallel,
+};
+
+static blasint (*dpotrf_parallel[])(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG) = {
+  dpotrf_U_parallel, dpotrf_L_parallel,
+};
+#endif
+
+/* the two triangular solves of POTRS, U**T * U or L * L**T */
+static int (*strsm_potrs[][2])(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG) = {
+  {strsm_LTUN, strsm_LNUN}, {strsm_LNLN, strsm_LTLN},
+};
+
+static int (*dtrsm_potrs[][2])(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG) = {
+  {dtrsm_LTUN, dtrsm_LNUN}, {dtrsm_LNLN, dtrsm_LTLN},
+};
+
+/* returns non-zero if an entry of the triangle does not fit into single precision */
+static int lat2s(int uplo, BLASLONG n, double *a, BLASLONG lda, float *sa, BLASLONG ldsa){
+
+  BLASLONG i, j;
+
+  for (j = 0; j < n; j++) {
+    for (i = (uplo ? j : 0); i < (uplo ? n : j + 1); i++) {
+      if (a[i + j * lda] < -FLT_MAX || a[i + j * lda] > FLT_MAX) return 1;
+      sa[i + j * ldsa] = (float)a[i + j * lda];
+    }
+  }
+
+  return 0;
+}
+
+static int lag2s(BLASLONG m, BLASLONG n, double *a, BLASLONG lda, float *sa, BLASLONG ldsa){
+
+  BLASLONG i, j;
+
+  for (j = 0; j < n; j++) {
+    for (i = 0; i < m; i++) {
+      if (a[i + j * lda] < -FLT_MAX || a[i + j * lda] > FLT_MAX) return 1;
+      sa[i + j * ldsa] = (float)a[i + j * lda];
+    }
+  }
+
+  return 0;
+}
+
+static void slag2d(BLASLONG m, BLASLONG n, float *sa, BLASLONG ldsa, double *a, BLASLONG lda){
+
+  BLASLONG i, j;
+
+  for (j = 0; j < n; j++)
+    for (i = 0; i < m; i++)
+      a[i + j * lda] = (double)sa[i + j * ldsa];
+}
+
+static void lacpy(BLASLONG m, BLASLONG n, double *a, BLASLONG lda, double *b, BLASLONG ldb){
+
+  BLASLONG j;
+
+  for (j = 0; j < n; j++) COPY_K(m, a + j * lda, 1, b + j * ldb, 1);
+}
+
+static void spotrs(int uplo, blas_arg_t *args, float *sa, float *sb){
+
+  int i;
+
+  for (i = 0; i < 2; i++) {
+#ifdef SMP
+    if (args -> nthreads > 1)
+      gemm_thread_n(BLAS_SINGLE | BLAS_REAL, args, NULL, NULL,
+		    (int (*)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG))strsm_potrs[uplo][i],
+		    sa, sb, args -> nthreads);
+    else
+#endif
+      (strsm_potrs[uplo][i])(args, NULL, NULL, sa, sb, 0);
+  }
+}
+
+static void dpotrs(int uplo, blas_arg_t *args, double *sa, double *sb){
+
+  int i;
+
+  for (i = 0; i < 2; i++) {
+#ifdef SMP
+    if (args -> nthreads > 1)
+      gemm_thread_n(BLAS_DOUBLE | BLAS_REAL, args, NULL, NULL, dtrsm_potrs[uplo][i], sa, sb, args -> nthreads);
+    else
+#endif
+      (dtrsm_potrs[uplo][i])(args, NULL, NULL, sa, sb, 0);
+  }
+}
+
+/* R = B - A * X with A symmetric, through SYMV for a single right hand side */
+static void residual(int uplo, blas_arg_t *args, double *b, BLASLONG ldb, double *x, BLASLONG ldx,
+		     double *r, double *sa, double *sb){
+
+  BLASLONG n    = args -> m;
+  BLASLONG nrhs = args -> n;
+  blas_arg_t gargs;
+
+  lacpy(n, nrhs, b, ldb, r, n);
+
+  if (nrhs == 1) {
+#ifdef SMP
+    if (args -> nthreads > 1) {
+      if (uplo)
+	dsymv_thread_L(n, dm1, (double *)args -> a, args -> lda, x, 1, r, 1, sa, args -> nthreads);
+      else
+	dsymv_thread_U(n, dm1, (double *)args -> a, args -> lda, x, 1, r, 1, sa, args -> nthreads);
+      return;
+    }
+#endif
+    if (uplo)
+      SYMV_L(n, n, dm1, (double *)args -> a, args -> lda, x, 1, r, 1, sa);
+    else
+      SYMV_U(n, n, dm1, (double *)args -> a, args -> lda, x, 1, r, 1, sa);
+    return;
+  }
+
+  gargs.m     = n;
+  gargs.n     = nrhs;
+  gargs.a     = args -> a;
+  gargs.lda   = args -> lda;
+  gargs.b     = (void *)x;
+  gargs.ldb   = ldx;
+  gargs.c     = (void *)r;
+  gargs.ldc   = n;
+  gargs.alpha = (void *)&dm1;
+  gargs.beta  = NULL;
+#ifdef SMP
+  gargs.common   = NULL;
+  gargs.nthreads = args -> nthreads;
+
+  if (gargs.nthreads > 1) {
+    if (uplo)
+      SYMM_THREAD_LL(&gargs, NULL, NULL, sa, sb, 0);
+    else
+      SYMM_THREAD_LU(&gargs, NULL, NULL, sa, sb, 0);
+    return;
+  }
+#endif
+  if (uplo)
+    SYMM_LL(&gargs, NULL, NULL, sa, sb, 0);
+  else
+    SYMM_LU(&gargs, NULL, NULL, sa, sb, 0);
+}
+
+/* every column passes the backward error test of the reference DSPOSV */
+static int converged(BLASLONG n, BLASLONG nrhs, double *x, BLASLONG ldx, double *r, double cte){
+
+  BLASLONG i;
+  double xnrm, rnrm;
+
+  for (i = 0; i < nrhs; i++) {
+    xnrm = fabs(x[IAMAX_K(n, x + i * ldx, 1) - 1 + i * ldx]);
+    rnrm = fabs(r[IAMAX_K(n, r + i * n,   1) - 1 + i * n]);
+    if (rnrm > xnrm * cte) return 0;
+  }
+
+  return 1;
+}
+
+int NAME(char *UPLO, blasint *N, blasint *NRHS, double *a, blasint *ldA,
+	 double *b, blasint *ldB, double *x, blasint *ldX, double *work,
+	 float *swork, blasint *Iter, blasint *Info){
+
+  blas_arg_t args, sargs;
+
+  blasint uplo_arg = *UPLO;
+  blasint uplo;
+  blasint info;
+  BLASLONG n, nrhs, ldb, ldx, i, j, iiter;
+  double anrm, cte, t;
+  void *buffer;
+  double *sa, *sb;
+  float *ssb;
+
+  PRINT_DEBUG_NAME;
+
+  n    = *N;
+  nrhs = *NRHS;
+  ldb  = *ldB;
+  ldx  = *ldX;
+
+  args.m    = n;
+  args.n    = nrhs;
+  args.a    = (void *)a;
+  args.lda  = *ldA;
+
+  TOUPPER(uplo_arg);
+
+  uplo = -1;
+  if (uplo_arg == 'U') uplo = 0;
+  if (uplo_arg == 'L') uplo = 1;
+
+  info  = 0;
+  if (ldx      < MAX(1,n)) info = 9;
+  if (ldb      < MAX(1,n)) info = 7;
+  if (args.lda < MAX(1,n)) info = 5;
+  if (nrhs     < 0)        info = 3;
+  if (n        < 0)        info = 2;
+  if (uplo     < 0)        info = 1;
+
+  *Iter = 0;
+
+  if (info) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    *Info = - info;
+    return 0;
+  }
+
+  *Info = 0;
+
+  if (n == 0) return 0;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+  buffer = blas_memory_alloc(1);
+
+  sa  = (double *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb  = (double *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+  ssb = (float  *)(((BLASLONG)sa + ((SGEMM_P * SGEMM_Q * sizeof(float) + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+
+#ifdef SMP
+  args.common = NULL;
+  if (n < 64) {
+    args.nthreads = 1;
+  } else {
+    args.nthreads = num_cpu_avail(4);
+    if (n / args.nthreads < 64) args.nthreads = n / 64;
+  }
+#endif
+
+  sargs = args;
+  sargs.a     = (void *)swork;
+  sargs.lda   = n;
+  sargs.b     = (void *)(swork + n * n);
+  sargs.ldb   = n;
+  sargs.alpha = NULL;
+  sargs.beta  = (void *)&sp1;
+
+  /* infinity norm of A from its triangle, with WORK holding the row sums */
+  anrm = ZERO;
+  if (nrhs > 0) {
+    for (i = 0; i < n; i++) work[i] = ZERO;
+    for (j = 0; j < n; j++) {
+      for (i = (uplo ? j + 1 : 0); i < (uplo ? n : j); i++) {
+	t = fabs(a[i + j * args.lda]);
+	work[i] += t;
+	work[j] += t;
+      }
+      work[j] += fabs(a[j + j * args.lda]);
+    }
+    for (i = 0; i < n; i++)
+      if (work[i] > anrm || work[i] != work[i]) anrm = work[i];
+  }
+
+  cte = anrm * (DBL_EPSILON * 0.5) * sqrt((double)n) * BWDMAX;
+
+  if (lag2s(n, nrhs, b, ldb, swork + n * n, n) || lat2s(uplo, n, a, args.lda, swork, n)) {
+    *Iter = -2;
+    goto fallback;
+  }
+
+  sargs.n = n;
+#ifdef SMP
+  if (args.nthreads > 1)
+    info = (spotrf_parallel[uplo])(&sargs, NULL, NULL, (float *)sa, ssb, 0);
+  else
+#endif
+    info = (spotrf_single[uplo])(&sargs, NULL, NULL, (float *)sa, ssb, 0);
+
+  if (info) {
+    *Iter = -3;
+    goto fallback;
+  }
+
+  if (nrhs == 0) goto done;
+
+  sargs.m = n;
+  sargs.n = nrhs;
+  spotrs(uplo, &sargs, (float *)sa, ssb);
+
+  slag2d(n, nrhs, swork + n * n, n, x, ldx);
+
+  residual(uplo, &args, b, ldb, x, ldx, work, sa, sb);
+
+  if (converged(n, nrhs, x, ldx, work, cte)) goto done;
+
+  for (iiter = 1; iiter <= ITERMAX; iiter++) {
+
+    if (lag2s(n, nrhs, work, n, swork + n * n, n)) {
+      *Iter = -2;
+      goto fallback;
+    }
+
+    spotrs(uplo, &sargs, (float *)sa, ssb);
+
+    slag2d(n, nrhs, swork + n * n, n, work, n);
+
+    for (i = 0; i < nrhs; i++)
+      AXPYU_K(n, 0, 0, ONE, work + i * n, 1, x + i * ldx, 1, NULL, 0);
+
+    residual(uplo, &args, b, ldb, x, ldx, work, sa, sb);
+
+    if (converged(n, nrhs, x, ldx, work, cte)) {
+      *Iter = iiter;
+      goto done;
+    }
+  }
+
+  *Iter = -ITERMAX - 1;
+
+ fallback:
+  /* the double precision solve of DPOSV */
+  args.n     = n;
+  args.alpha = NULL;
+  args.beta  = NULL;
+
+#ifdef SMP
+  if (args.nthreads > 1)
+    info = (dpotrf_parallel[uplo])(&args, NULL, NULL, sa, sb, 0);
+  else
+#endif
+    info = (dpotrf_single[uplo])(&args, NULL, NULL, sa, sb, 0);
+
+  if (info == 0 && nrhs > 0) {
+    lacpy(n, nrhs, b, ldb, x, ldx);
+
+    args.m    = n;
+    args.n    = nrhs;
+    args.b    = (void *)x;
+    args.ldb  = ldx;
+    args.beta = (void *)&dp1;
+    dpotrs(uplo, &args, sa, sb);
+  }
+
+  *Info = info;
+
+ done:
+  blas_memory_free(buffer);
+
+  FUNCTION_PROFILE_END(1, .5 * n * n, 1. / 3. * n * n * n + 2. * n * n * nrhs);
+
+  IDEBUG_END;
+
+  return 0;
+}
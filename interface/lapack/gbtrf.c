@@ -0,0 +1,156 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+#ifdef XDOUBLE
+#define ERROR_NAME "QGBTRF"
+#elif defined(DOUBLE)
+#define ERROR_NAME "DGBTRF"
+#else
+#define ERROR_NAME "SGBTRF"
+#endif
+
+#ifndef GBTRF_NB
+#define GBTRF_NB 64
+#endif
+
+/* bands with fewer subdiagonals are factorized column by column */
+#ifndef GBTRF_BLOCK_MIN
+#define GBTRF_BLOCK_MIN 32
+#endif
+
+int NAME(blasint *M, blasint *N, blasint *KL, blasint *KU, FLOAT *ab, blasint *ldAB, blasint *ipiv, blasint *Info){
+
+  blas_arg_t args;
+
+  blasint info;
+  BLASLONG nb, size;
+  int heap = 0;
+  FLOAT *buffer, *workspace = NULL;
+#ifdef PPC440
+  extern
+#endif
+  FLOAT *sa, *sb;
+
+  PRINT_DEBUG_NAME;
+
+  args.m    = *M;
+  args.n    = *N;
+  args.k    = *KL;
+  args.ldc  = *KU;
+  args.a    = (void *)ab;
+  args.lda  = *ldAB;
+  args.c    = (void *)ipiv;
+
+  info  = 0;
+  if (args.lda < 2 * args.k + args.ldc + 1) info = 6;
+  if (args.ldc < 0)             info = 4;
+  if (args.k   < 0)             info = 3;
+  if (args.n   < 0)             info = 2;
+  if (args.m   < 0)             info = 1;
+  if (info) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    *Info = - info;
+    return 0;
+  }
+
+  *Info = 0;
+
+  if (args.m == 0 || args.n == 0) return 0;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+#ifndef PPC440
+  buffer = (FLOAT *)blas_memory_alloc(1);
+
+  sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+#endif
+
+  nb = MIN(GBTRF_NB, args.k);
+  if (args.k < GBTRF_BLOCK_MIN || MIN(args.m, args.n) <= nb) nb = 1;
+
+  /* two blocks of the pipeline and the copy of the columns cut by the band storage */
+  if (nb > 1) {
+    size = 3 * (nb + args.k) * nb * SIZE;
+    if (size <= BUFFER_SIZE) {
+      workspace = (FLOAT *)blas_memory_alloc(1);
+    } else {
+      heap = 1;
+      workspace = (FLOAT *)malloc(size);
+      if (workspace == NULL) {
+	fprintf(stderr, "OpenBLAS: malloc failed in %s\n", __func__);
+	exit(1);
+      }
+    }
+  }
+
+  args.b   = (void *)workspace;
+  args.ldb = nb;
+
+#ifdef SMP
+  args.common = NULL;
+  if (nb == 1 || args.k + args.ldc < 128) {
+    args.nthreads = 1;
+  } else {
+    args.nthreads = num_cpu_avail(4);
+  }
+
+  if (args.nthreads == 1) {
+#endif
+
+    *Info = GBTRF_SINGLE(&args, NULL, NULL, sa, sb, 0);
+
+#ifdef SMP
+  } else {
+    *Info = GBTRF_PARALLEL(&args, NULL, NULL, sa, sb, 0);
+  }
+#endif
+
+  if (heap) {
+    free(workspace);
+  } else if (workspace) {
+    blas_memory_free(workspace);
+  }
+
+#ifndef PPC440
+  blas_memory_free(buffer);
+#endif
+
+  FUNCTION_PROFILE_END(1, args.n * (2 * args.k + args.ldc + 1), 2. * args.n * args.k * (args.k + args.ldc));
+
+  IDEBUG_END;
+
+  return 0;
+}
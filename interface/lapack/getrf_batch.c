@@ -0,0 +1,249 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+/*
+ * LU factorization of many small independent matrices in one call. The
+ * group variant follows cblas_?gemm_batch: group g holds group_size[g]
+ * matrices of the same m_array[g] x n_array[g] shape and the pointers to
+ * all of them (and to their pivot vectors) are listed group after group.
+ * The STRIDED variant takes one shape for the whole batch and finds the
+ * matrices and pivot vectors at a fixed stride from each other. info_array
+ * receives the INFO of GETRF for every matrix; a group with an invalid
+ * argument is reported through xerbla and has its entries set to -i.
+ */
+
+#ifndef STRIDED
+#ifdef DOUBLE
+#define ERROR_NAME "DGETRF_BATCH"
+#else
+#define ERROR_NAME "SGETRF_BATCH"
+#endif
+#else
+#ifdef DOUBLE
+#define ERROR_NAME "DGETRF_BATCH_STRIDED"
+#else
+#define ERROR_NAME "SGETRF_BATCH_STRIDED"
+#endif
+#endif
+
+/* below this many flops in a group a single thread does the whole group */
+#define BATCH_THREAD_MIN 262144
+
+static void factor_group(blas_arg_t *args, FLOAT *sa, FLOAT *sb) {
+
+#ifdef SMP
+  args -> common = NULL;
+  if ((double)args -> k * args -> m * args -> n * MIN(args -> m, args -> n) < BATCH_THREAD_MIN)
+    args -> nthreads = 1;
+  else
+    args -> nthreads = num_cpu_avail(4);
+
+  if (args -> nthreads == 1) {
+#endif
+
+    GETRF_BATCH_SINGLE(args, NULL, NULL, sa, sb, 0);
+
+#ifdef SMP
+  } else {
+    GETRF_BATCH_PARALLEL(args, NULL, NULL, sa, sb, 0);
+  }
+#endif
+}
+
+#ifndef STRIDED
+int NAME(blasint *m_array, blasint *n_array, FLOAT **a_array, blasint *lda_array, blasint **ipiv_array,
+	 blasint *group_count, blasint *group_size, blasint *info_array){
+
+  blas_arg_t args;
+
+  blasint info;
+  BLASLONG g, i, offset;
+  FLOAT *buffer;
+#ifdef PPC440
+  extern
+#endif
+  FLOAT *sa, *sb;
+
+  PRINT_DEBUG_NAME;
+
+  if (*group_count < 0) {
+    info = 6;
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    return 0;
+  }
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+#ifndef PPC440
+  buffer = (FLOAT *)blas_memory_alloc(1);
+
+  sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+#endif
+
+  offset = 0;
+
+  for (g = 0; g < *group_count; g++) {
+
+    args.m   = m_array[g];
+    args.n   = n_array[g];
+    args.lda = lda_array[g];
+    args.k   = group_size[g];
+
+    info = 0;
+    if (args.k   < 0)             info = 7;
+    if (args.lda < MAX(1,args.m)) info = 4;
+    if (args.n   < 0)             info = 2;
+    if (args.m   < 0)             info = 1;
+
+    if (info) {
+      BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+      for (i = 0; i < args.k; i++) info_array[offset + i] = -info;
+      if (args.k > 0) offset += args.k;
+      continue;
+    }
+
+    if (args.m == 0 || args.n == 0) {
+      for (i = 0; i < args.k; i++) info_array[offset + i] = 0;
+    } else if (args.k > 0) {
+      args.a = (void *)(a_array    + offset);
+      args.c = (void *)(ipiv_array + offset);
+      args.d = (void *)(info_array + offset);
+
+      factor_group(&args, sa, sb);
+    }
+
+    offset += args.k;
+  }
+
+#ifndef PPC440
+  blas_memory_free(buffer);
+#endif
+
+  FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, offset, offset);
+
+  IDEBUG_END;
+
+  return 0;
+}
+
+#else
+
+int NAME(blasint *M, blasint *N, FLOAT *a, blasint *ldA, blasint *strideA,
+	 blasint *ipiv, blasint *strideIpiv, blasint *batchSize, blasint *info_array){
+
+  blas_arg_t args;
+
+  blasint info;
+  BLASLONG i, stride_a, stride_ipiv;
+  FLOAT **a_array;
+  blasint **ipiv_array;
+  FLOAT *buffer;
+#ifdef PPC440
+  extern
+#endif
+  FLOAT *sa, *sb;
+
+  PRINT_DEBUG_NAME;
+
+  args.m      = *M;
+  args.n      = *N;
+  args.lda    = *ldA;
+  args.k      = *batchSize;
+  stride_a    = *strideA;
+  stride_ipiv = *strideIpiv;
+
+  info = 0;
+  if (args.k      < 0)                     info = 8;
+  if (stride_ipiv < MIN(args.m, args.n))   info = 7;
+  if (stride_a    < args.lda * args.n)     info = 5;
+  if (args.lda    < MAX(1,args.m))         info = 4;
+  if (args.n      < 0)                     info = 2;
+  if (args.m      < 0)                     info = 1;
+
+  if (info) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    for (i = 0; i < args.k; i++) info_array[i] = -info;
+    return 0;
+  }
+
+  for (i = 0; i < args.k; i++) info_array[i] = 0;
+
+  if (args.m == 0 || args.n == 0 || args.k == 0) return 0;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+  a_array    = (FLOAT   **)malloc(args.k * sizeof(FLOAT   *));
+  ipiv_array = (blasint **)malloc(args.k * sizeof(blasint *));
+  if (a_array == NULL || ipiv_array == NULL) {
+    fprintf(stderr, "OpenBLAS: malloc failed in %s\n", __func__);
+    exit(1);
+  }
+
+  for (i = 0; i < args.k; i++) {
+    a_array[i]    = a    + i * stride_a;
+    ipiv_array[i] = ipiv + i * stride_ipiv;
+  }
+
+#ifndef PPC440
+  buffer = (FLOAT *)blas_memory_alloc(1);
+
+  sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+#endif
+
+  args.a = (void *)a_array;
+  args.c = (void *)ipiv_array;
+  args.d = (void *)info_array;
+
+  factor_group(&args, sa, sb);
+
+#ifndef PPC440
+  blas_memory_free(buffer);
+#endif
+
+  free(a_array);
+  free(ipiv_array);
+
+  FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, args.k * args.m * args.n, 2. / 3. * args.k * args.m * args.n * MIN(args.m, args.n));
+
+  IDEBUG_END;
+
+  return 0;
+}
+#endif
@@ -0,0 +1,292 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+/*
+ * Solution of many small independent systems from the factorizations of
+ * ?getrf_batch, grouped like cblas_?gemm_batch or, with STRIDED, with one
+ * shape for all systems found at a fixed stride. info_array is zero for
+ * every system unless its group has an invalid argument, which is reported
+ * through xerbla and sets the entries of the group to -i.
+ */
+
+#ifndef STRIDED
+#ifdef DOUBLE
+#define ERROR_NAME "DGETRS_BATCH"
+#else
+#define ERROR_NAME "SGETRS_BATCH"
+#endif
+#else
+#ifdef DOUBLE
+#define ERROR_NAME "DGETRS_BATCH_STRIDED"
+#else
+#define ERROR_NAME "SGETRS_BATCH_STRIDED"
+#endif
+#endif
+
+/* below this many flops in a group a single thread does the whole group */
+#define BATCH_THREAD_MIN 262144
+
+static blasint (*getrs_batch_single[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  GETRS_N_BATCH_SINGLE, GETRS_T_BATCH_SINGLE,
+};
+
+#ifdef SMP
+static blasint (*getrs_batch_parallel[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  GETRS_N_BATCH_PARALLEL, GETRS_T_BATCH_PARALLEL,
+};
+#endif
+
+static int get_trans(char trans_arg) {
+
+  TOUPPER(trans_arg);
+
+  if (trans_arg == 'N') return 0;
+  if (trans_arg == 'T') return 1;
+  if (trans_arg == 'R') return 0;
+  if (trans_arg == 'C') return 1;
+
+  return -1;
+}
+
+static void solve_group(blas_arg_t *args, int trans, FLOAT *sa, FLOAT *sb) {
+
+#ifdef SMP
+  args -> common = NULL;
+  if ((double)args -> k * args -> m * args -> m * args -> n < BATCH_THREAD_MIN)
+    args -> nthreads = 1;
+  else
+    args -> nthreads = num_cpu_avail(4);
+
+  if (args -> nthreads == 1) {
+#endif
+
+    (getrs_batch_single[trans])(args, NULL, NULL, sa, sb, 0);
+
+#ifdef SMP
+  } else {
+    (getrs_batch_parallel[trans])(args, NULL, NULL, sa, sb, 0);
+  }
+#endif
+}
+
+#ifndef STRIDED
+int NAME(char *trans_array, blasint *n_array, blasint *nrhs_array, FLOAT **a_array, blasint *lda_array,
+	 blasint **ipiv_array, FLOAT **b_array, blasint *ldb_array,
+	 blasint *group_count, blasint *group_size, blasint *info_array){
+
+  blas_arg_t args;
+
+  blasint info;
+  int trans;
+  BLASLONG g, i, offset;
+  FLOAT *buffer;
+#ifdef PPC440
+  extern
+#endif
+  FLOAT *sa, *sb;
+
+  PRINT_DEBUG_NAME;
+
+  if (*group_count < 0) {
+    info = 9;
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    return 0;
+  }
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+#ifndef PPC440
+  buffer = (FLOAT *)blas_memory_alloc(1);
+
+  sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+#endif
+
+  args.alpha = NULL;
+  args.beta  = NULL;
+
+  offset = 0;
+
+  for (g = 0; g < *group_count; g++) {
+
+    trans    = get_trans(trans_array[g]);
+    args.m   = n_array[g];
+    args.n   = nrhs_array[g];
+    args.lda = lda_array[g];
+    args.ldb = ldb_array[g];
+    args.k   = group_size[g];
+
+    info = 0;
+    if (args.k   < 0)             info = 10;
+    if (args.ldb < MAX(1,args.m)) info = 8;
+    if (args.lda < MAX(1,args.m)) info = 5;
+    if (args.n   < 0)             info = 3;
+    if (args.m   < 0)             info = 2;
+    if (trans    < 0)             info = 1;
+
+    if (info) {
+      BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+      for (i = 0; i < args.k; i++) info_array[offset + i] = -info;
+      if (args.k > 0) offset += args.k;
+      continue;
+    }
+
+    if (args.m == 0 || args.n == 0) {
+      for (i = 0; i < args.k; i++) info_array[offset + i] = 0;
+    } else if (args.k > 0) {
+      args.a = (void *)(a_array    + offset);
+      args.b = (void *)(b_array    + offset);
+      args.c = (void *)(ipiv_array + offset);
+      args.d = (void *)(info_array + offset);
+
+      solve_group(&args, trans, sa, sb);
+    }
+
+    offset += args.k;
+  }
+
+#ifndef PPC440
+  blas_memory_free(buffer);
+#endif
+
+  FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, offset, offset);
+
+  IDEBUG_END;
+
+  return 0;
+}
+
+#else
+
+int NAME(char *TRANS, blasint *N, blasint *NRHS, FLOAT *a, blasint *ldA, blasint *strideA,
+	 blasint *ipiv, blasint *strideIpiv, FLOAT *b, blasint *ldB, blasint *strideB,
+	 blasint *batchSize, blasint *info_array){
+
+  blas_arg_t args;
+
+  blasint info;
+  int trans;
+  BLASLONG i, stride_a, stride_ipiv, stride_b;
+  FLOAT **a_array, **b_array;
+  blasint **ipiv_array;
+  FLOAT *buffer;
+#ifdef PPC440
+  extern
+#endif
+  FLOAT *sa, *sb;
+
+  PRINT_DEBUG_NAME;
+
+  trans       = get_trans(*TRANS);
+  args.m      = *N;
+  args.n      = *NRHS;
+  args.lda    = *ldA;
+  args.ldb    = *ldB;
+  args.k      = *batchSize;
+  stride_a    = *strideA;
+  stride_ipiv = *strideIpiv;
+  stride_b    = *strideB;
+
+  info = 0;
+  if (args.k      < 0)                   info = 12;
+  if (stride_b    < args.ldb * args.n)   info = 11;
+  if (args.ldb    < MAX(1,args.m))       info = 10;
+  if (stride_ipiv < args.m)              info = 8;
+  if (stride_a    < args.lda * args.m)   info = 6;
+  if (args.lda    < MAX(1,args.m))       info = 5;
+  if (args.n      < 0)                   info = 3;
+  if (args.m      < 0)                   info = 2;
+  if (trans       < 0)                   info = 1;
+
+  if (info) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    for (i = 0; i < args.k; i++) info_array[i] = -info;
+    return 0;
+  }
+
+  for (i = 0; i < args.k; i++) info_array[i] = 0;
+
+  if (args.m == 0 || args.n == 0 || args.k == 0) return 0;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+  a_array    = (FLOAT   **)malloc(args.k * sizeof(FLOAT   *));
+  b_array    = (FLOAT   **)malloc(args.k * sizeof(FLOAT   *));
+  ipiv_array = (blasint **)malloc(args.k * sizeof(blasint *));
+  if (a_array == NULL || b_array == NULL || ipiv_array == NULL) {
+    fprintf(stderr, "OpenBLAS: malloc failed in %s\n", __func__);
+    exit(1);
+  }
+
+  for (i = 0; i < args.k; i++) {
+    a_array[i]    = a    + i * stride_a;
+    b_array[i]    = b    + i * stride_b;
+    ipiv_array[i] = ipiv + i * stride_ipiv;
+  }
+
+#ifndef PPC440
+  buffer = (FLOAT *)blas_memory_alloc(1);
+
+  sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+#endif
+
+  args.a     = (void *)a_array;
+  args.b     = (void *)b_array;
+  args.c     = (void *)ipiv_array;
+  args.d     = (void *)info_array;
+  args.alpha = NULL;
+  args.beta  = NULL;
+
+  solve_group(&args, trans, sa, sb);
+
+#ifndef PPC440
+  blas_memory_free(buffer);
+#endif
+
+  free(a_array);
+  free(b_array);
+  free(ipiv_array);
+
+  FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, args.k * args.m * args.n, 2. * args.k * args.m * args.m * args.n);
+
+  IDEBUG_END;
+
+  return 0;
+}
+#endif
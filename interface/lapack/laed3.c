@@ -0,0 +1,120 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+#ifndef LAED3_THREAD_MIN
+#define LAED3_THREAD_MIN 262144.
+#endif
+
+#ifdef XDOUBLE
+#define ERROR_NAME "QLAED3"
+#elif defined(DOUBLE)
+#define ERROR_NAME "DLAED3"
+#else
+#define ERROR_NAME "SLAED3"
+#endif
+
+int NAME(blasint *K, blasint *N, blasint *N1, FLOAT *d, FLOAT *q, blasint *ldQ, FLOAT *RHO,
+	 FLOAT *dlambda, FLOAT *q2, blasint *indx, blasint *ctot, FLOAT *w, FLOAT *s, blasint *Info){
+
+  BLASLONG k, n, n1, ldq;
+  blasint info;
+  FLOAT *buffer;
+#ifdef PPC440
+  extern
+#endif
+  FLOAT *sa, *sb;
+#ifdef SMP
+  BLASLONG nthreads;
+#endif
+
+  PRINT_DEBUG_NAME;
+
+  k   = *K;
+  n   = *N;
+  n1  = *N1;
+  ldq = *ldQ;
+
+  info  = 0;
+  if (ldq < MAX(1, n)) info = 6;
+  if (n   < k)         info = 2;
+  if (k   < 0)         info = 1;
+  if (info) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    *Info = - info;
+    return 0;
+  }
+
+  *Info = 0;
+
+  if (k == 0) return 0;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+#ifndef PPC440
+  buffer = (FLOAT *)blas_memory_alloc(1);
+
+  sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+#endif
+
+#ifdef SMP
+  /* small merges near the leaves of the merge tree stay on one thread */
+  if ((double)n * (double)k * (double)k < LAED3_THREAD_MIN) {
+    nthreads = 1;
+  } else {
+    nthreads = num_cpu_avail(4);
+  }
+
+  if (nthreads == 1) {
+#endif
+
+    *Info = LAED3_SINGLE(k, n, n1, d, q, ldq, *RHO, dlambda, q2, indx, ctot, w, s, sa, sb);
+
+#ifdef SMP
+  } else {
+    *Info = LAED3_PARALLEL(k, n, n1, d, q, ldq, *RHO, dlambda, q2, indx, ctot, w, s, sa, sb, nthreads);
+  }
+#endif
+
+#ifndef PPC440
+  blas_memory_free(buffer);
+#endif
+
+  FUNCTION_PROFILE_END(1, n * k, 2. * n * k * k);
+
+  IDEBUG_END;
+
+  return 0;
+}
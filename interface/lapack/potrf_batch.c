@@ -0,0 +1,259 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+/*
+ * Cholesky factorization of many small independent matrices in one call,
+ * grouped like cblas_?gemm_batch (uplo_array[g], n_array[g] and
+ * lda_array[g] apply to the group_size[g] matrices of group g) or, with
+ * STRIDED, one shape for all matrices found at a fixed stride. info_array
+ * receives the INFO of POTRF for every matrix; a group with an invalid
+ * argument is reported through xerbla and has its entries set to -i.
+ */
+
+#ifndef STRIDED
+#ifdef DOUBLE
+#define ERROR_NAME "DPOTRF_BATCH"
+#else
+#define ERROR_NAME "SPOTRF_BATCH"
+#endif
+#else
+#ifdef DOUBLE
+#define ERROR_NAME "DPOTRF_BATCH_STRIDED"
+#else
+#define ERROR_NAME "SPOTRF_BATCH_STRIDED"
+#endif
+#endif
+
+/* below this many flops in a group a single thread does the whole group */
+#define BATCH_THREAD_MIN 262144
+
+static blasint (*potrf_batch_single[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  POTRF_U_BATCH_SINGLE, POTRF_L_BATCH_SINGLE,
+};
+
+#ifdef SMP
+static blasint (*potrf_batch_parallel[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  POTRF_U_BATCH_PARALLEL, POTRF_L_BATCH_PARALLEL,
+};
+#endif
+
+static int get_uplo(char uplo_arg) {
+
+  TOUPPER(uplo_arg);
+
+  if (uplo_arg == 'U') return 0;
+  if (uplo_arg == 'L') return 1;
+
+  return -1;
+}
+
+static void factor_group(blas_arg_t *args, int uplo, FLOAT *sa, FLOAT *sb) {
+
+#ifdef SMP
+  args -> common = NULL;
+  if ((double)args -> k * args -> n * args -> n * args -> n < BATCH_THREAD_MIN)
+    args -> nthreads = 1;
+  else
+    args -> nthreads = num_cpu_avail(4);
+
+  if (args -> nthreads == 1) {
+#endif
+
+    (potrf_batch_single[uplo])(args, NULL, NULL, sa, sb, 0);
+
+#ifdef SMP
+  } else {
+    (potrf_batch_parallel[uplo])(args, NULL, NULL, sa, sb, 0);
+  }
+#endif
+}
+
+#ifndef STRIDED
+int NAME(char *uplo_array, blasint *n_array, FLOAT **a_array, blasint *lda_array,
+	 blasint *group_count, blasint *group_size, blasint *info_array){
+
+  blas_arg_t args;
+
+  blasint info;
+  int uplo;
+  BLASLONG g, i, offset;
+  FLOAT *buffer;
+#ifdef PPC440
+  extern
+#endif
+  FLOAT *sa, *sb;
+
+  PRINT_DEBUG_NAME;
+
+  if (*group_count < 0) {
+    info = 5;
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    return 0;
+  }
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+#ifndef PPC440
+  buffer = (FLOAT *)blas_memory_alloc(1);
+
+  sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+#endif
+
+  offset = 0;
+
+  for (g = 0; g < *group_count; g++) {
+
+    uplo     = get_uplo(uplo_array[g]);
+    args.n   = n_array[g];
+    args.lda = lda_array[g];
+    args.k   = group_size[g];
+
+    info = 0;
+    if (args.k   < 0)             info = 6;
+    if (args.lda < MAX(1,args.n)) info = 4;
+    if (args.n   < 0)             info = 2;
+    if (uplo     < 0)             info = 1;
+
+    if (info) {
+      BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+      for (i = 0; i < args.k; i++) info_array[offset + i] = -info;
+      if (args.k > 0) offset += args.k;
+      continue;
+    }
+
+    if (args.n == 0) {
+      for (i = 0; i < args.k; i++) info_array[offset + i] = 0;
+    } else if (args.k > 0) {
+      args.a = (void *)(a_array    + offset);
+      args.d = (void *)(info_array + offset);
+
+      factor_group(&args, uplo, sa, sb);
+    }
+
+    offset += args.k;
+  }
+
+#ifndef PPC440
+  blas_memory_free(buffer);
+#endif
+
+  FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, offset, offset);
+
+  IDEBUG_END;
+
+  return 0;
+}
+
+#else
+
+int NAME(char *UPLO, blasint *N, FLOAT *a, blasint *ldA, blasint *strideA,
+	 blasint *batchSize, blasint *info_array){
+
+  blas_arg_t args;
+
+  blasint info;
+  int uplo;
+  BLASLONG i, stride_a;
+  FLOAT **a_array;
+  FLOAT *buffer;
+#ifdef PPC440
+  extern
+#endif
+  FLOAT *sa, *sb;
+
+  PRINT_DEBUG_NAME;
+
+  uplo     = get_uplo(*UPLO);
+  args.n   = *N;
+  args.lda = *ldA;
+  args.k   = *batchSize;
+  stride_a = *strideA;
+
+  info = 0;
+  if (args.k   < 0)                 info = 6;
+  if (stride_a < args.lda * args.n) info = 5;
+  if (args.lda < MAX(1,args.n))     info = 4;
+  if (args.n   < 0)                 info = 2;
+  if (uplo     < 0)                 info = 1;
+
+  if (info) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    for (i = 0; i < args.k; i++) info_array[i] = -info;
+    return 0;
+  }
+
+  for (i = 0; i < args.k; i++) info_array[i] = 0;
+
+  if (args.n == 0 || args.k == 0) return 0;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+  a_array = (FLOAT **)malloc(args.k * sizeof(FLOAT *));
+  if (a_array == NULL) {
+    fprintf(stderr, "OpenBLAS: malloc failed in %s\n", __func__);
+    exit(1);
+  }
+
+  for (i = 0; i < args.k; i++) a_array[i] = a + i * stride_a;
+
+#ifndef PPC440
+  buffer = (FLOAT *)blas_memory_alloc(1);
+
+  sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+#endif
+
+  args.a = (void *)a_array;
+  args.d = (void *)info_array;
+
+  factor_group(&args, uplo, sa, sb);
+
+#ifndef PPC440
+  blas_memory_free(buffer);
+#endif
+
+  free(a_array);
+
+  FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, args.k * args.n * args.n, 1. / 3. * args.k * args.n * args.n * args.n);
+
+  IDEBUG_END;
+
+  return 0;
+}
+#endif
@@ -0,0 +1,353 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include <float.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+#ifdef XDOUBLE
+#define ERROR_NAME "QSYEVD"
+#elif defined(DOUBLE)
+#define ERROR_NAME "DSYEVD"
+#else
+#define ERROR_NAME "SSYEVD"
+#endif
+
+#ifndef DOUBLE
+#define STERF BLASFUNC(ssterf)
+#define STEDC BLASFUNC(sstedc)
+#define SAFE_MIN FLT_MIN
+#define PREC     FLT_EPSILON
+#else
+#define STERF BLASFUNC(dsterf)
+#define STEDC BLASFUNC(dstedc)
+#define SAFE_MIN DBL_MIN
+#define PREC     DBL_EPSILON
+#endif
+
+extern void STERF(blasint *, FLOAT *, FLOAT *, blasint *);
+extern void STEDC(char *, blasint *, FLOAT *, FLOAT *, FLOAT *, blasint *, FLOAT *, blasint *,
+		  blasint *, blasint *, blasint *);
+
+/* bandwidth of the intermediate band matrix of the two-stage reduction */
+#ifndef SYEVD_KD
+#define SYEVD_KD 32
+#endif
+
+/*
+ * DSYEVD with the OpenBLAS two-stage tridiagonal reduction in place of
+ * DSYTRD: SY2SB reduces A to a band of SYEVD_KD subdiagonals with level-3
+ * updates, SB2ST chases the band down to tridiagonal, and DSTERF or DSTEDC
+ * solve the tridiagonal problem.  The eigenvectors are back-transformed
+ * with the stored reflectors of the second stage and then with ORMQR for
+ * the first.  WORK and IWORK keep the sizes DSYEVD documents; the band,
+ * the reflectors of the second stage and, for UPLO = 'U', a lower copy of
+ * A are allocated here.
+ */
+
+int NAME(char *JOBZ, char *UPLO, blasint *N, FLOAT *a, blasint *ldA, FLOAT *w,
+	 FLOAT *work, blasint *lWork, blasint *iwork, blasint *liWork, blasint *Info){
+
+  char jobz_arg = *JOBZ;
+  char uplo_arg = *UPLO;
+
+  blas_arg_t args;
+
+  blasint info, n, lda, lwork, liwork, lwmin, liwmin, lwork2, ldz;
+  int wantz, uplo, iscale;
+  BLASLONG kd, ldab, slots, ldr, i, j;
+  FLOAT anrm, sigma, smlnum, rmin, rmax;
+  FLOAT *buffer, *workspace, *heap, *r, *ab, *aux, *hous, *htau, *e, *tau, *z;
+  size_t size;
+  char compz = 'I';
+#ifdef PPC440
+  extern
+#endif
+  FLOAT *sa, *sb;
+
+  PRINT_DEBUG_NAME;
+
+  n      = *N;
+  lda    = *ldA;
+  lwork  = *lWork;
+  liwork = *liWork;
+
+  TOUPPER(jobz_arg);
+  TOUPPER(uplo_arg);
+
+  wantz = -1;
+  if (jobz_arg == 'N') wantz = 0;
+  if (jobz_arg == 'V') wantz = 1;
+
+  uplo = -1;
+  if (uplo_arg == 'U') uplo = 0;
+  if (uplo_arg == 'L') uplo = 1;
+
+  if (n <= 1) {
+    lwmin  = 1;
+    liwmin = 1;
+  } else if (wantz == 1) {
+    lwmin  = 1 + 6 * n + 2 * n * n;
+    liwmin = 3 + 5 * n;
+  } else {
+    lwmin  = 2 * n + 1;
+    liwmin = 1;
+  }
+
+  info = 0;
+  if ((lwork != -1) && (liwork != -1)) {
+    if (liwork < liwmin) info = 10;
+    if (lwork  < lwmin)  info =  8;
+  }
+  if (lda < MAX(1, n)) info = 5;
+  if (n    < 0)        info = 3;
+  if (uplo  < 0)       info = 2;
+  if (wantz < 0)       info = 1;
+  if (info) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    *Info = - info;
+    return 0;
+  }
+
+  *Info = 0;
+  work[0]  = (FLOAT)lwmin;
+  iwork[0] = liwmin;
+
+  if ((lwork == -1) || (liwork == -1)) return 0;
+  if (n == 0) return 0;
+
+  if (n == 1) {
+    w[0] = a[0];
+    if (wantz) a[0] = ONE;
+    return 0;
+  }
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+  /* scale A to the range DSYEVD works in */
+  smlnum = SAFE_MIN / PREC;
+  rmin   = sqrt(smlnum);
+  rmax   = sqrt(ONE / smlnum);
+
+  anrm = ZERO;
+  for (j = 0; j < n; j++) {
+    for (i = (uplo ? j : 0); i < (uplo ? n : j + 1); i++) {
+      if (fabs(a[i + j * lda]) > anrm || a[i + j * lda] != a[i + j * lda]) anrm = fabs(a[i + j * lda]);
+    }
+  }
+
+  iscale = 0;
+  sigma  = ONE;
+  if ((anrm > ZERO) && (anrm < rmin)) {
+    iscale = 1;
+    sigma  = rmin / anrm;
+  } else if (anrm > rmax) {
+    iscale = 1;
+    sigma  = rmax / anrm;
+  }
+  if (iscale) {
+    for (j = 0; j < n; j++) {
+      if (uplo) SCAL_K(n - j, 0, 0, sigma, a + j + j * lda, 1, NULL, 0, NULL, 0);
+      else      SCAL_K(j + 1, 0, 0, sigma, a + j * lda, 1, NULL, 0, NULL, 0);
+    }
+  }
+
+  kd    = MIN(SYEVD_KD, n - 1);
+  ldab  = 2 * kd + 1;
+  slots = n / kd + 3;
+
+  /* the reduction works on the lower triangle, of A or of a copy */
+  ldr  = uplo ? lda : n;
+  size = ldab * n + 2 * n * kd + 2 * kd * kd;
+  if (!uplo) size += (size_t)n * n;
+  if (wantz) size += (size_t)n * slots * (kd + 1);
+
+  heap = (FLOAT *)malloc(size * SIZE);
+  if (heap == NULL) {
+    fprintf(stderr, "OpenBLAS: malloc failed in %s\n", __func__);
+    exit(1);
+  }
+
+  ab   = heap;
+  aux  = ab + ldab * n;
+  r    = uplo ? a : aux + 2 * n * kd + 2 * kd * kd;
+  hous = NULL;
+  htau = NULL;
+  if (wantz) {
+    hous = (uplo ? aux + 2 * n * kd + 2 * kd * kd : r + (size_t)n * n);
+    htau = hous + (size_t)n * slots * kd;
+  }
+
+  if (!uplo) {
+    for (j = 0; j < n; j++) COPY_K(n - j, a + j + j * lda, lda, r + j + j * n, 1);
+  }
+
+  e   = work;
+  tau = work + n;
+
+#ifndef PPC440
+  buffer = (FLOAT *)blas_memory_alloc(1);
+
+  sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+#endif
+
+  workspace = (FLOAT *)blas_memory_alloc(1);
+
+#ifdef SMP
+  args.common = NULL;
+
+  if (n < 128) {
+    args.nthreads = 1;
+  } else {
+    args.nthreads = num_cpu_avail(4);
+  }
+#endif
+
+  /* dense to band */
+  args.a   = (void *)r;
+  args.lda = ldr;
+  args.n   = n;
+  args.k   = kd;
+  args.b   = (void *)tau;
+  args.c   = (void *)workspace;
+  args.d   = (void *)aux;
+
+#ifdef SMP
+  if (args.nthreads == 1) {
+#endif
+    SYTRD_SY2SB_SINGLE(&args, NULL, NULL, sa, sb, 0);
+#ifdef SMP
+  } else {
+    SYTRD_SY2SB_PARALLEL(&args, NULL, NULL, sa, sb, 0);
+  }
+#endif
+
+  /* band to tridiagonal */
+  for (i = 0; i < ldab * n; i++) ab[i] = ZERO;
+  for (j = 0; j < n; j++) COPY_K(MIN(kd + 1, n - j), r + j + j * ldr, 1, ab + j * ldab, 1);
+
+  args.a     = (void *)ab;
+  args.lda   = ldab;
+  args.n     = n;
+  args.k     = kd;
+  args.alpha = (void *)w;
+  args.beta  = (void *)e;
+  args.b     = (void *)hous;
+  args.c     = (void *)htau;
+  args.ldb   = slots;
+
+#ifdef SMP
+  if (args.nthreads == 1) {
+#endif
+    SYTRD_SB2ST_SINGLE(&args, NULL, NULL, sa, sb, 0);
+#ifdef SMP
+  } else {
+    SYTRD_SB2ST_PARALLEL(&args, NULL, NULL, sa, sb, 0);
+  }
+#endif
+
+  if (!wantz) {
+    STERF(&n, w, e, Info);
+  } else {
+    z      = work + 2 * n;
+    ldz    = n;
+    lwork2 = lwork - 2 * n - n * n;
+
+    STEDC(&compz, &n, w, e, z, &ldz, z + (size_t)n * n, &lwork2, iwork, &liwork, Info);
+
+    /* Z := Q2 Z */
+    args.m   = n;
+    args.n   = n;
+    args.k   = kd;
+    args.a   = (void *)hous;
+    args.lda = slots;
+    args.b   = (void *)htau;
+    args.c   = (void *)z;
+    args.ldc = n;
+
+#ifdef SMP
+    if (args.nthreads == 1) {
+#endif
+      SYTRD_Q2_SINGLE(&args, NULL, NULL, sa, sb, 0);
+#ifdef SMP
+    } else {
+      SYTRD_Q2_PARALLEL(&args, NULL, NULL, sa, sb, 0);
+    }
+#endif
+
+    /* Z := Q1 Z, the reflectors of the first stage start kd rows down */
+    if (n > kd + 1) {
+      args.m   = n - kd;
+      args.n   = n;
+      args.k   = n - kd;
+      args.a   = (void *)(r + kd);
+      args.lda = ldr;
+      args.b   = (void *)tau;
+      args.c   = (void *)(z + kd);
+      args.ldc = n;
+      args.d   = (void *)workspace;
+
+#ifdef SMP
+      if (args.nthreads == 1) {
+#endif
+	ORMQR_LN_SINGLE(&args, NULL, NULL, sa, sb, 0);
+#ifdef SMP
+      } else {
+	ORMQR_LN_PARALLEL(&args, NULL, NULL, sa, sb, 0);
+      }
+#endif
+    }
+
+    for (j = 0; j < n; j++) COPY_K(n, z + j * n, 1, a + j * lda, 1);
+  }
+
+  if (iscale) SCAL_K(n, 0, 0, ONE / sigma, w, 1, NULL, 0, NULL, 0);
+
+  work[0]  = (FLOAT)lwmin;
+  iwork[0] = liwmin;
+
+  blas_memory_free(workspace);
+
+#ifndef PPC440
+  blas_memory_free(buffer);
+#endif
+
+  free(heap);
+
+  FUNCTION_PROFILE_END(1, n * n, 4. / 3. * n * n * n + (wantz ? 4. * n * n * n : 0.));
+
+  IDEBUG_END;
+
+  return 0;
+}
@@ -0,0 +1,176 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+#ifdef XDOUBLE
+#define ERROR_NAME "QSYTRF"
+#elif defined(DOUBLE)
+#define ERROR_NAME "DSYTRF"
+#else
+#define ERROR_NAME "SSYTRF"
+#endif
+
+#ifndef SYTRF_NB
+#define SYTRF_NB 64
+#endif
+
+static blasint (*sytrf_single[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  SYTRF_U_SINGLE, SYTRF_L_SINGLE,
+};
+
+#ifdef SMP
+static blasint (*sytrf_parallel[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  SYTRF_U_PARALLEL, SYTRF_L_PARALLEL,
+};
+#endif
+
+int NAME(char *UPLO, blasint *N, FLOAT *a, blasint *ldA, blasint *ipiv, FLOAT *work, blasint *lWork, blasint *Info){
+
+  blas_arg_t args;
+
+  blasint uplo_arg = *UPLO;
+  blasint uplo;
+  blasint info, lwork;
+  BLASLONG nb;
+  int heap = 0;
+  FLOAT *buffer, *workspace;
+#ifdef PPC440
+  extern
+#endif
+  FLOAT *sa, *sb;
+
+  PRINT_DEBUG_NAME;
+
+  args.n    = *N;
+  args.a    = (void *)a;
+  args.lda  = *ldA;
+  args.c    = (void *)ipiv;
+
+  lwork = *lWork;
+
+  TOUPPER(uplo_arg);
+
+  uplo = -1;
+  if (uplo_arg == 'U') uplo = 0;
+  if (uplo_arg == 'L') uplo = 1;
+
+  info  = 0;
+  if ((lwork < 1) && (lwork != -1)) info = 7;
+  if (args.lda < MAX(1,args.n)) info = 4;
+  if (args.n   < 0)             info = 2;
+  if (uplo     < 0)             info = 1;
+  if (info) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    *Info = - info;
+    return 0;
+  }
+
+  /* the panel workspace is internal, WORK is not used */
+  *Info = 0;
+  work[0] = ONE;
+
+  if (lwork == -1) return 0;
+  if (args.n == 0) return 0;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+#ifndef PPC440
+  buffer = (FLOAT *)blas_memory_alloc(1);
+
+  sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+#endif
+
+  nb = BUFFER_SIZE / (SIZE * args.n);
+  if (nb > SYTRF_NB) nb = SYTRF_NB;
+
+  if (nb >= 2) {
+    workspace = (FLOAT *)blas_memory_alloc(1);
+  } else {
+    /* too tall for a two column panel in the buffer */
+    nb   = 2;
+    heap = 1;
+    workspace = (FLOAT *)malloc(args.n * nb * SIZE);
+    if (workspace == NULL) {
+      fprintf(stderr, "OpenBLAS: malloc failed in %s\n", __func__);
+      exit(1);
+    }
+  }
+
+  args.b   = (void *)workspace;
+  args.ldb = nb;
+
+#ifdef SMP
+  args.common = NULL;
+#ifndef DOUBLE
+  int nmax = 256;
+#else
+  int nmax = 128;
+#endif
+  if (args.n <nmax) {
+    args.nthreads = 1;
+  } else {
+    args.nthreads = num_cpu_avail(4);
+    if (args.n/args.nthreads <nmax)
+	    args.nthreads = args.n/nmax;
+  }
+
+  if (args.nthreads == 1) {
+#endif
+
+    *Info = (sytrf_single[uplo])(&args, NULL, NULL, sa, sb, 0);
+
+#ifdef SMP
+  } else {
+    *Info = (sytrf_parallel[uplo])(&args, NULL, NULL, sa, sb, 0);
+  }
+#endif
+
+  if (heap) {
+    free(workspace);
+  } else {
+    blas_memory_free(workspace);
+  }
+
+#ifndef PPC440
+  blas_memory_free(buffer);
+#endif
+
+  FUNCTION_PROFILE_END(1, .5 * args.n * args.n, args.n * args.n * args.n / 3.);
+
+  IDEBUG_END;
+
+  return 0;
+}
@@ -0,0 +1,157 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+#ifdef XDOUBLE
+#define ERROR_NAME "XGETRI"
+#elif defined(DOUBLE)
+#define ERROR_NAME "ZGETRI"
+#else
+#define ERROR_NAME "CGETRI"
+#endif
+
+#ifndef GETRI_NB
+#define GETRI_NB 64
+#endif
+
+int NAME(blasint *N, FLOAT *a, blasint *ldA, blasint *ipiv, FLOAT *work, blasint *lWork, blasint *Info){
+
+  blas_arg_t args;
+
+  blasint info, lwork;
+  BLASLONG nb;
+  int heap = 0;
+  FLOAT *buffer, *workspace;
+#ifdef PPC440
+  extern
+#endif
+  FLOAT *sa, *sb;
+
+  PRINT_DEBUG_NAME;
+
+  args.n    = *N;
+  args.a    = (void *)a;
+  args.lda  = *ldA;
+  args.c    = (void *)ipiv;
+
+  lwork = *lWork;
+
+  info  = 0;
+  if ((lwork < MAX(1,args.n)) && (lwork != -1)) info = 6;
+  if (args.lda < MAX(1,args.n)) info = 3;
+  if (args.n   < 0)             info = 1;
+  if (info) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME) - 1);
+    *Info = - info;
+    return 0;
+  }
+
+  /* the block workspace is internal, WORK is not used */
+  *Info = 0;
+  work[0] = (FLOAT)MAX(1,args.n);
+  work[1] = ZERO;
+
+  if (lwork == -1) return 0;
+  if (args.n == 0) return 0;
+
+  if (AMIN_K(args.n, args.a, args.lda + 1) == ZERO) {
+    *Info = IAMIN_K(args.n, args.a, args.lda + 1);
+    return 0;
+  }
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+#ifndef PPC440
+  buffer = (FLOAT *)blas_memory_alloc(1);
+
+  sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+#endif
+
+  nb = BUFFER_SIZE / (COMPSIZE * SIZE * args.n);
+  if (nb > GETRI_NB) nb = GETRI_NB;
+
+  if (nb >= 1) {
+    workspace = (FLOAT *)blas_memory_alloc(1);
+  } else {
+    /* too tall for a single column in the buffer */
+    nb   = 1;
+    heap = 1;
+    workspace = (FLOAT *)malloc(args.n * nb * COMPSIZE * SIZE);
+    if (workspace == NULL) {
+      fprintf(stderr, "OpenBLAS: malloc failed in %s\n", __func__);
+      exit(1);
+    }
+  }
+
+  args.b   = (void *)workspace;
+  args.ldb = nb;
+
+#ifdef SMP
+  args.common = NULL;
+  if (args.n * args.n < 10000)
+	args.nthreads = 1;
+  else
+	args.nthreads = num_cpu_avail(4);
+
+  if (args.nthreads == 1) {
+#endif
+
+    *Info = GETRI_SINGLE(&args, NULL, NULL, sa, sb, 0);
+
+#ifdef SMP
+  } else {
+
+    *Info = GETRI_PARALLEL(&args, NULL, NULL, sa, sb, 0);
+
+  }
+#endif
+
+  if (heap) {
+    free(workspace);
+  } else {
+    blas_memory_free(workspace);
+  }
+
+#ifndef PPC440
+  blas_memory_free(buffer);
+#endif
+
+  FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, args.n * args.n, 4. / 3. * args.n * args.n * args.n);
+
+  IDEBUG_END;
+
+  return 0;
+}
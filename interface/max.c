@@ -126,6 +126,77 @@
 
 #endif
 
+#ifdef SMP
+
+/* Each thread must get at least this many elements */
+#define MULTI_THREAD_MINIMAL  100000
+
+extern int blas_level1_thread_with_return_value(int mode, BLASLONG m, BLASLONG n, BLASLONG k, void *alpha, void *a, BLASLONG lda, void *b, BLASLONG ldb, void *c, BLASLONG ldc, int (*function)(), int nthreads);
+
+#ifndef COMPLEX
+static int max_thread_function(BLASLONG n, BLASLONG dummy0, BLASLONG dummy1, FLOAT dummy2,
+			       FLOAT *x, BLASLONG incx, FLOAT *dummy3, BLASLONG dummy4, FLOAT *result, BLASLONG dummy5){
+#else
+static int max_thread_function(BLASLONG n, BLASLONG dummy0, BLASLONG dummy1, FLOAT dummy2, FLOAT dummy6,
+			       FLOAT *x, BLASLONG incx, FLOAT *dummy3, BLASLONG dummy4, FLOAT *result, BLASLONG dummy5){
+#endif
+
+  *result = MAX_K(n, x, incx);
+
+  return 0;
+}
+
+static FLOAT max_threaded(BLASLONG n, FLOAT *x, BLASLONG incx, int nthreads){
+
+  char result[MAX_CPU_NUMBER * sizeof(double) * 2];
+  FLOAT dummy_alpha[2] = {ZERO, ZERO};
+  FLOAT *ptr, ret;
+  int i, mode;
+
+#ifdef XDOUBLE
+  mode = BLAS_XDOUBLE;
+#elif defined(DOUBLE)
+  mode = BLAS_DOUBLE;
+#else
+  mode = BLAS_SINGLE;
+#endif
+#ifndef COMPLEX
+  mode |= BLAS_REAL;
+#else
+  mode |= BLAS_COMPLEX;
+#endif
+
+  blas_level1_thread_with_return_value(mode, n, 0, 0, dummy_alpha, x, incx, NULL, 0, result, 0,
+				       (int (*)(void))max_thread_function, nthreads);
+
+  ptr = (FLOAT *)result;
+  ret = *ptr;
+
+  for (i = 1; i < nthreads; i++) {
+    ptr = (FLOAT *)(((char *)ptr) + sizeof(double) * 2);
+#ifdef USE_MIN
+    if (*ptr < ret) ret = *ptr;
+#else
+    if (*ptr > ret) ret = *ptr;
+#endif
+  }
+
+  return ret;
+}
+
+static int max_nthreads(BLASLONG n, BLASLONG incx){
+
+  int nthreads;
+
+  if (incx <= 0 || n < 2 * MULTI_THREAD_MINIMAL) return 1;
+
+  nthreads = num_cpu_avail(1);
+  if (nthreads > n / MULTI_THREAD_MINIMAL) nthreads = n / MULTI_THREAD_MINIMAL;
+
+  return nthreads;
+}
+#endif
+
 #ifndef CBLAS
 
 FLOATRET NAME(blasint *N, FLOAT *x, blasint *INCX){
@@ -133,6 +204,9 @@ FLOATRET NAME(blasint *N, FLOAT *x, blasint *INCX){
   BLASLONG n    = *N;
   BLASLONG incx = *INCX;
   FLOATRET ret;
+#ifdef SMP
+  int nthreads;
+#endif
 
   PRINT_DEBUG_NAME;
 
@@ -148,6 +222,13 @@ FLOATRET NAME(blasint *N, FLOAT *x, blasint *INCX){
 
   FUNCTION_PROFILE_START();
 
+#ifdef SMP
+  nthreads = max_nthreads(n, incx);
+
+  if (nthreads > 1)
+    ret = (FLOATRET)max_threaded(n, x, incx, nthreads);
+  else
+#endif
   ret = (FLOATRET)MAX_K(n, x, incx);
 
   FUNCTION_PROFILE_END(COMPSIZE, n, 0);
@@ -167,6 +248,9 @@ FLOAT CNAME(blasint n, FLOAT *x, blasint incx){
 #endif
   
   FLOAT ret;
+#ifdef SMP
+  int nthreads;
+#endif
 
   PRINT_DEBUG_CNAME;
 
@@ -182,6 +266,13 @@ FLOAT CNAME(blasint n, FLOAT *x, blasint incx){
 
   FUNCTION_PROFILE_START();
 
+#ifdef SMP
+  nthreads = max_nthreads(n, incx);
+
+  if (nthreads > 1)
+    ret = max_threaded(n, x, incx, nthreads);
+  else
+#endif
   ret = MAX_K(n, x, incx);
 
   FUNCTION_PROFILE_END(COMPSIZE, n, 0);
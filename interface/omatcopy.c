@@ -47,6 +47,29 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define BlasNoTrans  0
 #define BlasTrans    1
 
+#ifdef SMP
+#define MULTI_THREAD_MINIMAL  65536
+
+/* The outer dimension (columns for ColMajor, rows for RowMajor) is split
+   across threads; blas_level1_thread advances a by width * lda and b by
+   width * ldb (or by width when BLAS_TRANSB_T is set for a transpose). */
+static int omatcopy_cn(BLASLONG m, BLASLONG n, BLASLONG dummy, FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb, FLOAT *c, BLASLONG ldc){
+	return OMATCOPY_K_CN(n, m, alpha, a, lda, b, ldb);
+}
+
+static int omatcopy_ct(BLASLONG m, BLASLONG n, BLASLONG dummy, FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb, FLOAT *c, BLASLONG ldc){
+	return OMATCOPY_K_CT(n, m, alpha, a, lda, b, ldb);
+}
+
+static int omatcopy_rn(BLASLONG m, BLASLONG n, BLASLONG dummy, FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb, FLOAT *c, BLASLONG ldc){
+	return OMATCOPY_K_RN(m, n, alpha, a, lda, b, ldb);
+}
+
+static int omatcopy_rt(BLASLONG m, BLASLONG n, BLASLONG dummy, FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb, FLOAT *c, BLASLONG ldc){
+	return OMATCOPY_K_RT(m, n, alpha, a, lda, b, ldb);
+}
+#endif
+
 #ifndef CBLAS 
 void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha, FLOAT *a, blasint *lda, FLOAT *b, blasint *ldb)
 {
@@ -54,6 +77,9 @@ void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha,
 	char Order, Trans;
 	int order=-1,trans=-1;
 	blasint info = -1;
+#ifdef SMP
+	int mode, nthreads;
+#endif
 
 	Order = *ORDER;
 	Trans = *TRANS;
@@ -74,6 +100,9 @@ void CNAME(enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
 	FLOAT   *alpha; 
 	int order=-1,trans=-1;
 	blasint info = -1;
+#ifdef SMP
+	int mode, nthreads;
+#endif
 
 	if ( CORDER == CblasColMajor ) order = BlasColMajor; 
 	if ( CORDER == CblasRowMajor ) order = BlasRowMajor; 
@@ -113,6 +142,37 @@ void CNAME(enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
 
 	if ((*rows == 0) || (*cols == 0)) return;
 
+#ifdef SMP
+	if ( (BLASLONG)*rows * (BLASLONG)*cols < MULTI_THREAD_MINIMAL )
+		nthreads = 1;
+	else
+		nthreads = num_cpu_avail(1);
+
+	if ( nthreads > 1 )
+	{
+#ifdef DOUBLE
+		mode = BLAS_DOUBLE | BLAS_REAL;
+#else
+		mode = BLAS_SINGLE | BLAS_REAL;
+#endif
+		if ( order == BlasColMajor )
+		{
+			if ( trans == BlasNoTrans )
+				blas_level1_thread(mode, *cols, *rows, 0, alpha, a, *lda, b, *ldb, NULL, 0, (int (*)(void))omatcopy_cn, nthreads);
+			else
+				blas_level1_thread(mode | BLAS_TRANSB_T, *cols, *rows, 0, alpha, a, *lda, b, *ldb, NULL, 0, (int (*)(void))omatcopy_ct, nthreads);
+		}
+		else
+		{
+			if ( trans == BlasNoTrans )
+				blas_level1_thread(mode, *rows, *cols, 0, alpha, a, *lda, b, *ldb, NULL, 0, (int (*)(void))omatcopy_rn, nthreads);
+			else
+				blas_level1_thread(mode | BLAS_TRANSB_T, *rows, *cols, 0, alpha, a, *lda, b, *ldb, NULL, 0, (int (*)(void))omatcopy_rt, nthreads);
+		}
+		return;
+	}
+#endif
+
 	if ( order == BlasColMajor )
 	{
 		if ( trans == BlasNoTrans )
@@ -48,6 +48,16 @@
 #define ERROR_NAME "CGEADD "
 #endif
 
+#ifdef SMP
+#define MULTI_THREAD_MINIMAL  32768
+
+/* Columns are split across threads; C is passed as b and beta as c */
+static int geadd_thread(BLASLONG m, BLASLONG n, BLASLONG dummy, FLOAT alpha_r, FLOAT alpha_i,
+			FLOAT *a, BLASLONG lda, FLOAT *c, BLASLONG ldc, FLOAT *beta, BLASLONG dummy2){
+  return GEADD_K(n, m, alpha_r, alpha_i, a, lda, beta[0], beta[1], c, ldc);
+}
+#endif
+
 #ifndef CBLAS
 
 void NAME(blasint *M, blasint *N, FLOAT *ALPHA, FLOAT *a, blasint *LDA,
@@ -60,6 +70,9 @@ void NAME(blasint *M, blasint *N, FLOAT *ALPHA, FLOAT *a, blasint *LDA,
   blasint ldc = *LDC; 
 
   blasint info;
+#ifdef SMP
+  int mode, nthreads;
+#endif
 
   PRINT_DEBUG_NAME;
 
@@ -90,6 +103,9 @@ void CNAME(enum CBLAS_ORDER order,
 	   FLOAT  *c, blasint ldc){ */
 
   blasint info, t;
+#ifdef SMP
+  int mode, nthreads;
+#endif
 
   PRINT_DEBUG_CNAME;
 
@@ -134,8 +150,31 @@ void CNAME(enum CBLAS_ORDER order,
   FUNCTION_PROFILE_START();
 
 
+#ifdef SMP
+  if ((BLASLONG)m * (BLASLONG)n < MULTI_THREAD_MINIMAL)
+    nthreads = 1;
+  else
+    nthreads = num_cpu_avail(3);
+
+  if (nthreads == 1) {
+#endif
+
   GEADD_K(m,n,ALPHA[0],ALPHA[1], a, lda, BETA[0], BETA[1], c, ldc); 
 
+#ifdef SMP
+  } else {
+
+#ifdef DOUBLE
+    mode = BLAS_DOUBLE | BLAS_COMPLEX;
+#else
+    mode = BLAS_SINGLE | BLAS_COMPLEX;
+#endif
+
+    blas_level1_thread(mode, n, m, 0, ALPHA, a, lda, c, ldc, BETA, 0,
+		       (int (*)(void))geadd_thread, nthreads);
+  }
+#endif
+
 
   FUNCTION_PROFILE_END(1, 2* m * n ,  2 * m * n);
 
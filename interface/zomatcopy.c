@@ -49,6 +49,37 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define BlasTransConj    2
 #define BlasConj         3
 
+#ifdef SMP
+#define MULTI_THREAD_MINIMAL  65536
+
+/* As in omatcopy.c, the outer dimension (columns for ColMajor, rows for
+   RowMajor) is split across threads by blas_level1_thread. */
+#define COL_THREAD(name, kernel) \
+static int name(BLASLONG m, BLASLONG n, BLASLONG dummy, FLOAT alpha_r, FLOAT alpha_i, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb, FLOAT *c, BLASLONG ldc){ \
+	return kernel(n, m, alpha_r, alpha_i, a, lda, b, ldb); \
+}
+
+#define ROW_THREAD(name, kernel) \
+static int name(BLASLONG m, BLASLONG n, BLASLONG dummy, FLOAT alpha_r, FLOAT alpha_i, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb, FLOAT *c, BLASLONG ldc){ \
+	return kernel(m, n, alpha_r, alpha_i, a, lda, b, ldb); \
+}
+
+COL_THREAD(omatcopy_cn,  OMATCOPY_K_CN)
+COL_THREAD(omatcopy_ct,  OMATCOPY_K_CT)
+COL_THREAD(omatcopy_ctc, OMATCOPY_K_CTC)
+COL_THREAD(omatcopy_cnc, OMATCOPY_K_CNC)
+ROW_THREAD(omatcopy_rn,  OMATCOPY_K_RN)
+ROW_THREAD(omatcopy_rt,  OMATCOPY_K_RT)
+ROW_THREAD(omatcopy_rtc, OMATCOPY_K_RTC)
+ROW_THREAD(omatcopy_rnc, OMATCOPY_K_RNC)
+
+/* Indexed by [order][trans] */
+static int (*omatcopy_thread[2][4])(BLASLONG, BLASLONG, BLASLONG, FLOAT, FLOAT, FLOAT *, BLASLONG, FLOAT *, BLASLONG, FLOAT *, BLASLONG) = {
+	{ omatcopy_rn, omatcopy_rt, omatcopy_rtc, omatcopy_rnc },
+	{ omatcopy_cn, omatcopy_ct, omatcopy_ctc, omatcopy_cnc },
+};
+#endif
+
 #ifndef CBLAS
 void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha, FLOAT *a, blasint *lda, FLOAT *b, blasint *ldb)
 {
@@ -56,6 +87,9 @@ void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha,
 	char Order, Trans;
 	int order=-1,trans=-1;
 	blasint info = -1;
+#ifdef SMP
+	int mode, nthreads;
+#endif
 
 	Order = *ORDER;
 	Trans = *TRANS;
@@ -76,6 +110,9 @@ void CNAME(enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
 	blasint *rows, *cols, *lda, *ldb; 
 	int order=-1,trans=-1;
 	blasint info = -1;
+#ifdef SMP
+	int mode, nthreads;
+#endif
 
 	if ( CORDER == CblasColMajor ) order = BlasColMajor; 
 	if ( CORDER == CblasRowMajor ) order = BlasRowMajor; 
@@ -119,6 +156,30 @@ void CNAME(enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
 
 	if ((*rows == 0) || (*cols == 0)) return;
 
+#ifdef SMP
+	if ( (BLASLONG)*rows * (BLASLONG)*cols < MULTI_THREAD_MINIMAL )
+		nthreads = 1;
+	else
+		nthreads = num_cpu_avail(1);
+
+	if ( nthreads > 1 )
+	{
+#ifdef DOUBLE
+		mode = BLAS_DOUBLE | BLAS_COMPLEX;
+#else
+		mode = BLAS_SINGLE | BLAS_COMPLEX;
+#endif
+		if ( trans == BlasTrans || trans == BlasTransConj )
+			mode |= BLAS_TRANSB_T;
+
+		if ( order == BlasColMajor )
+			blas_level1_thread(mode, *cols, *rows, 0, alpha, a, *lda, b, *ldb, NULL, 0, (int (*)(void))omatcopy_thread[order][trans], nthreads);
+		else
+			blas_level1_thread(mode, *rows, *cols, 0, alpha, a, *lda, b, *ldb, NULL, 0, (int (*)(void))omatcopy_thread[order][trans], nthreads);
+		return;
+	}
+#endif
+
 	if ( order == BlasColMajor )
 	{
 
@@ -0,0 +1,130 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include "common.h"
+
+/*
+ * GEMM kernels for a fixed list of small shapes.
+ *
+ * Every (M, N, K, transa, transb) in GEMM_SMALL_FIXED_SHAPES gets its own
+ * function with the sizes and the transposes as literal constants, so the
+ * compiler can unroll the loops completely and keep a column of C in
+ * registers, with no remainder handling.  CNAME looks the shape up and
+ * returns 1 if it ran a kernel, or 0 to leave the call to the generic
+ * small matrix kernels and the blocked driver.
+ *
+ * A target can replace the list by defining GEMM_SMALL_FIXED_SHAPES in
+ * param.h.  Each dimension has to be below 256 to fit the lookup key.
+ */
+
+#ifndef GEMM_SMALL_FIXED_SHAPES
+#define GEMM_SMALL_FIXED_SHAPES(SHAPE) \
+	SHAPE( 4,  4,  4) \
+	SHAPE( 6,  6,  6) \
+	SHAPE( 8,  8,  8) \
+	SHAPE(12, 12,  4) \
+	SHAPE(16, 16, 16) \
+	SHAPE(24, 24, 24)
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC optimize ("O3")
+#endif
+
+typedef void (*fixed_kernel_t)(FLOAT *, BLASLONG, FLOAT, FLOAT *, BLASLONG, FLOAT, FLOAT *, BLASLONG);
+
+#define A_ELEM(TA, i, l)	((TA) ? A[(l) + (i) * lda] : A[(i) + (l) * lda])
+#define B_ELEM(TB, l, j)	((TB) ? B[(j) + (l) * ldb] : B[(l) + (j) * ldb])
+
+/*
+ * Without a transposed A each column of C is built as a sum of scaled
+ * columns of A; otherwise the rows of A are contiguous and each entry
+ * is a dot product.
+ */
+#define FIXED_KERNEL(TA, TB, M, N, K) \
+static void fixed_kernel_##TA##TB##_##M##x##N##x##K(FLOAT *A, BLASLONG lda, FLOAT alpha, \
+		FLOAT *B, BLASLONG ldb, FLOAT beta, FLOAT *C, BLASLONG ldc) \
+{ \
+	BLASLONG i, j, l; \
+	FLOAT result[M], b, sum; \
+\
+	for (j = 0; j < N; j++) { \
+		if (!(TA)) { \
+			for (i = 0; i < M; i++) result[i] = ZERO; \
+			for (l = 0; l < K; l++) { \
+				b = B_ELEM(TB, l, j); \
+				for (i = 0; i < M; i++) result[i] += A_ELEM(TA, i, l) * b; \
+			} \
+		} else { \
+			for (i = 0; i < M; i++) { \
+				sum = ZERO; \
+				for (l = 0; l < K; l++) sum += A_ELEM(TA, i, l) * B_ELEM(TB, l, j); \
+				result[i] = sum; \
+			} \
+		} \
+		if (beta == ZERO) { \
+			for (i = 0; i < M; i++) C[i + j * ldc] = alpha * result[i]; \
+		} else { \
+			for (i = 0; i < M; i++) C[i + j * ldc] = alpha * result[i] + beta * C[i + j * ldc]; \
+		} \
+	} \
+}
+
+#define FIXED_KERNELS(M, N, K) \
+	FIXED_KERNEL(0, 0, M, N, K) \
+	FIXED_KERNEL(1, 0, M, N, K) \
+	FIXED_KERNEL(0, 1, M, N, K) \
+	FIXED_KERNEL(1, 1, M, N, K) \
+static const fixed_kernel_t fixed_kernels_##M##x##N##x##K[4] = { \
+	fixed_kernel_00_##M##x##N##x##K, fixed_kernel_10_##M##x##N##x##K, \
+	fixed_kernel_01_##M##x##N##x##K, fixed_kernel_11_##M##x##N##x##K, \
+};
+
+GEMM_SMALL_FIXED_SHAPES(FIXED_KERNELS)
+
+#define FIXED_KEY(M, N, K)	(((M) << 16) | ((N) << 8) | (K))
+
+#define FIXED_CASE(M, N, K) \
+	case FIXED_KEY(M, N, K): kernel = fixed_kernels_##M##x##N##x##K[(transb << 1) | transa]; break;
+
+int CNAME(int transa, int transb, BLASLONG M, BLASLONG N, BLASLONG K, FLOAT * A, BLASLONG lda, FLOAT alpha, FLOAT * B, BLASLONG ldb, FLOAT beta, FLOAT * C, BLASLONG ldc)
+{
+	fixed_kernel_t kernel;
+
+	if ((M | N | K) & ~(BLASLONG)0xff) return 0;
+
+	switch (FIXED_KEY(M, N, K)) {
+		GEMM_SMALL_FIXED_SHAPES(FIXED_CASE)
+	default:
+		return 0;
+	}
+
+	kernel(A, lda, alpha, B, ldb, beta, C, ldc);
+
+	return 1;
+}
@@ -0,0 +1,89 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+#include "common.h"
+
+/*
+ * Packs a block of op(A) (int8) or op(B) (uint8, built with OUTER) for
+ * i8gemm_kernel.  m is the depth along K and n the number of rows of
+ * op(A) or columns of op(B) in the block.
+ *
+ * Every panel of UNROLL rows (columns) is stored as groups of four
+ * consecutive K values: for each group, UNROLL runs of 4 bytes.  Short
+ * panels and the tail of K are padded with zeros, so a panel takes
+ * UNROLL * ((m + 3) & ~3) bytes whatever the size of the block.
+ */
+
+#ifndef OUTER
+#define UNROLL		I8GEMM_DEFAULT_UNROLL_M
+typedef int8_t  itype;
+#else
+#define UNROLL		I8GEMM_DEFAULT_UNROLL_N
+typedef uint8_t itype;
+#endif
+
+/* the row (column) index runs along the leading dimension for a plain A
+   and a transposed B, and the K index does for the other two */
+#if defined(OUTER) == defined(TRANS)
+#define ELEMENT(r, l)	a[(r) + (l) * lda]
+#else
+#define ELEMENT(r, l)	a[(l) + (r) * lda]
+#endif
+
+int CNAME(BLASLONG m, BLASLONG n, itype *a, BLASLONG lda, itype *b){
+
+  BLASLONG js, ls, r, q, min_j;
+
+  for (js = 0; js < n; js += UNROLL) {
+
+    min_j = n - js;
+    if (min_j > UNROLL) min_j = UNROLL;
+
+    for (ls = 0; ls < m; ls += 4) {
+
+      if ((min_j == UNROLL) && (ls + 4 <= m)) {
+	for (r = 0; r < UNROLL; r++) {
+	  b[0] = ELEMENT(js + r, ls + 0);
+	  b[1] = ELEMENT(js + r, ls + 1);
+	  b[2] = ELEMENT(js + r, ls + 2);
+	  b[3] = ELEMENT(js + r, ls + 3);
+	  b += 4;
+	}
+      } else {
+	for (r = 0; r < UNROLL; r++) {
+	  for (q = 0; q < 4; q++) {
+	    b[q] = ((r < min_j) && (ls + q < m)) ? ELEMENT(js + r, ls + q) : 0;
+	  }
+	  b += 4;
+	}
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,79 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+#include "common.h"
+
+/*
+ * c += a * b on blocks packed by i8gemm_copy.c, with a holding m rows of
+ * int8 and b n columns of uint8, both along k.  m and n are multiples of
+ * the unrolls and k a multiple of 4, the packing having padded the block
+ * with zeros.  The products are summed in int32 without saturation.
+ */
+
+#define UNROLL_M	I8GEMM_DEFAULT_UNROLL_M
+#define UNROLL_N	I8GEMM_DEFAULT_UNROLL_N
+
+int CNAME(BLASLONG m, BLASLONG n, BLASLONG k, int8_t *a, uint8_t *b, int32_t *c, BLASLONG ldc){
+
+  BLASLONG i, j, l, ii, jj, q;
+  int8_t  *aa;
+  uint8_t *bb;
+  int32_t result[UNROLL_M * UNROLL_N];
+
+  for (j = 0; j < n; j += UNROLL_N) {
+    for (i = 0; i < m; i += UNROLL_M) {
+
+      aa = a + i * k;
+      bb = b + j * k;
+
+      for (q = 0; q < UNROLL_M * UNROLL_N; q++) result[q] = 0;
+
+      for (l = 0; l < k; l += 4) {
+	for (jj = 0; jj < UNROLL_N; jj++) {
+	  for (ii = 0; ii < UNROLL_M; ii++) {
+	    result[ii + jj * UNROLL_M] +=
+	      (int32_t)aa[ii * 4 + 0] * (int32_t)bb[jj * 4 + 0] +
+	      (int32_t)aa[ii * 4 + 1] * (int32_t)bb[jj * 4 + 1] +
+	      (int32_t)aa[ii * 4 + 2] * (int32_t)bb[jj * 4 + 2] +
+	      (int32_t)aa[ii * 4 + 3] * (int32_t)bb[jj * 4 + 3];
+	  }
+	}
+	aa += UNROLL_M * 4;
+	bb += UNROLL_N * 4;
+      }
+
+      for (jj = 0; jj < UNROLL_N; jj++) {
+	for (ii = 0; ii < UNROLL_M; ii++) {
+	  c[(i + ii) + (j + jj) * ldc] += result[ii + jj * UNROLL_M];
+	}
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,82 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+#include "common.h"
+
+/*
+ * Packs a block of op(A) (or op(B), built with OUTER) for SHGEMM.  There
+ * are no half precision microkernels, so the panels are plain SGEMM panels:
+ * every UNROLL wide strip of the block is widened to float in a fixed stage
+ * and handed to the SGEMM packer of the same core.  Packed panels are a
+ * concatenation of such strips, so packing strip by strip gives exactly the
+ * layout the SGEMM kernel expects.
+ *
+ * m is the depth along K.  The SHGEMM blocking caps it below
+ * SHGEMM_STAGE_SIZE / SGEMM_UNROLL_MN (see SHGEMM_Q), so one strip always
+ * fits the stage.
+ */
+
+#ifndef OUTER
+#define UNROLL		SGEMM_DEFAULT_UNROLL_M
+#ifndef TRANS
+#define COPY		SGEMM_INCOPY
+#else
+#define COPY		SGEMM_ITCOPY
+#endif
+#else
+#define UNROLL		SGEMM_DEFAULT_UNROLL_N
+#ifndef TRANS
+#define COPY		SGEMM_ONCOPY
+#else
+#define COPY		SGEMM_OTCOPY
+#endif
+#endif
+
+int CNAME(BLASLONG m, BLASLONG n, hfloat16 *a, BLASLONG lda, float *b){
+
+  float stage[SHGEMM_STAGE_SIZE];
+  BLASLONG js, i, min_j;
+
+  for (js = 0; js < n; js += UNROLL) {
+
+    min_j = n - js;
+    if (min_j > UNROLL) min_j = UNROLL;
+
+#ifndef TRANS
+    /* K runs along the leading dimension, one strip column at a time */
+    for (i = 0; i < min_j; i++) SHF16TOS_K(m, a + (js + i) * lda, 1, stage + i * m, 1);
+    COPY(m, min_j, stage, m, b + js * m);
+#else
+    /* the strip runs along the leading dimension, one K step at a time */
+    for (i = 0; i < m; i++) SHF16TOS_K(min_j, a + js + i * lda, 1, stage + i * min_j, 1);
+    COPY(m, min_j, stage, min_j, b + js * m);
+#endif
+  }
+
+  return 0;
+}
@@ -194,6 +194,7 @@ gotoblas_t TABLE_NAME = {
   sgemm_small_matrix_permitTS,
   sgemm_small_kernel_nnTS, sgemm_small_kernel_ntTS, sgemm_small_kernel_tnTS, sgemm_small_kernel_ttTS,
   sgemm_small_kernel_b0_nnTS, sgemm_small_kernel_b0_ntTS, sgemm_small_kernel_b0_tnTS, sgemm_small_kernel_b0_ttTS,
+  sgemm_small_kernel_fixedTS,
 #endif
 #endif
 
@@ -285,6 +286,7 @@ gotoblas_t TABLE_NAME = {
   dgemm_small_matrix_permitTS,
   dgemm_small_kernel_nnTS, dgemm_small_kernel_ntTS, dgemm_small_kernel_tnTS, dgemm_small_kernel_ttTS,
   dgemm_small_kernel_b0_nnTS, dgemm_small_kernel_b0_ntTS, dgemm_small_kernel_b0_tnTS, dgemm_small_kernel_b0_ttTS,
+  dgemm_small_kernel_fixedTS,
 #endif
 #endif
 #if  (BUILD_DOUBLE==1)   
@@ -887,6 +889,18 @@ gotoblas_t TABLE_NAME = {
 #if BUILD_COMPLEX16==1
   zgeadd_kTS,
 #endif
+
+#if BUILD_SINGLE == 1
+  I8GEMM_DEFAULT_P, I8GEMM_DEFAULT_Q, I8GEMM_DEFAULT_R,
+  I8GEMM_DEFAULT_UNROLL_M, I8GEMM_DEFAULT_UNROLL_N,
+  i8gemm_kernelTS,
+  i8gemm_incopyTS, i8gemm_itcopyTS,
+  i8gemm_oncopyTS, i8gemm_otcopyTS,
+
+  shstohf16_kTS, shdtohf16_kTS, shf16tos_kTS, dhf16tod_kTS,
+  shgemm_incopyTS, shgemm_itcopyTS,
+  shgemm_oncopyTS, shgemm_otcopyTS,
+#endif
 };
 
 #if (ARCH_ARM64)
@@ -1878,6 +1892,30 @@ static void init_parameter(void) {
 #endif
 #endif
 
+#ifdef ZEN4
+
+#ifdef DEBUG
+  fprintf(stderr, "Zen 4\n");
+#endif
+
+#if  (BUILD_SINGLE==1) || (BUILD_COMPLEX==1)
+  TABLE_NAME.sgemm_p = SGEMM_DEFAULT_P;
+#endif
+#if (BUILD_DOUBLE==1) || (BUILD_COMPLEX16==1)
+  TABLE_NAME.dgemm_p = DGEMM_DEFAULT_P;
+#endif
+#if BUILD_COMPLEX
+  TABLE_NAME.cgemm_p = CGEMM_DEFAULT_P;
+#endif
+#if BUILD_COMPLEX16
+  TABLE_NAME.zgemm_p = ZGEMM_DEFAULT_P;
+#endif
+#ifdef EXPRECISION
+  TABLE_NAME.qgemm_p = QGEMM_DEFAULT_P;
+  TABLE_NAME.xgemm_p = XGEMM_DEFAULT_P;
+#endif
+#endif
+
 
 #ifdef NANO
 
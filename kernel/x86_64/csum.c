@@ -1,6 +1,6 @@
 #include "common.h"
 
-#if defined(SKYLAKEX) || defined(COOPERLAKE) || defined(SAPPHIRERAPIDS)
+#if defined(SKYLAKEX) || defined(COOPERLAKE) || defined(SAPPHIRERAPIDS) || defined(ZEN4)
 #include "csum_microk_skylakex-2.c"
 #endif
 
@@ -41,6 +41,8 @@
 
 #if defined(SANDYBRIDGE)
 #include "dger_microk_sandy-2.c"
+#elif defined (SKYLAKEX) || defined (COOPERLAKE) || defined (SAPPHIRERAPIDS)
+#include "dger_microk_skylakex-2.c"
 #endif
 
 int CNAME(BLASLONG m, BLASLONG n, BLASLONG dummy1, FLOAT alpha,
@@ -57,6 +59,22 @@ int CNAME(BLASLONG m, BLASLONG n, BLASLONG dummy1, FLOAT alpha,
 
 	BLASLONG m1 = m & -16;
 
+#ifdef HAVE_KERNEL_16x4
+	while (n >= 4)
+	{
+		FLOAT y4[4];
+		y4[0] = alpha * y[0];
+		y4[1] = alpha * y[incy];
+		y4[2] = alpha * y[2 * incy];
+		y4[3] = alpha * y[3 * incy];
+		dger_kernel_16x4(m, X, a, lda, y4);
+
+		a += 4 * lda;
+		y += 4 * incy;
+		n -= 4;
+	}
+#endif
+
 	while (n > 0) 
 	{
    		FLOAT y0 = alpha * *y;
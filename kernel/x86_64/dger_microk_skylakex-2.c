@@ -0,0 +1,82 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+/* need a new enough GCC for avx512 support */
+#ifdef __NVCOMPILER
+#define NVCOMPVERS ( __NVCOMPILER_MAJOR__ * 100 + __NVCOMPILER_MINOR__ )
+#endif
+#if (( defined(__GNUC__)  && __GNUC__   > 6 && defined(__AVX512CD__)) || (defined(__clang__) && __clang_major__ >= 9)) || (defined(__NVCOMPILER) && NVCOMPVERS >= 2203 )
+
+#include <immintrin.h>
+
+#define HAVE_KERNEL_16x4 1
+
+/*
+ * Rank-1 update of four adjacent columns, a(:,j) += alpha[j] * x. Every
+ * vector of x is loaded once and reused for all four columns; the row
+ * remainder is handled with masked loads and stores.
+ */
+static void dger_kernel_16x4(BLASLONG m, FLOAT *x, FLOAT *a, BLASLONG lda, FLOAT *alpha)
+{
+	BLASLONG i = 0;
+	FLOAT *a0 = a;
+	FLOAT *a1 = a0 + lda;
+	FLOAT *a2 = a1 + lda;
+	FLOAT *a3 = a2 + lda;
+
+	__m512d alpha_0 = _mm512_set1_pd(alpha[0]);
+	__m512d alpha_1 = _mm512_set1_pd(alpha[1]);
+	__m512d alpha_2 = _mm512_set1_pd(alpha[2]);
+	__m512d alpha_3 = _mm512_set1_pd(alpha[3]);
+
+	for (; i + 2 * 8 <= m; i += 2 * 8) {
+		__m512d x0 = _mm512_loadu_pd(&x[i]);
+		__m512d x1 = _mm512_loadu_pd(&x[i + 8]);
+
+		_mm512_storeu_pd(&a0[i],      _mm512_fmadd_pd(alpha_0, x0, _mm512_loadu_pd(&a0[i])));
+		_mm512_storeu_pd(&a0[i + 8], _mm512_fmadd_pd(alpha_0, x1, _mm512_loadu_pd(&a0[i + 8])));
+		_mm512_storeu_pd(&a1[i],      _mm512_fmadd_pd(alpha_1, x0, _mm512_loadu_pd(&a1[i])));
+		_mm512_storeu_pd(&a1[i + 8], _mm512_fmadd_pd(alpha_1, x1, _mm512_loadu_pd(&a1[i + 8])));
+		_mm512_storeu_pd(&a2[i],      _mm512_fmadd_pd(alpha_2, x0, _mm512_loadu_pd(&a2[i])));
+		_mm512_storeu_pd(&a2[i + 8], _mm512_fmadd_pd(alpha_2, x1, _mm512_loadu_pd(&a2[i + 8])));
+		_mm512_storeu_pd(&a3[i],      _mm512_fmadd_pd(alpha_3, x0, _mm512_loadu_pd(&a3[i])));
+		_mm512_storeu_pd(&a3[i + 8], _mm512_fmadd_pd(alpha_3, x1, _mm512_loadu_pd(&a3[i + 8])));
+	}
+
+	for (; i < m; i += 8) {
+		__mmask8 mask = (m - i >= 8) ? (__mmask8)-1 : (__mmask8)((1 << (m - i)) - 1);
+		__m512d x0 = _mm512_maskz_loadu_pd(mask, &x[i]);
+
+		_mm512_mask_storeu_pd(&a0[i], mask, _mm512_fmadd_pd(alpha_0, x0, _mm512_maskz_loadu_pd(mask, &a0[i])));
+		_mm512_mask_storeu_pd(&a1[i], mask, _mm512_fmadd_pd(alpha_1, x0, _mm512_maskz_loadu_pd(mask, &a1[i])));
+		_mm512_mask_storeu_pd(&a2[i], mask, _mm512_fmadd_pd(alpha_2, x0, _mm512_maskz_loadu_pd(mask, &a2[i])));
+		_mm512_mask_storeu_pd(&a3[i], mask, _mm512_fmadd_pd(alpha_3, x0, _mm512_maskz_loadu_pd(mask, &a3[i])));
+	}
+}
+
+#endif
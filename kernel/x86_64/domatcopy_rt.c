@@ -0,0 +1,177 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include "common.h"
+
+/*
+ * Cache-blocked out-of-place transpose for double precision.
+ *
+ * Used for both DOMATCOPY_RT and DOMATCOPY_CT: a column-major transpose of
+ * a rows x cols matrix is the row-major transpose of a cols x rows one, so
+ * the CT variant (built without ROWM) simply swaps the dimensions.
+ *
+ * b[i + j * ldb] = alpha * a[j + i * lda],  0 <= i < rows, 0 <= j < cols
+ *
+ * The matrix is walked in TILE x TILE blocks so that source rows and
+ * destination columns of a block stay resident in L1, and each block is
+ * transposed with 8x8 (AVX-512) or 4x4 (AVX) register transposes.
+ */
+
+#define TILE 32
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+#if defined(__AVX512F__)
+
+static inline void transpose_8x8(FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb, __m512d va)
+{
+	__m512d r0, r1, r2, r3, r4, r5, r6, r7;
+	__m512d t0, t1, t2, t3, t4, t5, t6, t7;
+
+	r0 = _mm512_mul_pd(va, _mm512_loadu_pd(a + 0 * lda));
+	r1 = _mm512_mul_pd(va, _mm512_loadu_pd(a + 1 * lda));
+	r2 = _mm512_mul_pd(va, _mm512_loadu_pd(a + 2 * lda));
+	r3 = _mm512_mul_pd(va, _mm512_loadu_pd(a + 3 * lda));
+	r4 = _mm512_mul_pd(va, _mm512_loadu_pd(a + 4 * lda));
+	r5 = _mm512_mul_pd(va, _mm512_loadu_pd(a + 5 * lda));
+	r6 = _mm512_mul_pd(va, _mm512_loadu_pd(a + 6 * lda));
+	r7 = _mm512_mul_pd(va, _mm512_loadu_pd(a + 7 * lda));
+
+	t0 = _mm512_unpacklo_pd(r0, r1);
+	t1 = _mm512_unpackhi_pd(r0, r1);
+	t2 = _mm512_unpacklo_pd(r2, r3);
+	t3 = _mm512_unpackhi_pd(r2, r3);
+	t4 = _mm512_unpacklo_pd(r4, r5);
+	t5 = _mm512_unpackhi_pd(r4, r5);
+	t6 = _mm512_unpacklo_pd(r6, r7);
+	t7 = _mm512_unpackhi_pd(r6, r7);
+
+	r0 = _mm512_shuffle_f64x2(t0, t2, 0x88);
+	r1 = _mm512_shuffle_f64x2(t0, t2, 0xdd);
+	r2 = _mm512_shuffle_f64x2(t1, t3, 0x88);
+	r3 = _mm512_shuffle_f64x2(t1, t3, 0xdd);
+	r4 = _mm512_shuffle_f64x2(t4, t6, 0x88);
+	r5 = _mm512_shuffle_f64x2(t4, t6, 0xdd);
+	r6 = _mm512_shuffle_f64x2(t5, t7, 0x88);
+	r7 = _mm512_shuffle_f64x2(t5, t7, 0xdd);
+
+	_mm512_storeu_pd(b + 0 * ldb, _mm512_shuffle_f64x2(r0, r4, 0x88));
+	_mm512_storeu_pd(b + 1 * ldb, _mm512_shuffle_f64x2(r2, r6, 0x88));
+	_mm512_storeu_pd(b + 2 * ldb, _mm512_shuffle_f64x2(r1, r5, 0x88));
+	_mm512_storeu_pd(b + 3 * ldb, _mm512_shuffle_f64x2(r3, r7, 0x88));
+	_mm512_storeu_pd(b + 4 * ldb, _mm512_shuffle_f64x2(r0, r4, 0xdd));
+	_mm512_storeu_pd(b + 5 * ldb, _mm512_shuffle_f64x2(r2, r6, 0xdd));
+	_mm512_storeu_pd(b + 6 * ldb, _mm512_shuffle_f64x2(r1, r5, 0xdd));
+	_mm512_storeu_pd(b + 7 * ldb, _mm512_shuffle_f64x2(r3, r7, 0xdd));
+}
+
+#define BLOCK 8
+#define TRANSPOSE_BLOCK(a, lda, b, ldb) transpose_8x8(a, lda, b, ldb, valpha)
+#define ALPHA_VECTOR __m512d valpha = _mm512_set1_pd(alpha)
+
+#elif defined(__AVX__)
+
+static inline void transpose_4x4(FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb, __m256d va)
+{
+	__m256d r0, r1, r2, r3;
+	__m256d t0, t1, t2, t3;
+
+	r0 = _mm256_mul_pd(va, _mm256_loadu_pd(a + 0 * lda));
+	r1 = _mm256_mul_pd(va, _mm256_loadu_pd(a + 1 * lda));
+	r2 = _mm256_mul_pd(va, _mm256_loadu_pd(a + 2 * lda));
+	r3 = _mm256_mul_pd(va, _mm256_loadu_pd(a + 3 * lda));
+
+	t0 = _mm256_unpacklo_pd(r0, r1);
+	t1 = _mm256_unpackhi_pd(r0, r1);
+	t2 = _mm256_unpacklo_pd(r2, r3);
+	t3 = _mm256_unpackhi_pd(r2, r3);
+
+	_mm256_storeu_pd(b + 0 * ldb, _mm256_permute2f128_pd(t0, t2, 0x20));
+	_mm256_storeu_pd(b + 1 * ldb, _mm256_permute2f128_pd(t1, t3, 0x20));
+	_mm256_storeu_pd(b + 2 * ldb, _mm256_permute2f128_pd(t0, t2, 0x31));
+	_mm256_storeu_pd(b + 3 * ldb, _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+#define BLOCK 4
+#define TRANSPOSE_BLOCK(a, lda, b, ldb) transpose_4x4(a, lda, b, ldb, valpha)
+#define ALPHA_VECTOR __m256d valpha = _mm256_set1_pd(alpha)
+
+#endif
+
+static void transpose_tile(BLASLONG rows, BLASLONG cols, FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+	BLASLONG i = 0, j;
+
+#ifdef BLOCK
+	ALPHA_VECTOR;
+
+	for (; i + BLOCK <= rows; i += BLOCK) {
+		for (j = 0; j + BLOCK <= cols; j += BLOCK)
+			TRANSPOSE_BLOCK(a + i * lda + j, lda, b + i + j * ldb, ldb);
+		for (; j < cols; j++) {
+			BLASLONG k;
+			for (k = 0; k < BLOCK; k++)
+				b[i + k + j * ldb] = alpha * a[(i + k) * lda + j];
+		}
+	}
+#endif
+
+	for (; i < rows; i++)
+		for (j = 0; j < cols; j++)
+			b[i + j * ldb] = alpha * a[i * lda + j];
+}
+
+int CNAME(BLASLONG rows, BLASLONG cols, FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+	BLASLONG i, j, ib, jb;
+
+	if (rows <= 0) return 0;
+	if (cols <= 0) return 0;
+
+#ifndef ROWM
+	i = rows; rows = cols; cols = i;
+#endif
+
+	if (alpha == ZERO) {
+		for (j = 0; j < cols; j++)
+			for (i = 0; i < rows; i++)
+				b[i + j * ldb] = ZERO;
+		return 0;
+	}
+
+	for (i = 0; i < rows; i += TILE) {
+		ib = MIN(TILE, rows - i);
+		for (j = 0; j < cols; j += TILE) {
+			jb = MIN(TILE, cols - j);
+			transpose_tile(ib, jb, alpha, a + i * lda + j, lda, b + i + j * ldb, ldb);
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,91 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+#include <stddef.h>
+#include "common.h"
+
+#if defined(DOUBLE)
+#define FLOAT_TYPE double
+#elif defined(SINGLE)
+#define FLOAT_TYPE float
+#else
+#endif
+
+#if defined(SINGLE) && (defined(__F16C__) || defined(__AVX512F__))
+#include <immintrin.h>
+#endif
+
+/* Widening is exact: subnormal halves become normal floats, NaNs keep their payload */
+static inline float hf16_to_float(hfloat16 h)
+{
+  union { float f; uint32_t u; } r;
+  uint32_t sign = ((uint32_t)h & 0x8000) << 16;
+  uint32_t exp  = ((uint32_t)h >> 10) & 0x1f;
+  uint32_t mant = (uint32_t)h & 0x3ff;
+
+  if (exp == 0x1f) {
+    r.u = sign | 0x7f800000 | (mant << 13);
+  } else if (exp) {
+    r.u = sign | ((exp + 112) << 23) | (mant << 13);
+  } else if (mant) {
+    exp = 113;
+    while (!(mant & 0x400)) {
+      mant <<= 1;
+      exp--;
+    }
+    r.u = sign | (exp << 23) | ((mant & 0x3ff) << 13);
+  } else {
+    r.u = sign;
+  }
+
+  return r.f;
+}
+
+void CNAME(BLASLONG n, hfloat16 * in, BLASLONG inc_in, FLOAT_TYPE * out, BLASLONG inc_out)
+{
+  BLASLONG i = 0;
+
+  if (n <= 0) return;
+
+#if defined(SINGLE)
+  if (inc_in == 1 && inc_out == 1) {
+#if defined(__AVX512F__)
+    for (; i + 16 <= n; i += 16)
+      _mm512_storeu_ps(out + i, _mm512_cvtph_ps(_mm256_loadu_si256((__m256i *)(in + i))));
+#endif
+#if defined(__F16C__)
+    for (; i + 8 <= n; i += 8)
+      _mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128((__m128i *)(in + i))));
+#endif
+    for (; i < n; i++) out[i] = hf16_to_float(in[i]);
+    return;
+  }
+#endif
+
+  for (; i < n; i++) out[i * inc_out] = (FLOAT_TYPE)hf16_to_float(in[i * inc_in]);
+}
@@ -0,0 +1,109 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+#if (defined(__GNUC__) && __GNUC__ >= 8 && defined(__AVX512VNNI__)) || (defined(__clang__) && __clang_major__ >= 8 && defined(__AVX512VNNI__))
+
+#include <immintrin.h>
+#include "common.h"
+
+/*
+ * 32x8 int8 x uint8 kernel for AVX512-VNNI, on the layout of
+ * ../generic/i8gemm_copy.c.  vpdpbusd takes its unsigned operand from the
+ * four bytes of B broadcast to every lane and its signed operand from the
+ * four bytes of one row of A, so each lane accumulates one row of C.
+ */
+
+#define DECLARE_RESULT(N) __m512i result##N##l = _mm512_setzero_si512(), result##N##h = _mm512_setzero_si512()
+
+#define DPBUSD(N) \
+	bval = _mm512_set1_epi32(*(int *)(bb + N * 4)); \
+	result##N##l = _mm512_dpbusd_epi32(result##N##l, bval, aval0); \
+	result##N##h = _mm512_dpbusd_epi32(result##N##h, bval, aval1)
+
+#define STORE(N) \
+	_mm512_storeu_si512(c + (j + N) * ldc + i + 0, \
+			    _mm512_add_epi32(_mm512_loadu_si512(c + (j + N) * ldc + i + 0), result##N##l)); \
+	_mm512_storeu_si512(c + (j + N) * ldc + i + 16, \
+			    _mm512_add_epi32(_mm512_loadu_si512(c + (j + N) * ldc + i + 16), result##N##h))
+
+int CNAME(BLASLONG m, BLASLONG n, BLASLONG k, int8_t *a, uint8_t *b, int32_t *c, BLASLONG ldc){
+
+  BLASLONG i, j, l;
+  int8_t  *aa;
+  uint8_t *bb;
+  __m512i aval0, aval1, bval;
+
+  for (j = 0; j < n; j += 8) {
+    for (i = 0; i < m; i += 32) {
+
+      aa = a + i * k;
+      bb = b + j * k;
+
+      DECLARE_RESULT(0);
+      DECLARE_RESULT(1);
+      DECLARE_RESULT(2);
+      DECLARE_RESULT(3);
+      DECLARE_RESULT(4);
+      DECLARE_RESULT(5);
+      DECLARE_RESULT(6);
+      DECLARE_RESULT(7);
+
+      for (l = 0; l < k; l += 4) {
+	aval0 = _mm512_loadu_si512(aa +  0);
+	aval1 = _mm512_loadu_si512(aa + 64);
+
+	DPBUSD(0);
+	DPBUSD(1);
+	DPBUSD(2);
+	DPBUSD(3);
+	DPBUSD(4);
+	DPBUSD(5);
+	DPBUSD(6);
+	DPBUSD(7);
+
+	aa += 128;
+	bb +=  32;
+      }
+
+      STORE(0);
+      STORE(1);
+      STORE(2);
+      STORE(3);
+      STORE(4);
+      STORE(5);
+      STORE(6);
+      STORE(7);
+    }
+  }
+
+  return 0;
+}
+
+#else
+#include "../generic/i8gemm_kernel.c"
+#endif
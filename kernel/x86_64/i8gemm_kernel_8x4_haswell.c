@@ -0,0 +1,101 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+#if (defined(__GNUC__) && __GNUC__ > 6 && defined(__AVX2__)) || (defined(__clang__) && __clang_major__ >= 6 && defined(__AVX2__))
+
+#include <immintrin.h>
+#include "common.h"
+
+/*
+ * 8x4 int8 x uint8 kernel for AVX2, on the layout of ../generic/i8gemm_copy.c.
+ *
+ * vpmaddubsw would take the bytes as they are, but it adds its two u8*s8
+ * products with signed saturation to 16 bits and 2*255*128 does not fit,
+ * so both sides are widened to 16 bits and multiplied with vpmaddwd,
+ * whose pairwise sums are exact in 32 bits.  Each accumulator holds two
+ * partial sums per row, folded together with vphaddd at the end.
+ */
+
+#define DECLARE_RESULT(N) __m256i result##N##l = _mm256_setzero_si256(), result##N##h = _mm256_setzero_si256()
+
+#define MADD(N) \
+	bval = _mm256_permute4x64_epi64(bquad, 0x55 * N); \
+	result##N##l = _mm256_add_epi32(result##N##l, _mm256_madd_epi16(aval0, bval)); \
+	result##N##h = _mm256_add_epi32(result##N##h, _mm256_madd_epi16(aval1, bval))
+
+/* vphaddd leaves rows 0,1,4,5 | 2,3,6,7, which vpermq puts back in order */
+#define STORE(N) \
+	sum = _mm256_permute4x64_epi64(_mm256_hadd_epi32(result##N##l, result##N##h), 0xd8); \
+	_mm256_storeu_si256((__m256i *)(c + (j + N) * ldc + i), \
+			    _mm256_add_epi32(_mm256_loadu_si256((__m256i *)(c + (j + N) * ldc + i)), sum))
+
+int CNAME(BLASLONG m, BLASLONG n, BLASLONG k, int8_t *a, uint8_t *b, int32_t *c, BLASLONG ldc){
+
+  BLASLONG i, j, l;
+  int8_t  *aa;
+  uint8_t *bb;
+  __m256i aval0, aval1, bquad, bval, sum;
+
+  for (j = 0; j < n; j += 4) {
+    for (i = 0; i < m; i += 8) {
+
+      aa = a + i * k;
+      bb = b + j * k;
+
+      DECLARE_RESULT(0);
+      DECLARE_RESULT(1);
+      DECLARE_RESULT(2);
+      DECLARE_RESULT(3);
+
+      for (l = 0; l < k; l += 4) {
+	aval0 = _mm256_cvtepi8_epi16(_mm_loadu_si128((__m128i *)(aa +  0)));
+	aval1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((__m128i *)(aa + 16)));
+	bquad = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)bb));
+
+	MADD(0);
+	MADD(1);
+	MADD(2);
+	MADD(3);
+
+	aa += 32;
+	bb += 16;
+      }
+
+      STORE(0);
+      STORE(1);
+      STORE(2);
+      STORE(3);
+    }
+  }
+
+  return 0;
+}
+
+#else
+#include "../generic/i8gemm_kernel.c"
+#endif
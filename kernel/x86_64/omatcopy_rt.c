@@ -145,6 +145,9 @@ int CNAME(BLASLONG rows, BLASLONG cols, FLOAT alpha, FLOAT *a, BLASLONG lda, FLO
   float *src, *dst, *dst_tmp=0, *src_base, *dst_base;
   uint64_t src_ld_bytes = (uint64_t)lda * sizeof(float), dst_ld_bytes = (uint64_t)ldb * sizeof(float), num_rows = 0;
   BLASLONG cols_left, rows_done; float ALPHA = alpha;
+#ifndef ROWM
+  cols_left = rows; rows = cols; cols = cols_left;
+#endif
   if(ALPHA==0.0){
     dst_base = b;
     for(cols_left=cols;cols_left>0;cols_left--) {memset(dst_base,0,rows*sizeof(float)); dst_base += ldb;}
@@ -174,6 +177,10 @@ int CNAME(BLASLONG rows, BLASLONG cols, FLOAT alpha, FLOAT *a, BLASLONG lda, FLO
     if (rows <= 0)  return 0;
     if (cols <= 0)  return 0;
 
+#ifndef ROWM
+    i = rows; rows = cols; cols = i;
+#endif
+
     a_offset = a;
     b_offset = b;
 
@@ -0,0 +1,115 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+/* need a new enough GCC for avx512 support */
+#ifdef __NVCOMPILER
+#define NVCOMPVERS ( __NVCOMPILER_MAJOR__ * 100 + __NVCOMPILER_MINOR__ )
+#endif
+#if (( defined(__GNUC__)  && __GNUC__   > 6 && defined(__AVX512CD__)) || (defined(__clang__) && __clang_major__ >= 9)) || (defined(__NVCOMPILER) && NVCOMPVERS >= 2203 )
+
+#include <immintrin.h>
+
+#define HAVE_KERNEL_4x4 1
+
+static void ssymv_kernel_4x4(BLASLONG n, FLOAT *a0, FLOAT *a1, FLOAT *a2, FLOAT *a3, FLOAT *x, FLOAT *y, FLOAT *temp1, FLOAT *temp2)
+{
+	BLASLONG i = 0;
+	__m512 accum_0, accum_1, accum_2, accum_3;
+	__m512 temp1_0, temp1_1, temp1_2, temp1_3;
+
+	accum_0 = _mm512_setzero_ps();
+	accum_1 = _mm512_setzero_ps();
+	accum_2 = _mm512_setzero_ps();
+	accum_3 = _mm512_setzero_ps();
+
+	temp1_0 = _mm512_set1_ps(temp1[0]);
+	temp1_1 = _mm512_set1_ps(temp1[1]);
+	temp1_2 = _mm512_set1_ps(temp1[2]);
+	temp1_3 = _mm512_set1_ps(temp1[3]);
+
+	for (; i + 16 <= n; i += 16) {
+		__m512 _x, _y;
+		__m512 _a0, _a1, _a2, _a3;
+
+		_y = _mm512_loadu_ps(&y[i]);
+		_x = _mm512_loadu_ps(&x[i]);
+
+		_a0 = _mm512_loadu_ps(&a0[i]);
+		_a1 = _mm512_loadu_ps(&a1[i]);
+		_a2 = _mm512_loadu_ps(&a2[i]);
+		_a3 = _mm512_loadu_ps(&a3[i]);
+
+		_y = _mm512_fmadd_ps(temp1_0, _a0, _y);
+		_y = _mm512_fmadd_ps(temp1_1, _a1, _y);
+		_y = _mm512_fmadd_ps(temp1_2, _a2, _y);
+		_y = _mm512_fmadd_ps(temp1_3, _a3, _y);
+
+		accum_0 = _mm512_fmadd_ps(_x, _a0, accum_0);
+		accum_1 = _mm512_fmadd_ps(_x, _a1, accum_1);
+		accum_2 = _mm512_fmadd_ps(_x, _a2, accum_2);
+		accum_3 = _mm512_fmadd_ps(_x, _a3, accum_3);
+
+		_mm512_storeu_ps(&y[i], _y);
+	}
+
+	/* the caller passes a multiple of 8, the remainder is handled with masked loads */
+	if (i < n) {
+		__mmask16 mask = (__mmask16)((1 << (n - i)) - 1);
+		__m512 _x, _y;
+		__m512 _a0, _a1, _a2, _a3;
+
+		_y = _mm512_maskz_loadu_ps(mask, &y[i]);
+		_x = _mm512_maskz_loadu_ps(mask, &x[i]);
+
+		_a0 = _mm512_maskz_loadu_ps(mask, &a0[i]);
+		_a1 = _mm512_maskz_loadu_ps(mask, &a1[i]);
+		_a2 = _mm512_maskz_loadu_ps(mask, &a2[i]);
+		_a3 = _mm512_maskz_loadu_ps(mask, &a3[i]);
+
+		_y = _mm512_fmadd_ps(temp1_0, _a0, _y);
+		_y = _mm512_fmadd_ps(temp1_1, _a1, _y);
+		_y = _mm512_fmadd_ps(temp1_2, _a2, _y);
+		_y = _mm512_fmadd_ps(temp1_3, _a3, _y);
+
+		accum_0 = _mm512_fmadd_ps(_x, _a0, accum_0);
+		accum_1 = _mm512_fmadd_ps(_x, _a1, accum_1);
+		accum_2 = _mm512_fmadd_ps(_x, _a2, accum_2);
+		accum_3 = _mm512_fmadd_ps(_x, _a3, accum_3);
+
+		_mm512_mask_storeu_ps(&y[i], mask, _y);
+	}
+
+	temp2[0] += _mm512_reduce_add_ps(accum_0);
+	temp2[1] += _mm512_reduce_add_ps(accum_1);
+	temp2[2] += _mm512_reduce_add_ps(accum_2);
+	temp2[3] += _mm512_reduce_add_ps(accum_3);
+}
+
+#else
+#include "ssymv_U_microk_haswell-2.c"
+#endif
@@ -0,0 +1,146 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+#include <stddef.h>
+#include "common.h"
+
+#if defined(DOUBLE)
+#define FLOAT_TYPE double
+#elif defined(SINGLE)
+#define FLOAT_TYPE float
+#else
+#endif
+
+#if defined(SINGLE) && (defined(__F16C__) || defined(__AVX512F__))
+#include <immintrin.h>
+#endif
+
+/* Notes for algorithm:
+ * - Round to nearest even, overflow to infinity
+ * - NaNs stay quiet NaNs
+ * - Doubles are rounded directly, never through float, to avoid double rounding
+ */
+#if defined(SINGLE)
+static inline hfloat16 to_hf16(float f)
+{
+  union { float f; uint32_t u; } v;
+  uint32_t sign, absx, h, rem, shift, half;
+
+  v.f  = f;
+  sign = (v.u >> 16) & 0x8000;
+  absx = v.u & 0x7fffffff;
+
+  if (absx >= 0x7f800000) {
+    if (absx == 0x7f800000) return (hfloat16)(sign | 0x7c00);
+    return (hfloat16)(sign | 0x7e00 | ((absx >> 13) & 0x3ff));
+  }
+
+  /* 65520 and above round to infinity */
+  if (absx >= 0x477ff000) return (hfloat16)(sign | 0x7c00);
+
+  if (absx < 0x38800000) {
+    /* half subnormals: round |f| / 2^-24 to an integer */
+    if (absx <= 0x33000000) return (hfloat16)sign;
+    shift = 126 - (absx >> 23);
+    absx  = (absx & 0x7fffff) | 0x800000;
+    h     = absx >> shift;
+    rem   = absx & ((1U << shift) - 1);
+    half  = 1U << (shift - 1);
+    if (rem > half || (rem == half && (h & 1))) h++;
+    return (hfloat16)(sign | h);
+  }
+
+  /* a carry out of the mantissa correctly bumps the exponent */
+  h   = (absx >> 13) - (112 << 10);
+  rem = absx & 0x1fff;
+  if (rem > 0x1000 || (rem == 0x1000 && (h & 1))) h++;
+
+  return (hfloat16)(sign | h);
+}
+#else
+static inline hfloat16 to_hf16(double d)
+{
+  union { double d; uint64_t u; } v;
+  uint64_t absx, mant, rem, half;
+  uint32_t sign, exp, h, shift;
+
+  v.d  = d;
+  sign = (uint32_t)(v.u >> 48) & 0x8000;
+  absx = v.u & 0x7fffffffffffffffULL;
+  exp  = (uint32_t)(absx >> 52);
+  mant = absx & 0xfffffffffffffULL;
+
+  if (exp == 0x7ff) {
+    if (mant == 0) return (hfloat16)(sign | 0x7c00);
+    return (hfloat16)(sign | 0x7e00 | (uint32_t)(mant >> 42));
+  }
+
+  if (exp >= 1039) return (hfloat16)(sign | 0x7c00);
+
+  if (exp >= 1009) {
+    h    = ((exp - 1008) << 10) | (uint32_t)(mant >> 42);
+    rem  = mant & ((1ULL << 42) - 1);
+    half = 1ULL << 41;
+  } else {
+    if (exp < 998) return (hfloat16)sign;
+    shift = 1051 - exp;
+    mant |= 1ULL << 52;
+    h    = (uint32_t)(mant >> shift);
+    rem  = mant & ((1ULL << shift) - 1);
+    half = 1ULL << (shift - 1);
+  }
+  if (rem > half || (rem == half && (h & 1))) h++;
+
+  return (hfloat16)(sign | h);
+}
+#endif
+
+void CNAME(BLASLONG n, FLOAT_TYPE * in, BLASLONG inc_in, hfloat16 * out, BLASLONG inc_out)
+{
+  BLASLONG i = 0;
+
+  if (n <= 0) return;
+
+#if defined(SINGLE)
+  if (inc_in == 1 && inc_out == 1) {
+#if defined(__AVX512F__)
+    for (; i + 16 <= n; i += 16)
+      _mm256_storeu_si256((__m256i *)(out + i),
+                          _mm512_cvtps_ph(_mm512_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#endif
+#if defined(__F16C__)
+    for (; i + 8 <= n; i += 8)
+      _mm_storeu_si128((__m128i *)(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+#endif
+    for (; i < n; i++) out[i] = to_hf16(in[i]);
+    return;
+  }
+#endif
+
+  for (; i < n; i++) out[i * inc_out] = to_hf16(in[i * inc_in]);
+}
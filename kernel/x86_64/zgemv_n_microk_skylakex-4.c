@@ -0,0 +1,305 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+/* need a new enough GCC for avx512 support */
+#ifdef __NVCOMPILER
+#define NVCOMPVERS ( __NVCOMPILER_MAJOR__ * 100 + __NVCOMPILER_MINOR__ )
+#endif
+#if (( defined(__GNUC__)  && __GNUC__   > 6 && defined(__AVX512CD__)) || (defined(__clang__) && __clang_major__ >= 9)) || (defined(__NVCOMPILER) && NVCOMPVERS >= 2203 )
+
+#include <immintrin.h>
+
+/*
+ * y += A * x. Each zmm register holds four complex elements of a column;
+ * the products with the real parts of x and with the sign-adjusted imaginary
+ * parts of x are accumulated separately, so the real/imaginary swap is done
+ * once per output vector. Two partial sums per output vector keep the FMA
+ * chains short; the row remainder is handled with masked loads and stores.
+ */
+#define HAVE_KERNEL_4x4 1
+static void zgemv_kernel_4x4( BLASLONG n, FLOAT **ap, FLOAT *x, FLOAT *y)
+{
+	BLASLONG i = 0;
+	BLASLONG len = 2 * n;
+	FLOAT *a0 = ap[0];
+	FLOAT *a1 = ap[1];
+	FLOAT *a2 = ap[2];
+	FLOAT *a3 = ap[3];
+	__m512d sign = _mm512_set_pd(-1.0, 1.0, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	__m512d xr0, xi0, xr1, xi1, xr2, xi2, xr3, xi3;
+
+#if ( !defined(CONJ) && !defined(XCONJ) ) || ( defined(CONJ) && defined(XCONJ) )
+	xr0 = _mm512_set1_pd(x[0]);
+	xi0 = _mm512_mul_pd(_mm512_set1_pd(x[1]), sign);
+	xr1 = _mm512_set1_pd(x[2]);
+	xi1 = _mm512_mul_pd(_mm512_set1_pd(x[3]), sign);
+	xr2 = _mm512_set1_pd(x[4]);
+	xi2 = _mm512_mul_pd(_mm512_set1_pd(x[5]), sign);
+	xr3 = _mm512_set1_pd(x[6]);
+	xi3 = _mm512_mul_pd(_mm512_set1_pd(x[7]), sign);
+#else
+	xr0 = _mm512_mul_pd(_mm512_set1_pd(x[0]), sign);
+	xi0 = _mm512_set1_pd(x[1]);
+	xr1 = _mm512_mul_pd(_mm512_set1_pd(x[2]), sign);
+	xi1 = _mm512_set1_pd(x[3]);
+	xr2 = _mm512_mul_pd(_mm512_set1_pd(x[4]), sign);
+	xi2 = _mm512_set1_pd(x[5]);
+	xr3 = _mm512_mul_pd(_mm512_set1_pd(x[6]), sign);
+	xi3 = _mm512_set1_pd(x[7]);
+#endif
+
+	for (; i + 16 <= len; i += 16) {
+		_mm_prefetch((const char *)&a0[i + 64], _MM_HINT_T0);
+		_mm_prefetch((const char *)&a0[i + 64 + 8], _MM_HINT_T0);
+		_mm_prefetch((const char *)&a1[i + 64], _MM_HINT_T0);
+		_mm_prefetch((const char *)&a1[i + 64 + 8], _MM_HINT_T0);
+		_mm_prefetch((const char *)&a2[i + 64], _MM_HINT_T0);
+		_mm_prefetch((const char *)&a2[i + 64 + 8], _MM_HINT_T0);
+		_mm_prefetch((const char *)&a3[i + 64], _MM_HINT_T0);
+		_mm_prefetch((const char *)&a3[i + 64 + 8], _MM_HINT_T0);
+		{
+			__m512d va0 = _mm512_loadu_pd(&a0[i]);
+			__m512d va1 = _mm512_loadu_pd(&a1[i]);
+			__m512d va2 = _mm512_loadu_pd(&a2[i]);
+			__m512d va3 = _mm512_loadu_pd(&a3[i]);
+			__m512d r0 = _mm512_fmadd_pd(va0, xr0, _mm512_loadu_pd(&y[i]));
+			__m512d i0 = _mm512_mul_pd(va0, xi0);
+			__m512d r1 = _mm512_mul_pd(va1, xr1);
+			__m512d i1 = _mm512_mul_pd(va1, xi1);
+			r0 = _mm512_fmadd_pd(va2, xr2, r0);
+			i0 = _mm512_fmadd_pd(va2, xi2, i0);
+			r1 = _mm512_fmadd_pd(va3, xr3, r1);
+			i1 = _mm512_fmadd_pd(va3, xi3, i1);
+			r0 = _mm512_add_pd(r0, r1);
+			i0 = _mm512_add_pd(i0, i1);
+			_mm512_storeu_pd(&y[i], _mm512_add_pd(r0, _mm512_permute_pd(i0, 0x55)));
+		}
+		{
+			__m512d va0 = _mm512_loadu_pd(&a0[i + 8]);
+			__m512d va1 = _mm512_loadu_pd(&a1[i + 8]);
+			__m512d va2 = _mm512_loadu_pd(&a2[i + 8]);
+			__m512d va3 = _mm512_loadu_pd(&a3[i + 8]);
+			__m512d r0 = _mm512_fmadd_pd(va0, xr0, _mm512_loadu_pd(&y[i + 8]));
+			__m512d i0 = _mm512_mul_pd(va0, xi0);
+			__m512d r1 = _mm512_mul_pd(va1, xr1);
+			__m512d i1 = _mm512_mul_pd(va1, xi1);
+			r0 = _mm512_fmadd_pd(va2, xr2, r0);
+			i0 = _mm512_fmadd_pd(va2, xi2, i0);
+			r1 = _mm512_fmadd_pd(va3, xr3, r1);
+			i1 = _mm512_fmadd_pd(va3, xi3, i1);
+			r0 = _mm512_add_pd(r0, r1);
+			i0 = _mm512_add_pd(i0, i1);
+			_mm512_storeu_pd(&y[i + 8], _mm512_add_pd(r0, _mm512_permute_pd(i0, 0x55)));
+		}
+	}
+
+	for (; i < len; i += 8) {
+		__mmask8 mask = (len - i >= 8) ? 0xff : (__mmask8)((1 << (len - i)) - 1);
+		{
+			__m512d va0 = _mm512_maskz_loadu_pd(mask, &a0[i]);
+			__m512d va1 = _mm512_maskz_loadu_pd(mask, &a1[i]);
+			__m512d va2 = _mm512_maskz_loadu_pd(mask, &a2[i]);
+			__m512d va3 = _mm512_maskz_loadu_pd(mask, &a3[i]);
+			__m512d r0 = _mm512_fmadd_pd(va0, xr0, _mm512_maskz_loadu_pd(mask, &y[i]));
+			__m512d i0 = _mm512_mul_pd(va0, xi0);
+			__m512d r1 = _mm512_mul_pd(va1, xr1);
+			__m512d i1 = _mm512_mul_pd(va1, xi1);
+			r0 = _mm512_fmadd_pd(va2, xr2, r0);
+			i0 = _mm512_fmadd_pd(va2, xi2, i0);
+			r1 = _mm512_fmadd_pd(va3, xr3, r1);
+			i1 = _mm512_fmadd_pd(va3, xi3, i1);
+			r0 = _mm512_add_pd(r0, r1);
+			i0 = _mm512_add_pd(i0, i1);
+			_mm512_mask_storeu_pd(&y[i], mask, _mm512_add_pd(r0, _mm512_permute_pd(i0, 0x55)));
+		}
+	}
+}
+
+#define HAVE_KERNEL_4x2 1
+static void zgemv_kernel_4x2( BLASLONG n, FLOAT **ap, FLOAT *x, FLOAT *y)
+{
+	BLASLONG i = 0;
+	BLASLONG len = 2 * n;
+	FLOAT *a0 = ap[0];
+	FLOAT *a1 = ap[1];
+	__m512d sign = _mm512_set_pd(-1.0, 1.0, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	__m512d xr0, xi0, xr1, xi1;
+
+#if ( !defined(CONJ) && !defined(XCONJ) ) || ( defined(CONJ) && defined(XCONJ) )
+	xr0 = _mm512_set1_pd(x[0]);
+	xi0 = _mm512_mul_pd(_mm512_set1_pd(x[1]), sign);
+	xr1 = _mm512_set1_pd(x[2]);
+	xi1 = _mm512_mul_pd(_mm512_set1_pd(x[3]), sign);
+#else
+	xr0 = _mm512_mul_pd(_mm512_set1_pd(x[0]), sign);
+	xi0 = _mm512_set1_pd(x[1]);
+	xr1 = _mm512_mul_pd(_mm512_set1_pd(x[2]), sign);
+	xi1 = _mm512_set1_pd(x[3]);
+#endif
+
+	for (; i + 16 <= len; i += 16) {
+		_mm_prefetch((const char *)&a0[i + 64], _MM_HINT_T0);
+		_mm_prefetch((const char *)&a0[i + 64 + 8], _MM_HINT_T0);
+		_mm_prefetch((const char *)&a1[i + 64], _MM_HINT_T0);
+		_mm_prefetch((const char *)&a1[i + 64 + 8], _MM_HINT_T0);
+		{
+			__m512d va0 = _mm512_loadu_pd(&a0[i]);
+			__m512d va1 = _mm512_loadu_pd(&a1[i]);
+			__m512d r0 = _mm512_fmadd_pd(va0, xr0, _mm512_loadu_pd(&y[i]));
+			__m512d i0 = _mm512_mul_pd(va0, xi0);
+			__m512d r1 = _mm512_mul_pd(va1, xr1);
+			__m512d i1 = _mm512_mul_pd(va1, xi1);
+			r0 = _mm512_add_pd(r0, r1);
+			i0 = _mm512_add_pd(i0, i1);
+			_mm512_storeu_pd(&y[i], _mm512_add_pd(r0, _mm512_permute_pd(i0, 0x55)));
+		}
+		{
+			__m512d va0 = _mm512_loadu_pd(&a0[i + 8]);
+			__m512d va1 = _mm512_loadu_pd(&a1[i + 8]);
+			__m512d r0 = _mm512_fmadd_pd(va0, xr0, _mm512_loadu_pd(&y[i + 8]));
+			__m512d i0 = _mm512_mul_pd(va0, xi0);
+			__m512d r1 = _mm512_mul_pd(va1, xr1);
+			__m512d i1 = _mm512_mul_pd(va1, xi1);
+			r0 = _mm512_add_pd(r0, r1);
+			i0 = _mm512_add_pd(i0, i1);
+			_mm512_storeu_pd(&y[i + 8], _mm512_add_pd(r0, _mm512_permute_pd(i0, 0x55)));
+		}
+	}
+
+	for (; i < len; i += 8) {
+		__mmask8 mask = (len - i >= 8) ? 0xff : (__mmask8)((1 << (len - i)) - 1);
+		{
+			__m512d va0 = _mm512_maskz_loadu_pd(mask, &a0[i]);
+			__m512d va1 = _mm512_maskz_loadu_pd(mask, &a1[i]);
+			__m512d r0 = _mm512_fmadd_pd(va0, xr0, _mm512_maskz_loadu_pd(mask, &y[i]));
+			__m512d i0 = _mm512_mul_pd(va0, xi0);
+			__m512d r1 = _mm512_mul_pd(va1, xr1);
+			__m512d i1 = _mm512_mul_pd(va1, xi1);
+			r0 = _mm512_add_pd(r0, r1);
+			i0 = _mm512_add_pd(i0, i1);
+			_mm512_mask_storeu_pd(&y[i], mask, _mm512_add_pd(r0, _mm512_permute_pd(i0, 0x55)));
+		}
+	}
+}
+
+#define HAVE_KERNEL_4x1 1
+static void zgemv_kernel_4x1( BLASLONG n, FLOAT *ap, FLOAT *x, FLOAT *y)
+{
+	BLASLONG i = 0;
+	BLASLONG len = 2 * n;
+	FLOAT *a0 = ap;
+	__m512d sign = _mm512_set_pd(-1.0, 1.0, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	__m512d xr0, xi0;
+
+#if ( !defined(CONJ) && !defined(XCONJ) ) || ( defined(CONJ) && defined(XCONJ) )
+	xr0 = _mm512_set1_pd(x[0]);
+	xi0 = _mm512_mul_pd(_mm512_set1_pd(x[1]), sign);
+#else
+	xr0 = _mm512_mul_pd(_mm512_set1_pd(x[0]), sign);
+	xi0 = _mm512_set1_pd(x[1]);
+#endif
+
+	for (; i + 16 <= len; i += 16) {
+		_mm_prefetch((const char *)&a0[i + 64], _MM_HINT_T0);
+		_mm_prefetch((const char *)&a0[i + 64 + 8], _MM_HINT_T0);
+		{
+			__m512d va0 = _mm512_loadu_pd(&a0[i]);
+			__m512d r0 = _mm512_fmadd_pd(va0, xr0, _mm512_loadu_pd(&y[i]));
+			__m512d i0 = _mm512_mul_pd(va0, xi0);
+			_mm512_storeu_pd(&y[i], _mm512_add_pd(r0, _mm512_permute_pd(i0, 0x55)));
+		}
+		{
+			__m512d va0 = _mm512_loadu_pd(&a0[i + 8]);
+			__m512d r0 = _mm512_fmadd_pd(va0, xr0, _mm512_loadu_pd(&y[i + 8]));
+			__m512d i0 = _mm512_mul_pd(va0, xi0);
+			_mm512_storeu_pd(&y[i + 8], _mm512_add_pd(r0, _mm512_permute_pd(i0, 0x55)));
+		}
+	}
+
+	for (; i < len; i += 8) {
+		__mmask8 mask = (len - i >= 8) ? 0xff : (__mmask8)((1 << (len - i)) - 1);
+		{
+			__m512d va0 = _mm512_maskz_loadu_pd(mask, &a0[i]);
+			__m512d r0 = _mm512_fmadd_pd(va0, xr0, _mm512_maskz_loadu_pd(mask, &y[i]));
+			__m512d i0 = _mm512_mul_pd(va0, xi0);
+			_mm512_mask_storeu_pd(&y[i], mask, _mm512_add_pd(r0, _mm512_permute_pd(i0, 0x55)));
+		}
+	}
+}
+
+#define HAVE_KERNEL_ADDY 1
+
+static void add_y(BLASLONG n, FLOAT *src, FLOAT *dest, BLASLONG inc_dest,FLOAT alpha_r, FLOAT alpha_i)
+{
+	BLASLONG i;
+
+	if ( inc_dest != 2 )
+	{
+		FLOAT temp_r;
+		FLOAT temp_i;
+		for ( i=0; i<n; i++ )
+		{
+#if !defined(XCONJ)
+			temp_r = alpha_r * src[0] - alpha_i * src[1];
+			temp_i = alpha_r * src[1] + alpha_i * src[0];
+#else
+			temp_r =  alpha_r * src[0] + alpha_i * src[1];
+			temp_i = -alpha_r * src[1] + alpha_i * src[0];
+#endif
+			*dest += temp_r;
+			*(dest+1) += temp_i;
+
+			src+=2;
+			dest += inc_dest;
+		}
+		return;
+	}
+
+	BLASLONG len = 2 * n;
+	__m512d sign = _mm512_set_pd(-1.0, 1.0, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+#if !defined(XCONJ)
+	__m512d ar = _mm512_set1_pd(alpha_r);
+	__m512d ai = _mm512_mul_pd(_mm512_set1_pd(-alpha_i), sign);
+#else
+	__m512d ar = _mm512_mul_pd(_mm512_set1_pd(alpha_r), sign);
+	__m512d ai = _mm512_set1_pd(alpha_i);
+#endif
+
+	for (i = 0; i < len; i += 8) {
+		__mmask8 mask = (len - i >= 8) ? 0xff : (__mmask8)((1 << (len - i)) - 1);
+		__m512d s = _mm512_maskz_loadu_pd(mask, &src[i]);
+		__m512d d = _mm512_maskz_loadu_pd(mask, &dest[i]);
+		d = _mm512_fmadd_pd(s, ar, d);
+		d = _mm512_fmadd_pd(_mm512_permute_pd(s, 0x55), ai, d);
+		_mm512_mask_storeu_pd(&dest[i], mask, d);
+	}
+}
+
+#else
+#include "zgemv_n_microk_haswell-4.c"
+#endif
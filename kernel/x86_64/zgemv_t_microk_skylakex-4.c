@@ -0,0 +1,241 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+/* need a new enough GCC for avx512 support */
+#ifdef __NVCOMPILER
+#define NVCOMPVERS ( __NVCOMPILER_MAJOR__ * 100 + __NVCOMPILER_MINOR__ )
+#endif
+#if (( defined(__GNUC__)  && __GNUC__   > 6 && defined(__AVX512CD__)) || (defined(__clang__) && __clang_major__ >= 9)) || (defined(__NVCOMPILER) && NVCOMPVERS >= 2203 )
+
+#include <immintrin.h>
+
+/*
+ * y[j] += alpha * A(:,j)^T * x. For every column the products of A with x and
+ * with the real/imaginary swapped x are accumulated separately, with two sets
+ * of accumulators to hide the FMA latency. The signs that distinguish the
+ * conjugated variants are applied once in the horizontal reduction.
+ */
+static inline void zgemv_kernel_store(FLOAT *y, __m512d acc_r, __m512d acc_i, FLOAT *alpha)
+{
+	__m512d sign = _mm512_set_pd(-1.0, 1.0, -1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+	FLOAT temp_r, temp_i;
+	FLOAT alpha_r = alpha[0];
+	FLOAT alpha_i = alpha[1];
+
+#if ( !defined(CONJ) && !defined(XCONJ) ) || ( defined(CONJ) && defined(XCONJ) )
+	temp_r = _mm512_reduce_add_pd(_mm512_mul_pd(acc_r, sign));
+	temp_i = _mm512_reduce_add_pd(acc_i);
+#else
+	temp_r = _mm512_reduce_add_pd(acc_r);
+	temp_i = _mm512_reduce_add_pd(_mm512_mul_pd(acc_i, sign));
+#endif
+
+#if !defined(XCONJ)
+	y[0] +=  alpha_r * temp_r - alpha_i * temp_i;
+	y[1] +=  alpha_r * temp_i + alpha_i * temp_r;
+#else
+	y[0] +=  alpha_r * temp_r + alpha_i * temp_i;
+	y[1] -=  alpha_r * temp_i - alpha_i * temp_r;
+#endif
+}
+
+#define HAVE_KERNEL_4x4 1
+static void zgemv_kernel_4x4( BLASLONG n, FLOAT **ap, FLOAT *x, FLOAT *y, FLOAT *alpha)
+{
+	BLASLONG i = 0;
+	BLASLONG len = 2 * n;
+	FLOAT *a0 = ap[0];
+	FLOAT *a1 = ap[1];
+	FLOAT *a2 = ap[2];
+	FLOAT *a3 = ap[3];
+	__m512d r0_0 = _mm512_setzero_pd(), i0_0 = _mm512_setzero_pd();
+	__m512d r0_1 = _mm512_setzero_pd(), i0_1 = _mm512_setzero_pd();
+	__m512d r1_0 = _mm512_setzero_pd(), i1_0 = _mm512_setzero_pd();
+	__m512d r1_1 = _mm512_setzero_pd(), i1_1 = _mm512_setzero_pd();
+	__m512d r2_0 = _mm512_setzero_pd(), i2_0 = _mm512_setzero_pd();
+	__m512d r2_1 = _mm512_setzero_pd(), i2_1 = _mm512_setzero_pd();
+	__m512d r3_0 = _mm512_setzero_pd(), i3_0 = _mm512_setzero_pd();
+	__m512d r3_1 = _mm512_setzero_pd(), i3_1 = _mm512_setzero_pd();
+
+	for (; i + 16 <= len; i += 16) {
+		{
+			__m512d x0 = _mm512_loadu_pd(&x[i]);
+			__m512d x1 = _mm512_permute_pd(x0, 0x55);
+			__m512d va0 = _mm512_loadu_pd(&a0[i]);
+			__m512d va1 = _mm512_loadu_pd(&a1[i]);
+			__m512d va2 = _mm512_loadu_pd(&a2[i]);
+			__m512d va3 = _mm512_loadu_pd(&a3[i]);
+			r0_0 = _mm512_fmadd_pd(va0, x0, r0_0);
+			i0_0 = _mm512_fmadd_pd(va0, x1, i0_0);
+			r1_0 = _mm512_fmadd_pd(va1, x0, r1_0);
+			i1_0 = _mm512_fmadd_pd(va1, x1, i1_0);
+			r2_0 = _mm512_fmadd_pd(va2, x0, r2_0);
+			i2_0 = _mm512_fmadd_pd(va2, x1, i2_0);
+			r3_0 = _mm512_fmadd_pd(va3, x0, r3_0);
+			i3_0 = _mm512_fmadd_pd(va3, x1, i3_0);
+		}
+		{
+			__m512d x0 = _mm512_loadu_pd(&x[i + 8]);
+			__m512d x1 = _mm512_permute_pd(x0, 0x55);
+			__m512d va0 = _mm512_loadu_pd(&a0[i + 8]);
+			__m512d va1 = _mm512_loadu_pd(&a1[i + 8]);
+			__m512d va2 = _mm512_loadu_pd(&a2[i + 8]);
+			__m512d va3 = _mm512_loadu_pd(&a3[i + 8]);
+			r0_1 = _mm512_fmadd_pd(va0, x0, r0_1);
+			i0_1 = _mm512_fmadd_pd(va0, x1, i0_1);
+			r1_1 = _mm512_fmadd_pd(va1, x0, r1_1);
+			i1_1 = _mm512_fmadd_pd(va1, x1, i1_1);
+			r2_1 = _mm512_fmadd_pd(va2, x0, r2_1);
+			i2_1 = _mm512_fmadd_pd(va2, x1, i2_1);
+			r3_1 = _mm512_fmadd_pd(va3, x0, r3_1);
+			i3_1 = _mm512_fmadd_pd(va3, x1, i3_1);
+		}
+	}
+
+	for (; i < len; i += 8) {
+		__mmask8 mask = (len - i >= 8) ? 0xff : (__mmask8)((1 << (len - i)) - 1);
+		{
+			__m512d x0 = _mm512_maskz_loadu_pd(mask, &x[i]);
+			__m512d x1 = _mm512_permute_pd(x0, 0x55);
+			__m512d va0 = _mm512_maskz_loadu_pd(mask, &a0[i]);
+			__m512d va1 = _mm512_maskz_loadu_pd(mask, &a1[i]);
+			__m512d va2 = _mm512_maskz_loadu_pd(mask, &a2[i]);
+			__m512d va3 = _mm512_maskz_loadu_pd(mask, &a3[i]);
+			r0_0 = _mm512_fmadd_pd(va0, x0, r0_0);
+			i0_0 = _mm512_fmadd_pd(va0, x1, i0_0);
+			r1_0 = _mm512_fmadd_pd(va1, x0, r1_0);
+			i1_0 = _mm512_fmadd_pd(va1, x1, i1_0);
+			r2_0 = _mm512_fmadd_pd(va2, x0, r2_0);
+			i2_0 = _mm512_fmadd_pd(va2, x1, i2_0);
+			r3_0 = _mm512_fmadd_pd(va3, x0, r3_0);
+			i3_0 = _mm512_fmadd_pd(va3, x1, i3_0);
+		}
+	}
+
+	zgemv_kernel_store(&y[0], _mm512_add_pd(r0_0, r0_1), _mm512_add_pd(i0_0, i0_1), alpha);
+	zgemv_kernel_store(&y[2], _mm512_add_pd(r1_0, r1_1), _mm512_add_pd(i1_0, i1_1), alpha);
+	zgemv_kernel_store(&y[4], _mm512_add_pd(r2_0, r2_1), _mm512_add_pd(i2_0, i2_1), alpha);
+	zgemv_kernel_store(&y[6], _mm512_add_pd(r3_0, r3_1), _mm512_add_pd(i3_0, i3_1), alpha);
+}
+
+#define HAVE_KERNEL_4x2 1
+static void zgemv_kernel_4x2( BLASLONG n, FLOAT **ap, FLOAT *x, FLOAT *y, FLOAT *alpha)
+{
+	BLASLONG i = 0;
+	BLASLONG len = 2 * n;
+	FLOAT *a0 = ap[0];
+	FLOAT *a1 = ap[1];
+	__m512d r0_0 = _mm512_setzero_pd(), i0_0 = _mm512_setzero_pd();
+	__m512d r0_1 = _mm512_setzero_pd(), i0_1 = _mm512_setzero_pd();
+	__m512d r1_0 = _mm512_setzero_pd(), i1_0 = _mm512_setzero_pd();
+	__m512d r1_1 = _mm512_setzero_pd(), i1_1 = _mm512_setzero_pd();
+
+	for (; i + 16 <= len; i += 16) {
+		{
+			__m512d x0 = _mm512_loadu_pd(&x[i]);
+			__m512d x1 = _mm512_permute_pd(x0, 0x55);
+			__m512d va0 = _mm512_loadu_pd(&a0[i]);
+			__m512d va1 = _mm512_loadu_pd(&a1[i]);
+			r0_0 = _mm512_fmadd_pd(va0, x0, r0_0);
+			i0_0 = _mm512_fmadd_pd(va0, x1, i0_0);
+			r1_0 = _mm512_fmadd_pd(va1, x0, r1_0);
+			i1_0 = _mm512_fmadd_pd(va1, x1, i1_0);
+		}
+		{
+			__m512d x0 = _mm512_loadu_pd(&x[i + 8]);
+			__m512d x1 = _mm512_permute_pd(x0, 0x55);
+			__m512d va0 = _mm512_loadu_pd(&a0[i + 8]);
+			__m512d va1 = _mm512_loadu_pd(&a1[i + 8]);
+			r0_1 = _mm512_fmadd_pd(va0, x0, r0_1);
+			i0_1 = _mm512_fmadd_pd(va0, x1, i0_1);
+			r1_1 = _mm512_fmadd_pd(va1, x0, r1_1);
+			i1_1 = _mm512_fmadd_pd(va1, x1, i1_1);
+		}
+	}
+
+	for (; i < len; i += 8) {
+		__mmask8 mask = (len - i >= 8) ? 0xff : (__mmask8)((1 << (len - i)) - 1);
+		{
+			__m512d x0 = _mm512_maskz_loadu_pd(mask, &x[i]);
+			__m512d x1 = _mm512_permute_pd(x0, 0x55);
+			__m512d va0 = _mm512_maskz_loadu_pd(mask, &a0[i]);
+			__m512d va1 = _mm512_maskz_loadu_pd(mask, &a1[i]);
+			r0_0 = _mm512_fmadd_pd(va0, x0, r0_0);
+			i0_0 = _mm512_fmadd_pd(va0, x1, i0_0);
+			r1_0 = _mm512_fmadd_pd(va1, x0, r1_0);
+			i1_0 = _mm512_fmadd_pd(va1, x1, i1_0);
+		}
+	}
+
+	zgemv_kernel_store(&y[0], _mm512_add_pd(r0_0, r0_1), _mm512_add_pd(i0_0, i0_1), alpha);
+	zgemv_kernel_store(&y[2], _mm512_add_pd(r1_0, r1_1), _mm512_add_pd(i1_0, i1_1), alpha);
+}
+
+#define HAVE_KERNEL_4x1 1
+static void zgemv_kernel_4x1( BLASLONG n, FLOAT *ap, FLOAT *x, FLOAT *y, FLOAT *alpha)
+{
+	BLASLONG i = 0;
+	BLASLONG len = 2 * n;
+	FLOAT *a0 = ap;
+	__m512d r0_0 = _mm512_setzero_pd(), i0_0 = _mm512_setzero_pd();
+	__m512d r0_1 = _mm512_setzero_pd(), i0_1 = _mm512_setzero_pd();
+
+	for (; i + 16 <= len; i += 16) {
+		{
+			__m512d x0 = _mm512_loadu_pd(&x[i]);
+			__m512d x1 = _mm512_permute_pd(x0, 0x55);
+			__m512d va0 = _mm512_loadu_pd(&a0[i]);
+			r0_0 = _mm512_fmadd_pd(va0, x0, r0_0);
+			i0_0 = _mm512_fmadd_pd(va0, x1, i0_0);
+		}
+		{
+			__m512d x0 = _mm512_loadu_pd(&x[i + 8]);
+			__m512d x1 = _mm512_permute_pd(x0, 0x55);
+			__m512d va0 = _mm512_loadu_pd(&a0[i + 8]);
+			r0_1 = _mm512_fmadd_pd(va0, x0, r0_1);
+			i0_1 = _mm512_fmadd_pd(va0, x1, i0_1);
+		}
+	}
+
+	for (; i < len; i += 8) {
+		__mmask8 mask = (len - i >= 8) ? 0xff : (__mmask8)((1 << (len - i)) - 1);
+		{
+			__m512d x0 = _mm512_maskz_loadu_pd(mask, &x[i]);
+			__m512d x1 = _mm512_permute_pd(x0, 0x55);
+			__m512d va0 = _mm512_maskz_loadu_pd(mask, &a0[i]);
+			r0_0 = _mm512_fmadd_pd(va0, x0, r0_0);
+			i0_0 = _mm512_fmadd_pd(va0, x1, i0_0);
+		}
+	}
+
+	zgemv_kernel_store(&y[0], _mm512_add_pd(r0_0, r0_1), _mm512_add_pd(i0_0, i0_1), alpha);
+}
+
+#else
+#include "zgemv_t_microk_haswell-4.c"
+#endif
@@ -0,0 +1,240 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include "common.h"
+
+/*
+ * Cache-blocked out-of-place transpose for single and double complex.
+ *
+ * Used for the RT, CT, RTC and CTC variants: the CT variants (built without
+ * ROWM) swap the dimensions as in domatcopy_rt.c, and CONJ conjugates the
+ * source before it is scaled.
+ *
+ * b[i + j * ldb] = alpha * a[j + i * lda],  0 <= i < rows, 0 <= j < cols
+ *
+ * Each source row of a block is loaded and scaled as one vector, then the
+ * block is transposed in registers treating a complex element as a single
+ * 128-bit (double) or 64-bit (single) unit.
+ */
+
+#define TILE 16
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+#if defined(DOUBLE) && defined(__AVX512F__)
+
+#define BLOCK 4
+#define VTYPE __m512d
+#define LOAD(p) _mm512_loadu_pd(p)
+#define STORE(p, v) _mm512_storeu_pd(p, v)
+#define SET_ALPHA(ar, ai, c) ar = _mm512_set1_pd(alpha_r); ai = _mm512_set1_pd(alpha_i); \
+	c = _mm512_set_pd(-ONE, ONE, -ONE, ONE, -ONE, ONE, -ONE, ONE)
+#define MUL(x, y) _mm512_mul_pd(x, y)
+#define SCALE(v, ar, ai) _mm512_fmaddsub_pd(ar, v, _mm512_mul_pd(ai, _mm512_permute_pd(v, 0x55)))
+
+static inline void transpose_block(VTYPE *r)
+{
+	__m512d t0, t1, t2, t3;
+
+	t0 = _mm512_shuffle_f64x2(r[0], r[1], 0x44);
+	t1 = _mm512_shuffle_f64x2(r[0], r[1], 0xee);
+	t2 = _mm512_shuffle_f64x2(r[2], r[3], 0x44);
+	t3 = _mm512_shuffle_f64x2(r[2], r[3], 0xee);
+
+	r[0] = _mm512_shuffle_f64x2(t0, t2, 0x88);
+	r[1] = _mm512_shuffle_f64x2(t0, t2, 0xdd);
+	r[2] = _mm512_shuffle_f64x2(t1, t3, 0x88);
+	r[3] = _mm512_shuffle_f64x2(t1, t3, 0xdd);
+}
+
+#elif defined(DOUBLE) && defined(__AVX__)
+
+#define BLOCK 2
+#define VTYPE __m256d
+#define LOAD(p) _mm256_loadu_pd(p)
+#define STORE(p, v) _mm256_storeu_pd(p, v)
+#define SET_ALPHA(ar, ai, c) ar = _mm256_set1_pd(alpha_r); ai = _mm256_set1_pd(alpha_i); \
+	c = _mm256_set_pd(-ONE, ONE, -ONE, ONE)
+#define MUL(x, y) _mm256_mul_pd(x, y)
+#define SCALE(v, ar, ai) _mm256_addsub_pd(_mm256_mul_pd(ar, v), _mm256_mul_pd(ai, _mm256_permute_pd(v, 0x5)))
+
+static inline void transpose_block(VTYPE *r)
+{
+	__m256d t0;
+
+	t0   = _mm256_permute2f128_pd(r[0], r[1], 0x20);
+	r[1] = _mm256_permute2f128_pd(r[0], r[1], 0x31);
+	r[0] = t0;
+}
+
+#elif !defined(DOUBLE) && defined(__AVX512F__)
+
+#define BLOCK 8
+#define VTYPE __m512
+#define LOAD(p) _mm512_loadu_ps(p)
+#define STORE(p, v) _mm512_storeu_ps(p, v)
+#define SET_ALPHA(ar, ai, c) ar = _mm512_set1_ps(alpha_r); ai = _mm512_set1_ps(alpha_i); \
+	c = _mm512_set_ps(-ONE, ONE, -ONE, ONE, -ONE, ONE, -ONE, ONE, -ONE, ONE, -ONE, ONE, -ONE, ONE, -ONE, ONE)
+#define MUL(x, y) _mm512_mul_ps(x, y)
+#define SCALE(v, ar, ai) _mm512_fmaddsub_ps(ar, v, _mm512_mul_ps(ai, _mm512_permute_ps(v, 0xb1)))
+
+static inline void transpose_block(VTYPE *r)
+{
+	__m512d r0, r1, r2, r3, r4, r5, r6, r7;
+	__m512d t0, t1, t2, t3, t4, t5, t6, t7;
+
+	t0 = _mm512_unpacklo_pd(_mm512_castps_pd(r[0]), _mm512_castps_pd(r[1]));
+	t1 = _mm512_unpackhi_pd(_mm512_castps_pd(r[0]), _mm512_castps_pd(r[1]));
+	t2 = _mm512_unpacklo_pd(_mm512_castps_pd(r[2]), _mm512_castps_pd(r[3]));
+	t3 = _mm512_unpackhi_pd(_mm512_castps_pd(r[2]), _mm512_castps_pd(r[3]));
+	t4 = _mm512_unpacklo_pd(_mm512_castps_pd(r[4]), _mm512_castps_pd(r[5]));
+	t5 = _mm512_unpackhi_pd(_mm512_castps_pd(r[4]), _mm512_castps_pd(r[5]));
+	t6 = _mm512_unpacklo_pd(_mm512_castps_pd(r[6]), _mm512_castps_pd(r[7]));
+	t7 = _mm512_unpackhi_pd(_mm512_castps_pd(r[6]), _mm512_castps_pd(r[7]));
+
+	r0 = _mm512_shuffle_f64x2(t0, t2, 0x88);
+	r1 = _mm512_shuffle_f64x2(t0, t2, 0xdd);
+	r2 = _mm512_shuffle_f64x2(t1, t3, 0x88);
+	r3 = _mm512_shuffle_f64x2(t1, t3, 0xdd);
+	r4 = _mm512_shuffle_f64x2(t4, t6, 0x88);
+	r5 = _mm512_shuffle_f64x2(t4, t6, 0xdd);
+	r6 = _mm512_shuffle_f64x2(t5, t7, 0x88);
+	r7 = _mm512_shuffle_f64x2(t5, t7, 0xdd);
+
+	r[0] = _mm512_castpd_ps(_mm512_shuffle_f64x2(r0, r4, 0x88));
+	r[1] = _mm512_castpd_ps(_mm512_shuffle_f64x2(r2, r6, 0x88));
+	r[2] = _mm512_castpd_ps(_mm512_shuffle_f64x2(r1, r5, 0x88));
+	r[3] = _mm512_castpd_ps(_mm512_shuffle_f64x2(r3, r7, 0x88));
+	r[4] = _mm512_castpd_ps(_mm512_shuffle_f64x2(r0, r4, 0xdd));
+	r[5] = _mm512_castpd_ps(_mm512_shuffle_f64x2(r2, r6, 0xdd));
+	r[6] = _mm512_castpd_ps(_mm512_shuffle_f64x2(r1, r5, 0xdd));
+	r[7] = _mm512_castpd_ps(_mm512_shuffle_f64x2(r3, r7, 0xdd));
+}
+
+#elif !defined(DOUBLE) && defined(__AVX__)
+
+#define BLOCK 4
+#define VTYPE __m256
+#define LOAD(p) _mm256_loadu_ps(p)
+#define STORE(p, v) _mm256_storeu_ps(p, v)
+#define SET_ALPHA(ar, ai, c) ar = _mm256_set1_ps(alpha_r); ai = _mm256_set1_ps(alpha_i); \
+	c = _mm256_set_ps(-ONE, ONE, -ONE, ONE, -ONE, ONE, -ONE, ONE)
+#define MUL(x, y) _mm256_mul_ps(x, y)
+#define SCALE(v, ar, ai) _mm256_addsub_ps(_mm256_mul_ps(ar, v), _mm256_mul_ps(ai, _mm256_permute_ps(v, 0xb1)))
+
+static inline void transpose_block(VTYPE *r)
+{
+	__m256d t0, t1, t2, t3;
+
+	t0 = _mm256_unpacklo_pd(_mm256_castps_pd(r[0]), _mm256_castps_pd(r[1]));
+	t1 = _mm256_unpackhi_pd(_mm256_castps_pd(r[0]), _mm256_castps_pd(r[1]));
+	t2 = _mm256_unpacklo_pd(_mm256_castps_pd(r[2]), _mm256_castps_pd(r[3]));
+	t3 = _mm256_unpackhi_pd(_mm256_castps_pd(r[2]), _mm256_castps_pd(r[3]));
+
+	r[0] = _mm256_castpd_ps(_mm256_permute2f128_pd(t0, t2, 0x20));
+	r[1] = _mm256_castpd_ps(_mm256_permute2f128_pd(t1, t3, 0x20));
+	r[2] = _mm256_castpd_ps(_mm256_permute2f128_pd(t0, t2, 0x31));
+	r[3] = _mm256_castpd_ps(_mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+#endif
+
+static inline void copy_element(FLOAT alpha_r, FLOAT alpha_i, FLOAT *a, FLOAT *b)
+{
+#ifndef CONJ
+	b[0] = alpha_r * a[0] - alpha_i * a[1];
+	b[1] = alpha_r * a[1] + alpha_i * a[0];
+#else
+	b[0] = alpha_r * a[0] + alpha_i * a[1];
+	b[1] = alpha_i * a[0] - alpha_r * a[1];
+#endif
+}
+
+static void transpose_tile(BLASLONG rows, BLASLONG cols, FLOAT alpha_r, FLOAT alpha_i, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+	BLASLONG i = 0, j, k;
+
+#ifdef BLOCK
+	VTYPE r[BLOCK], valpha_r, valpha_i, vconj;
+
+	SET_ALPHA(valpha_r, valpha_i, vconj);
+	(void)vconj;
+
+	for (; i + BLOCK <= rows; i += BLOCK) {
+		for (j = 0; j + BLOCK <= cols; j += BLOCK) {
+			for (k = 0; k < BLOCK; k++) {
+				r[k] = LOAD(a + ((i + k) * lda + j) * 2);
+#ifdef CONJ
+				r[k] = MUL(r[k], vconj);
+#endif
+				r[k] = SCALE(r[k], valpha_r, valpha_i);
+			}
+			transpose_block(r);
+			for (k = 0; k < BLOCK; k++)
+				STORE(b + (i + (j + k) * ldb) * 2, r[k]);
+		}
+		for (; j < cols; j++)
+			for (k = 0; k < BLOCK; k++)
+				copy_element(alpha_r, alpha_i, a + ((i + k) * lda + j) * 2, b + (i + k + j * ldb) * 2);
+	}
+#endif
+
+	for (; i < rows; i++)
+		for (j = 0; j < cols; j++)
+			copy_element(alpha_r, alpha_i, a + (i * lda + j) * 2, b + (i + j * ldb) * 2);
+}
+
+int CNAME(BLASLONG rows, BLASLONG cols, FLOAT alpha_r, FLOAT alpha_i, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+	BLASLONG i, j, ib, jb;
+
+	if (rows <= 0) return 0;
+	if (cols <= 0) return 0;
+
+#ifndef ROWM
+	i = rows; rows = cols; cols = i;
+#endif
+
+	if (alpha_r == ZERO && alpha_i == ZERO) {
+		for (j = 0; j < cols; j++)
+			for (i = 0; i < rows * 2; i++)
+				b[i + j * ldb * 2] = ZERO;
+		return 0;
+	}
+
+	for (i = 0; i < rows; i += TILE) {
+		ib = MIN(TILE, rows - i);
+		for (j = 0; j < cols; j += TILE) {
+			jb = MIN(TILE, cols - j);
+			transpose_tile(ib, jb, alpha_r, alpha_i, a + (i * lda + j) * 2, lda, b + (i + j * ldb) * 2, ldb);
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,223 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include <float.h>
+#include "common.h"
+
+/*
+ * LU factorization with partial pivoting of a batch of small independent
+ * matrices (the unblocked DGETF2 algorithm). Square problems of order 4, 8,
+ * 16 and 32 are copied into a tile on the stack so that the kernel runs
+ * with constant sizes and a constant leading dimension; other problems up
+ * to BATCH_MAX run the same kernel in place, and larger ones go through
+ * GETRF_SINGLE. The trailing update handles four columns per pass, so
+ * each multiplier is loaded once for four columns; the kernels are plain
+ * C loops, not register-blocked microkernels. The parallel build splits
+ * the problems into ranges of whole problems with gemm_thread_m.
+ *
+ * args -> k   : number of problems
+ * args -> a   : array of pointers to the matrices
+ * args -> c   : array of pointers to ipiv (1-based, like GETRF)
+ * args -> d   : info of every problem
+ */
+
+#define BATCH_MAX 64
+
+#if defined(__GNUC__)
+#define BATCH_INLINE inline __attribute__((always_inline))
+#else
+#define BATCH_INLINE inline
+#endif
+
+#ifndef DOUBLE
+#define SFMIN FLT_MIN
+#else
+#define SFMIN DBL_MIN
+#endif
+
+static BATCH_INLINE blasint getrf_kernel(BLASLONG m, BLASLONG n, FLOAT *a, BLASLONG lda, blasint *ipiv) {
+
+  BLASLONG i, j, jj, jp, mn;
+  FLOAT *aj, *b0, *b1, *b2, *b3;
+  FLOAT amax, temp, l, u0, u1, u2, u3;
+  blasint info = 0;
+
+  mn = MIN(m, n);
+
+  for (j = 0; j < mn; j++) {
+    aj = a + j * lda;
+
+    jp   = j;
+    amax = fabs(aj[j]);
+    for (i = j + 1; i < m; i++) {
+      if (fabs(aj[i]) > amax) {
+	amax = fabs(aj[i]);
+	jp   = i;
+      }
+    }
+    ipiv[j] = jp + 1;
+
+    if (aj[jp] != ZERO) {
+      if (jp != j) {
+	for (jj = 0; jj < n; jj++) {
+	  temp             = a[j  + jj * lda];
+	  a[j  + jj * lda] = a[jp + jj * lda];
+	  a[jp + jj * lda] = temp;
+	}
+      }
+
+      temp = aj[j];
+      if (fabs(temp) >= SFMIN) {
+	temp = ONE / temp;
+	for (i = j + 1; i < m; i++) aj[i] *= temp;
+      } else {
+	for (i = j + 1; i < m; i++) aj[i] /= temp;
+      }
+    } else {
+      if (!info) info = j + 1;
+    }
+
+    for (jj = j + 1; jj + 4 <= n; jj += 4) {
+      b0 = a + jj * lda;
+      b1 = b0 + lda;
+      b2 = b1 + lda;
+      b3 = b2 + lda;
+      u0 = b0[j];
+      u1 = b1[j];
+      u2 = b2[j];
+      u3 = b3[j];
+      for (i = j + 1; i < m; i++) {
+	l = aj[i];
+	b0[i] -= l * u0;
+	b1[i] -= l * u1;
+	b2[i] -= l * u2;
+	b3[i] -= l * u3;
+      }
+    }
+    for (; jj < n; jj++) {
+      b0 = a + jj * lda;
+      u0 = b0[j];
+      for (i = j + 1; i < m; i++) b0[i] -= aj[i] * u0;
+    }
+  }
+
+  return info;
+}
+
+#define GETRF_TILE(N)								\
+static blasint getrf_tile_##N(FLOAT *a, BLASLONG lda, blasint *ipiv) {		\
+  FLOAT t[N * N];								\
+  BLASLONG i, j;								\
+  blasint info;									\
+										\
+  for (j = 0; j < N; j++)							\
+    for (i = 0; i < N; i++) t[i + j * N] = a[i + j * lda];			\
+										\
+  info = getrf_kernel(N, N, t, N, ipiv);					\
+										\
+  for (j = 0; j < N; j++)							\
+    for (i = 0; i < N; i++) a[i + j * lda] = t[i + j * N];			\
+										\
+  return info;									\
+}
+
+GETRF_TILE(4)
+GETRF_TILE(8)
+GETRF_TILE(16)
+GETRF_TILE(32)
+
+static blasint getrf_one(BLASLONG m, BLASLONG n, FLOAT *a, BLASLONG lda, blasint *ipiv, FLOAT *sa, FLOAT *sb) {
+
+  blas_arg_t args;
+
+  if (m == n) {
+    switch (n) {
+    case  4 : return getrf_tile_4 (a, lda, ipiv);
+    case  8 : return getrf_tile_8 (a, lda, ipiv);
+    case 16 : return getrf_tile_16(a, lda, ipiv);
+    case 32 : return getrf_tile_32(a, lda, ipiv);
+    }
+  }
+
+  if (m <= BATCH_MAX && n <= BATCH_MAX) return getrf_kernel(m, n, a, lda, ipiv);
+
+  args.m     = m;
+  args.n     = n;
+  args.a     = (void *)a;
+  args.lda   = lda;
+  args.c     = (void *)ipiv;
+  args.alpha = NULL;
+  args.beta  = NULL;
+
+  return GETRF_SINGLE(&args, NULL, NULL, sa, sb, 0);
+}
+
+static int batch_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  FLOAT   **a    = (FLOAT   **)args -> a;
+  blasint **ipiv = (blasint **)args -> c;
+  blasint  *info = (blasint  *)args -> d;
+  BLASLONG i, from = 0, to = args -> k;
+
+  if (range_m) {
+    from = range_m[0];
+    to   = range_m[1];
+  }
+
+  for (i = from; i < to; i++)
+    info[i] = getrf_one(args -> m, args -> n, a[i], args -> lda, ipiv[i], sa, sb);
+
+  return 0;
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+#ifdef PARALLEL
+  BLASLONG nthreads = MIN(args -> nthreads, args -> k);
+  BLASLONG range[2];
+  int mode;
+
+  if (nthreads > 1) {
+#ifndef DOUBLE
+    mode = BLAS_SINGLE | BLAS_REAL;
+#else
+    mode = BLAS_DOUBLE | BLAS_REAL;
+#endif
+    range[0] = 0;
+    range[1] = args -> k;
+
+    gemm_thread_m(mode, args, range, NULL, batch_thread, sa, sb, nthreads);
+    return 0;
+  }
+#endif
+
+  batch_thread(args, NULL, NULL, sa, sb, 0);
+
+  return 0;
+}
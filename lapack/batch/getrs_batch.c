@@ -0,0 +1,203 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+/*
+ * Solution of a batch of small independent systems A * X = B (or
+ * A**T * X = B with TRANS) from the LU factorizations of GETRF. Systems of
+ * order 4, 8, 16 and 32 run the kernel with a constant order; other systems
+ * up to BATCH_MAX run it with a variable one and larger ones go through
+ * GETRS_N_SINGLE / GETRS_T_SINGLE. The parallel build splits the problems
+ * into ranges of whole problems with gemm_thread_m.
+ *
+ * args -> k   : number of problems
+ * args -> m   : order of the matrices
+ * args -> n   : number of right hand sides
+ * args -> a   : array of pointers to the factored matrices
+ * args -> b   : array of pointers to the right hand sides
+ * args -> c   : array of pointers to ipiv (1-based)
+ * args -> d   : info of every problem
+ */
+
+#define BATCH_MAX 64
+
+#if defined(__GNUC__)
+#define BATCH_INLINE inline __attribute__((always_inline))
+#else
+#define BATCH_INLINE inline
+#endif
+
+#ifndef TRANS
+#define GETRS_SINGLE GETRS_N_SINGLE
+#else
+#define GETRS_SINGLE GETRS_T_SINGLE
+#endif
+
+static BATCH_INLINE void getrs_kernel(BLASLONG n, BLASLONG nrhs, FLOAT *a, BLASLONG lda, blasint *ipiv, FLOAT *b, BLASLONG ldb) {
+
+  BLASLONG i, j, jp, r;
+  FLOAT *aj, temp;
+
+  for (r = 0; r < nrhs; r++, b += ldb) {
+
+#ifndef TRANS
+    for (j = 0; j < n; j++) {
+      jp = ipiv[j] - 1;
+      if (jp != j) {
+	temp  = b[j];
+	b[j]  = b[jp];
+	b[jp] = temp;
+      }
+    }
+
+    /* L is unit lower triangular */
+    for (j = 0; j < n; j++) {
+      aj   = a + j * lda;
+      temp = b[j];
+      for (i = j + 1; i < n; i++) b[i] -= aj[i] * temp;
+    }
+
+    for (j = n - 1; j >= 0; j--) {
+      aj   = a + j * lda;
+      temp = b[j] / aj[j];
+      b[j] = temp;
+      for (i = 0; i < j; i++) b[i] -= aj[i] * temp;
+    }
+#else
+    for (j = 0; j < n; j++) {
+      aj   = a + j * lda;
+      temp = b[j];
+      for (i = 0; i < j; i++) temp -= aj[i] * b[i];
+      b[j] = temp / aj[j];
+    }
+
+    for (j = n - 1; j >= 0; j--) {
+      aj   = a + j * lda;
+      temp = b[j];
+      for (i = j + 1; i < n; i++) temp -= aj[i] * b[i];
+      b[j] = temp;
+    }
+
+    for (j = n - 1; j >= 0; j--) {
+      jp = ipiv[j] - 1;
+      if (jp != j) {
+	temp  = b[j];
+	b[j]  = b[jp];
+	b[jp] = temp;
+      }
+    }
+#endif
+  }
+}
+
+#define GETRS_FIXED(N)								\
+static void getrs_fixed_##N(BLASLONG nrhs, FLOAT *a, BLASLONG lda, blasint *ipiv, FLOAT *b, BLASLONG ldb) { \
+  getrs_kernel(N, nrhs, a, lda, ipiv, b, ldb);					\
+}
+
+GETRS_FIXED(4)
+GETRS_FIXED(8)
+GETRS_FIXED(16)
+GETRS_FIXED(32)
+
+static void getrs_one(BLASLONG n, BLASLONG nrhs, FLOAT *a, BLASLONG lda, blasint *ipiv, FLOAT *b, BLASLONG ldb, FLOAT *sa, FLOAT *sb) {
+
+  blas_arg_t args;
+
+  switch (n) {
+  case  4 : getrs_fixed_4 (nrhs, a, lda, ipiv, b, ldb); return;
+  case  8 : getrs_fixed_8 (nrhs, a, lda, ipiv, b, ldb); return;
+  case 16 : getrs_fixed_16(nrhs, a, lda, ipiv, b, ldb); return;
+  case 32 : getrs_fixed_32(nrhs, a, lda, ipiv, b, ldb); return;
+  }
+
+  if (n <= BATCH_MAX) {
+    getrs_kernel(n, nrhs, a, lda, ipiv, b, ldb);
+    return;
+  }
+
+  args.m     = n;
+  args.n     = nrhs;
+  args.a     = (void *)a;
+  args.lda   = lda;
+  args.b     = (void *)b;
+  args.ldb   = ldb;
+  args.c     = (void *)ipiv;
+  args.alpha = NULL;
+  args.beta  = NULL;
+
+  GETRS_SINGLE(&args, NULL, NULL, sa, sb, 0);
+}
+
+static int batch_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  FLOAT   **a    = (FLOAT   **)args -> a;
+  FLOAT   **b    = (FLOAT   **)args -> b;
+  blasint **ipiv = (blasint **)args -> c;
+  blasint  *info = (blasint  *)args -> d;
+  BLASLONG i, from = 0, to = args -> k;
+
+  if (range_m) {
+    from = range_m[0];
+    to   = range_m[1];
+  }
+
+  for (i = from; i < to; i++) {
+    getrs_one(args -> m, args -> n, a[i], args -> lda, ipiv[i], b[i], args -> ldb, sa, sb);
+    info[i] = 0;
+  }
+
+  return 0;
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+#ifdef PARALLEL
+  BLASLONG nthreads = MIN(args -> nthreads, args -> k);
+  BLASLONG range[2];
+  int mode;
+
+  if (nthreads > 1) {
+#ifndef DOUBLE
+    mode = BLAS_SINGLE | BLAS_REAL;
+#else
+    mode = BLAS_DOUBLE | BLAS_REAL;
+#endif
+    range[0] = 0;
+    range[1] = args -> k;
+
+    gemm_thread_m(mode, args, range, NULL, batch_thread, sa, sb, nthreads);
+    return 0;
+  }
+#endif
+
+  batch_thread(args, NULL, NULL, sa, sb, 0);
+
+  return 0;
+}
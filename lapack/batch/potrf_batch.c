@@ -0,0 +1,242 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include "common.h"
+
+/*
+ * Cholesky factorization of a batch of small independent symmetric positive
+ * definite matrices (right-looking, the DPOTF2 algorithm), the upper
+ * triangle by default and the lower one with LOWER. Problems of order 4, 8,
+ * 16 and 32 are copied into a tile on the stack so that the kernel runs
+ * with constant sizes; other problems up to BATCH_MAX run in place and
+ * larger ones go through POTRF_U_SINGLE / POTRF_L_SINGLE. The update of the
+ * trailing matrix handles four columns per pass; the kernels are plain C
+ * loops, not register-blocked microkernels. The parallel build splits the
+ * problems into ranges of whole problems with gemm_thread_m.
+ *
+ * args -> k   : number of problems
+ * args -> a   : array of pointers to the matrices
+ * args -> d   : info of every problem
+ */
+
+#define BATCH_MAX 64
+
+#if defined(__GNUC__)
+#define BATCH_INLINE inline __attribute__((always_inline))
+#else
+#define BATCH_INLINE inline
+#endif
+
+#ifndef LOWER
+#define POTRF_SINGLE POTRF_U_SINGLE
+#else
+#define POTRF_SINGLE POTRF_L_SINGLE
+#endif
+
+static BATCH_INLINE blasint potrf_kernel(BLASLONG n, FLOAT *a, BLASLONG lda) {
+
+  BLASLONG i, j, k;
+  FLOAT *b0, *b1, *b2, *b3;
+  FLOAT ajj, r, l, u0, u1, u2, u3;
+#ifndef LOWER
+  FLOAT t[BATCH_MAX];
+#else
+  FLOAT *aj;
+#endif
+
+  for (j = 0; j < n; j++) {
+    ajj = a[j + j * lda];
+
+    if (ajj <= ZERO || ajj != ajj) return j + 1;
+
+    ajj = sqrt(ajj);
+    a[j + j * lda] = ajj;
+    r = ONE / ajj;
+
+#ifndef LOWER
+    /* row j of U, kept in t[] for the update of the columns to its right */
+    for (k = j + 1; k < n; k++) {
+      a[j + k * lda] *= r;
+      t[k] = a[j + k * lda];
+    }
+
+    /* a(j+1:k, k) -= t(j+1:k) * t(k) */
+    for (k = j + 1; k + 4 <= n; k += 4) {
+      b0 = a + k * lda;
+      b1 = b0 + lda;
+      b2 = b1 + lda;
+      b3 = b2 + lda;
+      u0 = t[k    ];
+      u1 = t[k + 1];
+      u2 = t[k + 2];
+      u3 = t[k + 3];
+      for (i = j + 1; i <= k; i++) {
+	l = t[i];
+	b0[i] -= l * u0;
+	b1[i] -= l * u1;
+	b2[i] -= l * u2;
+	b3[i] -= l * u3;
+      }
+      b1[k + 1] -= t[k + 1] * u1;
+      b2[k + 1] -= t[k + 1] * u2;
+      b2[k + 2] -= t[k + 2] * u2;
+      b3[k + 1] -= t[k + 1] * u3;
+      b3[k + 2] -= t[k + 2] * u3;
+      b3[k + 3] -= t[k + 3] * u3;
+    }
+    for (; k < n; k++) {
+      b0 = a + k * lda;
+      u0 = t[k];
+      for (i = j + 1; i <= k; i++) b0[i] -= t[i] * u0;
+    }
+#else
+    aj = a + j * lda;
+    for (i = j + 1; i < n; i++) aj[i] *= r;
+
+    /* a(k:n, k) -= aj(k:n) * aj(k) */
+    for (k = j + 1; k + 4 <= n; k += 4) {
+      b0 = a + k * lda;
+      b1 = b0 + lda;
+      b2 = b1 + lda;
+      b3 = b2 + lda;
+      u0 = aj[k    ];
+      u1 = aj[k + 1];
+      u2 = aj[k + 2];
+      u3 = aj[k + 3];
+      b0[k    ] -= aj[k    ] * u0;
+      b0[k + 1] -= aj[k + 1] * u0;
+      b0[k + 2] -= aj[k + 2] * u0;
+      b1[k + 1] -= aj[k + 1] * u1;
+      b1[k + 2] -= aj[k + 2] * u1;
+      b2[k + 2] -= aj[k + 2] * u2;
+      for (i = k + 3; i < n; i++) {
+	l = aj[i];
+	b0[i] -= l * u0;
+	b1[i] -= l * u1;
+	b2[i] -= l * u2;
+	b3[i] -= l * u3;
+      }
+    }
+    for (; k < n; k++) {
+      b0 = a + k * lda;
+      u0 = aj[k];
+      for (i = k; i < n; i++) b0[i] -= aj[i] * u0;
+    }
+#endif
+  }
+
+  return 0;
+}
+
+#define POTRF_TILE(N)								\
+static blasint potrf_tile_##N(FLOAT *a, BLASLONG lda) {				\
+  FLOAT t[N * N];								\
+  BLASLONG i, j;								\
+  blasint info;									\
+										\
+  for (j = 0; j < N; j++)							\
+    for (i = 0; i < N; i++) t[i + j * N] = a[i + j * lda];			\
+										\
+  info = potrf_kernel(N, t, N);							\
+										\
+  for (j = 0; j < N; j++)							\
+    for (i = 0; i < N; i++) a[i + j * lda] = t[i + j * N];			\
+										\
+  return info;									\
+}
+
+POTRF_TILE(4)
+POTRF_TILE(8)
+POTRF_TILE(16)
+POTRF_TILE(32)
+
+static blasint potrf_one(BLASLONG n, FLOAT *a, BLASLONG lda, FLOAT *sa, FLOAT *sb) {
+
+  blas_arg_t args;
+
+  switch (n) {
+  case  4 : return potrf_tile_4 (a, lda);
+  case  8 : return potrf_tile_8 (a, lda);
+  case 16 : return potrf_tile_16(a, lda);
+  case 32 : return potrf_tile_32(a, lda);
+  }
+
+  if (n <= BATCH_MAX) return potrf_kernel(n, a, lda);
+
+  args.n     = n;
+  args.a     = (void *)a;
+  args.lda   = lda;
+  args.alpha = NULL;
+  args.beta  = NULL;
+
+  return POTRF_SINGLE(&args, NULL, NULL, sa, sb, 0);
+}
+
+static int batch_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  FLOAT   **a    = (FLOAT   **)args -> a;
+  blasint  *info = (blasint  *)args -> d;
+  BLASLONG i, from = 0, to = args -> k;
+
+  if (range_m) {
+    from = range_m[0];
+    to   = range_m[1];
+  }
+
+  for (i = from; i < to; i++)
+    info[i] = potrf_one(args -> n, a[i], args -> lda, sa, sb);
+
+  return 0;
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+#ifdef PARALLEL
+  BLASLONG nthreads = MIN(args -> nthreads, args -> k);
+  BLASLONG range[2];
+  int mode;
+
+  if (nthreads > 1) {
+#ifndef DOUBLE
+    mode = BLAS_SINGLE | BLAS_REAL;
+#else
+    mode = BLAS_DOUBLE | BLAS_REAL;
+#endif
+    range[0] = 0;
+    range[1] = args -> k;
+
+    gemm_thread_m(mode, args, range, NULL, batch_thread, sa, sb, nthreads);
+    return 0;
+  }
+#endif
+
+  batch_thread(args, NULL, NULL, sa, sb, 0);
+
+  return 0;
+}
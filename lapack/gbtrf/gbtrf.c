@@ -0,0 +1,433 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+/*
+ * LU factorization of a general M x N band matrix with KL subdiagonals and
+ * KU superdiagonals by partial pivoting with row interchanges (the DGBTRF
+ * algorithm). As in DGBTRF the rows KL + KU + 1 - KL .. KL + KU of AB take
+ * the fill-in, and the multipliers of every column are stored without the
+ * interchanges of the later columns.
+ *
+ * Inside the band the storage is a general matrix with leading dimension
+ * LDAB - 1. Every block of columns is gathered with its KL rows below the
+ * diagonal into the dense workspace W, factorized there with GETRF and
+ * applied to the KL + KU columns that follow it: interchanges, TRSM with
+ * the unit lower triangle and GEMM with the rows below it. All but the last
+ * JB - 1 of those columns hold the block rows in the band storage and are
+ * updated in place; the last ones are cut by the top of the storage and go
+ * through a dense copy.
+ *
+ * The steps are pipelined in the parallel build: while the other threads
+ * apply block k to the columns they own, the first thread updates the
+ * columns of block k + 1 first and factorizes them into the second W, so
+ * block k + 1 is ready when the update of block k finishes.
+ *
+ * Bands with few subdiagonals are factorized column by column.
+ *
+ * args -> a   : AB
+ * args -> lda : LDAB
+ * args -> m   : M
+ * args -> n   : N
+ * args -> k   : KL
+ * args -> ldc : KU
+ * args -> c   : IPIV
+ * args -> b   : workspace, three blocks of (args -> ldb + KL) x args -> ldb
+ * args -> ldb : block width, 1 for the unblocked code
+ */
+
+/* narrowest share of the trailing update worth a thread */
+#define GBTRF_THREAD_MIN 32
+
+static FLOAT dm1 = -1.;
+
+/* zeroes the fill-in rows of the columns from .. to */
+static void zero_fill(FLOAT *a, BLASLONG lda, BLASLONG kl, BLASLONG ku, BLASLONG from, BLASLONG to) {
+
+  BLASLONG j, i;
+
+  for (j = from; j < to; j++) {
+    for (i = MAX(0, j - kl - ku); i < j - ku; i++) a[i + j * lda] = ZERO;
+  }
+}
+
+/* column by column, the DGBTF2 algorithm; a points to the diagonal and lda is LDAB - 1 */
+static blasint gbtf2(BLASLONG m, BLASLONG n, BLASLONG kl, BLASLONG ku, FLOAT *a, BLASLONG lda,
+		     blasint *ipiv, FLOAT *sb) {
+
+  BLASLONG j, jp, km, ju, mn;
+  FLOAT temp;
+  blasint info = 0;
+
+  mn = MIN(m, n);
+
+  zero_fill(a, lda, kl, ku, 0, MIN(n, kl + ku));
+
+  ju = 0;
+
+  for (j = 0; j < mn; j++) {
+    if (j + kl + ku < n) zero_fill(a, lda, kl, ku, j + kl + ku, j + kl + ku + 1);
+
+    km = MIN(kl, m - j - 1);
+    jp = IAMAX_K(km + 1, a + j + j * lda, 1);
+    ipiv[j] = j + jp;
+
+    temp = a[j + jp - 1 + j * lda];
+
+    if (temp != ZERO) {
+      ju = MAX(ju, MIN(j + ku + jp - 1, n - 1));
+
+      if (jp != 1) SWAP_K(ju - j + 1, 0, 0, ZERO, a + j + jp - 1 + j * lda, lda, a + j + j * lda, lda, NULL, 0);
+
+      if (km > 0) {
+	SCAL_K(km, 0, 0, ONE / temp, a + j + 1 + j * lda, 1, NULL, 0, NULL, 0);
+
+	if (ju > j)
+	  GERU_K(km, ju - j, 0, dm1, a + j + 1 + j * lda, 1, a + j + (j + 1) * lda, lda,
+		 a + j + 1 + (j + 1) * lda, lda, sb);
+      }
+    } else {
+      if (!info) info = j + 1;
+    }
+  }
+
+  return info;
+}
+
+/*
+ * Gathers the block of jb columns at j with its rows j .. m into w and
+ * factorizes it. Returns the first zero pivot, relative to the block.
+ */
+static blasint factor(BLASLONG m, BLASLONG kl, FLOAT *a, BLASLONG lda, BLASLONG j, BLASLONG jb,
+		      FLOAT *w, BLASLONG ldw, blasint *ipiv, FLOAT *sa, FLOAT *sb) {
+
+  BLASLONG rows, p, q, len;
+  blas_arg_t args;
+
+  rows = MIN(m, j + jb + kl) - j;
+
+  for (q = 0; q < jb; q++) {
+    len = MIN(rows, q + kl + 1);
+    for (p = 0; p < len; p++) w[p + q * ldw] = a[j + p + (j + q) * lda];
+    for (; p < rows; p++) w[p + q * ldw] = ZERO;
+  }
+
+  args.m   = rows;
+  args.n   = jb;
+  args.a   = (void *)w;
+  args.lda = ldw;
+  args.c   = (void *)(ipiv + j);
+
+  return GETRF_SINGLE(&args, NULL, NULL, sa, sb, 0);
+}
+
+/*
+ * Undoes the interchanges of the block on its own earlier columns, so the
+ * multipliers are stored as DGBTF2 stores them, scatters w back into the
+ * band and makes the pivot indices absolute.
+ */
+static void finish(BLASLONG m, BLASLONG kl, FLOAT *a, BLASLONG lda, BLASLONG j, BLASLONG jb,
+		   FLOAT *w, BLASLONG ldw, blasint *ipiv) {
+
+  BLASLONG rows, p, q, len, ip;
+
+  rows = MIN(m, j + jb + kl) - j;
+
+  for (q = jb - 1; q > 0; q--) {
+    ip = ipiv[j + q] - 1;
+    if (ip != q) SWAP_K(q, 0, 0, ZERO, w + q, ldw, w + ip, ldw, NULL, 0);
+  }
+
+  for (q = 0; q < jb; q++) {
+    len = MIN(rows, q + kl + 1);
+    for (p = 0; p < len; p++) a[j + p + (j + q) * lda] = w[p + q * ldw];
+    ipiv[j + q] += j;
+  }
+}
+
+/* interchanges, TRSM and GEMM of the block in w on the rows x cols matrix b */
+static void apply(BLASLONG rows, BLASLONG cols, BLASLONG jb, FLOAT *w, BLASLONG ldw, blasint *ipiv,
+		  FLOAT *b, BLASLONG ldb, FLOAT *sa, FLOAT *sb) {
+
+  blas_arg_t args;
+
+  if (cols <= 0) return;
+
+  LASWP_PLUS(cols, 1, jb, ZERO, b, ldb, NULL, 0, ipiv, 1);
+
+  args.m     = jb;
+  args.n     = cols;
+  args.a     = (void *)w;
+  args.lda   = ldw;
+  args.b     = (void *)b;
+  args.ldb   = ldb;
+  args.beta  = NULL;
+
+  TRSM_LNLU(&args, NULL, NULL, sa, sb, 0);
+
+  if (rows > jb) {
+    args.m     = rows - jb;
+    args.n     = cols;
+    args.k     = jb;
+    args.a     = (void *)(w + jb);
+    args.lda   = ldw;
+    args.b     = (void *)b;
+    args.ldb   = ldb;
+    args.c     = (void *)(b + jb);
+    args.ldc   = ldb;
+    args.alpha = (void *)&dm1;
+    args.beta  = NULL;
+
+    GEMM_NN(&args, NULL, NULL, sa, sb, 0);
+  }
+}
+
+/*
+ * Applies the block of args -> ldd columns at args -> ldc, factorized in
+ * args -> b, to the columns from .. to. The columns past KL + KU from the
+ * block go through the dense copy in args -> beta.
+ *
+ * args -> a   : diagonal of the band, args -> lda : LDAB - 1
+ * args -> m   : M, args -> n : KL + KU, args -> k : KL
+ * args -> b   : W of the block, args -> ldb : its leading dimension
+ * args -> c   : IPIV
+ */
+static void update(blas_arg_t *args, BLASLONG from, BLASLONG to, FLOAT *sa, FLOAT *sb) {
+
+  BLASLONG kv  = args -> n;
+  BLASLONG lda = args -> lda;
+  BLASLONG ldw = args -> ldb;
+  BLASLONG j   = args -> ldc;
+  BLASLONG jb  = args -> ldd;
+  BLASLONG rows = MIN(args -> m, j + jb + args -> k) - j;
+  BLASLONG mid  = MIN(to, j + kv + 1);
+  FLOAT *a = (FLOAT *)args -> a;
+  FLOAT *w = (FLOAT *)args -> b;
+  FLOAT *x = (FLOAT *)args -> beta;
+  blasint *ipiv = (blasint *)args -> c + j;
+
+  BLASLONG p, q, top;
+
+  if (from < mid) apply(rows, mid - from, jb, w, ldw, ipiv, a + j + from * lda, lda, sa, sb);
+
+  from = MAX(from, mid);
+  if (from >= to) return;
+
+  /* the threads share x, column c of the copy is column j + kv + 1 + c */
+  x += (from - j - kv - 1) * ldw;
+
+  /* column c holds the rows from c - kv in the band */
+  for (q = 0; q < to - from; q++) {
+    top = from + q - kv - j;
+    for (p = 0; p < top; p++) x[p + q * ldw] = ZERO;
+    for (; p < rows; p++) x[p + q * ldw] = a[j + p + (from + q) * lda];
+  }
+
+  apply(rows, to - from, jb, w, ldw, ipiv, x, ldw, sa, sb);
+
+  for (q = 0; q < to - from; q++) {
+    top = from + q - kv - j;
+    for (p = top; p < rows; p++) a[j + p + (from + q) * lda] = x[p + q * ldw];
+  }
+}
+
+/*
+ * The first thread of a step: updates the next block, factorizes it into
+ * args -> d and then updates the rest of range_m. The width of the next
+ * block comes in range_n[0], and its INFO goes back in range_n[1].
+ */
+static int lookahead(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  BLASLONG next = args -> ldc + args -> ldd;
+  BLASLONG nb   = range_n[0];
+
+  update(args, next, next + nb, sa, sb);
+
+  if (nb > 0)
+    range_n[1] = factor(args -> m, args -> k, (FLOAT *)args -> a, args -> lda, next, nb,
+			(FLOAT *)args -> d, args -> ldb, (blasint *)args -> c, sa, sb);
+
+  update(args, next + nb, range_m[1], sa, sb);
+
+  return 0;
+}
+
+#ifdef PARALLEL
+static int update_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  update(args, range_m[0], range_m[1], sa, sb);
+
+  return 0;
+}
+
+/*
+ * Splits the columns from .. to between the threads; the first thread
+ * owns the next block and counts its factorization as half its width.
+ */
+static BLASLONG partition(BLASLONG from, BLASLONG to, BLASLONG nb, BLASLONG nthreads, BLASLONG *range) {
+
+  BLASLONG num, width, rest;
+
+  if (nthreads > (to - from) / GBTRF_THREAD_MIN) nthreads = (to - from) / GBTRF_THREAD_MIN;
+  if (nthreads < 1) nthreads = 1;
+
+  range[0] = from;
+  rest = to - from + nb / 2;
+  num  = 0;
+
+  while (from < to) {
+    width = blas_quickdivide(rest + nthreads - num - 1, nthreads - num);
+    rest -= width;
+
+    if (num == 0) {
+      width -= nb / 2;
+      if (width < nb) width = nb;
+    }
+    if (num == nthreads - 1 || width > to - from) width = to - from;
+
+    from += width;
+    range[++num] = from;
+  }
+
+  return num;
+}
+#endif
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m   = args -> m;
+  BLASLONG n   = args -> n;
+  BLASLONG kl  = args -> k;
+  BLASLONG ku  = args -> ldc;
+  BLASLONG kv  = kl + ku;
+  BLASLONG nb  = args -> ldb;
+  BLASLONG lda = args -> lda - 1;
+  FLOAT *a = (FLOAT *)args -> a + kv;
+  blasint *ipiv = (blasint *)args -> c;
+  FLOAT *wk, *wn, *wt;
+
+  BLASLONG j, jb, next, mn, ldw, end, zeroed;
+  BLASLONG range[MAX_CPU_NUMBER + 1];
+  BLASLONG panel[2];
+  blasint info, iinfo;
+  blas_arg_t newarg;
+
+#ifdef PARALLEL
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG num, t;
+  int mode;
+
+#ifndef DOUBLE
+  mode = BLAS_SINGLE | BLAS_REAL;
+#else
+  mode = BLAS_DOUBLE | BLAS_REAL;
+#endif
+#endif
+
+  mn = MIN(m, n);
+
+  /* the next block has to fit below the top of the band storage */
+  if (nb > (kv + 1) / 2) nb = (kv + 1) / 2;
+
+  if (nb <= 1 || mn <= nb) return gbtf2(m, n, kl, ku, a, lda, ipiv, sb);
+
+  ldw = nb + kl;
+  wk  = (FLOAT *)args -> b;
+  wn  = wk + ldw * nb;
+
+  zeroed = MIN(n, nb + kv);
+  zero_fill(a, lda, kl, ku, 0, zeroed);
+
+  jb   = nb;
+  info = factor(m, kl, a, lda, 0, jb, wk, ldw, ipiv, sa, sb);
+
+  newarg.a    = (void *)a;
+  newarg.lda  = lda;
+  newarg.m    = m;
+  newarg.n    = kv;
+  newarg.k    = kl;
+  newarg.ldb  = ldw;
+  newarg.c    = (void *)ipiv;
+  newarg.beta = (void *)(wk + 2 * ldw * nb);
+
+  for (j = 0; j < mn; j = next) {
+    next = j + jb;
+    end = MIN(n, j + jb + kv);
+
+    if (zeroed < end) {
+      zero_fill(a, lda, kl, ku, zeroed, end);
+      zeroed = end;
+    }
+
+    newarg.b   = (void *)wk;
+    newarg.d   = (void *)wn;
+    newarg.ldc = j;
+    newarg.ldd = jb;
+
+    panel[0] = MIN(nb, mn - next);
+    panel[1] = 0;
+
+    range[0] = next;
+    range[1] = end;
+
+#ifdef PARALLEL
+    num = partition(next, end, panel[0], args -> nthreads, range);
+
+    if (num > 1) {
+      for (t = 0; t < num; t++) {
+	queue[t].mode    = mode;
+	queue[t].routine = (t == 0) ? (void *)lookahead : (void *)update_thread;
+	queue[t].args    = &newarg;
+	queue[t].range_m = &range[t];
+	queue[t].range_n = (t == 0) ? panel : NULL;
+	queue[t].sa      = NULL;
+	queue[t].sb      = NULL;
+	queue[t].next    = &queue[t + 1];
+      }
+
+      queue[0].sa = sa;
+      queue[0].sb = sb;
+      queue[num - 1].next = NULL;
+
+      exec_blas(num, queue);
+    } else
+#endif
+      lookahead(&newarg, range, panel, sa, sb, 0);
+
+    finish(m, kl, a, lda, j, jb, wk, ldw, ipiv);
+
+    iinfo = panel[1];
+    if (iinfo && !info) info = iinfo + next;
+
+    jb = panel[0];
+    wt = wk; wk = wn; wn = wt;
+  }
+
+  return info;
+}
@@ -0,0 +1,508 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+/*
+ * Threaded QR factorization.  Panels are factorized by GEQRF_SINGLE, which
+ * leaves the panel's T factor at the start of the workspace, and the
+ * trailing update I - V T' V' is split across threads with the level-3
+ * thread drivers.
+ *
+ * Panels with at least GEQRF_TSQR_RATIO rows per column are instead
+ * factorized with TSQR: every thread factorizes its own row block, the R
+ * factors are reduced pairwise along a binary tree of log2(p) levels, and
+ * the explicit Q is formed from the root down, one level at a time.  The
+ * pairs of a level run in parallel.  The Householder form expected by
+ * ORMQR/ORGQR is then reconstructed from the explicit Q (Ballard et al.,
+ * "Reconstructing Householder vectors from tall-skinny QR").
+ */
+
+#ifndef GEQRF_NB
+#define GEQRF_NB 64
+#endif
+
+#ifndef GEQRF_TSQR_RATIO
+#define GEQRF_TSQR_RATIO 64
+#endif
+
+/* rows of Q streamed per GEMM while it is formed in place */
+#define GEQRF_TSQR_ROWS 256
+
+#define GEQRF_WCOLS ((BUFFER_SIZE / (SIZE * GEQRF_NB)) - GEQRF_NB)
+
+/* per row block: T, tau, W and the streaming buffer */
+#define GEQRF_TSQR_SLOT (2 * GEQRF_NB * GEQRF_NB + GEQRF_NB + GEQRF_TSQR_ROWS * GEQRF_NB)
+
+/* per tree node: the two stacked R factors (then V), T and tau */
+#define GEQRF_TSQR_NODE (3 * GEQRF_NB * GEQRF_NB + GEQRF_NB)
+
+/* row blocks that fit in the buffer, each with a slot, a node and its Q factor */
+#define GEQRF_TSQR_BLOCKS ((BUFFER_SIZE / SIZE - 2 * GEQRF_NB * GEQRF_NB) / (GEQRF_TSQR_SLOT + GEQRF_TSQR_NODE + GEQRF_NB * GEQRF_NB))
+
+static FLOAT dp1 =  1.;
+static FLOAT dm1 = -1.;
+static FLOAT dz  =  0.;
+
+static void larfb(BLASLONG m, BLASLONG n, BLASLONG k, FLOAT *v, BLASLONG ldv, FLOAT *t, BLASLONG ldt,
+		  FLOAT *c, BLASLONG ldc, FLOAT *w, BLASLONG ldw, FLOAT *sa, FLOAT *sb, BLASLONG nthreads) {
+
+  blas_arg_t args;
+  BLASLONG j;
+  int mode;
+
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+
+  args.nthreads = nthreads;
+
+  for (j = 0; j < n; j++) COPY_K(k, c + j * ldc, 1, w + j * ldw, 1);
+
+  args.m    = k;
+  args.n    = n;
+  args.a    = v;
+  args.lda  = ldv;
+  args.b    = w;
+  args.ldb  = ldw;
+  args.beta = NULL;
+  gemm_thread_n(mode | BLAS_TRANSA_T, &args, NULL, NULL, TRMM_LTLU, sa, sb, nthreads);
+
+  if (m > k) {
+    args.m     = k;
+    args.n     = n;
+    args.k     = m - k;
+    args.a     = v + k;
+    args.lda   = ldv;
+    args.b     = c + k;
+    args.ldb   = ldc;
+    args.c     = w;
+    args.ldc   = ldw;
+    args.alpha = &dp1;
+    args.beta  = &dp1;
+    GEMM_THREAD_TN(&args, NULL, NULL, sa, sb, 0);
+  }
+
+  args.m    = k;
+  args.n    = n;
+  args.a    = t;
+  args.lda  = ldt;
+  args.b    = w;
+  args.ldb  = ldw;
+  args.beta = NULL;
+  gemm_thread_n(mode | BLAS_TRANSA_T | BLAS_UPLO, &args, NULL, NULL, TRMM_LTUN, sa, sb, nthreads);
+
+  if (m > k) {
+    args.m     = m - k;
+    args.n     = n;
+    args.k     = k;
+    args.a     = v + k;
+    args.lda   = ldv;
+    args.b     = w;
+    args.ldb   = ldw;
+    args.c     = c + k;
+    args.ldc   = ldc;
+    args.alpha = &dm1;
+    args.beta  = &dp1;
+    GEMM_THREAD_NN(&args, NULL, NULL, sa, sb, 0);
+  }
+
+  args.m    = k;
+  args.n    = n;
+  args.a    = v;
+  args.lda  = ldv;
+  args.b    = w;
+  args.ldb  = ldw;
+  args.beta = NULL;
+  gemm_thread_n(mode, &args, NULL, NULL, TRMM_LNLU, sa, sb, nthreads);
+
+  for (j = 0; j < n; j++) AXPYU_K(k, 0, 0, dm1, w + j * ldw, 1, c + j * ldc, 1, NULL, 0);
+}
+
+/* V := H [X; 0], overwriting the reflectors V (m x n, block factor T) with Q */
+static void form_q(BLASLONG m, BLASLONG n, FLOAT *v, BLASLONG ldv, FLOAT *t, BLASLONG ldt,
+		   FLOAT *x, BLASLONG ldx, FLOAT *w, FLOAT *buffer, FLOAT *sa, FLOAT *sb) {
+
+  blas_arg_t args;
+  BLASLONG i, j, is, min_i;
+
+  /* W := T V1' X */
+  for (j = 0; j < n; j++) COPY_K(n, x + j * ldx, 1, w + j * n, 1);
+
+  args.m    = n;
+  args.n    = n;
+  args.a    = v;
+  args.lda  = ldv;
+  args.b    = w;
+  args.ldb  = n;
+  args.beta = NULL;
+  TRMM_LTLU(&args, NULL, NULL, sa, sb, 0);
+
+  args.a    = t;
+  args.lda  = ldt;
+  TRMM_LNUN(&args, NULL, NULL, sa, sb, 0);
+
+  /* Q2 := -V2 W, each row block is copied out before it is overwritten */
+  for (is = n; is < m; is += GEQRF_TSQR_ROWS) {
+    min_i = MIN(m - is, GEQRF_TSQR_ROWS);
+
+    for (j = 0; j < n; j++) COPY_K(min_i, v + is + j * ldv, 1, buffer + j * min_i, 1);
+
+    args.m     = min_i;
+    args.n     = n;
+    args.k     = n;
+    args.a     = buffer;
+    args.lda   = min_i;
+    args.b     = w;
+    args.ldb   = n;
+    args.c     = v + is;
+    args.ldc   = ldv;
+    args.alpha = &dm1;
+    args.beta  = &dz;
+    GEMM_NN(&args, NULL, NULL, sa, sb, 0);
+  }
+
+  /* Q1 := X - V1 W */
+  args.m    = n;
+  args.n    = n;
+  args.a    = v;
+  args.lda  = ldv;
+  args.b    = w;
+  args.ldb  = n;
+  args.beta = NULL;
+  TRMM_LNLU(&args, NULL, NULL, sa, sb, 0);
+
+  for (j = 0; j < n; j++)
+    for (i = 0; i < n; i++) v[i + j * ldv] = x[i + j * ldx] - w[i + j * n];
+}
+
+static int form_q_block(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  FLOAT *t = (FLOAT *)args -> c;
+  FLOAT *w = t + GEQRF_NB * GEQRF_NB + GEQRF_NB;
+
+  form_q(args -> m, args -> n, (FLOAT *)args -> a, args -> lda, t, GEQRF_NB,
+	 (FLOAT *)args -> b, args -> ldb, w, w + GEQRF_NB * GEQRF_NB, sa, sb);
+
+  return 0;
+}
+
+/* node of the reduction tree: V := QR of the two R factors a and b stacked */
+static int tree_reduce(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG n = args -> n;
+  FLOAT *rl  = (FLOAT *)args -> a;
+  FLOAT *rr  = (FLOAT *)args -> b;
+  FLOAT *v   = (FLOAT *)args -> c;
+  BLASLONG i, j;
+  blas_arg_t newarg;
+
+  for (j = 0; j < n; j++) {
+    for (i = 0; i < n; i++) {
+      v[i     + j * 2 * n] = (i <= j) ? rl[i + j * args -> lda] : ZERO;
+      v[i + n + j * 2 * n] = (i <= j) ? rr[i + j * args -> ldb] : ZERO;
+    }
+  }
+
+  newarg.m = 2 * n;
+  newarg.n = n;
+  newarg.a = v;
+  newarg.lda = 2 * n;
+  newarg.b = v + 3 * GEQRF_NB * GEQRF_NB;
+  newarg.c = v + 2 * GEQRF_NB * GEQRF_NB;
+  newarg.nthreads = 1;
+  GEQRF_SINGLE(&newarg, NULL, NULL, sa, sb, 0);
+
+  return 0;
+}
+
+/* [a; b] := Q [a; 0] with the Q of the node, a and b are n x n */
+static int tree_expand(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG n = args -> n;
+  FLOAT *xl  = (FLOAT *)args -> a;
+  FLOAT *xr  = (FLOAT *)args -> b;
+  FLOAT *v   = (FLOAT *)args -> c;
+  FLOAT *w   = (FLOAT *)args -> d;
+  BLASLONG i, j;
+
+  form_q(2 * n, n, v, 2 * n, v + 2 * GEQRF_NB * GEQRF_NB, GEQRF_NB, xl, n, w, w + GEQRF_NB * GEQRF_NB, sa, sb);
+
+  for (j = 0; j < n; j++) {
+    for (i = 0; i < n; i++) {
+      xl[i + j * n] = v[i     + j * 2 * n];
+      xr[i + j * n] = v[i + n + j * 2 * n];
+    }
+  }
+
+  return 0;
+}
+
+static void exec_blocks(int mode, void *routine, blas_arg_t *args, BLASLONG num, FLOAT *sa, FLOAT *sb) {
+
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG i;
+
+  for (i = 0; i < num; i++) {
+    queue[i].mode    = mode;
+    queue[i].routine = routine;
+    queue[i].args    = &args[i];
+    queue[i].range_m = NULL;
+    queue[i].range_n = NULL;
+    queue[i].sa      = NULL;
+    queue[i].sb      = NULL;
+    queue[i].next    = &queue[i + 1];
+  }
+
+  queue[0].sa = sa;
+  queue[0].sb = sb;
+  queue[num - 1].next = NULL;
+
+  exec_blas(num, queue);
+}
+
+/*
+ * TSQR panel (m >= GEQRF_TSQR_RATIO * n).  On return the panel holds R and
+ * V exactly as GEQRF_SINGLE leaves them and T is at the start of work.
+ */
+static void tsqr_panel(BLASLONG m, BLASLONG n, FLOAT *a, BLASLONG lda, FLOAT *tau, FLOAT *work,
+		       FLOAT *sa, FLOAT *sb, BLASLONG nthreads) {
+
+  blas_arg_t args[MAX_CPU_NUMBER], node[MAX_CPU_NUMBER], newarg;
+  FLOAT s[GEQRF_NB];
+  FLOAT *t, *r, *x, *nodes, *slot, *q1, *rp[MAX_CPU_NUMBER], ajj;
+  BLASLONG ldr[MAX_CPU_NUMBER], left[MAX_CPU_NUMBER], right[MAX_CPU_NUMBER], level[MAX_CPU_NUMBER + 1];
+  BLASLONG p, h, i, j, is, num, num_nodes, num_levels;
+  int mode;
+
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+
+  p = MIN(nthreads, m / n);
+  if (p > GEQRF_TSQR_BLOCKS) p = GEQRF_TSQR_BLOCKS;
+
+  if (p < 2) {
+    newarg.m = m;
+    newarg.n = n;
+    newarg.a = a;
+    newarg.lda = lda;
+    newarg.b = tau;
+    newarg.c = work;
+    newarg.nthreads = 1;
+    GEQRF_SINGLE(&newarg, NULL, NULL, sa, sb, 0);
+    return;
+  }
+
+  t     = work;
+  r     = t     + GEQRF_NB * GEQRF_NB;
+  x     = r     + GEQRF_NB * GEQRF_NB;
+  nodes = x     + p * GEQRF_NB * GEQRF_NB;
+  slot  = nodes + p * GEQRF_TSQR_NODE;
+
+  /* local QR of every row block */
+  for (i = 0, is = 0; i < p; i++) {
+    args[i].m        = m / p + ((i < m % p) ? 1 : 0);
+    args[i].n        = n;
+    args[i].a        = a + is;
+    args[i].lda      = lda;
+    args[i].b        = slot + i * GEQRF_TSQR_SLOT + GEQRF_NB * GEQRF_NB;
+    args[i].c        = slot + i * GEQRF_TSQR_SLOT;
+    args[i].nthreads = 1;
+    is += args[i].m;
+
+    rp[i]  = (FLOAT *)args[i].a;
+    ldr[i] = lda;
+  }
+
+  exec_blocks(mode, (void *)GEQRF_SINGLE, args, p, sa, sb);
+
+  /* reduce the R factors pairwise, block i absorbs block i + h */
+  num_nodes  = 0;
+  num_levels = 0;
+
+  for (h = 1; h < p; h *= 2) {
+    level[num_levels ++] = num_nodes;
+
+    for (i = 0, num = 0; i + h < p; i += 2 * h, num ++, num_nodes ++) {
+      node[num].n   = n;
+      node[num].a   = rp[i];
+      node[num].lda = ldr[i];
+      node[num].b   = rp[i + h];
+      node[num].ldb = ldr[i + h];
+      node[num].c   = nodes + num_nodes * GEQRF_TSQR_NODE;
+
+      left [num_nodes] = i;
+      right[num_nodes] = i + h;
+
+      rp[i]  = (FLOAT *)node[num].c;
+      ldr[i] = 2 * n;
+    }
+
+    exec_blocks(mode, (void *)tree_reduce, node, num, sa, sb);
+  }
+
+  level[num_levels] = num_nodes;
+
+  for (j = 0; j < n; j++) {
+    for (i = 0; i < n; i++) {
+      r[i + j * n] = (i <= j) ? rp[0][i + j * ldr[0]] : ZERO;
+      x[i + j * n] = (i == j) ? ONE : ZERO;
+    }
+  }
+
+  /* explicit Q of the tree from the root down; the left block's W and
+     streaming buffer are free until its own Q is formed */
+  while (num_levels > 0) {
+    num_levels --;
+
+    for (i = level[num_levels], num = 0; i < level[num_levels + 1]; i ++, num ++) {
+      node[num].n = n;
+      node[num].a = x + left [i] * GEQRF_NB * GEQRF_NB;
+      node[num].b = x + right[i] * GEQRF_NB * GEQRF_NB;
+      node[num].c = nodes + i * GEQRF_TSQR_NODE;
+      node[num].d = slot + left[i] * GEQRF_TSQR_SLOT + GEQRF_NB * GEQRF_NB + GEQRF_NB;
+    }
+
+    exec_blocks(mode, (void *)tree_expand, node, num, sa, sb);
+  }
+
+  /* explicit Q of every row block */
+  for (i = 0; i < p; i++) {
+    args[i].b   = x + i * GEQRF_NB * GEQRF_NB;
+    args[i].ldb = n;
+  }
+
+  exec_blocks(mode, (void *)form_q_block, args, p, sa, sb);
+
+  /* Q - S = L U without pivoting; s_j = -sign(q_jj) keeps |u_jj| >= 1 */
+  q1 = a;
+  for (j = 0; j < n; j++) {
+    ajj = q1[j + j * lda];
+    s[j] = (ajj >= ZERO) ? -ONE : ONE;
+    ajj -= s[j];
+    q1[j + j * lda] = ajj;
+
+    if (j < n - 1) {
+      SCAL_K(n - j - 1, 0, 0, ONE / ajj, q1 + j + 1 + j * lda, 1, NULL, 0, NULL, 0);
+      for (is = j + 1; is < n; is++)
+	AXPYU_K(n - j - 1, 0, 0, -q1[j + is * lda], q1 + j + 1 + j * lda, 1, q1 + j + 1 + is * lda, 1, NULL, 0);
+    }
+  }
+
+  newarg.m = m - n;
+  newarg.n = n;
+  newarg.a = q1;
+  newarg.lda = lda;
+  newarg.b = a + n;
+  newarg.ldb = lda;
+  newarg.beta = NULL;
+  newarg.nthreads = nthreads;
+  gemm_thread_m(mode | BLAS_RSIDE, &newarg, NULL, NULL, TRSM_RNUN, sa, sb, nthreads);
+
+  /* T := -U S L1^-T, R := S R */
+  for (j = 0; j < n; j++)
+    for (i = 0; i < n; i++) t[i + j * GEQRF_NB] = (i <= j) ? -s[j] * q1[i + j * lda] : ZERO;
+
+  newarg.m = n;
+  newarg.n = n;
+  newarg.a = q1;
+  newarg.lda = lda;
+  newarg.b = t;
+  newarg.ldb = GEQRF_NB;
+  newarg.beta = NULL;
+  TRSM_RTLU(&newarg, NULL, NULL, sa, sb, 0);
+
+  for (j = 0; j < n; j++) {
+    tau[j] = t[j + j * GEQRF_NB];
+    for (i = 0; i <= j; i++) q1[i + j * lda] = s[i] * r[i + j * n];
+  }
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, k, lda;
+  BLASLONG j, jb, js, min_j;
+  FLOAT *a, *tau, *t, *w;
+  blas_arg_t newarg;
+
+  if (args -> nthreads == 1) {
+    return GEQRF_SINGLE(args, NULL, NULL, sa, sb, 0);
+  }
+
+  m   = args -> m;
+  n   = args -> n;
+  a   = (FLOAT *)args -> a;
+  lda = args -> lda;
+  tau = (FLOAT *)args -> b;
+
+  t = (FLOAT *)args -> c;
+  w = t + GEQRF_NB * GEQRF_NB;
+
+  k = MIN(m, n);
+
+  if ((n <= GEQRF_NB * 2) && (m < GEQRF_TSQR_RATIO * n)) {
+    return GEQRF_SINGLE(args, NULL, NULL, sa, sb, 0);
+  }
+
+  newarg.lda      = lda;
+  newarg.c        = t;
+  newarg.nthreads = 1;
+
+  for (j = 0; j < k; j += GEQRF_NB) {
+    jb = MIN(k - j, GEQRF_NB);
+
+    newarg.m = m - j;
+    newarg.n = jb;
+    newarg.a = a + (j + j * lda);
+    newarg.b = tau + j;
+
+    if (m - j >= GEQRF_TSQR_RATIO * jb) {
+      tsqr_panel(m - j, jb, a + (j + j * lda), lda, tau + j, t, sa, sb, args -> nthreads);
+    } else {
+      GEQRF_SINGLE(&newarg, NULL, NULL, sa, sb, 0);
+    }
+
+    for (js = j + jb; js < n; js += GEQRF_WCOLS) {
+      min_j = MIN(n - js, GEQRF_WCOLS);
+
+      larfb(m - j, min_j, jb, a + (j + j * lda), lda, t, GEQRF_NB,
+	    a + (j + js * lda), lda, w, jb, sa, sb, args -> nthreads);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,273 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include <float.h>
+#include "common.h"
+
+/*
+ * Blocked Householder QR factorization A = Q * R.
+ *
+ * Each panel of GEQRF_NB columns is factorized recursively (Elmroth and
+ * Gustavson), which produces the compact WY factor T together with V so
+ * that the panel itself runs mostly in level-3 operations.  The trailing
+ * matrix is then updated with the blocked reflector I - V T' V'.
+ *
+ * args -> b : tau (min(m, n))
+ * args -> c : workspace, T (GEQRF_NB x GEQRF_NB) followed by W; T of the
+ *             last panel is left at the start of the workspace.
+ */
+
+#ifndef GEQRF_NB
+#define GEQRF_NB 64
+#endif
+
+/* columns of the trailing matrix handled per update, bounded by the buffer */
+#define GEQRF_WCOLS ((BUFFER_SIZE / (SIZE * GEQRF_NB)) - GEQRF_NB)
+
+static FLOAT dp1 =  1.;
+static FLOAT dm1 = -1.;
+
+static void larfg(BLASLONG n, FLOAT *alpha, FLOAT *x, FLOAT *tau) {
+
+  FLOAT xnorm, beta, w, z, safmin, rsafmn;
+  BLASLONG knt;
+
+  *tau = ZERO;
+  if (n <= 1) return;
+
+  xnorm = NRM2_K(n - 1, x, 1);
+  if (xnorm == ZERO) return;
+
+  w = MAX(fabs(*alpha), xnorm);
+  z = MIN(fabs(*alpha), xnorm);
+  beta = w * sqrt(ONE + (z / w) * (z / w));
+  if (*alpha >= ZERO) beta = -beta;
+
+#ifdef DOUBLE
+  safmin = DBL_MIN / (DBL_EPSILON * 0.5);
+#else
+  safmin = FLT_MIN / (FLT_EPSILON * 0.5);
+#endif
+  rsafmn = ONE / safmin;
+
+  knt = 0;
+  if (fabs(beta) < safmin) {
+    do {
+      knt ++;
+      SCAL_K(n - 1, 0, 0, rsafmn, x, 1, NULL, 0, NULL, 0);
+      beta   *= rsafmn;
+      *alpha *= rsafmn;
+    } while ((fabs(beta) < safmin) && (knt < 20));
+
+    xnorm = NRM2_K(n - 1, x, 1);
+    w = MAX(fabs(*alpha), xnorm);
+    z = MIN(fabs(*alpha), xnorm);
+    beta = w * sqrt(ONE + (z / w) * (z / w));
+    if (*alpha >= ZERO) beta = -beta;
+  }
+
+  *tau = (beta - *alpha) / beta;
+  SCAL_K(n - 1, 0, 0, ONE / (*alpha - beta), x, 1, NULL, 0, NULL, 0);
+
+  while (knt > 0) {
+    beta *= safmin;
+    knt --;
+  }
+
+  *alpha = beta;
+}
+
+/* C := (I - V T' V') C, V is m x k unit lower trapezoidal, W is k x n */
+static void larfb(BLASLONG m, BLASLONG n, BLASLONG k, FLOAT *v, BLASLONG ldv, FLOAT *t, BLASLONG ldt,
+		  FLOAT *c, BLASLONG ldc, FLOAT *w, BLASLONG ldw, FLOAT *sa, FLOAT *sb) {
+
+  blas_arg_t args;
+  BLASLONG j;
+
+  for (j = 0; j < n; j++) COPY_K(k, c + j * ldc, 1, w + j * ldw, 1);
+
+  args.m    = k;
+  args.n    = n;
+  args.a    = v;
+  args.lda  = ldv;
+  args.b    = w;
+  args.ldb  = ldw;
+  args.beta = NULL;
+  TRMM_LTLU(&args, NULL, NULL, sa, sb, 0);
+
+  if (m > k) {
+    args.m     = k;
+    args.n     = n;
+    args.k     = m - k;
+    args.a     = v + k;
+    args.lda   = ldv;
+    args.b     = c + k;
+    args.ldb   = ldc;
+    args.c     = w;
+    args.ldc   = ldw;
+    args.alpha = &dp1;
+    args.beta  = &dp1;
+    GEMM_TN(&args, NULL, NULL, sa, sb, 0);
+  }
+
+  args.m    = k;
+  args.n    = n;
+  args.a    = t;
+  args.lda  = ldt;
+  args.b    = w;
+  args.ldb  = ldw;
+  args.beta = NULL;
+  TRMM_LTUN(&args, NULL, NULL, sa, sb, 0);
+
+  if (m > k) {
+    args.m     = m - k;
+    args.n     = n;
+    args.k     = k;
+    args.a     = v + k;
+    args.lda   = ldv;
+    args.b     = w;
+    args.ldb   = ldw;
+    args.c     = c + k;
+    args.ldc   = ldc;
+    args.alpha = &dm1;
+    args.beta  = &dp1;
+    GEMM_NN(&args, NULL, NULL, sa, sb, 0);
+  }
+
+  args.m    = k;
+  args.n    = n;
+  args.a    = v;
+  args.lda  = ldv;
+  args.b    = w;
+  args.ldb  = ldw;
+  args.beta = NULL;
+  TRMM_LNLU(&args, NULL, NULL, sa, sb, 0);
+
+  for (j = 0; j < n; j++) AXPYU_K(k, 0, 0, dm1, w + j * ldw, 1, c + j * ldc, 1, NULL, 0);
+}
+
+/* Recursive panel factorization (m >= n); builds V in a and T in t */
+static void geqrt3(BLASLONG m, BLASLONG n, FLOAT *a, BLASLONG lda, FLOAT *t, BLASLONG ldt, FLOAT *sa, FLOAT *sb) {
+
+  blas_arg_t args;
+  BLASLONG n1, n2, i, j;
+  FLOAT *t12;
+
+  if (n == 1) {
+    larfg(m, a, a + 1, t);
+    return;
+  }
+
+  n1 = n / 2;
+  n2 = n - n1;
+  t12 = t + n1 * ldt;
+
+  geqrt3(m, n1, a, lda, t, ldt, sa, sb);
+
+  /* apply the first half to the second, using T12 as workspace */
+  larfb(m, n2, n1, a, lda, t, ldt, a + n1 * lda, lda, t12, ldt, sa, sb);
+
+  geqrt3(m - n1, n2, a + n1 + n1 * lda, lda, t + n1 + n1 * ldt, ldt, sa, sb);
+
+  /* T12 := -T11 * (V1' * V2) * T22 */
+  for (j = 0; j < n2; j++)
+    for (i = 0; i < n1; i++) t12[i + j * ldt] = a[n1 + j + i * lda];
+
+  args.m    = n1;
+  args.n    = n2;
+  args.a    = a + n1 + n1 * lda;
+  args.lda  = lda;
+  args.b    = t12;
+  args.ldb  = ldt;
+  args.beta = NULL;
+  TRMM_RNLU(&args, NULL, NULL, sa, sb, 0);
+
+  if (m > n) {
+    args.m     = n1;
+    args.n     = n2;
+    args.k     = m - n;
+    args.a     = a + n;
+    args.lda   = lda;
+    args.b     = a + n + n1 * lda;
+    args.ldb   = lda;
+    args.c     = t12;
+    args.ldc   = ldt;
+    args.alpha = &dp1;
+    args.beta  = &dp1;
+    GEMM_TN(&args, NULL, NULL, sa, sb, 0);
+  }
+
+  args.m    = n1;
+  args.n    = n2;
+  args.a    = t;
+  args.lda  = ldt;
+  args.b    = t12;
+  args.ldb  = ldt;
+  args.beta = &dm1;
+  TRMM_LNUN(&args, NULL, NULL, sa, sb, 0);
+
+  args.a    = t + n1 + n1 * ldt;
+  args.beta = NULL;
+  TRMM_RNUN(&args, NULL, NULL, sa, sb, 0);
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, k, lda;
+  BLASLONG i, j, jb, js, min_j;
+  FLOAT *a, *tau, *t, *w;
+
+  m   = args -> m;
+  n   = args -> n;
+  a   = (FLOAT *)args -> a;
+  lda = args -> lda;
+  tau = (FLOAT *)args -> b;
+
+  t = (FLOAT *)args -> c;
+  w = t + GEQRF_NB * GEQRF_NB;
+
+  k = MIN(m, n);
+
+  for (j = 0; j < k; j += GEQRF_NB) {
+    jb = MIN(k - j, GEQRF_NB);
+
+    geqrt3(m - j, jb, a + (j + j * lda), lda, t, GEQRF_NB, sa, sb);
+
+    for (i = 0; i < jb; i++) tau[j + i] = t[i + i * GEQRF_NB];
+
+    for (js = j + jb; js < n; js += GEQRF_WCOLS) {
+      min_j = MIN(n - js, GEQRF_WCOLS);
+
+      larfb(m - j, min_j, jb, a + (j + j * lda), lda, t, GEQRF_NB,
+	    a + (j + js * lda), lda, w, jb, sa, sb);
+    }
+  }
+
+  return 0;
+}
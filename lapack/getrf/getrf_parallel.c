@@ -37,8 +37,10 @@
 /*********************************************************************/
 
 #include <stdio.h>
+#include <float.h>
 #include "common.h"
 
+static FLOAT dp1 =  1.;
 static FLOAT dm1 = -1.;
 
 double sqrt(double);
@@ -64,6 +66,16 @@ double sqrt(double);
 #define GETRF_FACTOR 0.75
 #endif
 
+/* panels at least this many times taller than wide are split recursively */
+#ifndef GETRF_TALL_RATIO
+#define GETRF_TALL_RATIO 16
+#endif
+
+/* rows per thread below which a panel leaf stays single threaded */
+#ifndef GETF2_THREAD_ROWS
+#define GETF2_THREAD_ROWS 2048
+#endif
+
 #undef  GETRF_FACTOR
 #define GETRF_FACTOR 1.00
 
@@ -76,6 +88,14 @@ double sqrt(double);
 #define	atomic_store_long(p, v)		(*(volatile BLASLONG *)(p)) = (v)
 #endif
 
+#ifdef HAVE_C11
+#define	atomic_fetch_add_long(p, v)	__atomic_fetch_add(p, v, __ATOMIC_RELAXED)
+#elif defined(_MSC_VER)
+#define	atomic_fetch_add_long(p, v)	InterlockedExchangeAdd64((volatile LONG64 *)(p), v)
+#else
+#define	atomic_fetch_add_long(p, v)	__sync_fetch_and_add(p, v)
+#endif
+
 
 
 static __inline BLASLONG FORMULA1(BLASLONG M, BLASLONG N, BLASLONG IS, BLASLONG BK, BLASLONG T) {
@@ -206,30 +226,96 @@ typedef struct {
 	GEMM_KERNEL_N(M, N, K, dm1, ZERO, SA, SB, (FLOAT *)(C) + ((X) + (Y) * LDC) * COMPSIZE, LDC)
 #endif
 
-static int inner_advanced_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos){
+/* tiles of the trailing GEMM are handed out through two counters kept
+   behind the per-thread flags */
+#define TILE_NEXT(flag)	(&(flag)[MAX_CPU_NUMBER * CACHE_LINE_SIZE])
+#define TILE_DONE(flag)	(&(flag)[(MAX_CPU_NUMBER + 1) * CACHE_LINE_SIZE])
+
+/* at least one row tile per thread, including the panel thread */
+static BLASLONG row_tiles(BLASLONG m, BLASLONG nthreads, BLASLONG *tile_m){
+
+  BLASLONG size;
+
+  size = (m + nthreads) / (nthreads + 1);
+  size = ((size + GEMM_UNROLL_M - 1) / GEMM_UNROLL_M) * GEMM_UNROLL_M;
+  if (size > GEMM_P) size = GEMM_P;
+  if (size < GEMM_UNROLL_M) size = GEMM_UNROLL_M;
+
+  *tile_m = size;
+  return (m + size - 1) / size;
+}
+
+static void inner_gemm_tiles(blas_arg_t *args, BLASLONG *range_n, FLOAT *sa, BLASLONG start){
 
   job_t *job = (job_t *)args -> common;
+  volatile BLASLONG *flag = (volatile BLASLONG *)args -> d;
+
+  BLASLONG m = args -> m;
+  BLASLONG k = args -> k;
+  BLASLONG lda = args -> lda;
+
+  FLOAT *a = (FLOAT *)args -> b + (k          ) * COMPSIZE;
+  FLOAT *c = (FLOAT *)args -> b + (k + k * lda) * COMPSIZE;
+
+  BLASLONG tile, ntiles, tile_m, is, min_i;
+  BLASLONG xxx, bufferside, div_n, current;
+  BLASLONG jw;
+
+  ntiles = row_tiles(m, args -> nthreads, &tile_m);
+
+  while ((tile = atomic_fetch_add_long(TILE_NEXT(flag), 1)) < ntiles) {
+
+    is    = tile * tile_m;
+    min_i = MIN(m - is, tile_m);
+
+    ICOPY_OPERATION(k, min_i, a, lda, 0, is, sa);
+
+    current = start;
+
+    do {
+
+      div_n = (range_n[current + 1]  - range_n[current] + DIVIDE_RATE - 1) / DIVIDE_RATE;
+
+      for (xxx = range_n[current], bufferside = 0; xxx < range_n[current + 1]; xxx += div_n, bufferside ++) {
+
+	do {
+	  jw = atomic_load_long(&job[current].working[0][CACHE_LINE_SIZE * bufferside]);
+	} while (jw == 0);
+	MB;
 
-  BLASLONG xxx, bufferside;
+	KERNEL_OPERATION(min_i, MIN(range_n[current + 1] - xxx, div_n), k,
+			 sa, (FLOAT *)jw, c, lda, is, xxx);
+      }
+
+      current ++;
+      if (current >= args -> nthreads) current = 0;
+
+    } while (current != start);
+
+    MB;
+    atomic_fetch_add_long(TILE_DONE(flag), 1);
+  }
+}
+
+static int inner_advanced_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos){
 
   FLOAT *buffer[DIVIDE_RATE];
 
   BLASLONG jjs, min_jj, div_n;
 
-  BLASLONG i, current;
+  BLASLONG i, xxx, bufferside;
   BLASLONG is, min_i;
 
-  BLASLONG m, n_from, n_to;
+  BLASLONG m, n_from, n_to, ntiles, tile_m;
   BLASLONG k = args -> k;
 
   BLASLONG lda = args -> lda;
   BLASLONG off = args -> ldb;
 
-  FLOAT *a = (FLOAT *)args -> b + (k          ) * COMPSIZE;
   FLOAT *b = (FLOAT *)args -> b + (    k * lda) * COMPSIZE;
-  FLOAT *c = (FLOAT *)args -> b + (k + k * lda) * COMPSIZE;
   FLOAT *sbb= sb;
 
+  job_t *job = (job_t *)args -> common;
   blasint *ipiv = (blasint *)args -> c;
   BLASLONG jw;
   volatile BLASLONG *flag = (volatile BLASLONG *)args -> d;
@@ -241,13 +327,10 @@ static int inner_advanced_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *
     sb  = (FLOAT *)args -> a;
   }
 
-  m      = range_m[1] - range_m[0];
+  m      = args -> m;
   n_from = range_n[mypos + 0];
   n_to   = range_n[mypos + 1];
 
-  a     += range_m[0] * COMPSIZE;
-  c     += range_m[0] * COMPSIZE;
-
   div_n = (n_to - n_from + DIVIDE_RATE - 1) / DIVIDE_RATE;
 
   buffer[0] = sbb;
@@ -259,39 +342,18 @@ static int inner_advanced_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *
 
   for (xxx = n_from, bufferside = 0; xxx < n_to; xxx += div_n, bufferside ++) {
 
-    for (i = 0; i < args -> nthreads; i++)
-#if 1
-    {
-	do {
-	   jw =  atomic_load_long(&job[mypos].working[i][CACHE_LINE_SIZE * bufferside]);
-	} while (jw);
-	MB;
-    }
-#else
-      while (job[mypos].working[i][CACHE_LINE_SIZE * bufferside]) {};
-#endif
     for(jjs = xxx; jjs < MIN(n_to, xxx + div_n); jjs += min_jj){
       min_jj = MIN(n_to, xxx + div_n) - jjs;
       if (min_jj > GEMM_UNROLL_N) min_jj = GEMM_UNROLL_N;
 
-      if (0 && GEMM_UNROLL_N <= 8) {
-	printf("helllo\n");
-
-	LASWP_NCOPY(min_jj, off + 1, off + k,
-		    b + (- off + jjs * lda) * COMPSIZE, lda,
-		    ipiv, buffer[bufferside] + (jjs - xxx) * k * COMPSIZE);
-
-      } else {
-
-	LASWP_PLUS(min_jj, off + 1, off + k, ZERO,
+      LASWP_PLUS(min_jj, off + 1, off + k, ZERO,
 #ifdef COMPLEX
-		   ZERO,
+		 ZERO,
 #endif
-		   b + (- off + jjs * lda) * COMPSIZE, lda, NULL, 0, ipiv, 1);
+		 b + (- off + jjs * lda) * COMPSIZE, lda, NULL, 0, ipiv, 1);
 
-	GEMM_ONCOPY (k, min_jj, b + jjs * lda * COMPSIZE, lda,
-		     buffer[bufferside] + (jjs - xxx) * k * COMPSIZE);
-      }
+      GEMM_ONCOPY (k, min_jj, b + jjs * lda * COMPSIZE, lda,
+		   buffer[bufferside] + (jjs - xxx) * k * COMPSIZE);
 
       for (is = 0; is < k; is += GEMM_P) {
 	min_i = k - is;
@@ -307,83 +369,241 @@ static int inner_advanced_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *
       }
     }
     MB;
-    for (i = 0; i < args -> nthreads; i++) {
-      atomic_store_long(&job[mypos].working[i][CACHE_LINE_SIZE * bufferside], (BLASLONG)buffer[bufferside]);
-    }
+    atomic_store_long(&job[mypos].working[0][CACHE_LINE_SIZE * bufferside], (BLASLONG)buffer[bufferside]);
   }
 
   MB;
   atomic_store_long(&flag[mypos * CACHE_LINE_SIZE], 0);
 
-  if (m == 0) {
-    MB;
-    for (xxx = 0; xxx < DIVIDE_RATE; xxx++) {
-      atomic_store_long(&job[mypos].working[mypos][CACHE_LINE_SIZE * xxx], 0);
-    }
-  }
+  inner_gemm_tiles(args, range_n, sa, mypos);
 
-  for(is = 0; is < m; is += min_i){
-    min_i = m - is;
-    if (min_i >= GEMM_P * 2) {
-      min_i = GEMM_P;
-    } else
-      if (min_i > GEMM_P) {
-	min_i = (((min_i + 1) / 2 + GEMM_UNROLL_M - 1)/GEMM_UNROLL_M) * GEMM_UNROLL_M;
-      }
+  /* the packed panel stays in use until every row tile has been applied */
+  ntiles = row_tiles(m, args -> nthreads, &tile_m);
 
-      ICOPY_OPERATION(k, min_i, a, lda, 0, is, sa);
+  do {
+    jw = atomic_load_long(TILE_DONE(flag));
+  } while (jw < ntiles);
+  MB;
 
-      current = mypos;
+  return 0;
+}
 
-      do {
+/* slots of the panel leaf synchronisation area */
+#define SYNC_BARRIER(sync)	(&(sync)[0])
+#define SYNC_INFO(sync)		(&(sync)[CACHE_LINE_SIZE])
+#define SYNC_PIVOT(sync, i)	(&(sync)[((i) + 2) * CACHE_LINE_SIZE])
 
-	div_n = (range_n[current + 1]  - range_n[current] + DIVIDE_RATE - 1) / DIVIDE_RATE;
+static void leaf_barrier(volatile BLASLONG *sync, BLASLONG target){
 
-	for (xxx = range_n[current], bufferside = 0; xxx < range_n[current + 1]; xxx += div_n, bufferside ++) {
+  MB;
+  atomic_fetch_add_long(SYNC_BARRIER(sync), 1);
+  while (atomic_load_long(SYNC_BARRIER(sync)) < target) YIELDING;
+  MB;
+}
 
-	  if ((current != mypos) && (!is)) {
-#if 1
-		do {
-		   jw =  atomic_load_long(&job[current].working[mypos][CACHE_LINE_SIZE * bufferside]);
-	        } while (jw == 0);
-		MB;
+static __inline FLOAT leaf_abs(FLOAT *a){
+#ifndef COMPLEX
+  return fabs(a[0]);
 #else
-	    	    while(job[current].working[mypos][CACHE_LINE_SIZE * bufferside] == 0) {};
+  return fabs(a[0]) + fabs(a[1]);
+#endif
+}
+
+/* Right-looking unblocked LU of a tall leaf with its rows split across
+   threads. Every thread searches its own rows for a pivot candidate, the
+   first thread reduces them and swaps the pivot row, then every thread
+   scales and updates its own rows. */
+static int getf2_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos){
+
+  BLASLONG n   = args -> n;
+  BLASLONG lda = args -> lda;
+  BLASLONG offset = args -> ldb;
+  BLASLONG nthreads = args -> nthreads;
+
+  FLOAT *a = (FLOAT *)args -> a;
+  blasint *ipiv = (blasint *)args -> c;
+  volatile BLASLONG *sync = (volatile BLASLONG *)args -> d;
+
+  BLASLONG m_from = range_m[0];
+  BLASLONG m_to   = range_m[1];
+
+  BLASLONG i, j, is, ip, jp, epoch;
+  FLOAT temp1;
+#ifdef COMPLEX
+  FLOAT temp2, temp3, temp4, ratio, den;
 #endif
-	  }
 
-	  KERNEL_OPERATION(min_i, MIN(range_n[current + 1] - xxx, div_n), k,
-			   sa, (FLOAT *)job[current].working[mypos][CACHE_LINE_SIZE * bufferside],
-			   c, lda, is, xxx);
+  epoch = 0;
+
+  for (j = 0; j < n; j++) {
+
+    is = MAX(m_from, j);
+    jp = -1;
+
+    if (is < m_to) {
+      jp = is + IAMAX_K(m_to - is, a + (is + j * lda) * COMPSIZE, 1) - 1;
+      if (jp >= m_to) jp = m_to - 1;
+    }
+
+    atomic_store_long(SYNC_PIVOT(sync, mypos), jp);
+
+    epoch += nthreads;
+    leaf_barrier(sync, epoch);
+
+    if (mypos == 0) {
+
+      jp = -1;
+      for (i = 0; i < nthreads; i++) {
+	ip = atomic_load_long(SYNC_PIVOT(sync, i));
+	if ((ip >= 0) && ((jp < 0) ||
+			  (leaf_abs(a + (ip + j * lda) * COMPSIZE) > leaf_abs(a + (jp + j * lda) * COMPSIZE)))) jp = ip;
+      }
+
+      ipiv[j + offset] = jp + 1 + offset;
 
-	  MB;
-	  if (is + min_i >= m) {
-	    atomic_store_long(&job[current].working[mypos][CACHE_LINE_SIZE * bufferside], 0);
-	  }
+      if (leaf_abs(a + (jp + j * lda) * COMPSIZE) != ZERO) {
+	if (jp != j) {
+	  SWAP_K(n, 0, 0, ZERO,
+#ifdef COMPLEX
+		 ZERO,
+#endif
+		 a + j * COMPSIZE, lda, a + jp * COMPSIZE, lda, NULL, 0);
 	}
+      } else {
+	if (!atomic_load_long(SYNC_INFO(sync))) atomic_store_long(SYNC_INFO(sync), j + 1);
+      }
+    }
 
-	current ++;
-	if (current >= args -> nthreads) current = 0;
+    epoch += nthreads;
+    leaf_barrier(sync, epoch);
 
-      } while (current != mypos);
-  }
+    is = MAX(m_from, j + 1);
+    if (is >= m_to) continue;
 
-  for (i = 0; i < args -> nthreads; i++) {
-    for (xxx = 0; xxx < DIVIDE_RATE; xxx++) {
-#if 1
-	do {
-	    jw = atomic_load_long(&job[mypos].working[i][CACHE_LINE_SIZE *xxx]);
-	} while(jw != 0);
-	MB;
+#ifndef COMPLEX
+    temp1 = *(a + j + j * lda);
+
+    if (temp1 != ZERO) {
+#if defined(DOUBLE)
+      if (fabs(temp1) >= DBL_MIN) {
 #else
-      while (job[mypos].working[i][CACHE_LINE_SIZE * xxx] ) {};
+      if (fabs(temp1) >= FLT_MIN) {
 #endif
+	SCAL_K(m_to - is, 0, 0, dp1 / temp1, a + is + j * lda, 1, NULL, 0, NULL, 0);
+      } else {
+	for (i = is; i < m_to; i++) *(a + i + j * lda) /= temp1;
+      }
+    }
+
+    if (j + 1 < n) {
+      GERU_K(m_to - is, n - j - 1, 0, dm1,
+	     a + is + j * lda, 1, a + j + (j + 1) * lda, lda, a + is + (j + 1) * lda, lda, sb);
+    }
+#else
+    temp1 = *(a + (j + j * lda) * 2 + 0);
+    temp2 = *(a + (j + j * lda) * 2 + 1);
+
+#if defined(DOUBLE)
+    if ((fabs(temp1) >= DBL_MIN) || (fabs(temp2) >= DBL_MIN)) {
+#else
+    if ((fabs(temp1) >= FLT_MIN) || (fabs(temp2) >= FLT_MIN)) {
+#endif
+      if (fabs(temp1) >= fabs(temp2)){
+	ratio = temp2 / temp1;
+	den = dp1 /(temp1 * ( 1 + ratio * ratio));
+	temp3 =  den;
+	temp4 = -ratio * den;
+      } else {
+	ratio = temp1 / temp2;
+	den = dp1 /(temp2 * ( 1 + ratio * ratio));
+	temp3 =  ratio * den;
+	temp4 = -den;
+      }
+
+      SCAL_K(m_to - is, 0, 0, temp3, temp4, a + (is + j * lda) * 2, 1, NULL, 0, NULL, 0);
     }
+
+    if (j + 1 < n) {
+      GERU_K(m_to - is, n - j - 1, 0, dm1, ZERO,
+	     a + (is + j * lda) * 2, 1, a + (j + (j + 1) * lda) * 2, lda, a + (is + (j + 1) * lda) * 2, lda, sb);
+    }
+#endif
   }
 
   return 0;
 }
 
+static blasint getf2_parallel(blas_arg_t *args, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, int mode){
+
+  BLASLONG m, n, lda, offset;
+  BLASLONG i, width, nthreads;
+  FLOAT *a;
+  blas_arg_t newarg;
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG range_M[MAX_CPU_NUMBER + 1];
+
+#ifdef _MSC_VER
+  BLASLONG sync[(MAX_CPU_NUMBER + 2) * CACHE_LINE_SIZE];
+#else
+  volatile BLASLONG sync[(MAX_CPU_NUMBER + 2) * CACHE_LINE_SIZE] __attribute__((aligned(128)));
+#endif
+
+  m    = args -> m;
+  n    = args -> n;
+  a    = (FLOAT *)args -> a;
+  lda  = args -> lda;
+  offset = 0;
+
+  if (range_n) {
+    m     -= range_n[0];
+    n      = range_n[1] - range_n[0];
+    offset = range_n[0];
+    a     += range_n[0] * (lda + 1) * COMPSIZE;
+  }
+
+  nthreads = m / GETF2_THREAD_ROWS;
+  if (nthreads > args -> nthreads) nthreads = args -> nthreads;
+
+  if ((nthreads < 2) || (m < n)) return GETF2(args, NULL, range_n, sa, sb, 0);
+
+  newarg.m        = m;
+  newarg.n        = n;
+  newarg.a        = (void *)a;
+  newarg.lda      = lda;
+  newarg.c        = args -> c;
+  newarg.ldb      = offset;
+  newarg.d        = (void *)sync;
+  newarg.nthreads = nthreads;
+
+  atomic_store_long(SYNC_BARRIER(sync), 0);
+  atomic_store_long(SYNC_INFO(sync), 0);
+
+  range_M[0] = 0;
+
+  for (i = 0; i < nthreads; i++) {
+
+    width = blas_quickdivide(m - range_M[i] + nthreads - i - 1, nthreads - i);
+    range_M[i + 1] = range_M[i] + width;
+
+    queue[i].mode    = mode;
+    queue[i].routine = getf2_thread;
+    queue[i].args    = &newarg;
+    queue[i].range_m = &range_M[i];
+    queue[i].range_n = NULL;
+    queue[i].sa      = NULL;
+    queue[i].sb      = NULL;
+    queue[i].next    = &queue[i + 1];
+  }
+
+  queue[0].sa = sa;
+  queue[0].sb = sb;
+  queue[nthreads - 1].next = NULL;
+
+  exec_blas(nthreads, queue);
+
+  return (blasint)atomic_load_long(SYNC_INFO(sync));
+}
+
 #if 1
 
 blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
@@ -396,10 +616,10 @@ blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa,
 
   FLOAT *a, *sbb;
   FLOAT dummyalpha[2] = {ZERO, ZERO};
+  FLOAT dm1_alpha[2] = {dm1, ZERO};
 
   blas_queue_t queue[MAX_CPU_NUMBER];
 
-  BLASLONG range_M[MAX_CPU_NUMBER + 1];
   BLASLONG range_N[MAX_CPU_NUMBER + 1];
 
 #ifndef USE_ALLOC_HEAP
@@ -415,9 +635,9 @@ blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa,
   BLASLONG f;
 
 #ifdef _MSC_VER
-  BLASLONG flag[MAX_CPU_NUMBER * CACHE_LINE_SIZE];
+  BLASLONG flag[(MAX_CPU_NUMBER + 2) * CACHE_LINE_SIZE];
 #else
-  volatile BLASLONG flag[MAX_CPU_NUMBER * CACHE_LINE_SIZE] __attribute__((aligned(128)));
+  volatile BLASLONG flag[(MAX_CPU_NUMBER + 2) * CACHE_LINE_SIZE] __attribute__((aligned(128)));
 #endif
 
 #ifndef COMPLEX
@@ -465,7 +685,63 @@ blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa,
   if (init_bk > GEMM_Q) init_bk = GEMM_Q;
 
   if (init_bk <= GEMM_UNROLL_N) {
-    info = GETF2(args, NULL, range_n, sa, sb, 0);
+    info = getf2_parallel(args, range_n, sa, sb, mode);
+    return info;
+  }
+
+  /* Tall panels are factorized recursively, left half then right half,
+     so that every thread works on each level-3 update and on each leaf
+     rather than one thread factorizing the panel while the others wait. */
+  if (m >= GETRF_TALL_RATIO * n) {
+
+    bk = init_bk;
+
+    range_n_new[0] = offset;
+    range_n_new[1] = offset + bk;
+
+    info = CNAME(args, NULL, range_n_new, sa, sb, 0);
+
+    LASWP_PLUS(n - bk, offset + 1, offset + bk, ZERO,
+#ifdef COMPLEX
+	       ZERO,
+#endif
+	       a + (- offset + bk * lda) * COMPSIZE, lda, NULL, 0, ipiv, 1);
+
+    newarg.m        = bk;
+    newarg.n        = n - bk;
+    newarg.a        = (void *)a;
+    newarg.b        = (void *)(a + bk * lda * COMPSIZE);
+    newarg.ldb      = lda;
+    newarg.beta     = NULL;
+    newarg.nthreads = args -> nthreads;
+
+    gemm_thread_n(mode, &newarg, NULL, NULL, TRSM_LNLU, sa, sb, args -> nthreads);
+
+    newarg.m     = m - bk;
+    newarg.n     = n - bk;
+    newarg.k     = bk;
+    newarg.a     = (void *)(a + bk * COMPSIZE);
+    newarg.b     = (void *)(a + bk * lda * COMPSIZE);
+    newarg.c     = (void *)(a + (bk + bk * lda) * COMPSIZE);
+    newarg.ldc   = lda;
+    newarg.alpha = (void *)dm1_alpha;
+    newarg.beta  = NULL;
+
+    GEMM_THREAD_NN(&newarg, NULL, NULL, sa, sb, 0);
+
+    range_n_new[0] = offset + bk;
+    range_n_new[1] = offset + n;
+
+    iinfo = CNAME(args, NULL, range_n_new, sa, sb, 0);
+
+    if (iinfo && !info) info = iinfo + bk;
+
+    LASWP_PLUS(bk, offset + bk + 1, offset + mn, ZERO,
+#ifdef COMPLEX
+	       ZERO,
+#endif
+	       a - offset * COMPSIZE, lda, NULL, 0, ipiv, 1);
+
     return info;
   }
 
@@ -535,48 +811,24 @@ blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa,
     range_n_mine[1] = width;
 
     range_N[0] = width;
-    range_M[0] = 0;
 
     num_cpu  = 0;
 
+    /* only the columns are split, the rows of the update are handed out
+       as tiles to whichever thread is free, including this one once the
+       next panel has been factorized */
     while (nn > 0){
 
-      if (mm >= nn) {
-
-	width  = blas_quickdivide(nn + args -> nthreads - num_cpu, args -> nthreads - num_cpu - 1);
-	if (width == 0) width = nn;
-	if (nn < width) width = nn;
-	nn -= width;
-	range_N[num_cpu + 1] = range_N[num_cpu] + width;
-
-	width  = blas_quickdivide(mm + args -> nthreads - num_cpu, args -> nthreads - num_cpu - 1);
-	if (width == 0) width = mm;
-	if (mm < width) width = mm;
-	if (nn <=    0) width = mm;
-	mm -= width;
-	range_M[num_cpu + 1] = range_M[num_cpu] + width;
-
-      } else {
-
-	width  = blas_quickdivide(mm + args -> nthreads - num_cpu, args -> nthreads - num_cpu - 1);
-	if (width == 0) width = mm;
-	if (mm < width) width = mm;
-	mm -= width;
-	range_M[num_cpu + 1] = range_M[num_cpu] + width;
-
-	width  = blas_quickdivide(nn + args -> nthreads - num_cpu, args -> nthreads - num_cpu - 1);
-	if (width == 0) width = nn;
-	if (nn < width) width = nn;
-	if (mm <=    0) width = nn;
-	nn -= width;
-	range_N[num_cpu + 1] = range_N[num_cpu] + width;
-
-      }
+      width  = blas_quickdivide(nn + args -> nthreads - num_cpu, args -> nthreads - num_cpu - 1);
+      if (width == 0) width = nn;
+      if (nn < width) width = nn;
+      nn -= width;
+      range_N[num_cpu + 1] = range_N[num_cpu] + width;
 
       queue[num_cpu].mode    = mode;
       queue[num_cpu].routine = inner_advanced_thread;
       queue[num_cpu].args    = &newarg;
-      queue[num_cpu].range_m = &range_M[num_cpu];
+      queue[num_cpu].range_m = NULL;
       queue[num_cpu].range_n = &range_N[0];
       queue[num_cpu].sa      = NULL;
       queue[num_cpu].sb      = NULL;
@@ -591,12 +843,12 @@ blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa,
 
     if (num_cpu > 0) {
       for (j = 0; j < num_cpu; j++) {
-	for (i = 0; i < num_cpu; i++) {
-	  for (k = 0; k < DIVIDE_RATE; k++) {
-	    job[j].working[i][CACHE_LINE_SIZE * k] = 0;
-	  }
+	for (k = 0; k < DIVIDE_RATE; k++) {
+	  job[j].working[0][CACHE_LINE_SIZE * k] = 0;
 	}
       }
+      atomic_store_long(TILE_NEXT(flag), 0);
+      atomic_store_long(TILE_DONE(flag), 0);
     }
 
     is += bk;
@@ -620,6 +872,8 @@ blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa,
 
       if (iinfo && !info) info = iinfo + is;
 
+      inner_gemm_tiles(&newarg, range_N, sa, 0);
+
       for (i = 0; i < num_cpu; i ++) {
 #if 1
 	      do {
@@ -0,0 +1,199 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+/*
+ * Inverse of a general matrix from its LU factorization (the DGETRI
+ * algorithm): U is inverted in place, then inv(A) * L = inv(U) is solved
+ * for inv(A) one block of columns at a time, right to left, and finally
+ * the columns are swapped back in reverse pivot order.
+ *
+ * Each block takes the multipliers of L out of its columns into the
+ * workspace, subtracts inv(A) times the part of L below the block with
+ * GEMM and solves with the unit lower diagonal block of L from the right.
+ * The parallel build inverts U with TRTRI_UN_PARALLEL, uses the threaded
+ * GEMM driver and splits the triangular solves and the column swaps by
+ * rows, so every step of the inversion runs on all threads.
+ *
+ * args -> c   : ipiv from GETRF (1-based)
+ * args -> b   : workspace, n x args -> ldb
+ * args -> ldb : block width
+ */
+
+#ifndef PARALLEL
+#define TRTRI_UN TRTRI_UN_SINGLE
+#else
+#define TRTRI_UN TRTRI_UN_PARALLEL
+#endif
+
+static FLOAT dm1[2] = {-1., 0.};
+static FLOAT dp1[2] = { 1., 0.};
+
+/* undo the row interchanges of GETRF as column interchanges, on rows range_m of the inverse */
+static int swap_columns(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  BLASLONG n = args -> n;
+  BLASLONG lda = args -> lda;
+  FLOAT *a = (FLOAT *)args -> a;
+  blasint *ipiv = (blasint *)args -> c;
+  BLASLONG m_from = 0, m_to = args -> m;
+  BLASLONG j, jp;
+
+  if (range_m) {
+    m_from = range_m[0];
+    m_to   = range_m[1];
+  }
+
+  for (j = n - 2; j >= 0; j--) {
+    jp = ipiv[j] - 1;
+    if (jp != j) {
+#ifndef COMPLEX
+      SWAP_K(m_to - m_from, 0, 0, ZERO,
+#else
+      SWAP_K(m_to - m_from, 0, 0, ZERO, ZERO,
+#endif
+	     a + (m_from + j  * lda) * COMPSIZE, 1,
+	     a + (m_from + jp * lda) * COMPSIZE, 1, NULL, 0);
+    }
+  }
+
+  return 0;
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG n, lda, ldw, nb;
+  BLASLONG i, j, jj, jb;
+  FLOAT *a, *w;
+  blas_arg_t newarg;
+  blasint info;
+#ifdef PARALLEL
+  int mode;
+
+#ifndef COMPLEX
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_COMPLEX;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+#endif
+
+  n   = args -> n;
+  a   = (FLOAT *)args -> a;
+  lda = args -> lda;
+  w   = (FLOAT *)args -> b;
+  nb  = args -> ldb;
+  ldw = n;
+
+  info = TRTRI_UN(args, NULL, NULL, sa, sb, 0);
+  if (info) return info;
+
+  newarg.lda = lda;
+  newarg.ldb = lda;
+  newarg.ldc = lda;
+#ifdef PARALLEL
+  newarg.common   = NULL;
+  newarg.nthreads = args -> nthreads;
+#endif
+
+  for (j = ((n - 1) / nb) * nb; j >= 0; j -= nb) {
+    jb = n - j;
+    if (jb > nb) jb = nb;
+
+    for (jj = 0; jj < jb; jj++) {
+      for (i = j + jj + 1; i < n; i++) {
+	w[(i + jj * ldw) * COMPSIZE + 0] = a[(i + (j + jj) * lda) * COMPSIZE + 0];
+	a[(i + (j + jj) * lda) * COMPSIZE + 0] = ZERO;
+#ifdef COMPLEX
+	w[(i + jj * ldw) * COMPSIZE + 1] = a[(i + (j + jj) * lda) * COMPSIZE + 1];
+	a[(i + (j + jj) * lda) * COMPSIZE + 1] = ZERO;
+#endif
+      }
+    }
+
+    if (j + jb < n) {
+      newarg.m = n;
+      newarg.n = jb;
+      newarg.k = n - j - jb;
+      newarg.a = a + (    (j + jb) * lda) * COMPSIZE;
+      newarg.b = w + (j + jb) * COMPSIZE;
+      newarg.c = a + (     j       * lda) * COMPSIZE;
+      newarg.ldb = ldw;
+      newarg.alpha = dm1;
+      newarg.beta  = NULL;
+
+#ifndef PARALLEL
+      GEMM_NN(&newarg, NULL, NULL, sa, sb, 0);
+#else
+      GEMM_THREAD_NN(&newarg, NULL, NULL, sa, sb, 0);
+#endif
+    }
+
+    newarg.m = n;
+    newarg.n = jb;
+    newarg.a = w + j * COMPSIZE;
+    newarg.b = a + (j * lda) * COMPSIZE;
+    newarg.lda = ldw;
+    newarg.ldb = lda;
+    newarg.beta = dp1;
+
+#ifndef PARALLEL
+    TRSM_RNLU(&newarg, NULL, NULL, sa, sb, 0);
+#else
+    gemm_thread_m(mode, &newarg, NULL, NULL, TRSM_RNLU, sa, sb, args -> nthreads);
+#endif
+
+    newarg.lda = lda;
+  }
+
+  newarg.m = n;
+  newarg.n = n;
+  newarg.a = a;
+  newarg.lda = lda;
+  newarg.c = args -> c;
+
+#ifndef PARALLEL
+  swap_columns(&newarg, NULL, NULL, sa, sb, 0);
+#else
+  gemm_thread_m(mode, &newarg, NULL, NULL, swap_columns, sa, sb, args -> nthreads);
+#endif
+
+  return 0;
+}
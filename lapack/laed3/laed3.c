@@ -0,0 +1,286 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include "common.h"
+
+/*
+ * Merge step of the divide and conquer tridiagonal eigensolver (the
+ * DLAED3 algorithm, called by xLAED1 for every merge of xSTEDC).
+ *
+ * The k roots of the secular equation are found with xLAED4, the updating
+ * vector is recomputed from them (Gu/Eisenstat) so that the eigenvectors
+ * stay orthogonal, and the eigenvectors of the merged problem are formed
+ * as Q2 times the eigenvectors of the rank-one modified diagonal matrix.
+ *
+ * Those three sweeps are O(k^2) each and independent across roots, rows
+ * and columns respectively, so the parallel build splits each of them
+ * over the thread pool; the two products with Q2 use the threaded GEMM
+ * driver.  Every entry is computed with the same operations in the same
+ * order as in the single-threaded driver.
+ *
+ * Returns INFO as DLAED4 reports it (1 if a root failed to converge).
+ */
+
+#ifndef DOUBLE
+#define LAED4 BLASFUNC(slaed4)
+#else
+#define LAED4 BLASFUNC(dlaed4)
+#endif
+
+extern void LAED4(blasint *, blasint *, FLOAT *, FLOAT *, FLOAT *, FLOAT *, FLOAT *, blasint *);
+
+/* roots, rows or columns per thread in the secular sweeps */
+#ifndef LAED3_SWEEP_MIN
+#define LAED3_SWEEP_MIN 32
+#endif
+
+static FLOAT dp1 = 1.;
+static FLOAT dp0 = 0.;
+
+/* roots from .. to - 1: column j of q gets the differences dlambda - d[j] */
+static blasint secular_roots(BLASLONG k, BLASLONG from, BLASLONG to, FLOAT *d, FLOAT *q, BLASLONG ldq,
+			     FLOAT rho, FLOAT *dlambda, FLOAT *w) {
+
+  blasint kk = k, jj, info = 0;
+  BLASLONG j;
+
+  for (j = from; j < to; j++) {
+    jj = j + 1;
+    LAED4(&kk, &jj, dlambda, w, q + j * ldq, &rho, d + j, &info);
+    if (info) return info;
+  }
+
+  return 0;
+}
+
+/* recompute rows from .. to - 1 of the updating vector */
+static void update_weights(BLASLONG k, BLASLONG from, BLASLONG to, FLOAT *q, BLASLONG ldq,
+			   FLOAT *dlambda, FLOAT *w, FLOAT *s) {
+
+  BLASLONG i, j;
+
+  for (i = from; i < to; i++) {
+    s[i] = w[i];
+    w[i] = q[i + i * ldq];
+  }
+
+  for (j = 0; j < k; j++) {
+    for (i = from; i < to; i++) {
+      if (i != j) w[i] *= q[i + j * ldq] / (dlambda[i] - dlambda[j]);
+    }
+  }
+
+  for (i = from; i < to; i++) {
+    w[i] = sqrt(-w[i]);
+    if (s[i] < ZERO) w[i] = -w[i];
+  }
+}
+
+/* normalized eigenvectors from .. to - 1 of the modified diagonal matrix, permuted by indx */
+static void secular_vectors(BLASLONG k, BLASLONG from, BLASLONG to, FLOAT *q, BLASLONG ldq,
+			    FLOAT *w, blasint *indx, FLOAT *s) {
+
+  BLASLONG i, j;
+  FLOAT temp;
+
+  for (j = from; j < to; j++) {
+    for (i = 0; i < k; i++) s[i] = w[i] / q[i + j * ldq];
+
+    temp = NRM2_K(k, s, 1);
+
+    for (i = 0; i < k; i++) q[i + j * ldq] = s[indx[i] - 1] / temp;
+  }
+}
+
+#ifdef PARALLEL
+
+/*
+ * Thread bodies, run through gemm_thread_m.  range_m holds the first and
+ * one past the last root, row or column of the thread; range_n points to
+ * the INFO shared by all threads, which a thread sets when one of its
+ * roots fails.  INDX travels in args -> common.
+ */
+
+static int roots_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  blasint info;
+
+  info = secular_roots(args -> m, range_m[0], range_m[1], (FLOAT *)args -> d,
+		       (FLOAT *)args -> a, args -> lda, *(FLOAT *)args -> alpha,
+		       (FLOAT *)args -> b, (FLOAT *)args -> c);
+
+  if (info) range_n[0] = info;
+
+  return 0;
+}
+
+static int weights_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  update_weights(args -> m, range_m[0], range_m[1], (FLOAT *)args -> a, args -> lda,
+		 (FLOAT *)args -> b, (FLOAT *)args -> c, (FLOAT *)args -> beta);
+
+  return 0;
+}
+
+static int vectors_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  secular_vectors(args -> m, range_m[0], range_m[1], (FLOAT *)args -> a, args -> lda,
+		  (FLOAT *)args -> c, (blasint *)args -> common, sa);
+
+  return 0;
+}
+
+#endif
+
+/* q[0 .. m - 1, 0 .. n - 1] := a * b with the level-3 driver, or zero when the inner size is 0 */
+static void form_product(BLASLONG m, BLASLONG n, BLASLONG k, FLOAT *a, FLOAT *b, FLOAT *c, BLASLONG ldc,
+			 FLOAT *sa, FLOAT *sb, BLASLONG nthreads) {
+
+  blas_arg_t args;
+  BLASLONG i, j;
+
+  if (m <= 0 || n <= 0) return;
+
+  if (k == 0) {
+    for (j = 0; j < n; j++)
+      for (i = 0; i < m; i++) c[i + j * ldc] = ZERO;
+    return;
+  }
+
+  args.m = m;
+  args.n = n;
+  args.k = k;
+  args.a = (void *)a;
+  args.b = (void *)b;
+  args.c = (void *)c;
+  args.lda = m;
+  args.ldb = k;
+  args.ldc = ldc;
+  args.alpha = (void *)&dp1;
+  args.beta  = (void *)&dp0;
+
+#ifdef PARALLEL
+  args.common = NULL;
+  args.nthreads = nthreads;
+
+  if (nthreads > 1) {
+    GEMM_THREAD_NN(&args, NULL, NULL, sa, sb, 0);
+    return;
+  }
+#endif
+
+  GEMM_NN(&args, NULL, NULL, sa, sb, 0);
+}
+
+#ifndef PARALLEL
+blasint CNAME(BLASLONG k, BLASLONG n, BLASLONG n1, FLOAT *d, FLOAT *q, BLASLONG ldq, FLOAT rho,
+	      FLOAT *dlambda, FLOAT *q2, blasint *indx, blasint *ctot, FLOAT *w, FLOAT *s,
+	      FLOAT *sa, FLOAT *sb) {
+
+  BLASLONG nthreads = 1;
+#else
+blasint CNAME(BLASLONG k, BLASLONG n, BLASLONG n1, FLOAT *d, FLOAT *q, BLASLONG ldq, FLOAT rho,
+	      FLOAT *dlambda, FLOAT *q2, blasint *indx, blasint *ctot, FLOAT *w, FLOAT *s,
+	      FLOAT *sa, FLOAT *sb, BLASLONG nthreads) {
+
+  blas_arg_t args;
+#endif
+
+  BLASLONG j, n2, n12, n23;
+  blasint info;
+
+#ifdef PARALLEL
+  BLASLONG sweep = MIN(nthreads, k / LAED3_SWEEP_MIN);
+  BLASLONG sweep_info = 0;
+  int mode;
+
+#ifndef DOUBLE
+  mode = BLAS_SINGLE | BLAS_REAL;
+#else
+  mode = BLAS_DOUBLE | BLAS_REAL;
+#endif
+#endif
+
+  if (k == 0) return 0;
+
+#ifdef PARALLEL
+  args.m = k;
+  args.a = (void *)q;
+  args.lda = ldq;
+  args.b = (void *)dlambda;
+  args.c = (void *)w;
+  args.d = (void *)d;
+  args.alpha = (void *)&rho;
+  args.beta  = (void *)s;
+  args.common = (void *)indx;
+  args.nthreads = nthreads;
+
+  if (sweep > 1) {
+    gemm_thread_m(mode, &args, NULL, &sweep_info, roots_thread, sa, sb, sweep);
+    info = (blasint)sweep_info;
+  } else {
+    info = secular_roots(k, 0, k, d, q, ldq, rho, dlambda, w);
+  }
+#else
+  info = secular_roots(k, 0, k, d, q, ldq, rho, dlambda, w);
+#endif
+  if (info) return info;
+
+  if (k == 2) {
+    for (j = 0; j < 2; j++) {
+      w[0] = q[0 + j * ldq];
+      w[1] = q[1 + j * ldq];
+      q[0 + j * ldq] = w[indx[0] - 1];
+      q[1 + j * ldq] = w[indx[1] - 1];
+    }
+  } else if (k > 2) {
+#ifdef PARALLEL
+    if (sweep > 1) {
+      gemm_thread_m(mode, &args, NULL, NULL, weights_thread, sa, sb, sweep);
+      gemm_thread_m(mode, &args, NULL, NULL, vectors_thread, sa, sb, sweep);
+    } else
+#endif
+    {
+      update_weights(k, 0, k, q, ldq, dlambda, w, s);
+      secular_vectors(k, 0, k, q, ldq, w, indx, s);
+    }
+  }
+
+  n2  = n - n1;
+  n12 = ctot[0] + ctot[1];
+  n23 = ctot[1] + ctot[2];
+
+  OMATCOPY_K_CN(n23, k, dp1, q + ctot[0], ldq, s, n23);
+  form_product(n2, k, n23, q2 + n1 * n12, s, q + n1, ldq, sa, sb, nthreads);
+
+  OMATCOPY_K_CN(n12, k, dp1, q, ldq, s, n12);
+  form_product(n1, k, n12, q2, s, q, ldq, sa, sb, nthreads);
+
+  return 0;
+}
@@ -0,0 +1,400 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+/*
+ * Multiplication by the orthogonal matrix of GEQRF (the DORMQR algorithm):
+ * C := Q C or Q**T C with LEFT, C := C Q or C Q**T otherwise; TRANS selects
+ * the transpose.  Q = H(1) ... H(k) is applied in blocks of ORMQR_NB
+ * reflectors I - V T V**T, with T formed as in DLARFT, and every block is
+ * applied with level-3 calls.
+ *
+ * The blocks are handled in groups whose T factors fit in the workspace.
+ * The parallel build forms the T factors of a group with gemm_thread_m,
+ * whole blocks per thread, then splits C into column ranges (LEFT) or row
+ * ranges with gemm_thread_n / gemm_thread_m, and every thread applies the
+ * whole group to its own range.  The threads only meet twice per group.
+ *
+ * args -> m, n : C is m x n
+ * args -> k    : number of reflectors
+ * args -> a    : the reflectors as GEQRF returns them, lda
+ * args -> b    : tau
+ * args -> c    : C, ldc
+ * args -> d    : workspace of BUFFER_SIZE bytes for W and the T factors
+ */
+
+#ifndef ORMQR_NB
+#define ORMQR_NB 64
+#endif
+
+/* columns (LEFT) or rows of C per pass, W is ORMQR_NB x ORMQR_WCOLS */
+#define ORMQR_WCOLS 256
+
+#define ORMQR_W (ORMQR_NB * ORMQR_WCOLS)
+
+
+static FLOAT dp1 =  1.;
+static FLOAT dm1 = -1.;
+
+/* first reflector of the j-th block applied; Q C and C Q**T run the
+   blocks backwards, Q**T C and C Q forwards */
+static BLASLONG block_start(BLASLONG j, BLASLONG k) {
+#if (defined(LEFT) && defined(TRANS)) || (!defined(LEFT) && !defined(TRANS))
+  return j * ORMQR_NB;
+#else
+  return ((k + ORMQR_NB - 1) / ORMQR_NB - 1 - j) * ORMQR_NB;
+#endif
+}
+
+/* T (ib x ib, upper) of the block of reflectors V (m x ib), as DLARFT */
+static void larft(BLASLONG m, BLASLONG ib, FLOAT *v, BLASLONG ldv, FLOAT *tau, FLOAT *t, BLASLONG ldt, FLOAT *buffer) {
+
+  BLASLONG i, j;
+
+  for (i = 0; i < ib; i++) {
+    if (tau[i] == ZERO) {
+      for (j = 0; j <= i; j++) t[j + i * ldt] = ZERO;
+      continue;
+    }
+
+    /* T(0:i, i) := -tau V(i:m, 0:i)**T v_i, v_i is 1 at row i */
+    for (j = 0; j < i; j++) t[j + i * ldt] = -tau[i] * v[i + j * ldv];
+
+    if ((i > 0) && (m - i - 1 > 0))
+      GEMV_T(m - i - 1, i, 0, -tau[i], v + i + 1, ldv, v + i + 1 + i * ldv, 1, t + i * ldt, 1, buffer);
+
+    /* T(0:i, i) := T(0:i, 0:i) T(0:i, i) */
+    if (i > 0) TRMV_NUN(i, t, ldt, t + i * ldt, 1, buffer);
+
+    t[i + i * ldt] = tau[i];
+  }
+}
+
+#ifdef LEFT
+/* C := (I - V T V**T) C or (I - V T**T V**T) C; V is m x k, C is m x n, W is k x n */
+static void larfb(BLASLONG m, BLASLONG n, BLASLONG k, FLOAT *v, BLASLONG ldv, FLOAT *t, BLASLONG ldt,
+		  FLOAT *c, BLASLONG ldc, FLOAT *w, FLOAT *sa, FLOAT *sb) {
+
+  blas_arg_t args;
+  BLASLONG j;
+
+  for (j = 0; j < n; j++) COPY_K(k, c + j * ldc, 1, w + j * k, 1);
+
+  args.m    = k;
+  args.n    = n;
+  args.a    = v;
+  args.lda  = ldv;
+  args.b    = w;
+  args.ldb  = k;
+  args.beta = NULL;
+  TRMM_LTLU(&args, NULL, NULL, sa, sb, 0);
+
+  if (m > k) {
+    args.m     = k;
+    args.n     = n;
+    args.k     = m - k;
+    args.a     = v + k;
+    args.lda   = ldv;
+    args.b     = c + k;
+    args.ldb   = ldc;
+    args.c     = w;
+    args.ldc   = k;
+    args.alpha = &dp1;
+    args.beta  = &dp1;
+    GEMM_TN(&args, NULL, NULL, sa, sb, 0);
+  }
+
+  args.m    = k;
+  args.n    = n;
+  args.a    = t;
+  args.lda  = ldt;
+  args.b    = w;
+  args.ldb  = k;
+  args.beta = NULL;
+#ifndef TRANS
+  TRMM_LNUN(&args, NULL, NULL, sa, sb, 0);
+#else
+  TRMM_LTUN(&args, NULL, NULL, sa, sb, 0);
+#endif
+
+  if (m > k) {
+    args.m     = m - k;
+    args.n     = n;
+    args.k     = k;
+    args.a     = v + k;
+    args.lda   = ldv;
+    args.b     = w;
+    args.ldb   = k;
+    args.c     = c + k;
+    args.ldc   = ldc;
+    args.alpha = &dm1;
+    args.beta  = &dp1;
+    GEMM_NN(&args, NULL, NULL, sa, sb, 0);
+  }
+
+  args.m    = k;
+  args.n    = n;
+  args.a    = v;
+  args.lda  = ldv;
+  args.b    = w;
+  args.ldb  = k;
+  args.beta = NULL;
+  TRMM_LNLU(&args, NULL, NULL, sa, sb, 0);
+
+  for (j = 0; j < n; j++) AXPYU_K(k, 0, 0, dm1, w + j * k, 1, c + j * ldc, 1, NULL, 0);
+}
+#else
+/* C := C (I - V T V**T) or C (I - V T**T V**T); V is n x k, C is m x n, W is m x k */
+static void larfb(BLASLONG m, BLASLONG n, BLASLONG k, FLOAT *v, BLASLONG ldv, FLOAT *t, BLASLONG ldt,
+		  FLOAT *c, BLASLONG ldc, FLOAT *w, FLOAT *sa, FLOAT *sb) {
+
+  blas_arg_t args;
+  BLASLONG j;
+
+  for (j = 0; j < k; j++) COPY_K(m, c + j * ldc, 1, w + j * m, 1);
+
+  args.m    = m;
+  args.n    = k;
+  args.a    = v;
+  args.lda  = ldv;
+  args.b    = w;
+  args.ldb  = m;
+  args.beta = NULL;
+  TRMM_RNLU(&args, NULL, NULL, sa, sb, 0);
+
+  if (n > k) {
+    args.m     = m;
+    args.n     = k;
+    args.k     = n - k;
+    args.a     = c + k * ldc;
+    args.lda   = ldc;
+    args.b     = v + k;
+    args.ldb   = ldv;
+    args.c     = w;
+    args.ldc   = m;
+    args.alpha = &dp1;
+    args.beta  = &dp1;
+    GEMM_NN(&args, NULL, NULL, sa, sb, 0);
+  }
+
+  args.m    = m;
+  args.n    = k;
+  args.a    = t;
+  args.lda  = ldt;
+  args.b    = w;
+  args.ldb  = m;
+  args.beta = NULL;
+#ifndef TRANS
+  TRMM_RNUN(&args, NULL, NULL, sa, sb, 0);
+#else
+  TRMM_RTUN(&args, NULL, NULL, sa, sb, 0);
+#endif
+
+  if (n > k) {
+    args.m     = m;
+    args.n     = n - k;
+    args.k     = k;
+    args.a     = w;
+    args.lda   = m;
+    args.b     = v + k;
+    args.ldb   = ldv;
+    args.c     = c + k * ldc;
+    args.ldc   = ldc;
+    args.alpha = &dm1;
+    args.beta  = &dp1;
+    GEMM_NT(&args, NULL, NULL, sa, sb, 0);
+  }
+
+  args.m    = m;
+  args.n    = k;
+  args.a    = v;
+  args.lda  = ldv;
+  args.b    = w;
+  args.ldb  = m;
+  args.beta = NULL;
+  TRMM_RTLU(&args, NULL, NULL, sa, sb, 0);
+
+  for (j = 0; j < k; j++) AXPYU_K(m, 0, 0, dm1, w + j * m, 1, c + j * ldc, 1, NULL, 0);
+}
+#endif
+
+/*
+ * T factors of the blocks args -> ldb .. args -> ldb + args -> m - 1 of the
+ * group, counted in the order they are applied, into args -> d.
+ * args -> n is the order of Q.
+ */
+static int form_t(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  FLOAT *a   = (FLOAT *)args -> a;
+  FLOAT *tau = (FLOAT *)args -> b;
+  FLOAT *ts  = (FLOAT *)args -> d;
+  BLASLONG lda = args -> lda;
+  BLASLONG j, from = 0, to = args -> m, i, ib;
+
+  if (range_m) {
+    from = range_m[0];
+    to   = range_m[1];
+  }
+
+  for (j = from; j < to; j++) {
+    i  = block_start(args -> ldb + j, args -> k);
+    ib = MIN(args -> k - i, ORMQR_NB);
+
+    larft(args -> n - i, ib, a + i + i * lda, lda, tau + i, ts + j * ORMQR_NB * ORMQR_NB, ORMQR_NB, sb);
+  }
+
+  return 0;
+}
+
+/*
+ * Applies the args -> ldd blocks of the group starting at args -> ldb to
+ * the columns (LEFT) or rows of C in range_n (range_m), ORMQR_WCOLS at a
+ * time.  The T factors are in args -> d, the W of every thread in
+ * args -> beta.
+ */
+static int apply_group(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  FLOAT *a   = (FLOAT *)args -> a;
+  FLOAT *c   = (FLOAT *)args -> c;
+  FLOAT *ts  = (FLOAT *)args -> d;
+  FLOAT *w   = (FLOAT *)args -> beta + mypos * ORMQR_W;
+  BLASLONG lda = args -> lda;
+  BLASLONG ldc = args -> ldc;
+  BLASLONG j, i, ib, is, min_i, from, to;
+
+#ifdef LEFT
+  from = 0;
+  to   = args -> n;
+  if (range_n) {
+    from = range_n[0];
+    to   = range_n[1];
+  }
+#else
+  from = 0;
+  to   = args -> m;
+  if (range_m) {
+    from = range_m[0];
+    to   = range_m[1];
+  }
+#endif
+
+  for (is = from; is < to; is += ORMQR_WCOLS) {
+    min_i = MIN(to - is, ORMQR_WCOLS);
+
+    for (j = 0; j < args -> ldd; j++) {
+      i  = block_start(args -> ldb + j, args -> k);
+      ib = MIN(args -> k - i, ORMQR_NB);
+
+#ifdef LEFT
+      larfb(args -> m - i, min_i, ib, a + i + i * lda, lda, ts + j * ORMQR_NB * ORMQR_NB, ORMQR_NB,
+	    c + i + is * ldc, ldc, w, sa, sb);
+#else
+      larfb(min_i, args -> n - i, ib, a + i + i * lda, lda, ts + j * ORMQR_NB * ORMQR_NB, ORMQR_NB,
+	    c + is + i * ldc, ldc, w, sa, sb);
+#endif
+    }
+  }
+
+  return 0;
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  blas_arg_t targ, aarg;
+  BLASLONG nq, nb, group, j, num;
+  BLASLONG nthreads = 1;
+#ifdef PARALLEL
+  int mode;
+
+#ifndef DOUBLE
+  mode = BLAS_SINGLE | BLAS_REAL;
+#else
+  mode = BLAS_DOUBLE | BLAS_REAL;
+#endif
+
+  nthreads = args -> nthreads;
+  if (nthreads > (BUFFER_SIZE / SIZE - ORMQR_NB * ORMQR_NB) / ORMQR_W)
+    nthreads = (BUFFER_SIZE / SIZE - ORMQR_NB * ORMQR_NB) / ORMQR_W;
+#endif
+
+#ifdef LEFT
+  nq = args -> m;
+#else
+  nq = args -> n;
+#endif
+
+  nb    = (args -> k + ORMQR_NB - 1) / ORMQR_NB;
+  group = (BUFFER_SIZE / SIZE - nthreads * ORMQR_W) / (ORMQR_NB * ORMQR_NB);
+
+  targ.a   = args -> a;
+  targ.lda = args -> lda;
+  targ.b   = args -> b;
+  targ.d   = (FLOAT *)args -> d + nthreads * ORMQR_W;
+  targ.n   = nq;
+  targ.k   = args -> k;
+
+  aarg.a    = args -> a;
+  aarg.lda  = args -> lda;
+  aarg.c    = args -> c;
+  aarg.ldc  = args -> ldc;
+  aarg.d    = targ.d;
+  aarg.beta = args -> d;
+  aarg.m    = args -> m;
+  aarg.n    = args -> n;
+  aarg.k    = args -> k;
+
+  for (j = 0; j < nb; j += group) {
+    num = MIN(nb - j, group);
+
+    targ.m   = num;
+    targ.ldb = j;
+    aarg.ldb = j;
+    aarg.ldd = num;
+
+#ifdef PARALLEL
+    if (nthreads > 1) {
+      targ.nthreads = nthreads;
+      aarg.nthreads = nthreads;
+
+      gemm_thread_m(mode, &targ, NULL, NULL, form_t, sa, sb, MIN(nthreads, num));
+#ifdef LEFT
+      gemm_thread_n(mode, &aarg, NULL, NULL, apply_group, sa, sb, nthreads);
+#else
+      gemm_thread_m(mode, &aarg, NULL, NULL, apply_group, sa, sb, nthreads);
+#endif
+      continue;
+    }
+#endif
+
+    form_t(&targ, NULL, NULL, sa, sb, 0);
+    apply_group(&aarg, NULL, NULL, sa, sb, 0);
+  }
+
+  return 0;
+}
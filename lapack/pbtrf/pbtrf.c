@@ -0,0 +1,405 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include "common.h"
+
+/*
+ * Cholesky factorization of a symmetric positive definite band matrix with
+ * KD super- or subdiagonals (the DPBTRF algorithm), the upper triangle by
+ * default and the lower one with LOWER.
+ *
+ * Inside the band the storage is a general matrix with leading dimension
+ * LDAB - 1, so every block of columns is factorized in place with POTRF
+ * and its off-diagonal block, which reaches KD rows (columns) past it, is
+ * gathered into the workspace W, where the elements outside the band are
+ * zero, solved with TRSM and scattered back. W then updates the KD x KD
+ * triangle that follows the block: the diagonal blocks column by column
+ * with GEMV and the rest with GEMM.
+ *
+ * The steps are pipelined in the parallel build: while the other threads
+ * apply the update of block k to the columns (rows) they own, the first
+ * thread updates the columns (rows) of block k + 1 first and factorizes
+ * them into the second half of W, so block k + 1 is ready when the update
+ * of block k finishes.
+ *
+ * Bands narrower than two blocks are factorized column by column.
+ *
+ * args -> a   : AB
+ * args -> lda : LDAB
+ * args -> k   : KD
+ * args -> b   : workspace, two blocks of KD x args -> ldb
+ * args -> ldb : block width, 1 for the unblocked code
+ */
+
+/* columns per diagonal block of the trailing update */
+#ifndef PBTRF_UPDATE_NB
+#define PBTRF_UPDATE_NB 64
+#endif
+
+/* narrowest share of the trailing update worth a thread */
+#define PBTRF_THREAD_MIN 32
+
+static FLOAT dm1 = -1.;
+
+#ifndef LOWER
+#define POTRF_BLOCK POTRF_U_SINGLE
+#else
+#define POTRF_BLOCK POTRF_L_SINGLE
+#endif
+
+/* column by column, the DPBTF2 algorithm; a points to the diagonal and lda is LDAB - 1 */
+static blasint pbtf2(BLASLONG n, BLASLONG kd, FLOAT *a, BLASLONG lda) {
+
+  BLASLONG j, jj, kn;
+  FLOAT ajj, *x;
+
+  for (j = 0; j < n; j++) {
+    ajj = a[j + j * lda];
+    if (ajj <= ZERO) return j + 1;
+
+    ajj = sqrt(ajj);
+    a[j + j * lda] = ajj;
+
+    kn = MIN(kd, n - j - 1);
+    if (kn == 0) continue;
+
+#ifndef LOWER
+    x = a + j + (j + 1) * lda;
+    SCAL_K(kn, 0, 0, ONE / ajj, x, lda, NULL, 0, NULL, 0);
+
+    for (jj = 0; jj < kn; jj++)
+      AXPYU_K(jj + 1, 0, 0, -x[jj * lda], x, lda, a + (j + 1) + (j + 1 + jj) * lda, 1, NULL, 0);
+#else
+    x = a + (j + 1) + j * lda;
+    SCAL_K(kn, 0, 0, ONE / ajj, x, 1, NULL, 0, NULL, 0);
+
+    for (jj = 0; jj < kn; jj++)
+      AXPYU_K(kn - jj, 0, 0, -x[jj], x + jj, 1, a + (j + 1 + jj) + (j + 1 + jj) * lda, 1, NULL, 0);
+#endif
+  }
+
+  return 0;
+}
+
+/*
+ * Factorizes the block of ib columns at i, and gathers, solves and scatters
+ * its off-diagonal block through w. a points to the diagonal of the band
+ * and lda is LDAB - 1.
+ */
+static blasint factor(BLASLONG n, BLASLONG kd, FLOAT *a, BLASLONG lda, BLASLONG i, BLASLONG ib,
+		      FLOAT *w, BLASLONG ldw, FLOAT *sa, FLOAT *sb) {
+
+  BLASLONG start, m2, p, q, len;
+  blasint info;
+  blas_arg_t args;
+
+  args.n     = ib;
+  args.a     = (void *)(a + i + i * lda);
+  args.lda   = lda;
+  args.alpha = NULL;
+  args.beta  = NULL;
+
+  info = POTRF_BLOCK(&args, NULL, NULL, sa, sb, 0);
+  if (info) return info + i;
+
+  start = i + ib;
+  m2    = MIN(n, start + kd) - start;
+  if (m2 <= 0) return 0;
+
+#ifndef LOWER
+  /* W = A(i : i + ib, start : start + m2), ib x m2 */
+  for (q = 0; q < m2; q++) {
+    len = MIN(ib, kd - q);
+    for (p = 0; p < ib - len; p++) w[p + q * ldw] = ZERO;
+    for (; p < ib; p++) w[p + q * ldw] = a[i + p + (start + q) * lda];
+  }
+
+  args.m   = ib;
+  args.n   = m2;
+  args.b   = (void *)w;
+  args.ldb = ldw;
+
+  TRSM_LTUN(&args, NULL, NULL, sa, sb, 0);
+
+  for (q = 0; q < m2; q++) {
+    len = MIN(ib, kd - q);
+    for (p = ib - len; p < ib; p++) a[i + p + (start + q) * lda] = w[p + q * ldw];
+  }
+#else
+  /* W = A(start : start + m2, i : i + ib), m2 x ib */
+  for (p = 0; p < ib; p++) {
+    len = MIN(m2, kd - ib + p + 1);
+    for (q = 0; q < len; q++) w[q + p * ldw] = a[start + q + (i + p) * lda];
+    for (; q < m2; q++) w[q + p * ldw] = ZERO;
+  }
+
+  args.m   = m2;
+  args.n   = ib;
+  args.b   = (void *)w;
+  args.ldb = ldw;
+
+  TRSM_RTLN(&args, NULL, NULL, sa, sb, 0);
+
+  for (p = 0; p < ib; p++) {
+    len = MIN(m2, kd - ib + p + 1);
+    for (q = 0; q < len; q++) a[start + q + (i + p) * lda] = w[q + p * ldw];
+  }
+#endif
+
+  return 0;
+}
+
+/*
+ * Applies the block of args -> ldc columns at args -> m, solved in args -> b,
+ * to the columns (upper: rows) from .. to of the trailing triangle.
+ *
+ * args -> a   : diagonal of the band, args -> lda : LDAB - 1
+ * args -> n   : order, args -> k : KD
+ * args -> b   : W of the block, args -> ldb : its leading dimension
+ */
+static void update(blas_arg_t *args, BLASLONG from, BLASLONG to, FLOAT *sa, FLOAT *sb) {
+
+  BLASLONG n   = args -> n;
+  BLASLONG kd  = args -> k;
+  BLASLONG lda = args -> lda;
+  BLASLONG ldw = args -> ldb;
+  BLASLONG ib  = args -> ldc;
+  BLASLONG start = args -> m + ib;
+  BLASLONG end   = MIN(n, start + kd);
+  FLOAT *a = (FLOAT *)args -> a;
+  FLOAT *w = (FLOAT *)args -> b;
+
+  BLASLONG js, jj, min_j;
+  blas_arg_t newarg;
+
+  if (to > end) to = end;
+
+  newarg.k     = ib;
+  newarg.lda   = ldw;
+  newarg.ldb   = ldw;
+  newarg.ldc   = lda;
+  newarg.alpha = (void *)&dm1;
+  newarg.beta  = NULL;
+
+  for (js = from; js < to; js += min_j) {
+    min_j = to - js;
+    if (min_j > PBTRF_UPDATE_NB) min_j = PBTRF_UPDATE_NB;
+
+#ifndef LOWER
+    for (jj = js; jj < js + min_j; jj++) {
+      GEMV_T(ib, jj - js + 1, 0, dm1, w + (js - start) * ldw, ldw, w + (jj - start) * ldw, 1,
+	     a + js + jj * lda, 1, sb);
+    }
+
+    if (js + min_j < end) {
+      newarg.m = min_j;
+      newarg.n = end - js - min_j;
+      newarg.a = (void *)(w + (js - start) * ldw);
+      newarg.b = (void *)(w + (js + min_j - start) * ldw);
+      newarg.c = (void *)(a + js + (js + min_j) * lda);
+
+      GEMM_TN(&newarg, NULL, NULL, sa, sb, 0);
+    }
+#else
+    for (jj = js; jj < js + min_j; jj++) {
+      GEMV_N(js + min_j - jj, ib, 0, dm1, w + (jj - start), ldw, w + (jj - start), ldw,
+	     a + jj + jj * lda, 1, sb);
+    }
+
+    if (js + min_j < end) {
+      newarg.m = end - js - min_j;
+      newarg.n = min_j;
+      newarg.a = (void *)(w + (js + min_j - start));
+      newarg.b = (void *)(w + (js - start));
+      newarg.c = (void *)(a + js + min_j + js * lda);
+
+      GEMM_NT(&newarg, NULL, NULL, sa, sb, 0);
+    }
+#endif
+  }
+}
+
+/*
+ * The first thread of a step: updates the next block, factorizes it into
+ * args -> c and then updates the rest of range_m. Its INFO goes to range_n.
+ *
+ * args -> c   : W of the next block, args -> ldd : its width
+ */
+static int lookahead(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  BLASLONG next = args -> m + args -> ldc;
+  BLASLONG nb   = args -> ldd;
+
+  update(args, next, next + nb, sa, sb);
+
+  *range_n = factor(args -> n, args -> k, (FLOAT *)args -> a, args -> lda, next, nb,
+		    (FLOAT *)args -> c, args -> ldb, sa, sb);
+
+  update(args, next + nb, range_m[1], sa, sb);
+
+  return 0;
+}
+
+#ifdef PARALLEL
+static int update_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  update(args, range_m[0], range_m[1], sa, sb);
+
+  return 0;
+}
+
+/*
+ * Splits the trailing triangle from .. end between the threads so that
+ * each gets about the same area; the first thread also counts the
+ * factorization of the next block.
+ */
+static BLASLONG partition(BLASLONG from, BLASLONG end, BLASLONG nb, BLASLONG nthreads, BLASLONG *range) {
+
+  BLASLONG num, j;
+  double area, target, acc;
+
+  area = 0.5 * (double)(end - from) * (double)(end - from + 1) + 0.5 * (double)nb * (double)(end - from);
+
+  if (nthreads > (end - from - nb) / PBTRF_THREAD_MIN + 1) nthreads = (end - from - nb) / PBTRF_THREAD_MIN + 1;
+  if (nthreads < 1) nthreads = 1;
+
+  range[0] = from;
+  num = 0;
+  j   = from;
+  acc = 0.5 * (double)nb * (double)(end - from);
+
+  while (num < nthreads - 1) {
+    target = area * (double)(num + 1) / (double)nthreads;
+    while (j < end && acc < target) {
+      acc += (double)(end - j);
+      j ++;
+    }
+    if (num == 0 && j < from + nb) j = from + nb;
+    if (j >= end) break;
+    range[++num] = j;
+  }
+
+  range[++num] = end;
+
+  return num;
+}
+#endif
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG n   = args -> n;
+  BLASLONG kd  = args -> k;
+  BLASLONG nb  = args -> ldb;
+  BLASLONG lda = args -> lda - 1;
+  FLOAT *a = (FLOAT *)args -> a;
+  FLOAT *wk, *wn, *wt;
+
+  BLASLONG i, ib, next, ldw, info;
+  BLASLONG range[MAX_CPU_NUMBER + 1];
+  blas_arg_t newarg;
+
+#ifdef PARALLEL
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG num, t;
+  int mode;
+
+#ifndef DOUBLE
+  mode = BLAS_SINGLE | BLAS_REAL;
+#else
+  mode = BLAS_DOUBLE | BLAS_REAL;
+#endif
+#endif
+
+#ifndef LOWER
+  a  += kd;
+  ldw = nb;
+#else
+  ldw = kd;
+#endif
+
+  if (nb <= 1 || n <= nb) return pbtf2(n, kd, a, lda);
+
+  wk = (FLOAT *)args -> b;
+  wn = wk + kd * nb;
+
+  ib   = nb;
+  info = factor(n, kd, a, lda, 0, ib, wk, ldw, sa, sb);
+  if (info) return info;
+
+  newarg.a   = (void *)a;
+  newarg.lda = lda;
+  newarg.n   = n;
+  newarg.k   = kd;
+  newarg.ldb = ldw;
+
+  for (i = 0; i + ib < n; i = next) {
+    next = i + ib;
+
+    newarg.m   = i;
+    newarg.ldc = ib;
+    newarg.b   = (void *)wk;
+    newarg.c   = (void *)wn;
+    newarg.ldd = MIN(nb, n - next);
+
+    info = 0;
+    range[0] = next;
+    range[1] = MIN(n, next + kd);
+
+#ifdef PARALLEL
+    num = partition(next, range[1], newarg.ldd, args -> nthreads, range);
+
+    if (num > 1) {
+      for (t = 0; t < num; t++) {
+	queue[t].mode    = mode;
+	queue[t].routine = (t == 0) ? (void *)lookahead : (void *)update_thread;
+	queue[t].args    = &newarg;
+	queue[t].range_m = &range[t];
+	queue[t].range_n = (t == 0) ? &info : NULL;
+	queue[t].sa      = NULL;
+	queue[t].sb      = NULL;
+	queue[t].next    = &queue[t + 1];
+      }
+
+      queue[0].sa = sa;
+      queue[0].sb = sb;
+      queue[num - 1].next = NULL;
+
+      exec_blas(num, queue);
+    } else
+#endif
+      lookahead(&newarg, range, &info, sa, sb, 0);
+
+    if (info) return info;
+
+    ib = newarg.ldd;
+    wt = wk; wk = wn; wn = wt;
+  }
+
+  return 0;
+}
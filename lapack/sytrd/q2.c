@@ -0,0 +1,111 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+/*
+ * Z := Q2 Z, with Q2 the product of the reflectors of the second stage of
+ * the two-stage tridiagonal reduction (see sb2st.c), in the order the
+ * sweeps applied them.  The columns of Z are independent, so the parallel
+ * build splits them over the threads, and each thread applies all the
+ * reflectors, last one first, to SYTRD_Q2_COLS of its columns at a time.
+ *
+ * args -> m    : order of Q2
+ * args -> n    : columns of Z
+ * args -> k    : kd
+ * args -> a    : the reflectors, reflector k of sweep i at (i * lda + k) * kd
+ * args -> b    : their tau, at i * lda + k
+ * args -> c    : Z, ldc
+ */
+
+#ifndef SYTRD_Q2_COLS
+#define SYTRD_Q2_COLS 64
+#endif
+
+static int apply_q2(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  FLOAT *hous = (FLOAT *)args -> a;
+  FLOAT *htau = (FLOAT *)args -> b;
+  FLOAT *z    = (FLOAT *)args -> c;
+  BLASLONG n     = args -> m;
+  BLASLONG kd    = args -> k;
+  BLASLONG slots = args -> lda;
+  BLASLONG ldz   = args -> ldc;
+  BLASLONG i, k, p0, len, js, min_j, from, to;
+  FLOAT *v, *w = sa, tau;
+
+  from = 0;
+  to   = args -> n;
+  if (range_n) {
+    from = range_n[0];
+    to   = range_n[1];
+  }
+
+  for (js = from; js < to; js += SYTRD_Q2_COLS) {
+    min_j = MIN(to - js, SYTRD_Q2_COLS);
+
+    for (i = n - 3; i >= 0; i--) {
+      for (k = (n - 2 - i) / kd; k >= 0; k--) {
+	tau = htau[i * slots + k];
+	if (tau == ZERO) continue;
+
+	p0  = i + 1 + k * kd;
+	len = MIN(kd, n - p0);
+	v   = hous + (i * slots + k) * kd;
+
+	SCAL_K(min_j, 0, 0, ZERO, w, 1, NULL, 0, NULL, 0);
+	GEMV_T(len, min_j, 0, ONE, z + p0 + js * ldz, ldz, v, 1, w, 1, sb);
+	GERU_K(len, min_j, 0, -tau, v, 1, w, 1, z + p0 + js * ldz, ldz, sb);
+      }
+    }
+  }
+
+  return 0;
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+#ifdef PARALLEL
+  int mode;
+
+#ifndef DOUBLE
+  mode = BLAS_SINGLE | BLAS_REAL;
+#else
+  mode = BLAS_DOUBLE | BLAS_REAL;
+#endif
+
+  if (args -> nthreads > 1) {
+    gemm_thread_n(mode, args, NULL, NULL, apply_q2, sa, sb, args -> nthreads);
+    return 0;
+  }
+#endif
+
+  apply_q2(args, NULL, NULL, sa, sb, 0);
+
+  return 0;
+}
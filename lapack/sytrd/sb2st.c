@@ -0,0 +1,322 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include <float.h>
+#include "common.h"
+
+/*
+ * Second stage of the two-stage tridiagonal reduction (the DSYTRD_SB2ST
+ * algorithm): Q2**T B Q2 = T, with B banded with kd subdiagonals.
+ *
+ * Sweep i annihilates column i below the subdiagonal and chases the bulge
+ * down the band.  Every task of a sweep updates one diagonal block with
+ * the current reflector, applies it from the right to the block below,
+ * and annihilates the first column of that block with the next reflector.
+ * Task k of sweep i only touches rows and columns i + 1 + k kd ...
+ * i + (k + 2) kd, so it may start as soon as sweep i - 1 has finished
+ * task k + 1.
+ *
+ * The parallel build runs sweep i on thread i mod nthreads.  Every thread
+ * publishes how far it got in its current sweep, and waits on the thread
+ * of the previous sweep before each task, like the getf2 pipeline.
+ *
+ * B is stored by diagonals, B(r, c) at a[r - c + c * lda] for
+ * 0 <= r - c <= 2 kd, so that lda = 2 kd + 1 leaves room for the bulge.
+ * Any block inside that band is then a plain matrix with leading
+ * dimension lda - 1.
+ *
+ * args -> a      : B, lda
+ * args -> n      : order of B
+ * args -> k      : kd
+ * args -> alpha  : diagonal of T (n)
+ * args -> beta   : off-diagonal of T (n - 1)
+ * args -> b      : if not NULL, reflector k of sweep i is stored at
+ *                  (i * ldb + k) * kd, its tau at args -> c[i * ldb + k]
+ */
+
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE 8
+#endif
+
+#ifdef HAVE_C11
+#define	atomic_load_long(p)		__atomic_load_n(p, __ATOMIC_RELAXED)
+#define	atomic_store_long(p, v)		__atomic_store_n(p, v, __ATOMIC_RELAXED)
+#else
+#define	atomic_load_long(p)		(BLASLONG)(*(volatile BLASLONG*)(p))
+#define	atomic_store_long(p, v)		(*(volatile BLASLONG *)(p)) = (v)
+#endif
+
+static void larfg(BLASLONG n, FLOAT *alpha, FLOAT *x, FLOAT *tau) {
+
+  FLOAT xnorm, beta, w, z, safmin, rsafmn;
+  BLASLONG knt;
+
+  *tau = ZERO;
+  if (n <= 1) return;
+
+  xnorm = NRM2_K(n - 1, x, 1);
+  if (xnorm == ZERO) return;
+
+  w = MAX(fabs(*alpha), xnorm);
+  z = MIN(fabs(*alpha), xnorm);
+  beta = w * sqrt(ONE + (z / w) * (z / w));
+  if (*alpha >= ZERO) beta = -beta;
+
+#ifdef DOUBLE
+  safmin = DBL_MIN / (DBL_EPSILON * 0.5);
+#else
+  safmin = FLT_MIN / (FLT_EPSILON * 0.5);
+#endif
+  rsafmn = ONE / safmin;
+
+  knt = 0;
+  if (fabs(beta) < safmin) {
+    do {
+      knt ++;
+      SCAL_K(n - 1, 0, 0, rsafmn, x, 1, NULL, 0, NULL, 0);
+      beta   *= rsafmn;
+      *alpha *= rsafmn;
+    } while ((fabs(beta) < safmin) && (knt < 20));
+
+    xnorm = NRM2_K(n - 1, x, 1);
+    w = MAX(fabs(*alpha), xnorm);
+    z = MIN(fabs(*alpha), xnorm);
+    beta = w * sqrt(ONE + (z / w) * (z / w));
+    if (*alpha >= ZERO) beta = -beta;
+  }
+
+  *tau = (beta - *alpha) / beta;
+  SCAL_K(n - 1, 0, 0, ONE / (*alpha - beta), x, 1, NULL, 0, NULL, 0);
+
+  while (knt > 0) {
+    beta *= safmin;
+    knt --;
+  }
+
+  *alpha = beta;
+}
+
+/* reflector from the column x (n), left as v (v[0] = 1) and tau; x := beta e1 */
+static FLOAT reflector(BLASLONG n, FLOAT *x, FLOAT *v) {
+
+  FLOAT tau;
+
+  larfg(n, x, x + 1, &tau);
+
+  v[0] = ONE;
+  if (n > 1) {
+    COPY_K(n - 1, x + 1, 1, v + 1, 1);
+    SCAL_K(n - 1, 0, 0, ZERO, x + 1, 1, NULL, 0, NULL, 0);
+  }
+
+  return tau;
+}
+
+/* D := H D H for the lower triangle of D (l x l), H = I - tau v v**T */
+static void sym_update(BLASLONG l, FLOAT *d, BLASLONG ldd, FLOAT *v, FLOAT tau, FLOAT *w, FLOAT *buffer) {
+
+  BLASLONG c;
+  FLOAT alpha;
+
+  SCAL_K(l, 0, 0, ZERO, w, 1, NULL, 0, NULL, 0);
+  SYMV_L(l, l, tau, d, ldd, v, 1, w, 1, buffer);
+
+  alpha = -0.5 * tau * DOTU_K(l, w, 1, v, 1);
+  AXPYU_K(l, 0, 0, alpha, v, 1, w, 1, NULL, 0);
+
+  for (c = 0; c < l; c++) {
+    AXPYU_K(l - c, 0, 0, -w[c], v + c, 1, d + c + c * ldd, 1, NULL, 0);
+    AXPYU_K(l - c, 0, 0, -v[c], w + c, 1, d + c + c * ldd, 1, NULL, 0);
+  }
+}
+
+/*
+ * Sweep i: tasks run one after the other, and before task k the thread
+ * waits until the sweep before has finished task k + 1.  progress holds
+ * i * slots + tasks done for every thread.
+ */
+static void sweep(blas_arg_t *args, BLASLONG i, volatile BLASLONG *progress, BLASLONG nthreads, FLOAT *work, FLOAT *buffer) {
+
+  FLOAT *a    = (FLOAT *)args -> a;
+  FLOAT *hous = (FLOAT *)args -> b;
+  FLOAT *htau = (FLOAT *)args -> c;
+  BLASLONG n  = args -> n;
+  BLASLONG kd = args -> k;
+  BLASLONG ld = args -> lda - 1;
+  BLASLONG slots = args -> ldb;
+  BLASLONG k, p0 = 0, l = 0, lr;
+  FLOAT *v = work, *vn = work + kd, *w = work + 2 * kd, *b, *t;
+  FLOAT tau = ZERO, taun;
+  volatile BLASLONG *prev = NULL, *mine = NULL;
+
+  if (progress) {
+    mine = progress + (i % nthreads) * CACHE_LINE_SIZE;
+    if (i > 0) prev = progress + ((i - 1) % nthreads) * CACHE_LINE_SIZE;
+  }
+
+  for (k = 0; ; k++) {
+
+    if (prev) {
+      while (atomic_load_long(prev) < (i - 1) * slots + k + 2) YIELDING;
+      MB;
+    }
+
+    if (k == 0) {
+      /* annihilate column i below the subdiagonal */
+      p0  = i + 1;
+      l   = MIN(kd, n - p0);
+      tau = reflector(l, a + p0 + i * ld, v);
+      if (hous) {
+	COPY_K(l, v, 1, hous + (i * slots) * kd, 1);
+	htau[i * slots] = tau;
+      }
+    }
+
+    if (tau != ZERO) sym_update(l, a + p0 + p0 * ld, ld, v, tau, w, buffer);
+
+    lr = MIN(kd, n - p0 - l);
+    if (lr <= 0) break;
+
+    /* the block below: apply H from the right, then annihilate its first column */
+    b = a + (p0 + l) + p0 * ld;
+
+    if (tau != ZERO) {
+      SCAL_K(lr, 0, 0, ZERO, w, 1, NULL, 0, NULL, 0);
+      GEMV_N(lr, l, 0, ONE, b, ld, v, 1, w, 1, buffer);
+      GERU_K(lr, l, 0, -tau, w, 1, v, 1, b, ld, buffer);
+    }
+
+    taun = reflector(lr, b, vn);
+
+    if ((taun != ZERO) && (l > 1)) {
+      SCAL_K(l - 1, 0, 0, ZERO, w, 1, NULL, 0, NULL, 0);
+      GEMV_T(lr, l - 1, 0, ONE, b + ld, ld, vn, 1, w, 1, buffer);
+      GERU_K(lr, l - 1, 0, -taun, vn, 1, w, 1, b + ld, ld, buffer);
+    }
+
+    if (hous) {
+      COPY_K(lr, vn, 1, hous + (i * slots + k + 1) * kd, 1);
+      htau[i * slots + k + 1] = taun;
+    }
+
+    t = v; v = vn; vn = t;
+    tau = taun;
+    p0 += l;
+    l   = lr;
+
+    if (mine) {
+      WMB;
+      atomic_store_long(mine, i * slots + k + 1);
+    }
+  }
+
+  if (mine) {
+    WMB;
+    atomic_store_long(mine, (i + 1) * slots);
+  }
+}
+
+#ifdef PARALLEL
+static int sweep_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  volatile BLASLONG *progress = (volatile BLASLONG *)args -> d;
+  BLASLONG nthreads = args -> nthreads;
+  BLASLONG i;
+
+  for (i = range_m[0]; i < args -> n - 2; i += nthreads)
+    sweep(args, i, progress, nthreads, sa, sb);
+
+  return 0;
+}
+#endif
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  FLOAT *a  = (FLOAT *)args -> a;
+  FLOAT *d  = (FLOAT *)args -> alpha;
+  FLOAT *e  = (FLOAT *)args -> beta;
+  BLASLONG n  = args -> n;
+  BLASLONG ld = args -> lda - 1;
+  BLASLONG i;
+#ifdef PARALLEL
+  blas_arg_t newarg;
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG range[MAX_CPU_NUMBER];
+  BLASLONG nthreads;
+  int mode;
+
+#ifdef _MSC_VER
+  BLASLONG progress[MAX_CPU_NUMBER * CACHE_LINE_SIZE];
+#else
+  volatile BLASLONG progress[MAX_CPU_NUMBER * CACHE_LINE_SIZE] __attribute__((aligned(128)));
+#endif
+
+#ifndef DOUBLE
+  mode = BLAS_SINGLE | BLAS_REAL;
+#else
+  mode = BLAS_DOUBLE | BLAS_REAL;
+#endif
+
+  nthreads = MIN(args -> nthreads, n - 2);
+
+  if (nthreads > 1) {
+    newarg = *args;
+    newarg.d        = (void *)progress;
+    newarg.nthreads = nthreads;
+
+    for (i = 0; i < nthreads; i++) {
+      atomic_store_long(&progress[i * CACHE_LINE_SIZE], i * args -> ldb);
+
+      range[i] = i;
+
+      queue[i].mode    = mode;
+      queue[i].routine = sweep_thread;
+      queue[i].args    = &newarg;
+      queue[i].range_m = &range[i];
+      queue[i].range_n = NULL;
+      queue[i].sa      = NULL;
+      queue[i].sb      = NULL;
+      queue[i].next    = &queue[i + 1];
+    }
+
+    queue[0].sa = sa;
+    queue[0].sb = sb;
+    queue[nthreads - 1].next = NULL;
+
+    exec_blas(nthreads, queue);
+  } else
+#endif
+
+  for (i = 0; i < n - 2; i++) sweep(args, i, NULL, 1, sa, sb);
+
+  for (i = 0; i < n; i++) d[i] = a[i + i * ld];
+  for (i = 0; i < n - 1; i++) e[i] = a[i + 1 + i * ld];
+
+  return 0;
+}
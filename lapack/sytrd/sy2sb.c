@@ -0,0 +1,229 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+/*
+ * First stage of the two-stage tridiagonal reduction (the DSYTRD_SY2SB
+ * algorithm): Q1**T A Q1 = B, with A symmetric and stored in its lower
+ * triangle and B banded with args -> k subdiagonals.
+ *
+ * Each panel of k columns is factorized by GEQRF below its band, and the
+ * trailing matrix gets the two-sided update with Q = I - V T V**T in
+ * level-3 calls:
+ *
+ *   X := A V T,  Y := X - 1/2 V (T**T V**T X),  A := A - Y V**T - V Y**T
+ *
+ * The parallel build runs SYMM, TRMM, GEMM and SYR2K on the thread pool.
+ *
+ * On exit the band of B is in the band of A, and the reflectors below it
+ * are laid out as GEQRF leaves them for the (n - k) x (n - k) matrix at
+ * A(k, 0), with tau in args -> b, so that Q1 is applied by ORMQR.
+ *
+ * args -> a    : A, lda
+ * args -> n    : order of A
+ * args -> k    : bandwidth
+ * args -> b    : tau (n - k)
+ * args -> c    : workspace of BUFFER_SIZE bytes for GEQRF
+ * args -> d    : workspace, 2 n k + 2 k k
+ */
+
+static FLOAT dp1 =  1.;
+static FLOAT dm1 = -1.;
+static FLOAT dmh = -0.5;
+static FLOAT dz0 =  0.;
+
+/* T (ib x ib, upper) of the block of reflectors V (m x ib), as DLARFT */
+static void larft(BLASLONG m, BLASLONG ib, FLOAT *v, BLASLONG ldv, FLOAT *tau, FLOAT *t, BLASLONG ldt, FLOAT *buffer) {
+
+  BLASLONG i, j;
+
+  for (i = 0; i < ib; i++) {
+    if (tau[i] == ZERO) {
+      for (j = 0; j <= i; j++) t[j + i * ldt] = ZERO;
+      continue;
+    }
+
+    for (j = 0; j < i; j++) t[j + i * ldt] = -tau[i] * v[i + j * ldv];
+
+    if ((i > 0) && (m - i - 1 > 0))
+      GEMV_T(m - i - 1, i, 0, -tau[i], v + i + 1, ldv, v + i + 1 + i * ldv, 1, t + i * ldt, 1, buffer);
+
+    if (i > 0) TRMV_NUN(i, t, ldt, t + i * ldt, 1, buffer);
+
+    t[i + i * ldt] = tau[i];
+  }
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  blas_arg_t newarg;
+  BLASLONG n, kd, lda, j, i, m, ib;
+  FLOAT *a, *tau, *v, *x, *t, *w;
+#ifdef PARALLEL
+  int mode;
+
+#ifndef DOUBLE
+  mode = BLAS_SINGLE | BLAS_REAL;
+#else
+  mode = BLAS_DOUBLE | BLAS_REAL;
+#endif
+#endif
+
+  n   = args -> n;
+  kd  = args -> k;
+  a   = (FLOAT *)args -> a;
+  lda = args -> lda;
+  tau = (FLOAT *)args -> b;
+
+  v = (FLOAT *)args -> d;
+  x = v + n * kd;
+  t = x + n * kd;
+  w = t + kd * kd;
+
+#ifdef PARALLEL
+  newarg.nthreads = args -> nthreads;
+  newarg.common   = NULL;
+#endif
+
+  for (j = 0; j + kd < n; j += kd) {
+
+    /* QR of the panel below the band, m x kd with ib reflectors */
+    m  = n - j - kd;
+    ib = MIN(m, kd);
+
+    newarg.m   = m;
+    newarg.n   = kd;
+    newarg.a   = a + (j + kd) + j * lda;
+    newarg.lda = lda;
+    newarg.b   = tau + j;
+    newarg.c   = args -> c;
+    GEQRF_SINGLE(&newarg, NULL, NULL, sa, sb, 0);
+
+    /* V with its unit diagonal and zero upper triangle, m x ib */
+    for (i = 0; i < ib; i++) {
+      SCAL_K(i, 0, 0, ZERO, v + i * m, 1, NULL, 0, NULL, 0);
+      v[i + i * m] = ONE;
+      COPY_K(m - i - 1, a + (j + kd + i + 1) + (j + i) * lda, 1, v + i + 1 + i * m, 1);
+    }
+
+    larft(m, ib, v, m, tau + j, t, kd, sb);
+
+    /* X := A22 V */
+    newarg.m     = m;
+    newarg.n     = ib;
+    newarg.a     = a + (j + kd) + (j + kd) * lda;
+    newarg.lda   = lda;
+    newarg.b     = v;
+    newarg.ldb   = m;
+    newarg.c     = x;
+    newarg.ldc   = m;
+    newarg.alpha = &dp1;
+    newarg.beta  = &dz0;
+#ifndef PARALLEL
+    SYMM_LL(&newarg, NULL, NULL, sa, sb, 0);
+#else
+    SYMM_THREAD_LL(&newarg, NULL, NULL, sa, sb, 0);
+#endif
+
+    /* X := X T */
+    newarg.m    = m;
+    newarg.n    = ib;
+    newarg.a    = t;
+    newarg.lda  = kd;
+    newarg.b    = x;
+    newarg.ldb  = m;
+    newarg.beta = NULL;
+#ifndef PARALLEL
+    TRMM_RNUN(&newarg, NULL, NULL, sa, sb, 0);
+#else
+    gemm_thread_m(mode | BLAS_RSIDE | BLAS_UPLO, &newarg, NULL, NULL, TRMM_RNUN, sa, sb, args -> nthreads);
+#endif
+
+    /* W := T**T (V**T X) */
+    newarg.m     = ib;
+    newarg.n     = ib;
+    newarg.k     = m;
+    newarg.a     = v;
+    newarg.lda   = m;
+    newarg.b     = x;
+    newarg.ldb   = m;
+    newarg.c     = w;
+    newarg.ldc   = kd;
+    newarg.alpha = &dp1;
+    newarg.beta  = &dz0;
+    GEMM_TN(&newarg, NULL, NULL, sa, sb, 0);
+
+    newarg.m    = ib;
+    newarg.n    = ib;
+    newarg.a    = t;
+    newarg.lda  = kd;
+    newarg.b    = w;
+    newarg.ldb  = kd;
+    newarg.beta = NULL;
+    TRMM_LTUN(&newarg, NULL, NULL, sa, sb, 0);
+
+    /* Y := X - 1/2 V W, kept in X */
+    newarg.m     = m;
+    newarg.n     = ib;
+    newarg.k     = ib;
+    newarg.a     = v;
+    newarg.lda   = m;
+    newarg.b     = w;
+    newarg.ldb   = kd;
+    newarg.c     = x;
+    newarg.ldc   = m;
+    newarg.alpha = &dmh;
+    newarg.beta  = &dp1;
+#ifndef PARALLEL
+    GEMM_NN(&newarg, NULL, NULL, sa, sb, 0);
+#else
+    GEMM_THREAD_NN(&newarg, NULL, NULL, sa, sb, 0);
+#endif
+
+    /* A22 := A22 - Y V**T - V Y**T */
+    newarg.n     = m;
+    newarg.k     = ib;
+    newarg.a     = x;
+    newarg.lda   = m;
+    newarg.b     = v;
+    newarg.ldb   = m;
+    newarg.c     = a + (j + kd) + (j + kd) * lda;
+    newarg.ldc   = lda;
+    newarg.alpha = &dm1;
+    newarg.beta  = NULL;
+#ifndef PARALLEL
+    SYR2K_LN(&newarg, NULL, NULL, sa, sb, 0);
+#else
+    syrk_thread(mode | BLAS_TRANSA_N | BLAS_TRANSB_T | BLAS_UPLO,
+		&newarg, NULL, NULL, SYR2K_LN, sa, sb, args -> nthreads);
+#endif
+  }
+
+  return 0;
+}
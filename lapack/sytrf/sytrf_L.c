@@ -0,0 +1,289 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include "common.h"
+
+/*
+ * Blocked Bunch-Kaufman factorization A = L * D * L' of the lower
+ * triangle of a symmetric matrix (the DSYTRF/DLASYF algorithm).
+ *
+ * Each panel of args -> ldb columns is factorized left-looking into the
+ * workspace W = L * D, then the rest of the lower triangle is updated with
+ * A22 := A22 - L21 * W21'.  That update only touches the lower triangle:
+ * every block of columns gets its diagonal block column by column and the
+ * rows below it with GEMM_NT.  The parallel build splits the update across
+ * threads by columns, balanced on the triangle with syrk_thread.
+ *
+ * args -> c   : ipiv, LAPACK convention (1-based, negative for 2x2 pivots)
+ * args -> b   : workspace W, n x args -> ldb
+ * args -> ldb : panel width, at least 2
+ */
+
+/* columns per diagonal block of the trailing update */
+#ifndef SYTRF_UPDATE_NB
+#define SYTRF_UPDATE_NB 64
+#endif
+
+static FLOAT dm1 = -1.;
+
+static int update_L(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  BLASLONG n = args -> n;
+  BLASLONG k = args -> k;
+  BLASLONG lda = args -> lda;
+  BLASLONG ldw = args -> ldb;
+  FLOAT *a = (FLOAT *)args -> a;
+  FLOAT *w = (FLOAT *)args -> b;
+  FLOAT *c = (FLOAT *)args -> c;
+
+  BLASLONG js, jj, min_j, n_from, n_to;
+  blas_arg_t newarg;
+
+  n_from = 0;
+  n_to   = n;
+
+  if (range_n) {
+    n_from = range_n[0];
+    n_to   = range_n[1];
+  }
+
+  newarg.k     = k;
+  newarg.lda   = lda;
+  newarg.ldb   = ldw;
+  newarg.ldc   = lda;
+  newarg.alpha = (void *)&dm1;
+  newarg.beta  = NULL;
+
+  for (js = n_from; js < n_to; js += min_j) {
+    min_j = n_to - js;
+    if (min_j > SYTRF_UPDATE_NB) min_j = SYTRF_UPDATE_NB;
+
+    for (jj = js; jj < js + min_j; jj++) {
+      GEMV_N(js + min_j - jj, k, 0, dm1, a + jj, lda, w + jj, ldw, c + jj + jj * lda, 1, sb);
+    }
+
+    if (js + min_j < n) {
+      newarg.m = n - js - min_j;
+      newarg.n = min_j;
+      newarg.a = (void *)(a + js + min_j);
+      newarg.b = (void *)(w + js);
+      newarg.c = (void *)(c + js + min_j + js * lda);
+
+      GEMM_NT(&newarg, NULL, NULL, sa, sb, 0);
+    }
+  }
+
+  return 0;
+}
+
+/* Factorizes up to nb columns of the n x n matrix a and updates the rest;
+   returns the number of columns done in kb. Factorizes everything when
+   nb >= n. */
+static blasint lasyf_L(BLASLONG n, BLASLONG nb, BLASLONG *kb, FLOAT *a, BLASLONG lda, blasint *ipiv,
+		       FLOAT *w, BLASLONG ldw, FLOAT *sa, FLOAT *sb, BLASLONG nthreads) {
+
+  BLASLONG j, jj, jp, k, kk, kp, kstep, imax, jmax;
+  FLOAT alpha, absakk, colmax, rowmax, d11, d21, d22, r1, t;
+  blasint info;
+  blas_arg_t args;
+
+  info  = 0;
+  alpha = (ONE + sqrt(17.)) / 8.;
+
+  k = 0;
+
+  while ((k < nb - 1 || nb >= n) && k < n) {
+
+    COPY_K(n - k, a + k + k * lda, 1, w + k + k * ldw, 1);
+    if (k > 0) GEMV_N(n - k, k, 0, dm1, a + k, lda, w + k, ldw, w + k + k * ldw, 1, sb);
+
+    kstep  = 1;
+    absakk = fabs(w[k + k * ldw]);
+
+    imax   = k;
+    colmax = ZERO;
+    if (k < n - 1) {
+      imax   = k + IAMAX_K(n - k - 1, w + k + 1 + k * ldw, 1);
+      colmax = fabs(w[imax + k * ldw]);
+    }
+
+    if (MAX(absakk, colmax) == ZERO) {
+
+      if (!info) info = k + 1;
+      kp = k;
+
+    } else {
+
+      if (absakk >= alpha * colmax) {
+	kp = k;
+      } else {
+
+	COPY_K(imax - k, a + imax + k * lda, lda, w + k + (k + 1) * ldw, 1);
+	COPY_K(n - imax, a + imax + imax * lda, 1, w + imax + (k + 1) * ldw, 1);
+	if (k > 0) GEMV_N(n - k, k, 0, dm1, a + k, lda, w + imax, ldw, w + k + (k + 1) * ldw, 1, sb);
+
+	jmax   = k + IAMAX_K(imax - k, w + k + (k + 1) * ldw, 1) - 1;
+	rowmax = fabs(w[jmax + (k + 1) * ldw]);
+	if (imax < n - 1) {
+	  jmax   = imax + IAMAX_K(n - imax - 1, w + imax + 1 + (k + 1) * ldw, 1);
+	  rowmax = MAX(rowmax, fabs(w[jmax + (k + 1) * ldw]));
+	}
+
+	if (absakk >= alpha * colmax * (colmax / rowmax)) {
+	  kp = k;
+	} else if (fabs(w[imax + (k + 1) * ldw]) >= alpha * rowmax) {
+	  kp = imax;
+	  COPY_K(n - k, w + k + (k + 1) * ldw, 1, w + k + k * ldw, 1);
+	} else {
+	  kp = imax;
+	  kstep = 2;
+	}
+      }
+
+      kk = k + kstep - 1;
+
+      if (kp != kk) {
+	a[kp + kp * lda] = a[kk + kk * lda];
+	COPY_K(kp - kk - 1, a + kk + 1 + kk * lda, 1, a + kp + (kk + 1) * lda, lda);
+	if (kp < n - 1) COPY_K(n - kp - 1, a + kp + 1 + kk * lda, 1, a + kp + 1 + kp * lda, 1);
+	if (k > 0) SWAP_K(k, 0, 0, ZERO, a + kk, lda, a + kp, lda, NULL, 0);
+	SWAP_K(kk + 1, 0, 0, ZERO, w + kk, ldw, w + kp, ldw, NULL, 0);
+      }
+
+      if (kstep == 1) {
+	COPY_K(n - k, w + k + k * ldw, 1, a + k + k * lda, 1);
+	if (k < n - 1) {
+	  r1 = ONE / a[k + k * lda];
+	  SCAL_K(n - k - 1, 0, 0, r1, a + k + 1 + k * lda, 1, NULL, 0, NULL, 0);
+	}
+      } else {
+	if (k < n - 2) {
+	  d21 = w[k + 1 + k * ldw];
+	  d11 = w[k + 1 + (k + 1) * ldw] / d21;
+	  d22 = w[k + k * ldw] / d21;
+	  t   = ONE / (d11 * d22 - ONE);
+	  d21 = t / d21;
+	  for (j = k + 2; j < n; j++) {
+	    a[j +  k      * lda] = d21 * (d11 * w[j + k * ldw] - w[j + (k + 1) * ldw]);
+	    a[j + (k + 1) * lda] = d21 * (d22 * w[j + (k + 1) * ldw] - w[j + k * ldw]);
+	  }
+	}
+	a[k     +  k      * lda] = w[k     +  k      * ldw];
+	a[k + 1 +  k      * lda] = w[k + 1 +  k      * ldw];
+	a[k + 1 + (k + 1) * lda] = w[k + 1 + (k + 1) * ldw];
+      }
+    }
+
+    if (kstep == 1) {
+      ipiv[k] = kp + 1;
+    } else {
+      ipiv[k]     = -(kp + 1);
+      ipiv[k + 1] = -(kp + 1);
+    }
+
+    k += kstep;
+  }
+
+  if (k < n) {
+    args.n   = n - k;
+    args.k   = k;
+    args.a   = (void *)(a + k);
+    args.lda = lda;
+    args.b   = (void *)(w + k);
+    args.ldb = ldw;
+    args.c   = (void *)(a + k + k * lda);
+
+#ifdef PARALLEL
+    if (nthreads > 1) {
+      syrk_thread(
+#ifdef DOUBLE
+		  BLAS_DOUBLE | BLAS_REAL | BLAS_UPLO,
+#else
+		  BLAS_SINGLE | BLAS_REAL | BLAS_UPLO,
+#endif
+		  &args, NULL, NULL, update_L, sa, sb, nthreads);
+    } else
+#endif
+    update_L(&args, NULL, NULL, sa, sb, 0);
+  }
+
+  /* undo the interchanges of the factorized columns on the columns
+     to their left, as the unblocked factorization leaves them */
+  j = k - 1;
+  do {
+    jj = j;
+    jp = ipiv[j];
+    if (jp < 0) {
+      jp = -jp;
+      j--;
+    }
+    j--;
+    if ((jp - 1 != jj) && (j >= 0)) SWAP_K(j + 1, 0, 0, ZERO, a + jp - 1, lda, a + jj, lda, NULL, 0);
+  } while (j > 0);
+
+  *kb = k;
+
+  return info;
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG n, lda, nb, k, kb, j;
+  blasint *ipiv, info, iinfo;
+  FLOAT *a, *w;
+
+  n    = args -> n;
+  a    = (FLOAT *)args -> a;
+  lda  = args -> lda;
+  w    = (FLOAT *)args -> b;
+  ipiv = (blasint *)args -> c;
+
+  nb = args -> ldb;
+
+  info = 0;
+
+  for (k = 0; k < n; k += kb) {
+
+    iinfo = lasyf_L(n - k, (k < n - nb) ? nb : n - k, &kb, a + k + k * lda, lda, ipiv + k, w, n - k, sa, sb,
+#ifdef PARALLEL
+		    args -> nthreads
+#else
+		    1
+#endif
+		    );
+
+    if (iinfo && !info) info = iinfo + k;
+
+    for (j = k; j < k + kb; j++) {
+      if (ipiv[j] > 0) ipiv[j] += k; else ipiv[j] -= k;
+    }
+  }
+
+  return info;
+}
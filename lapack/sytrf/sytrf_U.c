@@ -0,0 +1,288 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include "common.h"
+
+/*
+ * Blocked Bunch-Kaufman factorization A = U * D * U' of the upper
+ * triangle of a symmetric matrix (the DSYTRF/DLASYF algorithm), working
+ * from the last column backwards.
+ *
+ * Each panel of args -> ldb columns is factorized left-looking into the
+ * workspace W = U * D, then the leading upper triangle is updated with
+ * A11 := A11 - U12 * W12'.  Every block of columns gets its diagonal block
+ * column by column and the rows above it with GEMM_NT.  The parallel build
+ * splits the update across threads with syrk_thread.
+ *
+ * args -> c   : ipiv, LAPACK convention (1-based, negative for 2x2 pivots)
+ * args -> b   : workspace W, n x args -> ldb
+ * args -> ldb : panel width, at least 2
+ */
+
+/* columns per diagonal block of the trailing update */
+#ifndef SYTRF_UPDATE_NB
+#define SYTRF_UPDATE_NB 64
+#endif
+
+static FLOAT dm1 = -1.;
+
+static int update_U(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  BLASLONG n = args -> n;
+  BLASLONG k = args -> k;
+  BLASLONG lda = args -> lda;
+  BLASLONG ldw = args -> ldb;
+  FLOAT *a = (FLOAT *)args -> a;
+  FLOAT *w = (FLOAT *)args -> b;
+  FLOAT *c = (FLOAT *)args -> c;
+
+  BLASLONG js, jj, min_j, n_from, n_to;
+  blas_arg_t newarg;
+
+  n_from = 0;
+  n_to   = n;
+
+  if (range_n) {
+    n_from = range_n[0];
+    n_to   = range_n[1];
+  }
+
+  newarg.k     = k;
+  newarg.lda   = lda;
+  newarg.ldb   = ldw;
+  newarg.ldc   = lda;
+  newarg.alpha = (void *)&dm1;
+  newarg.beta  = NULL;
+
+  for (js = n_from; js < n_to; js += min_j) {
+    min_j = n_to - js;
+    if (min_j > SYTRF_UPDATE_NB) min_j = SYTRF_UPDATE_NB;
+
+    for (jj = js; jj < js + min_j; jj++) {
+      GEMV_N(jj - js + 1, k, 0, dm1, a + js, lda, w + jj, ldw, c + js + jj * lda, 1, sb);
+    }
+
+    if (js > 0) {
+      newarg.m = js;
+      newarg.n = min_j;
+      newarg.a = (void *)a;
+      newarg.b = (void *)(w + js);
+      newarg.c = (void *)(c + js * lda);
+
+      GEMM_NT(&newarg, NULL, NULL, sa, sb, 0);
+    }
+  }
+
+  return 0;
+}
+
+/* Factorizes up to nb trailing columns of the n x n leading matrix a and
+   updates the rest; returns the number of columns done in kb. Factorizes
+   everything when nb >= n. */
+static blasint lasyf_U(BLASLONG n, BLASLONG nb, BLASLONG *kb, FLOAT *a, BLASLONG lda, blasint *ipiv,
+		       FLOAT *w, BLASLONG ldw, FLOAT *sa, FLOAT *sb, BLASLONG nthreads) {
+
+  BLASLONG j, jj, jp, k, kk, kp, kw, kkw, kstep, imax, jmax;
+  FLOAT alpha, absakk, colmax, rowmax, d11, d21, d22, r1, t;
+  blasint info;
+  blas_arg_t args;
+
+  info  = 0;
+  alpha = (ONE + sqrt(17.)) / 8.;
+
+  k = n - 1;
+
+  while ((k > n - nb || nb >= n) && k >= 0) {
+
+    kw = nb + k - n;
+
+    COPY_K(k + 1, a + k * lda, 1, w + kw * ldw, 1);
+    if (k < n - 1) GEMV_N(k + 1, n - k - 1, 0, dm1, a + (k + 1) * lda, lda, w + k + (kw + 1) * ldw, ldw, w + kw * ldw, 1, sb);
+
+    kstep  = 1;
+    absakk = fabs(w[k + kw * ldw]);
+
+    imax   = k;
+    colmax = ZERO;
+    if (k > 0) {
+      imax   = IAMAX_K(k, w + kw * ldw, 1) - 1;
+      colmax = fabs(w[imax + kw * ldw]);
+    }
+
+    if (MAX(absakk, colmax) == ZERO) {
+
+      if (!info) info = k + 1;
+      kp = k;
+
+    } else {
+
+      if (absakk >= alpha * colmax) {
+	kp = k;
+      } else {
+
+	COPY_K(imax + 1, a + imax * lda, 1, w + (kw - 1) * ldw, 1);
+	COPY_K(k - imax, a + imax + (imax + 1) * lda, lda, w + imax + 1 + (kw - 1) * ldw, 1);
+	if (k < n - 1) GEMV_N(k + 1, n - k - 1, 0, dm1, a + (k + 1) * lda, lda, w + imax + (kw + 1) * ldw, ldw, w + (kw - 1) * ldw, 1, sb);
+
+	jmax   = imax + IAMAX_K(k - imax, w + imax + 1 + (kw - 1) * ldw, 1);
+	rowmax = fabs(w[jmax + (kw - 1) * ldw]);
+	if (imax > 0) {
+	  jmax   = IAMAX_K(imax, w + (kw - 1) * ldw, 1) - 1;
+	  rowmax = MAX(rowmax, fabs(w[jmax + (kw - 1) * ldw]));
+	}
+
+	if (absakk >= alpha * colmax * (colmax / rowmax)) {
+	  kp = k;
+	} else if (fabs(w[imax + (kw - 1) * ldw]) >= alpha * rowmax) {
+	  kp = imax;
+	  COPY_K(k + 1, w + (kw - 1) * ldw, 1, w + kw * ldw, 1);
+	} else {
+	  kp = imax;
+	  kstep = 2;
+	}
+      }
+
+      kk  = k - kstep + 1;
+      kkw = nb + kk - n;
+
+      if (kp != kk) {
+	a[kp + kp * lda] = a[kk + kk * lda];
+	COPY_K(kk - 1 - kp, a + kp + 1 + kk * lda, 1, a + kp + (kp + 1) * lda, lda);
+	if (kp > 0) COPY_K(kp, a + kk * lda, 1, a + kp * lda, 1);
+	if (k < n - 1) SWAP_K(n - k - 1, 0, 0, ZERO, a + kk + (k + 1) * lda, lda, a + kp + (k + 1) * lda, lda, NULL, 0);
+	SWAP_K(n - kk, 0, 0, ZERO, w + kk + kkw * ldw, ldw, w + kp + kkw * ldw, ldw, NULL, 0);
+      }
+
+      if (kstep == 1) {
+	COPY_K(k + 1, w + kw * ldw, 1, a + k * lda, 1);
+	r1 = ONE / a[k + k * lda];
+	SCAL_K(k, 0, 0, r1, a + k * lda, 1, NULL, 0, NULL, 0);
+      } else {
+	if (k > 1) {
+	  d21 = w[k - 1 + kw * ldw];
+	  d11 = w[k + kw * ldw] / d21;
+	  d22 = w[k - 1 + (kw - 1) * ldw] / d21;
+	  t   = ONE / (d11 * d22 - ONE);
+	  d21 = t / d21;
+	  for (j = 0; j < k - 1; j++) {
+	    a[j + (k - 1) * lda] = d21 * (d11 * w[j + (kw - 1) * ldw] - w[j + kw * ldw]);
+	    a[j +  k      * lda] = d21 * (d22 * w[j + kw * ldw] - w[j + (kw - 1) * ldw]);
+	  }
+	}
+	a[k - 1 + (k - 1) * lda] = w[k - 1 + (kw - 1) * ldw];
+	a[k - 1 +  k      * lda] = w[k - 1 +  kw      * ldw];
+	a[k     +  k      * lda] = w[k     +  kw      * ldw];
+      }
+    }
+
+    if (kstep == 1) {
+      ipiv[k] = kp + 1;
+    } else {
+      ipiv[k]     = -(kp + 1);
+      ipiv[k - 1] = -(kp + 1);
+    }
+
+    k -= kstep;
+  }
+
+  kw = nb + k - n;
+
+  if (k >= 0) {
+    args.n   = k + 1;
+    args.k   = n - k - 1;
+    args.a   = (void *)(a + (k + 1) * lda);
+    args.lda = lda;
+    args.b   = (void *)(w + (kw + 1) * ldw);
+    args.ldb = ldw;
+    args.c   = (void *)a;
+
+#ifdef PARALLEL
+    if (nthreads > 1) {
+      syrk_thread(
+#ifdef DOUBLE
+		  BLAS_DOUBLE | BLAS_REAL,
+#else
+		  BLAS_SINGLE | BLAS_REAL,
+#endif
+		  &args, NULL, NULL, update_U, sa, sb, nthreads);
+    } else
+#endif
+    update_U(&args, NULL, NULL, sa, sb, 0);
+  }
+
+  /* undo the interchanges of the factorized columns on the columns
+     to their right, as the unblocked factorization leaves them */
+  j = k + 1;
+  do {
+    jj = j;
+    jp = ipiv[j];
+    if (jp < 0) {
+      jp = -jp;
+      j++;
+    }
+    j++;
+    if ((jp - 1 != jj) && (j < n)) SWAP_K(n - j, 0, 0, ZERO, a + jp - 1 + j * lda, lda, a + jj + j * lda, lda, NULL, 0);
+  } while (j < n - 1);
+
+  *kb = n - k - 1;
+
+  return info;
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG n, lda, nb, k, kb;
+  blasint *ipiv, info, iinfo;
+  FLOAT *a, *w;
+
+  n    = args -> n;
+  a    = (FLOAT *)args -> a;
+  lda  = args -> lda;
+  w    = (FLOAT *)args -> b;
+  ipiv = (blasint *)args -> c;
+
+  nb = args -> ldb;
+
+  info = 0;
+
+  for (k = n; k > 0; k -= kb) {
+
+    iinfo = lasyf_U(k, (k > nb) ? nb : k, &kb, a, lda, ipiv, w, k, sa, sb,
+#ifdef PARALLEL
+		    args -> nthreads
+#else
+		    1
+#endif
+		    );
+
+    if (iinfo && !info) info = iinfo;
+  }
+
+  return info;
+}
@@ -81,6 +81,12 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define SBGEMM_DEFAULT_Q 256
 #define SBGEMM_ALIGN_K 1  // must be 2^x
 
+/* int8 GEMM: Q counts bytes of K and must be a multiple of 4, P and R
+   must be multiples of the unrolls */
+#define I8GEMM_DEFAULT_P 256
+#define I8GEMM_DEFAULT_Q 1024
+#define I8GEMM_DEFAULT_R 512
+
 #ifdef OPTERON
 
 #define SNUMOPT		4
@@ -614,6 +620,9 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define SYMV_P  8
 
+#define I8GEMM_DEFAULT_UNROLL_M 8
+#define I8GEMM_DEFAULT_UNROLL_N 4
+
 #if defined(XDOUBLE) || defined(DOUBLE)
 #define SWITCH_RATIO            4
 #define GEMM_PREFERED_SIZE      4
@@ -1523,6 +1532,9 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define SYMV_P  8
 
+#define I8GEMM_DEFAULT_UNROLL_M 8
+#define I8GEMM_DEFAULT_UNROLL_N 4
+
 #if defined(XDOUBLE) || defined(DOUBLE)
 #define SWITCH_RATIO            4
 #define GEMM_PREFERED_SIZE      4
@@ -1649,6 +1661,9 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define SYMV_P  8
 
+#define I8GEMM_DEFAULT_UNROLL_M 8
+#define I8GEMM_DEFAULT_UNROLL_N 4
+
 #if defined(XDOUBLE) || defined(DOUBLE)
 #define SWITCH_RATIO           8
 #define GEMM_PREFERED_SIZE     8
@@ -1793,6 +1808,9 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define SBGEMM_DEFAULT_Q 1024
 #define SBGEMM_DEFAULT_R sbgemm_r
 
+#define I8GEMM_DEFAULT_UNROLL_M 32
+#define I8GEMM_DEFAULT_UNROLL_N 8
+
 #ifdef ARCH_X86
 
 #define SGEMM_DEFAULT_UNROLL_M 4
@@ -1923,6 +1941,9 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define SBGEMM_DEFAULT_Q 768
 #define SBGEMM_DEFAULT_R sbgemm_r
 
+#define I8GEMM_DEFAULT_UNROLL_M 32
+#define I8GEMM_DEFAULT_UNROLL_N 8
+
 #ifdef ARCH_X86
 
 #define SGEMM_DEFAULT_UNROLL_M 4
@@ -2023,6 +2044,144 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #endif
 
 
+#ifdef ZEN4
+
+/* Zen 4 runs the AVX512 kernels on double-pumped 256-bit units and pairs a
+   1MB 8-way L2 with 32MB of L3 per CCD, so the packed A block is kept to
+   about half of L2 with a longer K panel, and DGEMM's R is sized to the L3. */
+
+#define SNUMOPT         16
+#define DNUMOPT         8
+
+#define GEMM_DEFAULT_OFFSET_A     0
+#define GEMM_DEFAULT_OFFSET_B     0
+#define GEMM_DEFAULT_ALIGN 0x03fffUL
+
+#define SYMV_P  8
+
+#if defined(XDOUBLE) || defined(DOUBLE)
+#define SWITCH_RATIO           8
+#define GEMM_PREFERED_SIZE     8
+#else
+#define SWITCH_RATIO           16
+#define GEMM_PREFERED_SIZE     16
+#endif
+#define USE_SGEMM_KERNEL_DIRECT 1
+
+#undef SBGEMM_DEFAULT_UNROLL_N
+#undef SBGEMM_DEFAULT_UNROLL_M
+#undef SBGEMM_DEFAULT_P
+#undef SBGEMM_DEFAULT_R
+#undef SBGEMM_DEFAULT_Q
+#define SBGEMM_DEFAULT_UNROLL_N 4
+#define SBGEMM_DEFAULT_UNROLL_M 16
+#define SBGEMM_DEFAULT_P 384
+#define SBGEMM_DEFAULT_Q 768
+#define SBGEMM_DEFAULT_R sbgemm_r
+
+#define I8GEMM_DEFAULT_UNROLL_M 32
+#define I8GEMM_DEFAULT_UNROLL_N 8
+
+#ifdef ARCH_X86
+
+#define SGEMM_DEFAULT_UNROLL_M 4
+#define DGEMM_DEFAULT_UNROLL_M 2
+#define QGEMM_DEFAULT_UNROLL_M 2
+#define CGEMM_DEFAULT_UNROLL_M 2
+#define ZGEMM_DEFAULT_UNROLL_M 1
+#define XGEMM_DEFAULT_UNROLL_M 1
+
+#define SGEMM_DEFAULT_UNROLL_N 4
+#define DGEMM_DEFAULT_UNROLL_N 4
+#define QGEMM_DEFAULT_UNROLL_N 2
+#define CGEMM_DEFAULT_UNROLL_N 2
+#define ZGEMM_DEFAULT_UNROLL_N 2
+#define XGEMM_DEFAULT_UNROLL_N 1
+
+#else
+
+#define SGEMM_DEFAULT_UNROLL_M 16
+#define DGEMM_DEFAULT_UNROLL_M 16
+#define QGEMM_DEFAULT_UNROLL_M 2
+#define CGEMM_DEFAULT_UNROLL_M 8
+#define ZGEMM_DEFAULT_UNROLL_M 4
+#define XGEMM_DEFAULT_UNROLL_M 1
+
+#define SGEMM_DEFAULT_UNROLL_N 4
+#define DGEMM_DEFAULT_UNROLL_N 2
+#define QGEMM_DEFAULT_UNROLL_N 2
+#define CGEMM_DEFAULT_UNROLL_N 2
+#define ZGEMM_DEFAULT_UNROLL_N 2
+#define XGEMM_DEFAULT_UNROLL_N 1
+
+#define SGEMM_DEFAULT_UNROLL_MN 32
+#define DGEMM_DEFAULT_UNROLL_MN 32
+#endif
+
+#ifdef ARCH_X86
+
+#define SGEMM_DEFAULT_P 512
+#define SGEMM_DEFAULT_R sgemm_r
+#define DGEMM_DEFAULT_P 512
+#define DGEMM_DEFAULT_R dgemm_r
+#define QGEMM_DEFAULT_P 504
+#define QGEMM_DEFAULT_R qgemm_r
+#define CGEMM_DEFAULT_P 128
+#define CGEMM_DEFAULT_R 1024
+#define ZGEMM_DEFAULT_P 512
+#define ZGEMM_DEFAULT_R zgemm_r
+#define XGEMM_DEFAULT_P 252
+#define XGEMM_DEFAULT_R xgemm_r
+#define SGEMM_DEFAULT_Q 256
+#define DGEMM_DEFAULT_Q 256
+#define QGEMM_DEFAULT_Q 128
+#define CGEMM_DEFAULT_Q 256
+#define ZGEMM_DEFAULT_Q 192
+#define XGEMM_DEFAULT_Q 128
+
+#else
+
+#define SGEMM_DEFAULT_P 320
+#define DGEMM_DEFAULT_P 192
+#define CGEMM_DEFAULT_P 192
+#define ZGEMM_DEFAULT_P 128
+
+#define SGEMM_DEFAULT_Q 384
+#define DGEMM_DEFAULT_Q 320
+#define CGEMM_DEFAULT_Q 320
+#define ZGEMM_DEFAULT_Q 240
+
+#define SGEMM_DEFAULT_R sgemm_r
+#define DGEMM_DEFAULT_R 6144
+#define CGEMM_DEFAULT_R cgemm_r
+#define ZGEMM_DEFAULT_R zgemm_r
+
+#define QGEMM_DEFAULT_Q 128
+#define QGEMM_DEFAULT_P 504
+#define QGEMM_DEFAULT_R qgemm_r
+#define XGEMM_DEFAULT_P 252
+#define XGEMM_DEFAULT_R xgemm_r
+#define XGEMM_DEFAULT_Q 128
+
+#define CGEMM3M_DEFAULT_UNROLL_N 4
+#define CGEMM3M_DEFAULT_UNROLL_M 8
+#define ZGEMM3M_DEFAULT_UNROLL_N 4
+#define ZGEMM3M_DEFAULT_UNROLL_M 4
+
+#define CGEMM3M_DEFAULT_P 320
+#define ZGEMM3M_DEFAULT_P 256
+#define XGEMM3M_DEFAULT_P 112
+#define CGEMM3M_DEFAULT_Q 320
+#define ZGEMM3M_DEFAULT_Q 256
+#define XGEMM3M_DEFAULT_Q 224
+#define CGEMM3M_DEFAULT_R 12288
+#define ZGEMM3M_DEFAULT_R 12288
+#define XGEMM3M_DEFAULT_R 12288
+
+#endif
+#endif
+
+
 #ifdef ATOM
 
 #define SNUMOPT		2
@@ -4125,6 +4284,14 @@ Until then, just keep it different than DGEMM_DEFAULT_UNROLL_N to keep copy rout
 #define XGEMM_DEFAULT_UNROLL_N 2
 #endif
 
+#ifndef I8GEMM_DEFAULT_UNROLL_M
+#define I8GEMM_DEFAULT_UNROLL_M 4
+#endif
+
+#ifndef I8GEMM_DEFAULT_UNROLL_N
+#define I8GEMM_DEFAULT_UNROLL_N 4
+#endif
+
 #ifndef HAVE_SSE2
 #define SHUFPD_0	shufps	$0x44,
 #define SHUFPD_1	shufps	$0x4e,
@@ -0,0 +1,228 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+
+/* the unblocked reference routines, still taken from reference LAPACK */
+void BLASFUNC(sgbtf2)(blasint *, blasint *, blasint *, blasint *, float  *, blasint *, blasint *, blasint *);
+void BLASFUNC(dgbtf2)(blasint *, blasint *, blasint *, blasint *, double *, blasint *, blasint *, blasint *);
+void BLASFUNC(dpbtf2)(char *, blasint *, blasint *, double *, blasint *, blasint *);
+
+static double fill_value(unsigned int *seed)
+{
+	*seed = *seed * 1103515245u + 12345u;
+	return (double)((*seed >> 8) & 0xffff) / 32768.0 - 1.0;
+}
+
+/* general band storage, the KL fill-in rows left as garbage */
+static void fill_gb(double *ab, blasint ldab, blasint n, unsigned int seed)
+{
+	blasint i;
+
+	for (i = 0; i < ldab * n; i++) ab[i] = fill_value(&seed);
+}
+
+/* symmetric band storage of a diagonally dominant matrix */
+static void fill_pb(double *ab, blasint ldab, blasint n, blasint kd, int upper, unsigned int seed)
+{
+	blasint i, diag = upper ? kd : 0;
+
+	for (i = 0; i < ldab * n; i++) ab[i] = fill_value(&seed);
+	for (i = 0; i < n; i++) ab[diag + i * ldab] = 2.0 * kd + 2.0;
+}
+
+static double max_diff(double *a, double *b, blasint len)
+{
+	blasint i;
+	double d = 0.0;
+
+	for (i = 0; i < len; i++) d = MAX(d, fabs(a[i] - b[i]));
+
+	return d;
+}
+
+static void check_dgbtrf(blasint m, blasint n, blasint kl, blasint ku, unsigned int seed)
+{
+	blasint ldab = 2 * kl + ku + 1, mn = MIN(m, n), info, info0;
+	double *ab  = (double *)malloc(sizeof(double) * ldab * n);
+	double *ab0 = (double *)malloc(sizeof(double) * ldab * n);
+	blasint *ipiv  = (blasint *)malloc(sizeof(blasint) * mn);
+	blasint *ipiv0 = (blasint *)malloc(sizeof(blasint) * mn);
+
+	fill_gb(ab, ldab, n, seed);
+	memcpy(ab0, ab, sizeof(double) * ldab * n);
+
+	BLASFUNC(dgbtrf)(&m, &n, &kl, &ku, ab, &ldab, ipiv, &info);
+	BLASFUNC(dgbtf2)(&m, &n, &kl, &ku, ab0, &ldab, ipiv0, &info0);
+
+	ASSERT_EQUAL(info0, info);
+	ASSERT_EQUAL(0, memcmp(ipiv0, ipiv, sizeof(blasint) * mn));
+	ASSERT_DBL_NEAR_TOL(0.0, max_diff(ab, ab0, ldab * n), 1e-9);
+
+	free(ab);
+	free(ab0);
+	free(ipiv);
+	free(ipiv0);
+}
+
+static void check_dpbtrf(char uplo, blasint n, blasint kd, unsigned int seed)
+{
+	blasint ldab = kd + 1, info, info0;
+	double *ab  = (double *)malloc(sizeof(double) * ldab * n);
+	double *ab0 = (double *)malloc(sizeof(double) * ldab * n);
+
+	fill_pb(ab, ldab, n, kd, uplo == 'U', seed);
+	memcpy(ab0, ab, sizeof(double) * ldab * n);
+
+	BLASFUNC(dpbtrf)(&uplo, &n, &kd, ab, &ldab, &info);
+	BLASFUNC(dpbtf2)(&uplo, &n, &kd, ab0, &ldab, &info0);
+
+	ASSERT_EQUAL(0, info0);
+	ASSERT_EQUAL(0, info);
+	ASSERT_DBL_NEAR_TOL(0.0, max_diff(ab, ab0, ldab * n), 1e-10);
+
+	free(ab);
+	free(ab0);
+}
+
+/* the blocked LU against the unblocked reference, pivots and storage */
+CTEST(banded, dgbtrf_blocked)
+{
+	check_dgbtrf(300, 300, 40, 35, 3u);
+	check_dgbtrf(257, 301, 70, 20, 5u);
+	check_dgbtrf(301, 190, 33, 90, 7u);
+}
+
+/* wide enough for the pipelined threads, with blocks cut by the band storage */
+CTEST(banded, dgbtrf_wide)
+{
+	check_dgbtrf(900, 900, 100, 60, 59u);
+	check_dgbtrf(700, 650, 150, 20, 61u);
+}
+
+CTEST(banded, dgbtrf_unblocked)
+{
+	check_dgbtrf(120, 120, 5, 7, 11u);
+	check_dgbtrf(40, 60, 40, 12, 13u);
+}
+
+/* an exactly zero column stops nothing but is reported */
+CTEST(banded, dgbtrf_singular)
+{
+	blasint m = 200, n = 200, kl = 40, ku = 40, ldab = 2 * kl + ku + 1;
+	blasint i, ipiv[200], ipiv0[200], info, info0;
+	double *ab  = (double *)malloc(sizeof(double) * ldab * n);
+	double *ab0 = (double *)malloc(sizeof(double) * ldab * n);
+
+	fill_gb(ab, ldab, n, 17u);
+	for (i = 0; i < ldab; i++) ab[i + 150 * ldab] = 0.0;
+	memcpy(ab0, ab, sizeof(double) * ldab * n);
+
+	BLASFUNC(dgbtrf)(&m, &n, &kl, &ku, ab, &ldab, ipiv, &info);
+	BLASFUNC(dgbtf2)(&m, &n, &kl, &ku, ab0, &ldab, ipiv0, &info0);
+
+	ASSERT_EQUAL(151, info0);
+	ASSERT_EQUAL(info0, info);
+	ASSERT_EQUAL(0, memcmp(ipiv0, ipiv, sizeof(ipiv)));
+	ASSERT_DBL_NEAR_TOL(0.0, max_diff(ab, ab0, ldab * n), 1e-9);
+
+	free(ab);
+	free(ab0);
+}
+
+CTEST(banded, sgbtrf_blocked)
+{
+	blasint m = 250, n = 250, kl = 48, ku = 20, ldab = 2 * kl + ku + 1;
+	blasint i, ipiv[250], ipiv0[250], info, info0;
+	float *ab  = (float *)malloc(sizeof(float) * ldab * n);
+	float *ab0 = (float *)malloc(sizeof(float) * ldab * n);
+	unsigned int seed = 19u;
+	double d = 0.0;
+
+	for (i = 0; i < ldab * n; i++) ab[i] = ab0[i] = (float)fill_value(&seed);
+
+	BLASFUNC(sgbtrf)(&m, &n, &kl, &ku, ab, &ldab, ipiv, &info);
+	BLASFUNC(sgbtf2)(&m, &n, &kl, &ku, ab0, &ldab, ipiv0, &info0);
+
+	for (i = 0; i < ldab * n; i++) d = MAX(d, fabs(ab[i] - ab0[i]));
+
+	ASSERT_EQUAL(info0, info);
+	ASSERT_EQUAL(0, memcmp(ipiv0, ipiv, sizeof(ipiv)));
+	ASSERT_DBL_NEAR_TOL(0.0, d, 1e-3);
+
+	free(ab);
+	free(ab0);
+}
+
+CTEST(banded, dpbtrf_blocked)
+{
+	check_dpbtrf('U', 300, 50, 23u);
+	check_dpbtrf('L', 300, 50, 29u);
+	check_dpbtrf('U', 261, 100, 31u);
+	check_dpbtrf('L', 261, 100, 37u);
+}
+
+CTEST(banded, dpbtrf_wide)
+{
+	check_dpbtrf('U', 900, 200, 67u);
+	check_dpbtrf('L', 900, 200, 71u);
+}
+
+CTEST(banded, dpbtrf_unblocked)
+{
+	check_dpbtrf('U', 100, 10, 41u);
+	check_dpbtrf('L', 100, 10, 43u);
+	check_dpbtrf('L', 40, 60, 47u);
+}
+
+/* the first non positive leading minor, inside the third block */
+CTEST(banded, dpbtrf_not_definite)
+{
+	blasint n = 300, kd = 50, ldab = kd + 1, info, info0;
+	double *ab  = (double *)malloc(sizeof(double) * ldab * n);
+	double *ab0 = (double *)malloc(sizeof(double) * ldab * n);
+	char uplo = 'L';
+
+	fill_pb(ab, ldab, n, kd, 0, 53u);
+	ab[140 * ldab] = -1.0;
+	memcpy(ab0, ab, sizeof(double) * ldab * n);
+
+	BLASFUNC(dpbtrf)(&uplo, &n, &kd, ab, &ldab, &info);
+	BLASFUNC(dpbtf2)(&uplo, &n, &kd, ab0, &ldab, &info0);
+
+	ASSERT_EQUAL(141, info0);
+	ASSERT_EQUAL(info0, info);
+
+	free(ab);
+	free(ab0);
+}
@@ -0,0 +1,249 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+
+#include "openblas_utest.h"
+
+static double fill_value(unsigned int *seed)
+{
+	*seed = *seed * 1103515245u + 12345u;
+	return (double)((*seed >> 8) & 0xffff) / 32768.0 - 1.0;
+}
+
+static void fill(double *a, blasint m, blasint n, blasint lda, unsigned int seed)
+{
+	blasint i, j;
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < m; i++) a[i + j * lda] = fill_value(&seed);
+}
+
+/* symmetric positive definite, both triangles filled */
+static void fill_spd(double *a, blasint n, blasint lda, unsigned int seed)
+{
+	blasint i, j;
+
+	for (j = 0; j < n; j++)
+		for (i = j; i < n; i++) {
+			a[i + j * lda] = fill_value(&seed);
+			a[j + i * lda] = a[i + j * lda];
+		}
+	for (i = 0; i < n; i++) a[i + i * lda] += n;
+}
+
+static double max_diff(double *a, double *b, blasint m, blasint n, blasint lda)
+{
+	blasint i, j;
+	double d = 0.0;
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < m; i++) d = MAX(d, fabs(a[i + j * lda] - b[i + j * lda]));
+
+	return d;
+}
+
+/*
+ * three groups through the batched LU (a stack tile, the in place kernel
+ * and the blocked fallback), compared with DGETRF matrix by matrix
+ */
+CTEST(batch, dgetrf_groups)
+{
+	blasint m[3] = {8, 13, 70}, n[3] = {8, 9, 70}, lda[3] = {10, 13, 71};
+	blasint size[3] = {3, 2, 2}, count = 3;
+	blasint total = 7, g, i, p, info[7], info0, mn;
+	double *a[7], *a0[7];
+	blasint *ipiv[7], ipiv0[70];
+
+	for (g = 0, p = 0; g < count; g++)
+		for (i = 0; i < size[g]; i++, p++) {
+			a[p]    = (double *)malloc(sizeof(double) * lda[g] * n[g]);
+			a0[p]   = (double *)malloc(sizeof(double) * lda[g] * n[g]);
+			ipiv[p] = (blasint *)malloc(sizeof(blasint) * MIN(m[g], n[g]));
+			fill(a[p], lda[g], n[g], lda[g], 17u + p);
+			memcpy(a0[p], a[p], sizeof(double) * lda[g] * n[g]);
+		}
+
+	BLASFUNC(dgetrf_batch)(m, n, a, lda, ipiv, &count, size, info);
+
+	for (g = 0, p = 0; g < count; g++)
+		for (i = 0; i < size[g]; i++, p++) {
+			BLASFUNC(dgetrf)(&m[g], &n[g], a0[p], &lda[g], ipiv0, &info0);
+			ASSERT_EQUAL(info0, info[p]);
+			mn = MIN(m[g], n[g]);
+			ASSERT_EQUAL(0, memcmp(ipiv0, ipiv[p], sizeof(blasint) * mn));
+			ASSERT_DBL_NEAR_TOL(0.0, max_diff(a[p], a0[p], m[g], n[g], lda[g]), 1e-10);
+		}
+
+	for (p = 0; p < total; p++) {
+		free(a[p]);
+		free(a0[p]);
+		free(ipiv[p]);
+	}
+}
+
+CTEST(batch, dgetrf_singular_and_invalid_group)
+{
+	blasint m[2] = {4, 6}, n[2] = {4, 6}, lda[2] = {4, 5}, size[2] = {2, 1}, count = 2;
+	blasint ipiv[3][6], *pipiv[3] = {ipiv[0], ipiv[1], ipiv[2]}, info[3];
+	double a[3][36], *pa[3] = {a[0], a[1], a[2]};
+
+	fill(a[0], 4, 4, 4, 3u);
+	fill(a[1], 4, 4, 4, 5u);
+	/* the third column of the second matrix is zero */
+	memset(a[1] + 8, 0, sizeof(double) * 4);
+
+	BLASFUNC(dgetrf_batch)(m, n, pa, lda, pipiv, &count, size, info);
+
+	ASSERT_EQUAL(0, info[0]);
+	ASSERT_EQUAL(3, info[1]);
+	ASSERT_EQUAL(-4, info[2]);
+}
+
+/* LU and solve of a strided batch, with A X = B and A**T X = B */
+static void check_strided_solve(char trans, blasint n, blasint nrhs, blasint batch)
+{
+	blasint lda = n + 1, ldb = n + 2, stride_a = lda * n + 5, stride_b = ldb * nrhs, stride_ipiv = n;
+	blasint i, j, l, p, r, *ipiv, *info;
+	double *a, *a0, *b, *b0, res, err = 0.0;
+
+	a    = (double *)malloc(sizeof(double) * stride_a * batch);
+	a0   = (double *)malloc(sizeof(double) * stride_a * batch);
+	b    = (double *)malloc(sizeof(double) * stride_b * batch);
+	b0   = (double *)malloc(sizeof(double) * stride_b * batch);
+	ipiv = (blasint *)malloc(sizeof(blasint) * stride_ipiv * batch);
+	info = (blasint *)malloc(sizeof(blasint) * batch);
+
+	fill(a, stride_a, batch, stride_a, 29u + n);
+	fill(b, stride_b, batch, stride_b, 31u + n);
+	memcpy(a0, a, sizeof(double) * stride_a * batch);
+	memcpy(b0, b, sizeof(double) * stride_b * batch);
+
+	BLASFUNC(dgetrf_batch_strided)(&n, &n, a, &lda, &stride_a, ipiv, &stride_ipiv, &batch, info);
+	for (p = 0; p < batch; p++) ASSERT_EQUAL(0, info[p]);
+
+	BLASFUNC(dgetrs_batch_strided)(&trans, &n, &nrhs, a, &lda, &stride_a, ipiv, &stride_ipiv,
+				       b, &ldb, &stride_b, &batch, info);
+
+	for (p = 0; p < batch; p++) {
+		double *ap = a0 + p * stride_a, *xp = b + p * stride_b, *bp = b0 + p * stride_b;
+
+		ASSERT_EQUAL(0, info[p]);
+		for (r = 0; r < nrhs; r++)
+			for (i = 0; i < n; i++) {
+				res = bp[i + r * ldb];
+				for (l = 0; l < n; l++) {
+					j = (trans == 'N') ? i + l * lda : l + i * lda;
+					res -= ap[j] * xp[l + r * ldb];
+				}
+				err = MAX(err, fabs(res));
+			}
+	}
+
+	ASSERT_DBL_NEAR_TOL(0.0, err, 1e-9);
+
+	free(a);
+	free(a0);
+	free(b);
+	free(b0);
+	free(ipiv);
+	free(info);
+}
+
+CTEST(batch, dgetrs_strided_notrans)
+{
+	check_strided_solve('N', 16, 3, 50);
+	check_strided_solve('N', 11, 1, 9);
+}
+
+CTEST(batch, dgetrs_strided_trans)
+{
+	check_strided_solve('T', 32, 2, 20);
+	check_strided_solve('T', 70, 2, 2);
+}
+
+/* both triangles in two groups, compared with SPOTRF matrix by matrix */
+CTEST(batch, spotrf_groups)
+{
+	char uplo[2] = {'U', 'L'};
+	blasint n[2] = {16, 23}, lda[2] = {17, 23}, size[2] = {2, 2}, count = 2;
+	blasint g, i, j, k, p, info[4], info0;
+	float *a[4], *a0[4];
+	double tmp[24 * 24];
+
+	memset(tmp, 0, sizeof(tmp));
+
+	for (g = 0, p = 0; g < count; g++)
+		for (k = 0; k < size[g]; k++, p++) {
+			a[p]  = (float *)malloc(sizeof(float) * lda[g] * n[g]);
+			a0[p] = (float *)malloc(sizeof(float) * lda[g] * n[g]);
+			fill_spd(tmp, n[g], lda[g], 7u + p);
+			for (j = 0; j < n[g]; j++)
+				for (i = 0; i < lda[g]; i++)
+					a[p][i + j * lda[g]] = a0[p][i + j * lda[g]] = (float)tmp[i + j * lda[g]];
+		}
+
+	BLASFUNC(spotrf_batch)(uplo, n, a, lda, &count, size, info);
+
+	for (g = 0, p = 0; g < count; g++)
+		for (k = 0; k < size[g]; k++, p++) {
+			BLASFUNC(spotrf)(&uplo[g], &n[g], a0[p], &lda[g], &info0);
+			ASSERT_EQUAL(0, info0);
+			ASSERT_EQUAL(0, info[p]);
+			for (j = 0; j < n[g]; j++)
+				for (i = 0; i < n[g]; i++) {
+					if ((uplo[g] == 'U') ? i > j : i < j) continue;
+					ASSERT_DBL_NEAR_TOL(a0[p][i + j * lda[g]], a[p][i + j * lda[g]], 1e-4);
+				}
+			free(a[p]);
+			free(a0[p]);
+		}
+}
+
+CTEST(batch, dpotrf_strided_not_positive_definite)
+{
+	char uplo = 'L';
+	blasint n = 8, lda = 8, stride_a = 64, batch = 3, info[3];
+	double a[3 * 64];
+
+	fill_spd(a,       n, lda, 41u);
+	fill_spd(a + 64,  n, lda, 43u);
+	fill_spd(a + 128, n, lda, 47u);
+	a[64 + 5 + 5 * lda] = -100.0;
+
+	BLASFUNC(dpotrf_batch_strided)(&uplo, &n, a, &lda, &stride_a, &batch, info);
+
+	ASSERT_EQUAL(0, info[0]);
+	ASSERT_EQUAL(6, info[1]);
+	ASSERT_EQUAL(0, info[2]);
+}
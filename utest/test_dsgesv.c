@@ -0,0 +1,192 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "openblas_utest.h"
+
+static double fill_value(unsigned int *seed)
+{
+	*seed = *seed * 1103515245u + 12345u;
+	return (double)((*seed >> 8) & 0xffff) / 32768.0 - 1.0;
+}
+
+/* max |B - A * X| / (|A| |X|), columnwise infinity norms */
+static double backward_error(blasint n, blasint nrhs, double *a, blasint lda,
+			     double *b, blasint ldb, double *x, blasint ldx)
+{
+	blasint i, j, l;
+	double r, rmax, xmax, anrm = 0.0, err = 0.0;
+
+	for (i = 0; i < n; i++) {
+		r = 0.0;
+		for (l = 0; l < n; l++) r += fabs(a[i + l * lda]);
+		anrm = MAX(anrm, r);
+	}
+
+	for (j = 0; j < nrhs; j++) {
+		rmax = xmax = 0.0;
+		for (i = 0; i < n; i++) {
+			r = b[i + j * ldb];
+			for (l = 0; l < n; l++) r -= a[i + l * lda] * x[l + j * ldx];
+			rmax = MAX(rmax, fabs(r));
+			xmax = MAX(xmax, fabs(x[i + j * ldx]));
+		}
+		err = MAX(err, rmax / (anrm * xmax));
+	}
+
+	return err;
+}
+
+/* solve a diagonally dominant system, returning the backward error and ITER */
+static double check_dsgesv(blasint n, blasint nrhs, int bf16, blasint *iter)
+{
+	blasint lda = n + 3, ldb = n + 1, ldx = n + 2, info, i;
+	unsigned int seed = 11u + n;
+	double *a  = (double *)malloc(sizeof(double) * lda * n);
+	double *a0 = (double *)malloc(sizeof(double) * lda * n);
+	double *b  = (double *)malloc(sizeof(double) * ldb * nrhs);
+	double *x  = (double *)malloc(sizeof(double) * ldx * nrhs);
+	double *work  = (double *)malloc(sizeof(double) * n * MAX(1, nrhs));
+	float  *swork = (float  *)malloc(sizeof(float) * n * (n + nrhs));
+	blasint *ipiv = (blasint *)malloc(sizeof(blasint) * n);
+	double err;
+
+	for (i = 0; i < lda * n; i++) a[i] = a0[i] = fill_value(&seed);
+	for (i = 0; i < n; i++) a[i + i * lda] = a0[i + i * lda] += n;
+	for (i = 0; i < ldb * nrhs; i++) b[i] = fill_value(&seed);
+
+#ifdef BUILD_BFLOAT16
+	if (bf16)
+		BLASFUNC(dsbgesv)(&n, &nrhs, a, &lda, ipiv, b, &ldb, x, &ldx, work, swork, iter, &info);
+	else
+#endif
+		BLASFUNC(dsgesv)(&n, &nrhs, a, &lda, ipiv, b, &ldb, x, &ldx, work, swork, iter, &info);
+
+	err = (info == 0) ? backward_error(n, nrhs, a0, lda, b, ldb, x, ldx) : 1.0;
+
+	free(a); free(a0); free(b); free(x); free(work); free(swork); free(ipiv);
+	return err;
+}
+
+CTEST(dsgesv, refined_multiple_rhs)
+{
+	blasint iter;
+
+	ASSERT_DBL_NEAR_TOL(0.0, check_dsgesv(300, 3, 0, &iter), 1e-14);
+	ASSERT_TRUE(iter >= 0);
+}
+
+CTEST(dsgesv, refined_single_rhs)
+{
+	blasint iter;
+
+	ASSERT_DBL_NEAR_TOL(0.0, check_dsgesv(157, 1, 0, &iter), 1e-14);
+	ASSERT_TRUE(iter >= 0);
+}
+
+#ifdef BUILD_BFLOAT16
+CTEST(dsgesv, dsbgesv_refined)
+{
+	blasint iter;
+
+	ASSERT_DBL_NEAR_TOL(0.0, check_dsgesv(400, 2, 1, &iter), 1e-14);
+	ASSERT_TRUE(iter >= 0);
+}
+#endif
+
+/* a Hilbert matrix defeats single precision, the solve falls back to dgetrf */
+CTEST(dsgesv, fallback_ill_conditioned)
+{
+	blasint n = 12, nrhs = 1, lda = 12, info, iter, i, j;
+	double a[144], a0[144], b[12], x[12], work[12];
+	float swork[12 * 13];
+	blasint ipiv[12];
+
+	for (j = 0; j < n; j++) {
+		for (i = 0; i < n; i++) a[i + j * lda] = a0[i + j * lda] = 1.0 / (i + j + 1);
+		b[j] = 1.0;
+	}
+
+	BLASFUNC(dsgesv)(&n, &nrhs, a, &lda, ipiv, b, &lda, x, &lda, work, swork, &iter, &info);
+	ASSERT_EQUAL(0, info);
+	ASSERT_TRUE(iter < 0);
+	ASSERT_DBL_NEAR_TOL(0.0, backward_error(n, nrhs, a0, lda, b, lda, x, lda), 1e-14);
+}
+
+static double check_dsposv(char uplo, blasint n, blasint nrhs, blasint *iter)
+{
+	blasint lda = n + 1, info, i, j;
+	unsigned int seed = 5u + n;
+	double *a  = (double *)malloc(sizeof(double) * lda * n);
+	double *a0 = (double *)malloc(sizeof(double) * lda * n);
+	double *b  = (double *)malloc(sizeof(double) * n * nrhs);
+	double *x  = (double *)malloc(sizeof(double) * n * nrhs);
+	double *work  = (double *)malloc(sizeof(double) * n * nrhs);
+	float  *swork = (float  *)malloc(sizeof(float) * n * (n + nrhs));
+	double err;
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i <= j; i++)
+			a0[i + j * lda] = a0[j + i * lda] = fill_value(&seed);
+	for (i = 0; i < n; i++) a0[i + i * lda] += n;
+	for (i = 0; i < lda * n; i++) a[i] = a0[i];
+	for (i = 0; i < n * nrhs; i++) b[i] = fill_value(&seed);
+
+	/* the other triangle must not be referenced */
+	for (j = 0; j < n; j++)
+		for (i = 0; i < n; i++)
+			if ((uplo == 'U') ? (i > j) : (i < j)) a[i + j * lda] = 1e300;
+
+	BLASFUNC(dsposv)(&uplo, &n, &nrhs, a, &lda, b, &n, x, &n, work, swork, iter, &info);
+
+	err = (info == 0) ? backward_error(n, nrhs, a0, lda, b, n, x, n) : 1.0;
+
+	free(a); free(a0); free(b); free(x); free(work); free(swork);
+	return err;
+}
+
+CTEST(dsgesv, dsposv_upper)
+{
+	blasint iter;
+
+	ASSERT_DBL_NEAR_TOL(0.0, check_dsposv('U', 250, 2, &iter), 1e-14);
+	ASSERT_TRUE(iter >= 0);
+}
+
+CTEST(dsgesv, dsposv_lower_single_rhs)
+{
+	blasint iter;
+
+	ASSERT_DBL_NEAR_TOL(0.0, check_dsposv('L', 131, 1, &iter), 1e-14);
+	ASSERT_TRUE(iter >= 0);
+}
@@ -34,7 +34,7 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "utest/openblas_utest.h"
 #include "common.h"
 
-#define DATASIZE 100
+#define DATASIZE 300
 
 struct DATA_CIMATCOPY {
     float a_test[DATASIZE * DATASIZE * 2];
@@ -505,6 +505,78 @@ CTEST(cimatcopy, rowmajor_conjtrans_col_50_row_100)
 }
 
 #ifndef NO_CBLAS
+/**
+ * Fortran API specific test
+ * Test cimatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Column Major
+ * Transposition and conjugate
+ * Rectangular matrix with padded leading dimensions,
+ * large enough to run multithreaded
+ * alpha_r = 2.0, alpha_i = 1.0
+ */
+CTEST(cimatcopy, colmajor_conjtrans_col_240_row_300)
+{
+    blasint m = 300, n = 240;
+    blasint lda_src = 300, lda_dst = 250;
+    char order = 'C';
+    char trans = 'C';
+    float alpha[] = {2.0f, 1.0f};
+
+    float norm = check_cimatcopy('F', order, trans, m, n, alpha, lda_src, lda_dst);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_EPS);
+}
+
+/**
+ * Fortran API specific test
+ * Test cimatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Row Major
+ * Transposition
+ * Rectangular matrix with coprime dimensions,
+ * large enough to run multithreaded
+ * alpha_r = 1.0, alpha_i = -2.0
+ */
+CTEST(cimatcopy, rowmajor_trans_col_263_row_257)
+{
+    blasint m = 257, n = 263;
+    blasint lda_src = 263, lda_dst = 257;
+    char order = 'R';
+    char trans = 'T';
+    float alpha[] = {1.0f, -2.0f};
+
+    float norm = check_cimatcopy('F', order, trans, m, n, alpha, lda_src, lda_dst);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_EPS);
+}
+
+/**
+ * Fortran API specific test
+ * Test cimatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Column Major
+ * Copy and conjugate
+ * Square matrix with ldb < lda,
+ * large enough to run multithreaded
+ * alpha_r = 1.0, alpha_i = 2.0
+ */
+CTEST(cimatcopy, colmajor_conj_col_260_row_260)
+{
+    blasint m = 260, n = 260;
+    blasint lda_src = 270, lda_dst = 260;
+    char order = 'C';
+    char trans = 'R';
+    float alpha[] = {1.0f, 2.0f};
+
+    float norm = check_cimatcopy('F', order, trans, m, n, alpha, lda_src, lda_dst);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_EPS);
+}
+
 /**
  * C API specific test
  * Test cimatcopy by comparing it against reference
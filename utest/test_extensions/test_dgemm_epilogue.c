@@ -0,0 +1,254 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <math.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#if defined(BUILD_DOUBLE) && !defined(NO_CBLAS)
+
+/**
+ * Reference for cblas_dgemm_epilogue: cblas_dgemm followed by a separate
+ * pass over C that adds the bias, applies the activation and clamps.
+ */
+static void dgemm_epilogue_trusted(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE transa,
+                                   enum CBLAS_TRANSPOSE transb, blasint m, blasint n, blasint k,
+                                   double alpha, double *a, blasint lda, double *b, blasint ldb,
+                                   double beta, double *c, blasint ldc,
+                                   const openblas_gemm_epilogue *epi)
+{
+    blasint i, j;
+    const double *bias = (const double *)epi->bias;
+
+    cblas_dgemm(order, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+
+    for (i = 0; i < m; i++) {
+        for (j = 0; j < n; j++) {
+            double *x = (order == CblasColMajor) ? &c[i + j * ldc] : &c[i * ldc + j];
+
+            if (epi->bias_type == CblasRowBias) *x += bias[i];
+            if (epi->bias_type == CblasColBias) *x += bias[j];
+
+            if (epi->activation == CblasReLU && *x < 0.0) *x = 0.0;
+            if (epi->activation == CblasGELU)
+                *x = 0.5 * *x * (1.0 + erf(*x * 0.70710678118654752440));
+            if (epi->activation == CblasGELUTanh)
+                *x = 0.5 * *x * (1.0 + tanh(0.79788456080286535588 * (*x + 0.044715 * *x * *x * *x)));
+
+            if (epi->clamp) {
+                if (*x < epi->clamp_min) *x = epi->clamp_min;
+                if (*x > epi->clamp_max) *x = epi->clamp_max;
+            }
+        }
+    }
+}
+
+/**
+ * Compare cblas_dgemm_epilogue against dgemm_epilogue_trusted
+ *
+ * param nthreads - number of threads for the call (the result must not depend on it)
+ * return largest difference relative to the size of the entry
+ */
+static double check_dgemm_epilogue(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE transa,
+                                   enum CBLAS_TRANSPOSE transb, blasint m, blasint n, blasint k,
+                                   double beta, enum CBLAS_BIAS bias_type,
+                                   enum CBLAS_ACTIVATION activation, int clamp, int nthreads)
+{
+    blasint i, rows_c = (order == CblasColMajor) ? n : m;
+    blasint lda, ldb, ldc, a_rows, b_rows;
+    double alpha = 1.5, d = 0.0;
+    double *a, *b, *c, *c_verify, *bias;
+    openblas_gemm_epilogue epi;
+    int nthreads_old = openblas_get_num_threads();
+
+    /* leading dimension and number of lines of op(A) = m x k and op(B) = k x n */
+    if ((order == CblasColMajor) == (transa == CblasNoTrans)) {
+        lda = m + 1; a_rows = k;
+    } else {
+        lda = k + 1; a_rows = m;
+    }
+    if ((order == CblasColMajor) == (transb == CblasNoTrans)) {
+        ldb = k + 2; b_rows = n;
+    } else {
+        ldb = n + 2; b_rows = k;
+    }
+    ldc = ((order == CblasColMajor) ? m : n) + 3;
+
+    a = (double *)malloc(sizeof(double) * lda * a_rows);
+    b = (double *)malloc(sizeof(double) * ldb * b_rows);
+    c = (double *)malloc(sizeof(double) * ldc * rows_c);
+    c_verify = (double *)malloc(sizeof(double) * ldc * rows_c);
+    bias = (double *)malloc(sizeof(double) * (m + n));
+
+    drand_generate(a, lda * a_rows);
+    drand_generate(b, ldb * b_rows);
+    drand_generate(c, ldc * rows_c);
+    drand_generate(bias, m + n);
+    for (i = 0; i < ldc * rows_c; i++) c_verify[i] = c[i];
+
+    epi.bias_type  = bias_type;
+    epi.bias       = bias;
+    epi.activation = activation;
+    epi.clamp      = clamp;
+    epi.clamp_min  = -0.5;
+    epi.clamp_max  = 2.0;
+
+    dgemm_epilogue_trusted(order, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                           beta, c_verify, ldc, &epi);
+
+    openblas_set_num_threads(nthreads);
+    cblas_dgemm_epilogue(order, transa, transb, m, n, k, alpha, a, lda, b, ldb,
+                         beta, c, ldc, &epi);
+    openblas_set_num_threads(nthreads_old);
+
+    for (i = 0; i < ldc * rows_c; i++)
+        d = MAX(d, fabs(c[i] - c_verify[i]) / (1.0 + fabs(c_verify[i])));
+
+    free(a);
+    free(b);
+    free(c);
+    free(c_verify);
+    free(bias);
+
+    return d;
+}
+
+/**
+ * Check if error function was called with expected function name
+ * and param info
+ */
+static int check_badargs(blasint m, blasint n, blasint k, blasint ldc,
+                         openblas_gemm_epilogue *epi, int expected_info)
+{
+    double a[4 * 4], b[4 * 4], c[4 * 4];
+
+    set_xerbla("DGEMM_EPILOGUE ", expected_info);
+
+    cblas_dgemm_epilogue(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                         1.0, a, 4, b, 4, 0.0, c, ldc, epi);
+
+    return check_error();
+}
+
+CTEST(dgemm_epilogue, c_api_colmajor_row_bias_relu)
+{
+    double d = check_dgemm_epilogue(CblasColMajor, CblasNoTrans, CblasNoTrans, 50, 40, 30,
+                                    0.5, CblasRowBias, CblasReLU, 0, 1);
+
+    ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS);
+}
+
+CTEST(dgemm_epilogue, c_api_colmajor_col_bias_gelu_clamp)
+{
+    double d = check_dgemm_epilogue(CblasColMajor, CblasTrans, CblasNoTrans, 70, 33, 64,
+                                    0.0, CblasColBias, CblasGELU, 1, 1);
+
+    ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS);
+}
+
+CTEST(dgemm_epilogue, c_api_rowmajor_row_bias_gelu_tanh)
+{
+    double d = check_dgemm_epilogue(CblasRowMajor, CblasNoTrans, CblasTrans, 45, 61, 20,
+                                    1.0, CblasRowBias, CblasGELUTanh, 0, 1);
+
+    ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS);
+}
+
+CTEST(dgemm_epilogue, c_api_rowmajor_col_bias_clamp)
+{
+    double d = check_dgemm_epilogue(CblasRowMajor, CblasTrans, CblasTrans, 31, 57, 42,
+                                    -1.0, CblasColBias, CblasNoActivation, 1, 1);
+
+    ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS);
+}
+
+/**
+ * Large enough for the threaded driver and for several blocks of K,
+ * so that the epilogue must only be applied after the last one
+ */
+CTEST(dgemm_epilogue, c_api_threaded_deep_k)
+{
+    double d = check_dgemm_epilogue(CblasColMajor, CblasNoTrans, CblasTrans, 517, 433, 900,
+                                    0.5, CblasRowBias, CblasReLU, 1, 4);
+
+    ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS * 10);
+
+    d = check_dgemm_epilogue(CblasRowMajor, CblasTrans, CblasNoTrans, 301, 389, 700,
+                             0.0, CblasColBias, CblasGELU, 0, 4);
+
+    ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS * 10);
+}
+
+/**
+ * With K = 0 only beta * C + bias is left to go through the epilogue
+ */
+CTEST(dgemm_epilogue, c_api_k_zero)
+{
+    double d = check_dgemm_epilogue(CblasColMajor, CblasNoTrans, CblasNoTrans, 40, 30, 0,
+                                    0.5, CblasColBias, CblasReLU, 1, 1);
+
+    ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS);
+}
+
+CTEST(dgemm_epilogue, xerbla_invalid_activation)
+{
+    openblas_gemm_epilogue epi = { CblasNoBias, NULL, (enum CBLAS_ACTIVATION)7, 0, 0.0, 0.0 };
+    int passed = check_badargs(4, 4, 4, 4, &epi, 14);
+
+    ASSERT_EQUAL(TRUE, passed);
+}
+
+CTEST(dgemm_epilogue, xerbla_bias_null)
+{
+    openblas_gemm_epilogue epi = { CblasRowBias, NULL, CblasNoActivation, 0, 0.0, 0.0 };
+    int passed = check_badargs(4, 4, 4, 4, &epi, 14);
+
+    ASSERT_EQUAL(TRUE, passed);
+}
+
+CTEST(dgemm_epilogue, xerbla_clamp_range_invalid)
+{
+    openblas_gemm_epilogue epi = { CblasNoBias, NULL, CblasNoActivation, 1, 1.0, -1.0 };
+    int passed = check_badargs(4, 4, 4, 4, &epi, 14);
+
+    ASSERT_EQUAL(TRUE, passed);
+}
+
+CTEST(dgemm_epilogue, xerbla_ldc_invalid)
+{
+    openblas_gemm_epilogue epi = { CblasRowBias, NULL, CblasNoActivation, 0, 0.0, 0.0 };
+    int passed = check_badargs(4, 4, 4, 3, &epi, 13);
+
+    ASSERT_EQUAL(TRUE, passed);
+}
+#endif
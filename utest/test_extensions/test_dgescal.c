@@ -0,0 +1,196 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#define N 100
+#define M 100
+
+struct DATA_DGESCAL{
+    double a_test[M * N];
+    double a_verify[M * N];
+};
+
+#ifdef BUILD_DOUBLE
+static struct DATA_DGESCAL data_dgescal;
+
+/**
+ * Test dgescal by comparing it against reference
+ *
+ * param api - specifies Fortran or C API
+ * param order - specifies whether A is stored in
+ * row-major order or column-major order
+ * param m - number of rows of A
+ * param n - number of columns of A
+ * param alpha - scaling factor for matrix A
+ * param lda - leading dimension of A
+ * return norm of differences
+ */
+static double check_dgescal(char api, OPENBLAS_CONST enum CBLAS_ORDER order,
+                            blasint m, blasint n, double alpha, blasint lda)
+{
+    blasint cols = m, rows = n;
+
+    if (order == CblasRowMajor)
+    {
+        rows = m;
+        cols = n;
+    }
+
+    drand_generate(data_dgescal.a_test, lda * rows);
+
+    // Elements outside of the m x n submatrix must be left alone
+    dcopy(rows, lda, 1.0, data_dgescal.a_test, lda, data_dgescal.a_verify, lda);
+    dcopy(rows, cols, alpha, data_dgescal.a_test, lda, data_dgescal.a_verify, lda);
+
+    if (api == 'F')
+        BLASFUNC(dgescal)(&m, &n, &alpha, data_dgescal.a_test, &lda);
+#ifndef NO_CBLAS
+    else
+        cblas_dgescal(order, m, n, alpha, data_dgescal.a_test, lda);
+#endif
+
+    return dmatrix_difference(data_dgescal.a_test, data_dgescal.a_verify, lda, rows, lda);
+}
+
+/**
+ * Check if error function was called with expected function name
+ * and param info
+ *
+ * param m - number of rows of A
+ * param n - number of columns of A
+ * param lda - leading dimension of A
+ * param expected_info - expected invalid parameter number in dgescal
+ * return TRUE if everything is ok, otherwise FALSE
+ */
+static int check_badargs(blasint m, blasint n, blasint lda, int expected_info)
+{
+    double alpha = 2.0;
+
+    set_xerbla("DGESCAL", expected_info);
+
+    BLASFUNC(dgescal)(&m, &n, &alpha, data_dgescal.a_test, &lda);
+
+    return check_error();
+}
+
+/**
+ * Fortran API specific test
+ * Test dgescal by comparing it against reference
+ * with the following options:
+ *
+ * For A number of rows is 100, number of colums is 100
+ */
+CTEST(dgescal, matrix_n_100_m_100)
+{
+    double norm = check_dgescal('F', CblasColMajor, M, N, 3.0, M);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
+}
+
+/**
+ * Fortran API specific test
+ * Test dgescal by comparing it against reference
+ * with the following options:
+ *
+ * For A number of rows is 50, number of colums is 70, lda is 100
+ */
+CTEST(dgescal, submatrix_n_70_m_50)
+{
+    double norm = check_dgescal('F', CblasColMajor, 50, 70, -1.5, M);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
+}
+
+/**
+ * Fortran API specific test
+ * Test dgescal by comparing it against reference
+ * with the following options:
+ *
+ * For A number of rows is 50, number of colums is 70, lda is 100
+ * Scalar alpha is zero (A is cleared)
+ */
+CTEST(dgescal, submatrix_n_70_m_50_alpha_zero)
+{
+    double norm = check_dgescal('F', CblasColMajor, 50, 70, 0.0, M);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
+}
+
+#ifndef NO_CBLAS
+/**
+ * C API specific test
+ * Test dgescal by comparing it against reference
+ * with the following options:
+ *
+ * Row Major, number of rows is 30, number of colums is 80, lda is 100
+ */
+CTEST(dgescal, c_api_rowmajor_submatrix_n_80_m_30)
+{
+    double norm = check_dgescal('C', CblasRowMajor, 30, 80, 0.5, N);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
+}
+#endif
+
+/**
+ * Test error function for an invalid param lda.
+ * Must be at least max(1, m).
+ */
+CTEST(dgescal, xerbla_lda_invalid)
+{
+    int passed = check_badargs(M, N, M - 1, 5);
+    ASSERT_EQUAL(TRUE, passed);
+}
+
+/**
+ * Test error function for an invalid param n.
+ * Must be at least zero.
+ */
+CTEST(dgescal, xerbla_n_invalid)
+{
+    int passed = check_badargs(M, -1, M, 2);
+    ASSERT_EQUAL(TRUE, passed);
+}
+
+/**
+ * Test error function for an invalid param m.
+ * Must be at least zero.
+ */
+CTEST(dgescal, xerbla_m_invalid)
+{
+    int passed = check_badargs(-1, N, M, 1);
+    ASSERT_EQUAL(TRUE, passed);
+}
+#endif
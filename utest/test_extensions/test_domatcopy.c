@@ -34,7 +34,7 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "utest/openblas_utest.h"
 #include "common.h"
 
-#define DATASIZE 100
+#define DATASIZE 300
 
 struct DATA_DOMATCOPY {
     double a_test[DATASIZE * DATASIZE];
@@ -391,6 +391,30 @@ CTEST(domatcopy, rowmajor_trans_col_27_row_27)
     ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
 }
 
+/**
+ * Fortran API specific test
+ * Test domatcopy by comparing it against refernce
+ * with the following options:
+ *
+ * Column Major
+ * Transposition
+ * Matrix dimensions leave residues from 8 and 4 (specialize
+ * for ct case)
+ * alpha = 1.5
+ */
+CTEST(domatcopy, colmajor_trans_col_37_row_45)
+{
+    blasint m = 45, n = 37;
+    blasint lda = 50, ldb = 40;
+    char order = 'C';
+    char trans = 'T'; 
+    double alpha = 1.5;
+
+    double norm = check_domatcopy('F', order, trans, m, n, alpha, lda, ldb);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
+}
+
 /**
  * Fortran API specific test
  * Test domatcopy by comparing it against refernce
@@ -415,6 +439,78 @@ CTEST(domatcopy, rowmajor_notrans_col_100_row_50)
 }
 
 #ifndef NO_CBLAS
+/**
+ * Fortran API specific test
+ * Test domatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Column Major
+ * Transposition
+ * Rectangular matrix with padded leading dimensions,
+ * large enough to run multithreaded
+ * alpha = 2.0
+ */
+CTEST(domatcopy, colmajor_trans_col_240_row_300)
+{
+    blasint m = 300, n = 240;
+    blasint lda = 300, ldb = 250;
+    char order = 'C';
+    char trans = 'T';
+    double alpha = 2.0;
+
+    double norm = check_domatcopy('F', order, trans, m, n, alpha, lda, ldb);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
+}
+
+/**
+ * Fortran API specific test
+ * Test domatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Row Major
+ * Transposition
+ * Rectangular matrix with padded leading dimensions,
+ * large enough to run multithreaded
+ * alpha = -1.5
+ */
+CTEST(domatcopy, rowmajor_trans_col_300_row_240)
+{
+    blasint m = 240, n = 300;
+    blasint lda = 300, ldb = 250;
+    char order = 'R';
+    char trans = 'T';
+    double alpha = -1.5;
+
+    double norm = check_domatcopy('F', order, trans, m, n, alpha, lda, ldb);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
+}
+
+/**
+ * Fortran API specific test
+ * Test domatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Column Major
+ * Copy only
+ * Square matrix with padded leading dimensions,
+ * large enough to run multithreaded
+ * alpha = 3.0
+ */
+CTEST(domatcopy, colmajor_notrans_col_260_row_260)
+{
+    blasint m = 260, n = 260;
+    blasint lda = 270, ldb = 280;
+    char order = 'C';
+    char trans = 'N';
+    double alpha = 3.0;
+
+    double norm = check_domatcopy('F', order, trans, m, n, alpha, lda, ldb);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
+}
+
 /**
  * C API specific test
  * Test domatcopy by comparing it against refernce
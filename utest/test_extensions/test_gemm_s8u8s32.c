@@ -0,0 +1,288 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+#include <math.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#if defined(BUILD_SINGLE) && !defined(NO_CBLAS)
+
+/**
+ * Reference for cblas_gemm_s8u8s32: the products are accumulated exactly
+ * in 64 bit integers, scaled in double and rounded and saturated the same
+ * way as the library, so both results must agree bit for bit.
+ */
+static void gemm_s8u8s32_trusted(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE transa,
+                                 enum CBLAS_TRANSPOSE transb, enum CBLAS_OFFSET offsetc,
+                                 blasint m, blasint n, blasint k, float alpha,
+                                 int8_t *a, blasint lda, int ao, uint8_t *b, blasint ldb, int bo,
+                                 float beta, int *c, blasint ldc, int *co)
+{
+    blasint i, j, l;
+    int col_a = ((order == CblasColMajor) == (transa == CblasNoTrans));
+    int col_b = ((order == CblasColMajor) == (transb == CblasNoTrans));
+
+    for (i = 0; i < m; i++) {
+        for (j = 0; j < n; j++) {
+            int *x = (order == CblasColMajor) ? &c[i + j * ldc] : &c[i * ldc + j];
+            long long acc = 0;
+            double t;
+
+            for (l = 0; l < k; l++) {
+                int ail = col_a ? a[i + l * lda] : a[i * lda + l];
+                int blj = col_b ? b[l + j * ldb] : b[l * ldb + j];
+
+                acc += (long long)(ail + ao) * (blj + bo);
+            }
+
+            t = (double)alpha * (double)acc;
+            if (beta != 0.0) t += (double)beta * (double)*x;
+            if (co != NULL) {
+                if (offsetc == CblasFixOffset) t += co[0];
+                if (offsetc == CblasColOffset) t += co[i];
+                if (offsetc == CblasRowOffset) t += co[j];
+            }
+
+            t = floor(t + 0.5);
+            if (t >  2147483647.) t =  2147483647.;
+            if (t < -2147483648.) t = -2147483648.;
+            *x = (int)t;
+        }
+    }
+}
+
+/**
+ * Compare cblas_gemm_s8u8s32 against gemm_s8u8s32_trusted
+ *
+ * param a_val, b_val - fill A and B with this value instead of random data if not 0
+ * param nthreads - number of threads for the call
+ * return number of entries of C that differ
+ */
+static int check_gemm_s8u8s32(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE transa,
+                              enum CBLAS_TRANSPOSE transb, enum CBLAS_OFFSET offsetc,
+                              blasint m, blasint n, blasint k, float alpha, int ao, int bo,
+                              float beta, int a_val, int b_val, int nthreads)
+{
+    blasint i, rows_c = (order == CblasColMajor) ? n : m;
+    blasint lda, ldb, ldc, a_rows, b_rows;
+    int8_t *a;
+    uint8_t *b;
+    int *c, *c_verify, *co;
+    int nthreads_old = openblas_get_num_threads();
+    int diff = 0;
+
+    if ((order == CblasColMajor) == (transa == CblasNoTrans)) {
+        lda = m + 1; a_rows = k;
+    } else {
+        lda = k + 1; a_rows = m;
+    }
+    if ((order == CblasColMajor) == (transb == CblasNoTrans)) {
+        ldb = k + 2; b_rows = n;
+    } else {
+        ldb = n + 2; b_rows = k;
+    }
+    ldc = ((order == CblasColMajor) ? m : n) + 3;
+
+    a = (int8_t *)malloc(sizeof(int8_t) * lda * MAX(a_rows, 1));
+    b = (uint8_t *)malloc(sizeof(uint8_t) * ldb * MAX(b_rows, 1));
+    c = (int *)malloc(sizeof(int) * ldc * rows_c);
+    c_verify = (int *)malloc(sizeof(int) * ldc * rows_c);
+    co = (int *)malloc(sizeof(int) * (m + n));
+
+    for (i = 0; i < lda * a_rows; i++) a[i] = a_val ? a_val : (int8_t)(rand() % 256 - 128);
+    for (i = 0; i < ldb * b_rows; i++) b[i] = b_val ? b_val : (uint8_t)(rand() % 256);
+    for (i = 0; i < ldc * rows_c; i++) c[i] = c_verify[i] = rand() % 20001 - 10000;
+    for (i = 0; i < m + n; i++) co[i] = rand() % 2001 - 1000;
+
+    gemm_s8u8s32_trusted(order, transa, transb, offsetc, m, n, k, alpha, a, lda, ao,
+                         b, ldb, bo, beta, c_verify, ldc, co);
+
+    openblas_set_num_threads(nthreads);
+    cblas_gemm_s8u8s32(order, transa, transb, offsetc, m, n, k, alpha, a, lda, ao,
+                       b, ldb, bo, beta, c, ldc, co);
+    openblas_set_num_threads(nthreads_old);
+
+    for (i = 0; i < ldc * rows_c; i++)
+        if (c[i] != c_verify[i]) diff++;
+
+    free(a);
+    free(b);
+    free(c);
+    free(c_verify);
+    free(co);
+
+    return diff;
+}
+
+/**
+ * Check if error function was called with expected function name
+ * and param info
+ */
+static int check_badargs(enum CBLAS_OFFSET offsetc, blasint m, blasint n, blasint k,
+                         blasint lda, blasint ldc, int expected_info)
+{
+    int8_t a[4 * 4];
+    uint8_t b[4 * 4];
+    int c[4 * 4], co[4];
+
+    set_xerbla("GEMM_S8U8S32 ", expected_info);
+
+    cblas_gemm_s8u8s32(CblasColMajor, CblasNoTrans, CblasNoTrans, offsetc, m, n, k,
+                       1.0, a, lda, 0, b, 4, 0, 0.0, c, ldc, co);
+
+    return check_error();
+}
+
+CTEST(gemm_s8u8s32, c_api_colmajor_nn_fix_offset)
+{
+    int d = check_gemm_s8u8s32(CblasColMajor, CblasNoTrans, CblasNoTrans, CblasFixOffset,
+                               37, 29, 43, 1.0, 0, 0, 0.0, 0, 0, 1);
+
+    ASSERT_EQUAL(0, d);
+}
+
+CTEST(gemm_s8u8s32, c_api_colmajor_tn_col_offset)
+{
+    int d = check_gemm_s8u8s32(CblasColMajor, CblasTrans, CblasNoTrans, CblasColOffset,
+                               70, 33, 64, 0.75, -3, 5, 0.5, 0, 0, 1);
+
+    ASSERT_EQUAL(0, d);
+}
+
+CTEST(gemm_s8u8s32, c_api_colmajor_nt_row_offset)
+{
+    int d = check_gemm_s8u8s32(CblasColMajor, CblasNoTrans, CblasTrans, CblasRowOffset,
+                               45, 61, 21, 1.5, 7, -128, 1.0, 0, 0, 1);
+
+    ASSERT_EQUAL(0, d);
+}
+
+CTEST(gemm_s8u8s32, c_api_colmajor_tt_fix_offset)
+{
+    int d = check_gemm_s8u8s32(CblasColMajor, CblasTrans, CblasTrans, CblasFixOffset,
+                               31, 57, 42, -0.5, 2, 1, -1.0, 0, 0, 1);
+
+    ASSERT_EQUAL(0, d);
+}
+
+CTEST(gemm_s8u8s32, c_api_rowmajor_nn_row_offset)
+{
+    int d = check_gemm_s8u8s32(CblasRowMajor, CblasNoTrans, CblasNoTrans, CblasRowOffset,
+                               50, 40, 30, 1.0, -1, 3, 0.5, 0, 0, 1);
+
+    ASSERT_EQUAL(0, d);
+}
+
+CTEST(gemm_s8u8s32, c_api_rowmajor_tt_col_offset)
+{
+    int d = check_gemm_s8u8s32(CblasRowMajor, CblasTrans, CblasTrans, CblasColOffset,
+                               19, 23, 77, 0.25, 4, -2, 0.0, 0, 0, 1);
+
+    ASSERT_EQUAL(0, d);
+}
+
+/**
+ * -128 * 255 is the pairwise product that overflows a 16 bit sum, every
+ * kernel has to keep it exact
+ */
+CTEST(gemm_s8u8s32, c_api_extreme_values)
+{
+    int d = check_gemm_s8u8s32(CblasColMajor, CblasNoTrans, CblasNoTrans, CblasFixOffset,
+                               40, 24, 128, 1.0, 0, 0, 0.0, -128, 255, 1);
+
+    ASSERT_EQUAL(0, d);
+}
+
+/**
+ * Large enough for the threaded driver, several blocks of K and M, and
+ * for the column sums of B to be taken across the K blocks
+ */
+CTEST(gemm_s8u8s32, c_api_threaded_deep_k)
+{
+    int d = check_gemm_s8u8s32(CblasColMajor, CblasNoTrans, CblasTrans, CblasColOffset,
+                               517, 433, 1100, 0.5, -5, 9, 0.5, 0, 0, 4);
+
+    ASSERT_EQUAL(0, d);
+
+    d = check_gemm_s8u8s32(CblasRowMajor, CblasTrans, CblasNoTrans, CblasRowOffset,
+                           301, 589, 700, 1.0, 3, -7, 0.0, 0, 0, 4);
+
+    ASSERT_EQUAL(0, d);
+}
+
+/**
+ * Large alpha pushes most of C past the int32 range
+ */
+CTEST(gemm_s8u8s32, c_api_saturate)
+{
+    int d = check_gemm_s8u8s32(CblasColMajor, CblasNoTrans, CblasNoTrans, CblasFixOffset,
+                               20, 20, 50, 1.0e6, 0, 0, 1.0, 0, 0, 1);
+
+    ASSERT_EQUAL(0, d);
+}
+
+/**
+ * With K = 0 or alpha = 0 only beta * C + co is left
+ */
+CTEST(gemm_s8u8s32, c_api_k_zero)
+{
+    int d = check_gemm_s8u8s32(CblasColMajor, CblasNoTrans, CblasNoTrans, CblasColOffset,
+                               40, 30, 0, 1.0, 3, 4, 0.5, 0, 0, 1);
+
+    ASSERT_EQUAL(0, d);
+}
+
+CTEST(gemm_s8u8s32, c_api_alpha_zero)
+{
+    int d = check_gemm_s8u8s32(CblasRowMajor, CblasTrans, CblasNoTrans, CblasRowOffset,
+                               40, 30, 20, 0.0, 3, 4, 1.5, 0, 0, 1);
+
+    ASSERT_EQUAL(0, d);
+}
+
+CTEST(gemm_s8u8s32, xerbla_invalid_offset)
+{
+    int passed = check_badargs((enum CBLAS_OFFSET)7, 4, 4, 4, 4, 4, 3);
+
+    ASSERT_EQUAL(TRUE, passed);
+}
+
+CTEST(gemm_s8u8s32, xerbla_lda_invalid)
+{
+    int passed = check_badargs(CblasFixOffset, 4, 4, 4, 3, 4, 9);
+
+    ASSERT_EQUAL(TRUE, passed);
+}
+
+CTEST(gemm_s8u8s32, xerbla_ldc_invalid)
+{
+    int passed = check_badargs(CblasFixOffset, 4, 4, 4, 4, 3, 16);
+
+    ASSERT_EQUAL(TRUE, passed);
+}
+#endif
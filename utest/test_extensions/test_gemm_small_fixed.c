@@ -0,0 +1,200 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+#include <math.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+/*
+ * Shapes listed in GEMM_SMALL_FIXED_SHAPES go to the specialised small
+ * kernels, the others next to them take the usual path.  Both have to
+ * agree with a plain triple loop for every transpose, storage order
+ * and beta.
+ */
+
+#if !defined(NO_CBLAS) && defined(SMALL_MATRIX_OPT)
+
+static const blasint fixed_shapes[][3] = {
+    { 4,  4,  4}, { 6,  6,  6}, { 8,  8,  8}, {12, 12,  4}, {16, 16, 16}, {24, 24, 24},
+    { 6,  6,  7}, {12, 11,  4}, { 5,  4,  4},
+};
+
+#define NUM_SHAPES (sizeof(fixed_shapes) / sizeof(fixed_shapes[0]))
+
+#ifdef BUILD_DOUBLE
+/**
+ * return largest difference relative to the size of the entry
+ */
+static double check_dgemm_fixed(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE transa,
+                                enum CBLAS_TRANSPOSE transb, blasint m, blasint n, blasint k,
+                                double beta)
+{
+    blasint i, j, l, lda, ldb, ldc, a_rows, b_rows, rows_c;
+    double alpha = 1.5, d = 0.0;
+    double *a, *b, *c, *c_verify;
+    int col_a, col_b;
+
+    col_a = ((order == CblasColMajor) == (transa == CblasNoTrans));
+    col_b = ((order == CblasColMajor) == (transb == CblasNoTrans));
+
+    /* leading dimensions larger than the matrices, so ld is not folded in */
+    if (col_a) { lda = m + 2; a_rows = k; } else { lda = k + 2; a_rows = m; }
+    if (col_b) { ldb = k + 1; b_rows = n; } else { ldb = n + 1; b_rows = k; }
+    if (order == CblasColMajor) { ldc = m + 3; rows_c = n; } else { ldc = n + 3; rows_c = m; }
+
+    a = (double *)malloc(sizeof(double) * lda * a_rows);
+    b = (double *)malloc(sizeof(double) * ldb * b_rows);
+    c = (double *)malloc(sizeof(double) * ldc * rows_c);
+    c_verify = (double *)malloc(sizeof(double) * ldc * rows_c);
+
+    drand_generate(a, lda * a_rows);
+    drand_generate(b, ldb * b_rows);
+    drand_generate(c, ldc * rows_c);
+    for (i = 0; i < ldc * rows_c; i++) c_verify[i] = c[i];
+
+    /* C must not be read when beta is zero */
+    if (beta == 0.0)
+        for (i = 0; i < ldc * rows_c; i++) c[i] = NAN;
+
+    for (i = 0; i < m; i++) {
+        for (j = 0; j < n; j++) {
+            double s = 0.0, *x = (order == CblasColMajor) ? &c_verify[i + j * ldc] : &c_verify[i * ldc + j];
+
+            for (l = 0; l < k; l++)
+                s += (col_a ? a[i + l * lda] : a[i * lda + l]) * (col_b ? b[l + j * ldb] : b[l * ldb + j]);
+
+            *x = (beta == 0.0) ? alpha * s : alpha * s + beta * *x;
+        }
+    }
+
+    cblas_dgemm(order, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+
+    for (i = 0; i < m; i++)
+        for (j = 0; j < n; j++) {
+            blasint idx = (order == CblasColMajor) ? i + j * ldc : i * ldc + j;
+            double e = fabs(c[idx] - c_verify[idx]) / (1.0 + fabs(c_verify[idx]));
+
+            /* a NaN left over from C would not show up in MAX */
+            if (isnan(e)) e = INFINITY;
+            d = MAX(d, e);
+        }
+
+    free(a);
+    free(b);
+    free(c);
+    free(c_verify);
+
+    return d;
+}
+
+CTEST(gemm_small_fixed, dgemm_all_shapes)
+{
+    enum CBLAS_TRANSPOSE trans[2] = {CblasNoTrans, CblasTrans};
+    enum CBLAS_ORDER order[2] = {CblasColMajor, CblasRowMajor};
+    double betas[3] = {0.0, 1.0, -0.5};
+    unsigned int s, ta, tb, o, bt;
+    double d = 0.0;
+
+    for (s = 0; s < NUM_SHAPES; s++)
+        for (o = 0; o < 2; o++)
+            for (ta = 0; ta < 2; ta++)
+                for (tb = 0; tb < 2; tb++)
+                    for (bt = 0; bt < 3; bt++)
+                        d = MAX(d, check_dgemm_fixed(order[o], trans[ta], trans[tb],
+                                                     fixed_shapes[s][0], fixed_shapes[s][1],
+                                                     fixed_shapes[s][2], betas[bt]));
+
+    ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS * 100);
+}
+#endif
+
+#ifdef BUILD_SINGLE
+static float check_sgemm_fixed(enum CBLAS_TRANSPOSE transa, enum CBLAS_TRANSPOSE transb,
+                               blasint m, blasint n, blasint k, float beta)
+{
+    blasint i, j, l, lda, ldb, ldc = m + 1;
+    float alpha = -0.75, d = 0.0;
+    float *a, *b, *c, *c_verify;
+
+    lda = (transa == CblasNoTrans) ? m : k;
+    ldb = (transb == CblasNoTrans) ? k : n;
+
+    a = (float *)malloc(sizeof(float) * m * k);
+    b = (float *)malloc(sizeof(float) * k * n);
+    c = (float *)malloc(sizeof(float) * ldc * n);
+    c_verify = (float *)malloc(sizeof(float) * ldc * n);
+
+    srand_generate(a, m * k);
+    srand_generate(b, k * n);
+    srand_generate(c, ldc * n);
+    for (i = 0; i < ldc * n; i++) c_verify[i] = c[i];
+
+    for (i = 0; i < m; i++) {
+        for (j = 0; j < n; j++) {
+            double s = 0.0;
+
+            for (l = 0; l < k; l++)
+                s += (double)((transa == CblasNoTrans) ? a[i + l * lda] : a[l + i * lda])
+                   * (double)((transb == CblasNoTrans) ? b[l + j * ldb] : b[j + l * ldb]);
+
+            c_verify[i + j * ldc] = alpha * s + beta * c_verify[i + j * ldc];
+        }
+    }
+
+    cblas_sgemm(CblasColMajor, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+
+    for (i = 0; i < ldc * n; i++)
+        d = MAX(d, fabs(c[i] - c_verify[i]) / (1.0 + fabs(c_verify[i])));
+
+    free(a);
+    free(b);
+    free(c);
+    free(c_verify);
+
+    return d;
+}
+
+CTEST(gemm_small_fixed, sgemm_all_shapes)
+{
+    enum CBLAS_TRANSPOSE trans[2] = {CblasNoTrans, CblasTrans};
+    unsigned int s, ta, tb;
+    float d = 0.0;
+
+    for (s = 0; s < NUM_SHAPES; s++)
+        for (ta = 0; ta < 2; ta++)
+            for (tb = 0; tb < 2; tb++) {
+                d = MAX(d, check_sgemm_fixed(trans[ta], trans[tb], fixed_shapes[s][0],
+                                             fixed_shapes[s][1], fixed_shapes[s][2], 0.0));
+                d = MAX(d, check_sgemm_fixed(trans[ta], trans[tb], fixed_shapes[s][0],
+                                             fixed_shapes[s][1], fixed_shapes[s][2], 2.0));
+            }
+
+    ASSERT_DBL_NEAR_TOL(0.0, d, SINGLE_EPS * 10);
+}
+#endif
+#endif
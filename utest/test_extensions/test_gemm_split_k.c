@@ -0,0 +1,213 @@
+/***************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <math.h>
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+/*
+ * With several threads, a small C and a long K the threads split K and
+ * reduce their partial results into C.  The result has to match a plain
+ * triple loop for every transpose and beta, also when K or N do not
+ * divide evenly between the threads.
+ */
+
+#ifndef NO_CBLAS
+
+#define NUM_THREADS_SPLIT 4
+
+#ifdef BUILD_DOUBLE
+/**
+ * return largest difference relative to the size of the entry
+ */
+static double check_dgemm_split_k(enum CBLAS_TRANSPOSE transa, enum CBLAS_TRANSPOSE transb,
+                                  blasint m, blasint n, blasint k, double beta, int nthreads)
+{
+    blasint i, j, l, lda, ldb, ldc = m + 3;
+    double alpha = 1.25, d = 0.0;
+    double *a, *b, *c, *c_verify;
+    int nthreads_old = openblas_get_num_threads();
+
+    lda = (transa == CblasNoTrans) ? m + 1 : k + 1;
+    ldb = (transb == CblasNoTrans) ? k + 2 : n + 2;
+
+    a = (double *)malloc(sizeof(double) * lda * ((transa == CblasNoTrans) ? k : m));
+    b = (double *)malloc(sizeof(double) * ldb * ((transb == CblasNoTrans) ? n : k));
+    c = (double *)malloc(sizeof(double) * ldc * n);
+    c_verify = (double *)malloc(sizeof(double) * ldc * n);
+
+    drand_generate(a, lda * ((transa == CblasNoTrans) ? k : m));
+    drand_generate(b, ldb * ((transb == CblasNoTrans) ? n : k));
+    drand_generate(c, ldc * n);
+    for (i = 0; i < ldc * n; i++) c_verify[i] = c[i];
+
+    /* C must not be read when beta is zero */
+    if (beta == 0.0)
+        for (i = 0; i < ldc * n; i++) c[i] = NAN;
+
+    for (i = 0; i < m; i++) {
+        for (j = 0; j < n; j++) {
+            double s = 0.0;
+
+            for (l = 0; l < k; l++)
+                s += ((transa == CblasNoTrans) ? a[i + l * lda] : a[l + i * lda])
+                   * ((transb == CblasNoTrans) ? b[l + j * ldb] : b[j + l * ldb]);
+
+            c_verify[i + j * ldc] = (beta == 0.0) ? alpha * s : alpha * s + beta * c_verify[i + j * ldc];
+        }
+    }
+
+    openblas_set_num_threads(nthreads);
+    cblas_dgemm(CblasColMajor, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    openblas_set_num_threads(nthreads_old);
+
+    for (j = 0; j < n; j++)
+        for (i = 0; i < m; i++) {
+            double e = fabs(c[i + j * ldc] - c_verify[i + j * ldc]) / (1.0 + fabs(c_verify[i + j * ldc]));
+
+            /* a NaN left over from C would not show up in MAX */
+            if (isnan(e)) e = INFINITY;
+            d = MAX(d, e);
+        }
+
+    /* rows between m and ldc are not part of C and must be left alone */
+    for (j = 0; j < n; j++)
+        for (i = m; i < ldc; i++)
+            if (c[i + j * ldc] != c_verify[i + j * ldc] && !(beta == 0.0 && isnan(c[i + j * ldc])))
+                d = INFINITY;
+
+    free(a);
+    free(b);
+    free(c);
+    free(c_verify);
+
+    return d;
+}
+
+CTEST(gemm_split_k, dgemm_all_trans)
+{
+    enum CBLAS_TRANSPOSE trans[2] = {CblasNoTrans, CblasTrans};
+    double betas[3] = {0.0, 1.0, -0.5};
+    unsigned int ta, tb, bt;
+    double d = 0.0;
+
+    for (ta = 0; ta < 2; ta++)
+        for (tb = 0; tb < 2; tb++)
+            for (bt = 0; bt < 3; bt++)
+                d = MAX(d, check_dgemm_split_k(trans[ta], trans[tb], 40, 24, 6001, betas[bt], NUM_THREADS_SPLIT));
+
+    ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS * 6001);
+}
+
+CTEST(gemm_split_k, dgemm_uneven)
+{
+    double d = 0.0;
+
+    /* fewer columns than threads, a single row, three threads */
+    d = MAX(d, check_dgemm_split_k(CblasNoTrans, CblasNoTrans, 64, 2, 9000, 0.5, NUM_THREADS_SPLIT));
+    d = MAX(d, check_dgemm_split_k(CblasTrans, CblasNoTrans, 1, 17, 8193, 0.0, NUM_THREADS_SPLIT));
+    d = MAX(d, check_dgemm_split_k(CblasNoTrans, CblasTrans, 33, 31, 7777, 1.0, 3));
+
+    ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS * 9000);
+}
+#endif
+
+#ifdef BUILD_COMPLEX16
+static double check_zgemm_split_k(enum CBLAS_TRANSPOSE transa, enum CBLAS_TRANSPOSE transb,
+                                  blasint m, blasint n, blasint k, double beta_r, double beta_i)
+{
+    blasint i, j, l, lda, ldb, ldc = m + 1;
+    double alpha[2] = {0.75, -0.5}, beta[2] = {beta_r, beta_i}, d = 0.0;
+    double *a, *b, *c, *c_verify;
+    int ta = (transa == CblasTrans || transa == CblasConjTrans);
+    int tb = (transb == CblasTrans || transb == CblasConjTrans);
+    double ca = (transa == CblasConjTrans || transa == CblasConjNoTrans) ? -1.0 : 1.0;
+    double cb = (transb == CblasConjTrans || transb == CblasConjNoTrans) ? -1.0 : 1.0;
+    int nthreads_old = openblas_get_num_threads();
+
+    lda = ta ? k : m;
+    ldb = tb ? n : k;
+
+    a = (double *)malloc(sizeof(double) * 2 * m * k);
+    b = (double *)malloc(sizeof(double) * 2 * k * n);
+    c = (double *)malloc(sizeof(double) * 2 * ldc * n);
+    c_verify = (double *)malloc(sizeof(double) * 2 * ldc * n);
+
+    drand_generate(a, 2 * m * k);
+    drand_generate(b, 2 * k * n);
+    drand_generate(c, 2 * ldc * n);
+    for (i = 0; i < 2 * ldc * n; i++) c_verify[i] = c[i];
+
+    for (i = 0; i < m; i++) {
+        for (j = 0; j < n; j++) {
+            double sr = 0.0, si = 0.0, *x = &c_verify[2 * (i + j * ldc)], xr;
+
+            for (l = 0; l < k; l++) {
+                double *pa = &a[2 * (ta ? l + i * lda : i + l * lda)];
+                double *pb = &b[2 * (tb ? j + l * ldb : l + j * ldb)];
+
+                sr += pa[0] * pb[0] - ca * cb * pa[1] * pb[1];
+                si += ca * pa[1] * pb[0] + cb * pa[0] * pb[1];
+            }
+
+            xr   = alpha[0] * sr - alpha[1] * si + beta[0] * x[0] - beta[1] * x[1];
+            x[1] = alpha[0] * si + alpha[1] * sr + beta[0] * x[1] + beta[1] * x[0];
+            x[0] = xr;
+        }
+    }
+
+    openblas_set_num_threads(NUM_THREADS_SPLIT);
+    cblas_zgemm(CblasColMajor, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+    openblas_set_num_threads(nthreads_old);
+
+    for (i = 0; i < 2 * ldc * n; i++)
+        d = MAX(d, fabs(c[i] - c_verify[i]) / (1.0 + fabs(c_verify[i])));
+
+    free(a);
+    free(b);
+    free(c);
+    free(c_verify);
+
+    return d;
+}
+
+CTEST(gemm_split_k, zgemm_all_trans)
+{
+    enum CBLAS_TRANSPOSE trans[4] = {CblasNoTrans, CblasTrans, CblasConjNoTrans, CblasConjTrans};
+    unsigned int ta, tb;
+    double d = 0.0;
+
+    for (ta = 0; ta < 4; ta++)
+        for (tb = 0; tb < 4; tb++) {
+            d = MAX(d, check_zgemm_split_k(trans[ta], trans[tb], 20, 13, 3001, 0.0, 0.0));
+            d = MAX(d, check_zgemm_split_k(trans[ta], trans[tb], 20, 13, 3001, 0.5, 0.25));
+        }
+
+    ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS * 3001 * 4);
+}
+#endif
+#endif
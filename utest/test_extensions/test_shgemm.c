@@ -0,0 +1,290 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "utest/openblas_utest.h"
+#include "common.h"
+
+#define M 67
+#define N 45
+#define K 1100
+
+#define GEMV_M 300
+#define GEMV_N 270
+
+struct DATA_SHGEMM{
+    hfloat16 a[GEMV_M * GEMV_N];
+    hfloat16 b[K * N];
+    hfloat16 x[2 * GEMV_M];
+    float a_float[GEMV_M * GEMV_N];
+    float b_float[K * N];
+    float x_float[2 * GEMV_M];
+    float c_test[GEMV_M * N];
+    float c_verify[GEMV_M * N];
+};
+
+#ifdef BUILD_SINGLE
+static struct DATA_SHGEMM data_shgemm;
+
+/**
+ * Small multiples of 1/8 are exact in half precision, and so are all the
+ * products and sums formed from them below, which keeps the comparison exact
+ */
+static void exact_generate(float *f, blasint n)
+{
+    blasint i;
+
+    for (i = 0; i < n; i++)
+        f[i] = (float)(rand() % 17 - 8) / 8.0f;
+}
+
+/**
+ * Fill a hfloat16 array and keep a float copy for the reference computation
+ */
+static void hrand_generate(hfloat16 *h, float *f, blasint n)
+{
+    blasint one = 1;
+
+    exact_generate(f, n);
+    BLASFUNC(shstohf16)(&n, f, &one, h, &one);
+}
+
+/**
+ * Test shgemm by comparing it against a reference computed in double
+ *
+ * param api - specifies Fortran or C API
+ * param order - specifies whether the matrices are row or column major
+ * param transa, transb - specifies op(A) and op(B)
+ * param alpha, beta - scalars
+ * return norm of differences
+ */
+static float check_shgemm(char api, OPENBLAS_CONST enum CBLAS_ORDER order,
+                          char transa, char transb, float alpha, float beta)
+{
+    blasint m = M, n = N, k = K;
+    blasint lda, ldb, ldc;
+    blasint i, j, l;
+    int ta = (transa == 'T'), tb = (transb == 'T');
+    float *a = data_shgemm.a_float, *b = data_shgemm.b_float;
+
+    hrand_generate(data_shgemm.a, data_shgemm.a_float, m * k);
+    hrand_generate(data_shgemm.b, data_shgemm.b_float, k * n);
+    exact_generate(data_shgemm.c_test, m * n);
+    for (i = 0; i < m * n; i++) data_shgemm.c_verify[i] = data_shgemm.c_test[i];
+
+    if (order == CblasColMajor) {
+        lda = ta ? k : m;
+        ldb = tb ? n : k;
+        ldc = m;
+    } else {
+        lda = ta ? m : k;
+        ldb = tb ? k : n;
+        ldc = n;
+    }
+
+    for (i = 0; i < m; i++) {
+        for (j = 0; j < n; j++) {
+            double sum = 0.0, aval, bval;
+            for (l = 0; l < k; l++) {
+                if (order == CblasColMajor) {
+                    aval = ta ? a[l + i * lda] : a[i + l * lda];
+                    bval = tb ? b[j + l * ldb] : b[l + j * ldb];
+                } else {
+                    aval = ta ? a[i + l * lda] : a[l + i * lda];
+                    bval = tb ? b[l + j * ldb] : b[j + l * ldb];
+                }
+                sum += aval * bval;
+            }
+            if (order == CblasColMajor)
+                data_shgemm.c_verify[i + j * ldc] = alpha * sum + beta * data_shgemm.c_verify[i + j * ldc];
+            else
+                data_shgemm.c_verify[j + i * ldc] = alpha * sum + beta * data_shgemm.c_verify[j + i * ldc];
+        }
+    }
+
+    if (api == 'F')
+        BLASFUNC(shgemm)(&transa, &transb, &m, &n, &k, &alpha, data_shgemm.a, &lda,
+                         data_shgemm.b, &ldb, &beta, data_shgemm.c_test, &ldc);
+#ifndef NO_CBLAS
+    else
+        cblas_shgemm(order, ta ? CblasTrans : CblasNoTrans, tb ? CblasTrans : CblasNoTrans,
+                     m, n, k, alpha, data_shgemm.a, lda, data_shgemm.b, ldb, beta,
+                     data_shgemm.c_test, ldc);
+#endif
+
+    return smatrix_difference(data_shgemm.c_test, data_shgemm.c_verify, m * n, 1, m * n);
+}
+
+/**
+ * Test shgemv by comparing it against a reference computed in double
+ *
+ * param trans - specifies op(A)
+ * param incx, incy - increments of x and y
+ * return norm of differences
+ */
+static float check_shgemv(char trans, blasint incx, blasint incy)
+{
+    blasint m = GEMV_M, n = GEMV_N, lda = GEMV_M;
+    blasint lenx = (trans == 'T') ? m : n;
+    blasint leny = (trans == 'T') ? n : m;
+    blasint i, j;
+    float alpha = 1.5f, beta = -0.5f;
+    float *a = data_shgemm.a_float, *x = data_shgemm.x_float;
+
+    hrand_generate(data_shgemm.a, data_shgemm.a_float, m * n);
+    hrand_generate(data_shgemm.x, data_shgemm.x_float, lenx * incx);
+    exact_generate(data_shgemm.c_test, leny * incy);
+    for (i = 0; i < leny * incy; i++) data_shgemm.c_verify[i] = data_shgemm.c_test[i];
+
+    for (i = 0; i < leny; i++) {
+        double sum = 0.0;
+        for (j = 0; j < lenx; j++)
+            sum += (double)((trans == 'T') ? a[j + i * lda] : a[i + j * lda]) * x[j * incx];
+        data_shgemm.c_verify[i * incy] = alpha * sum + beta * data_shgemm.c_verify[i * incy];
+    }
+
+    BLASFUNC(shgemv)(&trans, &m, &n, &alpha, data_shgemm.a, &lda, data_shgemm.x, &incx,
+                     &beta, data_shgemm.c_test, &incy);
+
+    return smatrix_difference(data_shgemm.c_test, data_shgemm.c_verify, leny * incy, 1, leny * incy);
+}
+
+CTEST(shgemm, colmajor_nn)
+{
+    float norm = check_shgemm('F', CblasColMajor, 'N', 'N', 1.0f, 0.0f);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_EPS);
+}
+
+CTEST(shgemm, colmajor_nt)
+{
+    float norm = check_shgemm('F', CblasColMajor, 'N', 'T', 2.0f, 1.0f);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_EPS);
+}
+
+CTEST(shgemm, colmajor_tn)
+{
+    float norm = check_shgemm('F', CblasColMajor, 'T', 'N', -1.0f, 0.5f);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_EPS);
+}
+
+CTEST(shgemm, colmajor_tt)
+{
+    float norm = check_shgemm('F', CblasColMajor, 'T', 'T', 0.25f, -2.0f);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_EPS);
+}
+
+#ifndef NO_CBLAS
+CTEST(shgemm, c_api_rowmajor_nt)
+{
+    float norm = check_shgemm('C', CblasRowMajor, 'N', 'T', 1.0f, 1.0f);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_EPS);
+}
+#endif
+
+CTEST(shgemv, n_inc_2)
+{
+    float norm = check_shgemv('N', 2, 1);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_EPS);
+}
+
+CTEST(shgemv, t_inc_y_2)
+{
+    float norm = check_shgemv('T', 1, 2);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_EPS);
+}
+
+/**
+ * Every finite half value survives a round trip through float
+ */
+CTEST(shf16tos, round_trip_all_values)
+{
+    blasint n = 0x7c00, one = 1, i;
+    hfloat16 *h = data_shgemm.a, *back = data_shgemm.a + n;
+    float *f = data_shgemm.a_float;
+    int sign, mismatches = 0;
+
+    for (sign = 0; sign < 2; sign++) {
+        for (i = 0; i < n; i++) h[i] = (hfloat16)(i | (sign << 15));
+
+        BLASFUNC(shf16tos)(&n, h, &one, f, &one);
+        BLASFUNC(shstohf16)(&n, f, &one, back, &one);
+
+        for (i = 0; i < n; i++)
+            if (h[i] != back[i]) mismatches++;
+    }
+
+    ASSERT_EQUAL(0, mismatches);
+    ASSERT_DBL_NEAR_TOL(-65504.0f, f[0x7bff], 0.0f);
+    ASSERT_DBL_NEAR_TOL(-0x1p-24f, f[1], 0.0f);
+}
+
+/**
+ * Narrowing rounds to nearest even and handles overflow and subnormals
+ */
+CTEST(shstohf16, rounding)
+{
+    float in[6] = {1.0f + 0x1p-11f, 1.0f + 0x3p-11f, 65520.0f, 0x1p-25f, 0x3p-26f, -0x1p-24f};
+    hfloat16 expect[6] = {0x3c00, 0x3c02, 0x7c00, 0x0000, 0x0001, 0x8001};
+    hfloat16 out[12];
+    blasint n = 6, one = 1, two = 2, i;
+
+    BLASFUNC(shstohf16)(&n, in, &one, out, &two);
+
+    for (i = 0; i < n; i++)
+        ASSERT_EQUAL(expect[i], out[2 * i]);
+}
+
+/**
+ * Double inputs are rounded once, straight to half precision
+ */
+CTEST(shdtohf16, no_double_rounding)
+{
+    double in[2] = {1.0 + 0x1p-11 + 0x1p-40, 65519.0};
+    hfloat16 out[2];
+    double back[2];
+    blasint n = 2, one = 1;
+
+    BLASFUNC(shdtohf16)(&n, in, &one, out, &one);
+    BLASFUNC(dhf16tod)(&n, out, &one, back, &one);
+
+    ASSERT_EQUAL(0x3c01, out[0]);
+    ASSERT_EQUAL(0x7bff, out[1]);
+    ASSERT_DBL_NEAR_TOL(65504.0, back[1], 0.0);
+}
+#endif
@@ -34,7 +34,7 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "utest/openblas_utest.h"
 #include "common.h"
 
-#define DATASIZE 100
+#define DATASIZE 300
 
 struct DATA_SIMATCOPY {
     float a_test[DATASIZE* DATASIZE];
@@ -690,6 +690,102 @@ CTEST(simatcopy, rowmajor_notrans_col_100_row_50)
 }
 
 #ifndef NO_CBLAS
+/**
+ * Fortran API specific test
+ * Test simatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Column Major
+ * Transposition
+ * Rectangular matrix with padded leading dimensions,
+ * large enough to run multithreaded
+ * alpha = 2.0f
+ */
+CTEST(simatcopy, colmajor_trans_col_240_row_300)
+{
+    blasint m = 300, n = 240;
+    blasint lda_src = 300, lda_dst = 250;
+    char order = 'C';
+    char trans = 'T';
+    float alpha = 2.0f;
+
+    float norm = check_simatcopy('F', order, trans, m, n, alpha, lda_src, lda_dst);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_EPS);
+}
+
+/**
+ * Fortran API specific test
+ * Test simatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Row Major
+ * Transposition
+ * Rectangular matrix with coprime dimensions,
+ * large enough to run multithreaded
+ * alpha = 1.5f
+ */
+CTEST(simatcopy, rowmajor_trans_col_263_row_257)
+{
+    blasint m = 257, n = 263;
+    blasint lda_src = 263, lda_dst = 257;
+    char order = 'R';
+    char trans = 'T';
+    float alpha = 1.5f;
+
+    float norm = check_simatcopy('F', order, trans, m, n, alpha, lda_src, lda_dst);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_EPS);
+}
+
+/**
+ * Fortran API specific test
+ * Test simatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Column Major
+ * Transposition
+ * Square matrix with lda != ldb,
+ * large enough to run multithreaded
+ * alpha = -1.0f
+ */
+CTEST(simatcopy, colmajor_trans_col_260_row_260)
+{
+    blasint m = 260, n = 260;
+    blasint lda_src = 270, lda_dst = 280;
+    char order = 'C';
+    char trans = 'T';
+    float alpha = -1.0f;
+
+    float norm = check_simatcopy('F', order, trans, m, n, alpha, lda_src, lda_dst);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_EPS);
+}
+
+/**
+ * Fortran API specific test
+ * Test simatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Column Major
+ * Copy only
+ * Square matrix with ldb > lda,
+ * large enough to run multithreaded
+ * alpha = 3.0f
+ */
+CTEST(simatcopy, colmajor_notrans_col_260_row_260)
+{
+    blasint m = 260, n = 260;
+    blasint lda_src = 260, lda_dst = 280;
+    char order = 'C';
+    char trans = 'N';
+    float alpha = 3.0f;
+
+    float norm = check_simatcopy('F', order, trans, m, n, alpha, lda_src, lda_dst);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_EPS);
+}
+
 /**
  * C API specific test
  * Test simatcopy by comparing it against reference
@@ -34,7 +34,7 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "utest/openblas_utest.h"
 #include "common.h"
 
-#define DATASIZE 100
+#define DATASIZE 300
 
 struct DATA_SOMATCOPY {
     float a_test[DATASIZE * DATASIZE];
@@ -415,6 +415,78 @@ CTEST(somatcopy, rowmajor_notrans_col_100_row_50)
 }
 
 #ifndef NO_CBLAS
+/**
+ * Fortran API specific test
+ * Test somatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Column Major
+ * Transposition
+ * Rectangular matrix with padded leading dimensions,
+ * large enough to run multithreaded
+ * alpha = 2.0f
+ */
+CTEST(somatcopy, colmajor_trans_col_240_row_300)
+{
+    blasint m = 300, n = 240;
+    blasint lda = 300, ldb = 250;
+    char order = 'C';
+    char trans = 'T';
+    float alpha = 2.0f;
+
+    float norm = check_somatcopy('F', order, trans, m, n, alpha, lda, ldb);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_EPS);
+}
+
+/**
+ * Fortran API specific test
+ * Test somatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Row Major
+ * Transposition
+ * Rectangular matrix with padded leading dimensions,
+ * large enough to run multithreaded
+ * alpha = -1.5f
+ */
+CTEST(somatcopy, rowmajor_trans_col_300_row_240)
+{
+    blasint m = 240, n = 300;
+    blasint lda = 300, ldb = 250;
+    char order = 'R';
+    char trans = 'T';
+    float alpha = -1.5f;
+
+    float norm = check_somatcopy('F', order, trans, m, n, alpha, lda, ldb);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_EPS);
+}
+
+/**
+ * Fortran API specific test
+ * Test somatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Column Major
+ * Copy only
+ * Square matrix with padded leading dimensions,
+ * large enough to run multithreaded
+ * alpha = 3.0f
+ */
+CTEST(somatcopy, colmajor_notrans_col_260_row_260)
+{
+    blasint m = 260, n = 260;
+    blasint lda = 270, ldb = 280;
+    char order = 'C';
+    char trans = 'N';
+    float alpha = 3.0f;
+
+    float norm = check_somatcopy('F', order, trans, m, n, alpha, lda, ldb);
+
+    ASSERT_DBL_NEAR_TOL(0.0f, norm, SINGLE_EPS);
+}
+
 /**
  * C API specific test
  * Test somatcopy by comparing it against refernce
@@ -34,7 +34,7 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "utest/openblas_utest.h"
 #include "common.h"
 
-#define DATASIZE 100
+#define DATASIZE 300
 
 struct DATA_ZOMATCOPY {
     double a_test[DATASIZE * DATASIZE * 2];
@@ -328,6 +328,78 @@ CTEST(zomatcopy, rowmajor_conjtrans_col_100_row_100)
 }
 
 #ifndef NO_CBLAS
+/**
+ * Fortran API specific test
+ * Test zomatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Column Major
+ * Transposition and conjugate
+ * Rectangular matrix with padded leading dimensions,
+ * large enough to run multithreaded
+ * alpha_r = 2.0, alpha_i = 1.0
+ */
+CTEST(zomatcopy, colmajor_conjtrans_col_240_row_300)
+{
+    blasint m = 300, n = 240;
+    blasint lda = 300, ldb = 250;
+    char order = 'C';
+    char trans = 'C';
+    double alpha[] = {2.0, 1.0};
+
+    double norm = check_zomatcopy('F', order, trans, m, n, alpha, lda, ldb);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
+}
+
+/**
+ * Fortran API specific test
+ * Test zomatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Row Major
+ * Transposition
+ * Rectangular matrix with padded leading dimensions,
+ * large enough to run multithreaded
+ * alpha_r = -1.0, alpha_i = 2.0
+ */
+CTEST(zomatcopy, rowmajor_trans_col_300_row_240)
+{
+    blasint m = 240, n = 300;
+    blasint lda = 300, ldb = 250;
+    char order = 'R';
+    char trans = 'T';
+    double alpha[] = {-1.0, 2.0};
+
+    double norm = check_zomatcopy('F', order, trans, m, n, alpha, lda, ldb);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
+}
+
+/**
+ * Fortran API specific test
+ * Test zomatcopy by comparing it against reference
+ * with the following options:
+ *
+ * Row Major
+ * Copy and conjugate
+ * Rectangular matrix with padded leading dimensions,
+ * large enough to run multithreaded
+ * alpha_r = 1.0, alpha_i = 2.0
+ */
+CTEST(zomatcopy, rowmajor_conj_col_300_row_240)
+{
+    blasint m = 240, n = 300;
+    blasint lda = 300, ldb = 310;
+    char order = 'R';
+    char trans = 'R';
+    double alpha[] = {1.0, 2.0};
+
+    double norm = check_zomatcopy('F', order, trans, m, n, alpha, lda, ldb);
+
+    ASSERT_DBL_NEAR_TOL(0.0, norm, DOUBLE_EPS);
+}
+
 /**
  * C API specific test
  * Test zomatcopy by comparing it against refernce
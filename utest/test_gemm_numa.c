@@ -0,0 +1,186 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+#include "openblas_utest.h"
+
+/*
+ * Threaded GEMM on shapes that put every partition of C on a different
+ * footing: tall, wide, square and odd sizes.  ctest runs this suite once
+ * more with OPENBLAS_GEMM_NUMA set to 2 and 4, which partitions C over
+ * that many emulated nodes and multiplies local copies of A and B.  Every
+ * entry must match a plain triple loop and the rows of C between m and
+ * ldc must be left alone.
+ */
+
+static double fill_value(unsigned int *seed)
+{
+	*seed = *seed * 1103515245u + 12345u;
+	return (double)((*seed >> 8) & 0xffff) / 32768.0 - 1.0;
+}
+
+static void set_threads(int nthreads)
+{
+#ifdef SMP
+	goto_set_num_threads(nthreads);
+#endif
+}
+
+static int get_threads(void)
+{
+#ifdef SMP
+	return blas_cpu_number;
+#else
+	return 1;
+#endif
+}
+
+/*
+ * C = alpha * op(A) * op(B) + beta * C in double or double complex, with
+ * cs = 1 or 2 and trans one of N, T, C; returns the largest error, or -1
+ * if anything outside C changed.
+ */
+static double check_gemm(int cs, char transa, char transb, blasint m, blasint n, blasint k)
+{
+	blasint lda = ((transa == 'N') ? m : k) + 1;
+	blasint ldb = ((transb == 'N') ? k : n) + 2;
+	blasint ldc = m + 3;
+	blasint la = lda * ((transa == 'N') ? k : m) * cs;
+	blasint lb = ldb * ((transb == 'N') ? n : k) * cs;
+	blasint i, j, l;
+	double alpha[2] = { 1.5, -0.25 }, beta[2] = { -0.5, 0.75 }, d = 0.0;
+	double *a = (double *)malloc(sizeof(double) * la);
+	double *b = (double *)malloc(sizeof(double) * lb);
+	double *c = (double *)malloc(sizeof(double) * ldc * n * cs);
+	double *ref = (double *)malloc(sizeof(double) * ldc * n * cs);
+	unsigned int seed = 7u;
+
+	for (i = 0; i < la; i++) a[i] = fill_value(&seed);
+	for (i = 0; i < lb; i++) b[i] = fill_value(&seed);
+	for (i = 0; i < ldc * n * cs; i++) c[i] = ref[i] = fill_value(&seed);
+
+	for (j = 0; j < n; j++) {
+		for (i = 0; i < m; i++) {
+			double sr = 0.0, si = 0.0, *x = &ref[(i + j * ldc) * cs], xr;
+
+			for (l = 0; l < k; l++) {
+				double *pa = &a[((transa == 'N') ? i + l * lda : l + i * lda) * cs];
+				double *pb = &b[((transb == 'N') ? l + j * ldb : j + l * ldb) * cs];
+				double ar = pa[0], ai = (cs == 2) ? pa[1] : 0.0;
+				double br = pb[0], bi = (cs == 2) ? pb[1] : 0.0;
+
+				if (transa == 'C') ai = -ai;
+				if (transb == 'C') bi = -bi;
+				sr += ar * br - ai * bi;
+				si += ar * bi + ai * br;
+			}
+
+			if (cs == 1) {
+				x[0] = alpha[0] * sr + beta[0] * x[0];
+			} else {
+				xr   = alpha[0] * sr - alpha[1] * si + beta[0] * x[0] - beta[1] * x[1];
+				x[1] = alpha[0] * si + alpha[1] * sr + beta[0] * x[1] + beta[1] * x[0];
+				x[0] = xr;
+			}
+		}
+	}
+
+	if (cs == 1)
+		BLASFUNC(dgemm)(&transa, &transb, &m, &n, &k, alpha, a, &lda, b, &ldb, beta, c, &ldc);
+	else
+		BLASFUNC(zgemm)(&transa, &transb, &m, &n, &k, alpha, a, &lda, b, &ldb, beta, c, &ldc);
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < ldc * cs; i++) {
+			double e = fabs(c[i + j * ldc * cs] - ref[i + j * ldc * cs]);
+
+			if (i >= m * cs) {
+				if (e != 0.0) d = -1.0;
+			} else if (d >= 0.0) {
+				d = MAX(d, e);
+			}
+		}
+
+	free(a);
+	free(b);
+	free(c);
+	free(ref);
+
+	return d;
+}
+
+static const blasint shapes[][3] = {
+	{ 600,  40, 300 }, {  40, 600, 300 }, { 257, 263, 129 }, { 401, 97, 517 },
+};
+
+#define NUM_SHAPES (sizeof(shapes) / sizeof(shapes[0]))
+
+#ifdef BUILD_DOUBLE
+CTEST(gemm_numa, dgemm_threaded)
+{
+	static const char trans[] = { 'N', 'T' };
+	int nthreads = get_threads(), ta, tb;
+	unsigned int s;
+
+	set_threads(4);
+
+	for (s = 0; s < NUM_SHAPES; s++)
+		for (ta = 0; ta < 2; ta++)
+			for (tb = 0; tb < 2; tb++) {
+				double d = check_gemm(1, trans[ta], trans[tb], shapes[s][0], shapes[s][1], shapes[s][2]);
+				ASSERT_TRUE(d >= 0.0);
+				ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS * 1000);
+			}
+
+	set_threads(nthreads);
+}
+#endif
+
+#ifdef BUILD_COMPLEX16
+CTEST(gemm_numa, zgemm_threaded)
+{
+	static const char trans[] = { 'N', 'T', 'C' };
+	int nthreads = get_threads(), ta, tb;
+	unsigned int s;
+
+	set_threads(4);
+
+	for (s = 0; s < NUM_SHAPES; s += 2)
+		for (ta = 0; ta < 3; ta++)
+			for (tb = 0; tb < 3; tb++) {
+				double d = check_gemm(2, trans[ta], trans[tb], shapes[s][0], shapes[s][1], shapes[s][2]);
+				ASSERT_TRUE(d >= 0.0);
+				ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS * 1000);
+			}
+
+	set_threads(nthreads);
+}
+#endif
@@ -0,0 +1,288 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+#include "openblas_utest.h"
+#ifndef NO_CBLAS
+#include <cblas.h>
+#endif
+#include <float.h>
+
+/*
+ * Strassen-Winograd GEMM.  ctest runs this suite once more with
+ * OPENBLAS_GEMM_STRASSEN=64, so that ?gemm and cblas_?gemm_strassen
+ * recurse one or two levels deep on these shapes and peel odd rows,
+ * columns and inner indices on the way.
+ *
+ * The fast algorithm does not satisfy the componentwise bound
+ * |C - fl(C)| <= k u |A| |B| of the classical one.  Following Higham,
+ * "Accuracy and Stability of Numerical Algorithms", 2nd ed., chapter 23,
+ * L levels of Winograd's variant on top of a classical product of inner
+ * dimension k0 = k / 2^L satisfy, to first order, the normwise bound
+ *
+ *   max|C - fl(C)| <= (18^L (k0^2 + 6 k0) - 6 k) u max|A| max|B|.
+ *
+ * The checks allow this bound, scaled by |alpha|, plus k u |alpha|
+ * max|A| max|B| for the rounding of the reference and 2 u |beta| max|C|
+ * for the scaling of C.  Entries of C between m and ldc must be left
+ * alone, and with beta == 0 NaNs in C must not propagate.
+ */
+
+/* Crossover used by the library when the mode is on without a size */
+#define DEFAULT_CROSSOVER 1536
+
+enum { FORTRAN, CBLAS_COL, CBLAS_ROW };
+
+static double fill_value(unsigned int *seed, int single)
+{
+	double v;
+
+	*seed = *seed * 1103515245u + 12345u;
+	v = (double)*seed / 2147483648.0 - 1.0;
+
+	return single ? (double)(float)v : v;
+}
+
+static void set_threads(int nthreads)
+{
+#ifdef SMP
+	goto_set_num_threads(nthreads);
+#endif
+}
+
+static int get_threads(void)
+{
+#ifdef SMP
+	return blas_cpu_number;
+#else
+	return 1;
+#endif
+}
+
+/* Levels of recursion the library uses; forced for cblas_?gemm_strassen */
+static int levels(int forced, blasint m, blasint n, blasint k)
+{
+	char *p = getenv("OPENBLAS_GEMM_STRASSEN");
+	int crossover = p ? atoi(p) : 0, l = 0;
+
+	if (forced && (crossover < 1)) crossover = 1;
+	if (crossover < 1) return 0;
+	if (crossover == 1) crossover = DEFAULT_CROSSOVER;
+
+	while (MIN(m, MIN(n, k)) >= 2 * crossover) {
+		m /= 2;
+		n /= 2;
+		k /= 2;
+		l++;
+	}
+
+	return l;
+}
+
+/*
+ * C = alpha * op(A) * op(B) + beta * C through the given interface, in
+ * single or double precision; returns the largest error divided by the
+ * bound above, or -1 if anything outside C changed.
+ */
+static double check_gemm(int single, int api, char transa, char transb,
+			 blasint m, blasint n, blasint k, double alpha, double beta)
+{
+	int rm = (api == CBLAS_ROW);
+	blasint ar = (transa == 'N') ? m : k, ac = (transa == 'N') ? k : m;
+	blasint br = (transb == 'N') ? k : n, bc = (transb == 'N') ? n : k;
+	blasint lda = (rm ? ac : ar) + 1;
+	blasint ldb = (rm ? bc : br) + 2;
+	blasint ldc = (rm ? n : m) + 3;
+	blasint la = lda * (rm ? ar : ac), lb = ldb * (rm ? br : bc), lc = ldc * (rm ? m : n);
+	blasint i, j, l, p;
+	int forced = (api != FORTRAN), lv = levels(forced, m, n, k);
+	double u = single ? FLT_EPSILON / 2 : DBL_EPSILON / 2;
+	double amax = 0.0, bmax = 0.0, cmax = 0.0, err = 0.0, k0, bound;
+	double *a = (double *)malloc(sizeof(double) * la);
+	double *b = (double *)malloc(sizeof(double) * lb);
+	double *c = (double *)malloc(sizeof(double) * lc);
+	double *ref = (double *)malloc(sizeof(double) * lc);
+	unsigned int seed = 11u;
+
+#define IDX(i, j, ld) (rm ? (i) * (ld) + (j) : (i) + (j) * (ld))
+#define INSIDE(p) (rm ? ((p) % ldc < n) : ((p) % ldc < m))
+
+	for (p = 0; p < la; p++) amax = MAX(amax, fabs(a[p] = fill_value(&seed, single)));
+	for (p = 0; p < lb; p++) bmax = MAX(bmax, fabs(b[p] = fill_value(&seed, single)));
+	for (p = 0; p < lc; p++) {
+		c[p] = ref[p] = fill_value(&seed, single);
+		if (INSIDE(p)) {
+			if (beta == 0.0) c[p] = NAN;
+			cmax = MAX(cmax, fabs(ref[p]));
+		}
+	}
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < m; i++) {
+			double s = 0.0, *x = &ref[IDX(i, j, ldc)];
+
+			for (l = 0; l < k; l++)
+				s += ((transa == 'N') ? a[IDX(i, l, lda)] : a[IDX(l, i, lda)])
+				   * ((transb == 'N') ? b[IDX(l, j, ldb)] : b[IDX(j, l, ldb)]);
+
+			*x = alpha * s + ((beta == 0.0) ? 0.0 : beta * *x);
+		}
+
+	if (single) {
+		float *fa = (float *)malloc(sizeof(float) * la);
+		float *fb = (float *)malloc(sizeof(float) * lb);
+		float *fc = (float *)malloc(sizeof(float) * lc);
+		float falpha = alpha, fbeta = beta;
+
+		for (p = 0; p < la; p++) fa[p] = a[p];
+		for (p = 0; p < lb; p++) fb[p] = b[p];
+		for (p = 0; p < lc; p++) fc[p] = c[p];
+
+		if (api == FORTRAN)
+			BLASFUNC(sgemm)(&transa, &transb, &m, &n, &k, &falpha, fa, &lda, fb, &ldb, &fbeta, fc, &ldc);
+#ifndef NO_CBLAS
+		else
+			cblas_sgemm_strassen(rm ? CblasRowMajor : CblasColMajor,
+					     (transa == 'N') ? CblasNoTrans : CblasTrans, (transb == 'N') ? CblasNoTrans : CblasTrans,
+					     m, n, k, falpha, fa, lda, fb, ldb, fbeta, fc, ldc);
+#endif
+
+		for (p = 0; p < lc; p++) c[p] = fc[p];
+
+		free(fa);
+		free(fb);
+		free(fc);
+	} else {
+		if (api == FORTRAN)
+			BLASFUNC(dgemm)(&transa, &transb, &m, &n, &k, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
+#ifndef NO_CBLAS
+		else
+			cblas_dgemm_strassen(rm ? CblasRowMajor : CblasColMajor,
+					     (transa == 'N') ? CblasNoTrans : CblasTrans, (transb == 'N') ? CblasNoTrans : CblasTrans,
+					     m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+#endif
+	}
+
+	for (p = 0; p < lc; p++) {
+		if (!INSIDE(p)) {
+			if (c[p] != ref[p]) err = -1.0;
+		} else if (err >= 0.0) {
+			double e = fabs(c[p] - ref[p]);
+			err = (e <= err) ? err : e;
+		}
+	}
+
+	k0 = ldexp((double)k, -lv);
+	bound = (pow(18.0, lv) * (k0 * k0 + 6.0 * k0) - 5.0 * k) * u * fabs(alpha) * amax * bmax
+	      + 2.0 * u * fabs(beta) * cmax;
+
+#undef IDX
+#undef INSIDE
+
+	free(a);
+	free(b);
+	free(c);
+	free(ref);
+
+	return (err < 0.0) ? -1.0 : err / bound;
+}
+
+static const blasint shapes[][3] = {
+	{ 256, 256, 256 }, { 259, 263, 301 }, { 300, 141, 522 }, { 130, 517, 133 },
+};
+
+#define NUM_SHAPES (sizeof(shapes) / sizeof(shapes[0]))
+
+/* All shapes and transposes on one thread, or the odd shape on more */
+static void check_all(int single, int api, int nthreads, double alpha, double beta)
+{
+	static const char trans[] = { 'N', 'T' };
+	int saved = get_threads(), ta, tb;
+	unsigned int s, first = (nthreads > 1) ? 1 : 0, last = (nthreads > 1) ? 2 : NUM_SHAPES;
+
+	set_threads(nthreads);
+
+	for (s = first; s < last; s++)
+		for (ta = 0; ta < 2; ta++)
+			for (tb = 0; tb < 2; tb++) {
+				double r = check_gemm(single, api, trans[ta], trans[tb],
+						      shapes[s][0], shapes[s][1], shapes[s][2], alpha, beta);
+				ASSERT_TRUE(r >= 0.0);
+				ASSERT_TRUE(r <= 1.0);
+			}
+
+	set_threads(saved);
+}
+
+#ifdef BUILD_DOUBLE
+CTEST(gemm_strassen, dgemm)
+{
+	check_all(0, FORTRAN, 1, 1.5, -0.5);
+}
+
+CTEST(gemm_strassen, dgemm_threaded)
+{
+	check_all(0, FORTRAN, 4, -0.75, 0.25);
+}
+
+CTEST(gemm_strassen, dgemm_beta_zero)
+{
+	check_all(0, FORTRAN, 1, 1.0, 0.0);
+}
+
+#ifndef NO_CBLAS
+CTEST(gemm_strassen, cblas_dgemm_strassen)
+{
+	check_all(0, CBLAS_COL, 1, 1.5, -0.5);
+	check_all(0, CBLAS_COL, 1, 2.0, 0.0);
+}
+
+CTEST(gemm_strassen, cblas_dgemm_strassen_rowmajor)
+{
+	check_all(0, CBLAS_ROW, 1, -1.0, 1.0);
+}
+#endif
+#endif
+
+#ifdef BUILD_SINGLE
+CTEST(gemm_strassen, sgemm)
+{
+	check_all(1, FORTRAN, 1, 1.5, -0.5);
+}
+
+#ifndef NO_CBLAS
+CTEST(gemm_strassen, cblas_sgemm_strassen)
+{
+	check_all(1, CBLAS_COL, 1, 0.5, 0.0);
+	check_all(1, CBLAS_ROW, 1, 1.5, 2.0);
+}
+#endif
+#endif
@@ -0,0 +1,177 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+
+/*
+ * Sizes past GEMM_P/GEMM_Q, so that the level-3 driver goes through several
+ * row and depth blocks and splits the diagonal blocks with the masked kernel.
+ * The selected triangle must match GEMM, the other one must be left alone.
+ */
+
+static double fill_value(unsigned int *seed)
+{
+	*seed = *seed * 1103515245u + 12345u;
+	return (double)((*seed >> 8) & 0xffff) / 32768.0 - 1.0;
+}
+
+static double *fill_matrix(blasint len, int cplx, unsigned int seed)
+{
+	blasint i;
+	double *x = (double *)malloc(sizeof(double) * len * (cplx ? 2 : 1));
+
+	for (i = 0; i < len * (cplx ? 2 : 1); i++) x[i] = fill_value(&seed);
+
+	return x;
+}
+
+/* largest error inside the triangle, or -1 if anything outside it changed */
+static double triangle_diff(char uplo, blasint m, blasint ldc, int cplx,
+			    double *c, double *ref, double *orig)
+{
+	blasint i, j, l, cs = cplx ? 2 : 1;
+	double d = 0.0;
+
+	for (j = 0; j < m; j++) {
+		for (i = 0; i < m; i++) {
+			for (l = 0; l < cs; l++) {
+				blasint p = (i + j * ldc) * cs + l;
+
+				if ((uplo == 'U') ? (i <= j) : (i >= j))
+					d = MAX(d, fabs(c[p] - ref[p]));
+				else if (c[p] != orig[p])
+					return -1.0;
+			}
+		}
+	}
+
+	return d;
+}
+
+#ifdef BUILD_DOUBLE
+static double check_dgemmt(char uplo, char transa, char transb, blasint m, blasint k)
+{
+	blasint lda = ((transa == 'N') ? m : k) + 1;
+	blasint ldb = ((transb == 'N') ? k : m) + 2;
+	blasint ldc = m + 3;
+	double alpha = 1.5, beta = -0.5, d;
+	double *a    = fill_matrix(lda * ((transa == 'N') ? k : m), 0, 11u);
+	double *b    = fill_matrix(ldb * ((transb == 'N') ? m : k), 0, 13u);
+	double *c    = fill_matrix(ldc * m, 0, 17u);
+	double *ref  = fill_matrix(ldc * m, 0, 17u);
+	double *orig = fill_matrix(ldc * m, 0, 17u);
+
+	BLASFUNC(dgemmt)(&uplo, &transa, &transb, &m, &k, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
+	BLASFUNC(dgemm)(&transa, &transb, &m, &m, &k, &alpha, a, &lda, b, &ldb, &beta, ref, &ldc);
+
+	d = triangle_diff(uplo, m, ldc, 0, c, ref, orig);
+
+	free(a);
+	free(b);
+	free(c);
+	free(ref);
+	free(orig);
+
+	return d;
+}
+
+CTEST(gemmt, dgemmt_blocked)
+{
+	static const char trans[] = { 'N', 'T' };
+	int u, ta, tb;
+
+	for (u = 0; u < 2; u++)
+		for (ta = 0; ta < 2; ta++)
+			for (tb = 0; tb < 2; tb++) {
+				double d = check_dgemmt(u ? 'L' : 'U', trans[ta], trans[tb], 701, 523);
+				ASSERT_TRUE(d >= 0.0);
+				ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS * 1000);
+			}
+}
+
+CTEST(gemmt, dgemmt_small_k)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgemmt('U', 'N', 'T', 333, 1), DOUBLE_EPS * 100);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgemmt('L', 'T', 'N', 333, 1), DOUBLE_EPS * 100);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgemmt('U', 'N', 'N', 333, 0), DOUBLE_EPS * 100);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgemmt('L', 'N', 'N', 333, 0), DOUBLE_EPS * 100);
+}
+#endif
+
+#ifdef BUILD_COMPLEX16
+static double check_zgemmt(char uplo, char transa, char transb, blasint m, blasint k)
+{
+	blasint lda = ((transa == 'N' || transa == 'R') ? m : k) + 1;
+	blasint ldb = ((transb == 'N' || transb == 'R') ? k : m) + 2;
+	blasint ldc = m + 3;
+	double alpha[2] = { 1.5, -0.25 }, beta[2] = { -0.5, 0.75 }, d;
+	double *a    = fill_matrix(lda * ((transa == 'N' || transa == 'R') ? k : m), 1, 11u);
+	double *b    = fill_matrix(ldb * ((transb == 'N' || transb == 'R') ? m : k), 1, 13u);
+	double *b0   = fill_matrix(ldb * ((transb == 'N' || transb == 'R') ? m : k), 1, 13u);
+	double *c    = fill_matrix(ldc * m, 1, 17u);
+	double *ref  = fill_matrix(ldc * m, 1, 17u);
+	double *orig = fill_matrix(ldc * m, 1, 17u);
+
+	BLASFUNC(zgemmt)(&uplo, &transa, &transb, &m, &k, alpha, a, &lda, b, &ldb, beta, c, &ldc);
+	BLASFUNC(zgemm)(&transa, &transb, &m, &m, &k, alpha, a, &lda, b0, &ldb, beta, ref, &ldc);
+
+	d = triangle_diff(uplo, m, ldc, 1, c, ref, orig);
+
+	/* B is read only */
+	if (memcmp(b, b0, sizeof(double) * 2 * ldb * ((transb == 'N' || transb == 'R') ? m : k)))
+		d = -1.0;
+
+	free(a);
+	free(b);
+	free(b0);
+	free(c);
+	free(ref);
+	free(orig);
+
+	return d;
+}
+
+CTEST(gemmt, zgemmt_blocked)
+{
+	static const char trans[] = { 'N', 'T', 'R', 'C' };
+	int u, ta, tb;
+
+	for (u = 0; u < 2; u++)
+		for (ta = 0; ta < 4; ta++)
+			for (tb = 0; tb < 4; tb++) {
+				double d = check_zgemmt(u ? 'L' : 'U', trans[ta], trans[tb], 293, 277);
+				ASSERT_TRUE(d >= 0.0);
+				ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS * 1000);
+			}
+}
+#endif
@@ -0,0 +1,144 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+#ifndef NO_CBLAS
+#include <cblas.h>
+#endif
+#include <stdlib.h>
+
+/*
+ * Few output rows and many columns: in a threaded build these shapes are
+ * split along the columns and the per-thread partial sums are reduced into y.
+ */
+#define ROWS 10
+#define COLS 100000
+
+#ifdef BUILD_DOUBLE
+static double gemv_check(blasint m, blasint n, double alpha, double *a, blasint lda,
+                         double *x, double beta, double *y0, double *y, blasint incy)
+{
+  blasint i, j;
+  double err = 0.0;
+
+  for (i = 0; i < m; i ++) {
+    double sum = 0.0;
+    for (j = 0; j < n; j ++)
+      sum += a[i + j * lda] * x[j];
+    sum = alpha * sum + beta * y0[i * incy];
+    err = fmax(err, fabs(sum - y[i * incy]) / fmax(1.0, fabs(sum)));
+  }
+  return err;
+}
+
+CTEST(gemv, dgemv_n_wide_strided_y){
+  blasint i;
+  blasint m = ROWS, n = COLS, lda = ROWS, incx = 1, incy = 3;
+  double alpha = 0.5, beta = 2.0;
+  char trans = 'N';
+  double *a  = (double *)malloc(sizeof(double) * lda * n);
+  double *x  = (double *)malloc(sizeof(double) * n);
+  double *y  = (double *)malloc(sizeof(double) * m * incy);
+  double *y0 = (double *)malloc(sizeof(double) * m * incy);
+
+  for (i = 0; i < lda * n; i ++) a[i] = (double)(i % 17) / 17.0 - 0.5;
+  for (i = 0; i < n; i ++) x[i] = (double)(i % 13) / 13.0;
+  for (i = 0; i < m * incy; i ++) y[i] = y0[i] = (double)i;
+
+  BLASFUNC(dgemv)(&trans, &m, &n, &alpha, a, &lda, x, &incx, &beta, y, &incy);
+
+  ASSERT_DBL_NEAR_TOL(0.0, gemv_check(m, n, alpha, a, lda, x, beta, y0, y, incy), DOUBLE_EPS * 1000);
+  for (i = 0; i < m * incy; i ++)
+    if (i % incy) ASSERT_DBL_NEAR_TOL(y0[i], y[i], 0.0);
+
+  free(a); free(x); free(y); free(y0);
+}
+
+#ifndef NO_CBLAS
+CTEST(gemv, cblas_dgemv_rowmajor_tall_trans){
+  blasint i;
+  blasint m = COLS, n = ROWS, lda = ROWS, incy = 2;
+  double alpha = -1.5, beta = 0.0;
+  double *a  = (double *)malloc(sizeof(double) * lda * m);
+  double *x  = (double *)malloc(sizeof(double) * m);
+  double *y  = (double *)malloc(sizeof(double) * n * incy);
+  double *y0 = (double *)malloc(sizeof(double) * n * incy);
+
+  for (i = 0; i < lda * m; i ++) a[i] = (double)(i % 19) / 19.0 - 0.5;
+  for (i = 0; i < m; i ++) x[i] = (double)(i % 11) / 11.0;
+  for (i = 0; i < n * incy; i ++) y[i] = y0[i] = 1.0;
+
+  /* the transpose of a row-major m x n matrix is the column-major n x m one */
+  cblas_dgemv(CblasRowMajor, CblasTrans, m, n, alpha, a, lda, x, 1, beta, y, incy);
+
+  ASSERT_DBL_NEAR_TOL(0.0, gemv_check(n, m, alpha, a, lda, x, beta, y0, y, incy), DOUBLE_EPS * 1000);
+
+  free(a); free(x); free(y); free(y0);
+}
+#endif
+#endif
+
+#ifdef BUILD_COMPLEX16
+CTEST(gemv, zgemv_n_wide){
+  blasint i, j;
+  blasint m = ROWS, n = COLS, lda = ROWS, incx = 1, incy = 2;
+  double alpha[2] = {1.0, -0.5}, beta[2] = {0.0, 0.0};
+  char trans = 'N';
+  double err = 0.0;
+  double *a = (double *)malloc(sizeof(double) * 2 * lda * n);
+  double *x = (double *)malloc(sizeof(double) * 2 * n);
+  double *y = (double *)malloc(sizeof(double) * 2 * m * incy);
+
+  for (i = 0; i < 2 * lda * n; i ++) a[i] = (double)(i % 23) / 23.0 - 0.5;
+  for (i = 0; i < 2 * n; i ++) x[i] = (double)(i % 7) / 7.0;
+  for (i = 0; i < 2 * m * incy; i ++) y[i] = 3.0;
+
+  BLASFUNC(zgemv)(&trans, &m, &n, alpha, a, &lda, x, &incx, beta, y, &incy);
+
+  for (i = 0; i < m; i ++) {
+    double sr = 0.0, si = 0.0, tr, ti;
+    for (j = 0; j < n; j ++) {
+      double ar = a[2 * (i + j * lda)], ai = a[2 * (i + j * lda) + 1];
+      sr += ar * x[2 * j] - ai * x[2 * j + 1];
+      si += ar * x[2 * j + 1] + ai * x[2 * j];
+    }
+    tr = alpha[0] * sr - alpha[1] * si;
+    ti = alpha[0] * si + alpha[1] * sr;
+    err = fmax(err, fabs(tr - y[2 * i * incy]) / fmax(1.0, fabs(tr)));
+    err = fmax(err, fabs(ti - y[2 * i * incy + 1]) / fmax(1.0, fabs(ti)));
+  }
+  ASSERT_DBL_NEAR_TOL(0.0, err, DOUBLE_EPS * 1000);
+
+  free(a); free(x); free(y);
+}
+#endif
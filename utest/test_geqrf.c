@@ -0,0 +1,177 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+
+void BLASFUNC(sgeqr2)(blasint *, blasint *, float  *, blasint *, float  *, float  *, blasint *);
+void BLASFUNC(dgeqr2)(blasint *, blasint *, double *, blasint *, double *, double *, blasint *);
+void BLASFUNC(dorm2r)(char *, char *, blasint *, blasint *, blasint *, double *, blasint *, double *,
+		      double *, blasint *, double *, blasint *);
+
+static double fill_value(unsigned int *seed)
+{
+	*seed = *seed * 1103515245u + 12345u;
+	return (double)((*seed >> 8) & 0xffff) / 32768.0 - 1.0;
+}
+
+/* compare the blocked driver against the unblocked reference dgeqr2 */
+static double check_dgeqrf(blasint m, blasint n, blasint lda)
+{
+	blasint info, lwork, k = MIN(m, n), i;
+	unsigned int seed = 1234u + m * 7u + n;
+	double *a = (double *)malloc(sizeof(double) * lda * n);
+	double *b = (double *)malloc(sizeof(double) * lda * n);
+	double *tau  = (double *)malloc(sizeof(double) * k);
+	double *tau2 = (double *)malloc(sizeof(double) * k);
+	double *work = (double *)malloc(sizeof(double) * n);
+	double wq, diff = 0.0;
+
+	for (i = 0; i < lda * n; i++) a[i] = b[i] = fill_value(&seed);
+
+	lwork = -1;
+	BLASFUNC(dgeqrf)(&m, &n, a, &lda, tau, &wq, &lwork, &info);
+	lwork = (blasint)wq;
+	BLASFUNC(dgeqrf)(&m, &n, a, &lda, tau, work, &lwork, &info);
+	if (info != 0) diff = 1.0;
+	BLASFUNC(dgeqr2)(&m, &n, b, &lda, tau2, work, &info);
+
+	for (i = 0; i < lda * n; i++) diff = MAX(diff, fabs(a[i] - b[i]));
+	for (i = 0; i < k; i++) diff = MAX(diff, fabs(tau[i] - tau2[i]));
+
+	free(a); free(b); free(tau); free(tau2); free(work);
+	return diff;
+}
+
+CTEST(geqrf, dgeqrf_tall)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgeqrf(300, 200, 310), 1e-10);
+}
+
+CTEST(geqrf, dgeqrf_wide)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgeqrf(90, 250, 90), 1e-10);
+}
+
+/* tall enough for the TSQR panel path in threaded builds */
+CTEST(geqrf, dgeqrf_tall_skinny)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgeqrf(4000, 24, 4000), 1e-10);
+}
+
+CTEST(geqrf, dgeqrf_single_column)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgeqrf(17, 1, 17), 1e-14);
+}
+
+CTEST(geqrf, sgeqrf_square)
+{
+	blasint m = 150, n = 150, lda = 150, lwork = 150, info, i;
+	unsigned int seed = 42u;
+	float *a = (float *)malloc(sizeof(float) * lda * n);
+	float *b = (float *)malloc(sizeof(float) * lda * n);
+	float tau[150], tau2[150], work[150];
+	float diff = 0.0f;
+
+	for (i = 0; i < lda * n; i++) a[i] = b[i] = (float)fill_value(&seed);
+
+	BLASFUNC(sgeqrf)(&m, &n, a, &lda, tau, work, &lwork, &info);
+	ASSERT_EQUAL(0, info);
+	BLASFUNC(sgeqr2)(&m, &n, b, &lda, tau2, work, &info);
+
+	for (i = 0; i < lda * n; i++) diff = MAX(diff, fabsf(a[i] - b[i]));
+	for (i = 0; i < n; i++) diff = MAX(diff, fabsf(tau[i] - tau2[i]));
+
+	free(a); free(b);
+	ASSERT_DBL_NEAR_TOL(0.0, diff, 1e-3);
+}
+
+CTEST(geqrf, xerbla_lwork_invalid)
+{
+	blasint m = 10, n = 10, lda = 10, lwork = 5, info;
+	double a[100], tau[10], work[10];
+
+	BLASFUNC(dgeqrf)(&m, &n, a, &lda, tau, work, &lwork, &info);
+	ASSERT_EQUAL(-7, info);
+}
+
+/* compare the blocked dormqr against the unblocked reference dorm2r */
+static double check_dormqr(char side, char trans, blasint m, blasint n, blasint k)
+{
+	blasint nq = (side == 'L') ? m : n, nw = (side == 'L') ? n : m;
+	blasint lda = nq + 3, ldc = m + 5, lwork = -1, info, i;
+	unsigned int seed = 4321u + m * 3u + n;
+	double *a = (double *)malloc(sizeof(double) * lda * k);
+	double *c = (double *)malloc(sizeof(double) * ldc * n);
+	double *d = (double *)malloc(sizeof(double) * ldc * n);
+	double *tau  = (double *)malloc(sizeof(double) * k);
+	double *work = (double *)malloc(sizeof(double) * MAX(nq, nw));
+	double wq, diff = 0.0;
+
+	for (i = 0; i < lda * k; i++) a[i] = fill_value(&seed);
+	for (i = 0; i < ldc * n; i++) c[i] = d[i] = fill_value(&seed);
+
+	BLASFUNC(dgeqr2)(&nq, &k, a, &lda, tau, work, &info);
+
+	BLASFUNC(dormqr)(&side, &trans, &m, &n, &k, a, &lda, tau, c, &ldc, &wq, &lwork, &info);
+	lwork = (blasint)wq;
+	BLASFUNC(dormqr)(&side, &trans, &m, &n, &k, a, &lda, tau, c, &ldc, work, &lwork, &info);
+	if (info != 0) diff = 1.0;
+	BLASFUNC(dorm2r)(&side, &trans, &m, &n, &k, a, &lda, tau, d, &ldc, work, &info);
+
+	for (i = 0; i < ldc * n; i++) diff = MAX(diff, fabs(c[i] - d[i]));
+
+	free(a); free(c); free(d); free(tau); free(work);
+	return diff;
+}
+
+CTEST(geqrf, dormqr_left)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dormqr('L', 'N', 300, 90, 150), 1e-10);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dormqr('L', 'T', 300, 90, 150), 1e-10);
+}
+
+CTEST(geqrf, dormqr_right)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dormqr('R', 'N', 80, 260, 130), 1e-10);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dormqr('R', 'T', 80, 260, 130), 1e-10);
+}
+
+CTEST(geqrf, dormqr_xerbla_side)
+{
+	blasint m = 10, n = 10, k = 5, lda = 10, ldc = 10, lwork = 10, info;
+	double a[100], c[100], tau[5], work[10];
+	char side = 'X', trans = 'N';
+
+	BLASFUNC(dormqr)(&side, &trans, &m, &n, &k, a, &lda, tau, c, &ldc, work, &lwork, &info);
+	ASSERT_EQUAL(-1, info);
+}
@@ -0,0 +1,130 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "openblas_utest.h"
+
+static double fill_value(unsigned int *seed)
+{
+	*seed = *seed * 1103515245u + 12345u;
+	return (double)((*seed >> 8) & 0xffff) / 32768.0 - 1.0;
+}
+
+/* invert a random matrix through dgetrf/dgetri and return max |A * inv(A) - I| */
+static double check_dgetri(blasint n, blasint lda)
+{
+	blasint info, lwork, i, j, l;
+	unsigned int seed = 99u + n;
+	double *a = (double *)malloc(sizeof(double) * lda * n);
+	double *b = (double *)malloc(sizeof(double) * lda * n);
+	blasint *ipiv = (blasint *)malloc(sizeof(blasint) * n);
+	double wq, *work, r, err = 0.0;
+
+	for (i = 0; i < lda * n; i++) a[i] = b[i] = fill_value(&seed);
+	for (i = 0; i < n; i++) a[i + i * lda] = b[i + i * lda] += 4.0;
+
+	BLASFUNC(dgetrf)(&n, &n, a, &lda, ipiv, &info);
+	if (info != 0) return 1.0;
+
+	lwork = -1;
+	BLASFUNC(dgetri)(&n, a, &lda, ipiv, &wq, &lwork, &info);
+	lwork = (blasint)wq;
+	work = (double *)malloc(sizeof(double) * lwork);
+	BLASFUNC(dgetri)(&n, a, &lda, ipiv, work, &lwork, &info);
+	if (info != 0) return 1.0;
+
+	for (j = 0; j < n; j++) {
+		for (i = 0; i < n; i++) {
+			r = (i == j) ? -1.0 : 0.0;
+			for (l = 0; l < n; l++) r += b[i + l * lda] * a[l + j * lda];
+			err = MAX(err, fabs(r));
+		}
+	}
+
+	free(a); free(b); free(ipiv); free(work);
+	return err;
+}
+
+CTEST(getri, dgetri_blocked)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgetri(300, 310), 1e-12);
+}
+
+CTEST(getri, dgetri_partial_block)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgetri(71, 71), 1e-13);
+}
+
+CTEST(getri, zgetri)
+{
+	blasint n = 90, lda = 90, lwork = 90, info, i, j, l;
+	unsigned int seed = 3u;
+	double *a = (double *)malloc(sizeof(double) * 2 * lda * n);
+	double *b = (double *)malloc(sizeof(double) * 2 * lda * n);
+	double *work = (double *)malloc(sizeof(double) * 2 * lwork);
+	blasint ipiv[90];
+	double rr, ri, err = 0.0;
+
+	for (i = 0; i < 2 * lda * n; i++) a[i] = b[i] = fill_value(&seed);
+
+	BLASFUNC(zgetrf)(&n, &n, a, &lda, ipiv, &info);
+	ASSERT_EQUAL(0, info);
+	BLASFUNC(zgetri)(&n, a, &lda, ipiv, work, &lwork, &info);
+	ASSERT_EQUAL(0, info);
+
+	for (j = 0; j < n; j++) {
+		for (i = 0; i < n; i++) {
+			rr = (i == j) ? -1.0 : 0.0;
+			ri = 0.0;
+			for (l = 0; l < n; l++) {
+				rr += b[2 * (i + l * lda)] * a[2 * (l + j * lda)] - b[2 * (i + l * lda) + 1] * a[2 * (l + j * lda) + 1];
+				ri += b[2 * (i + l * lda)] * a[2 * (l + j * lda) + 1] + b[2 * (i + l * lda) + 1] * a[2 * (l + j * lda)];
+			}
+			err = MAX(err, fabs(rr) + fabs(ri));
+		}
+	}
+
+	free(a); free(b); free(work);
+	ASSERT_DBL_NEAR_TOL(0.0, err, 1e-10);
+}
+
+CTEST(getri, singular_info)
+{
+	blasint n = 3, lda = 3, lwork = 3, info;
+	double a[9] = { 2.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 1.0 };
+	double work[3];
+	blasint ipiv[3] = { 1, 2, 3 };
+
+	BLASFUNC(dgetri)(&n, a, &lda, ipiv, work, &lwork, &info);
+	ASSERT_EQUAL(2, info);
+}
@@ -0,0 +1,142 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+#ifndef NO_CBLAS
+#include <cblas.h>
+#endif
+#include <stdlib.h>
+
+/* Large enough to be split across threads in a threaded build */
+#define ELEMENTS 1000000
+
+#ifdef BUILD_DOUBLE
+CTEST(iamax, idamax_first_of_ties){
+  blasint i;
+  blasint N = ELEMENTS, inc = 1;
+  double *x = (double *)malloc(sizeof(double) * N);
+  for (i = 0; i < N; i ++) {
+    x[i] = (double)(i % 1000) / 1000.0;
+  }
+
+  x[N - 10] = -5.0;
+  x[N / 3] = 5.0;
+  x[N / 2] = -5.0;
+  blasint index = BLASFUNC(idamax)(&N, x, &inc);
+  ASSERT_EQUAL(N / 3 + 1, index);
+  free(x);
+}
+
+CTEST(iamax, idamin_first_of_ties){
+  blasint i;
+  blasint N = ELEMENTS, inc = 1;
+  double *x = (double *)malloc(sizeof(double) * N);
+  for (i = 0; i < N; i ++) {
+    x[i] = 1.0 + (double)(i % 1000);
+  }
+
+  x[N - 1] = 0.0;
+  x[3 * N / 4] = 0.0;
+  blasint index = BLASFUNC(idamin)(&N, x, &inc);
+  ASSERT_EQUAL(3 * N / 4 + 1, index);
+  free(x);
+}
+
+CTEST(iamax, damax_large){
+  blasint i;
+  blasint N = ELEMENTS, inc = 1;
+  double *x = (double *)malloc(sizeof(double) * N);
+  for (i = 0; i < N; i ++) {
+    x[i] = (double)(i % 1000) / 1000.0;
+  }
+
+  x[N - 7] = -42.0;
+  double amax = BLASFUNC(damax)(&N, x, &inc);
+  ASSERT_DBL_NEAR_TOL(42.0, amax, DOUBLE_EPS);
+  free(x);
+}
+
+#ifndef NO_CBLAS
+CTEST(iamax, cblas_idamax_zero_based){
+  blasint i;
+  blasint N = ELEMENTS;
+  double *x = (double *)malloc(sizeof(double) * N);
+  for (i = 0; i < N; i ++) {
+    x[i] = (double)(i % 1000) / 1000.0;
+  }
+
+  x[N / 5] = 7.0;
+  x[4 * N / 5] = 7.0;
+  size_t index = cblas_idamax(N, x, 1);
+  ASSERT_EQUAL(N / 5, index);
+  free(x);
+}
+#endif
+#endif
+
+#ifdef BUILD_SINGLE
+CTEST(iamax, isamax_step_2){
+  blasint i;
+  blasint N = ELEMENTS / 2, inc = 2;
+  float *x = (float *)malloc(sizeof(float) * N * inc);
+  for (i = 0; i < N * inc; i ++) {
+    x[i] = (float)(i % 100);
+  }
+
+  x[(N - 3) * inc] = 1000.0f;
+  x[(N / 2) * inc] = -1000.0f;
+  blasint index = BLASFUNC(isamax)(&N, x, &inc);
+  ASSERT_EQUAL(N / 2 + 1, index);
+  free(x);
+}
+#endif
+
+#ifdef BUILD_COMPLEX16
+CTEST(iamax, izamax_first_of_ties){
+  blasint i;
+  blasint N = ELEMENTS / 2, inc = 1;
+  double *x = (double *)malloc(sizeof(double) * N * 2);
+  for (i = 0; i < N * 2; i ++) {
+    x[i] = (double)(i % 100) / 100.0;
+  }
+
+  /* |re| + |im| is 10 for both */
+  x[2 * (N / 3)] = 4.0;
+  x[2 * (N / 3) + 1] = -6.0;
+  x[2 * (N - 2)] = -10.0;
+  x[2 * (N - 2) + 1] = 0.0;
+  blasint index = BLASFUNC(izamax)(&N, x, &inc);
+  ASSERT_EQUAL(N / 3 + 1, index);
+  free(x);
+}
+#endif
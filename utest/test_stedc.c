@@ -0,0 +1,215 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "openblas_utest.h"
+
+void BLASFUNC(dstedc)(char *, blasint *, double *, double *, double *, blasint *, double *, blasint *, blasint *, blasint *, blasint *);
+void BLASFUNC(sstedc)(char *, blasint *, float  *, float  *, float  *, blasint *, float  *, blasint *, blasint *, blasint *, blasint *);
+void BLASFUNC(dsterf)(blasint *, double *, double *, blasint *);
+void BLASFUNC(dsyevd)(char *, char *, blasint *, double *, blasint *, double *, double *, blasint *, blasint *, blasint *, blasint *);
+
+static double fill_value(unsigned int *seed)
+{
+	*seed = *seed * 1103515245u + 12345u;
+	return (double)((*seed >> 8) & 0xffff) / 32768.0 - 1.0;
+}
+
+/*
+ * divide and conquer on a random tridiagonal matrix, large enough for
+ * several levels of merges: returns the worst of the eigenvalue error
+ * against dsterf, the residual T * Z - Z * D and the loss of orthogonality
+ */
+static double check_dstedc(blasint n)
+{
+	blasint info, lwork, liwork, i, j, l;
+	unsigned int seed = 2024u + n;
+	double *d  = (double *)malloc(sizeof(double) * n);
+	double *e  = (double *)malloc(sizeof(double) * n);
+	double *d2 = (double *)malloc(sizeof(double) * n);
+	double *e2 = (double *)malloc(sizeof(double) * n);
+	double *a  = (double *)malloc(sizeof(double) * n);
+	double *t  = (double *)malloc(sizeof(double) * n);
+	double *z  = (double *)malloc(sizeof(double) * n * n);
+	double *work, wq, r, err = 0.0;
+	blasint *iwork, iwq;
+	char compz = 'I';
+
+	for (i = 0; i < n; i++) d[i] = d2[i] = a[i] = fill_value(&seed);
+	for (i = 0; i < n - 1; i++) e[i] = e2[i] = t[i] = fill_value(&seed);
+
+	lwork = -1;
+	liwork = -1;
+	BLASFUNC(dstedc)(&compz, &n, d, e, z, &n, &wq, &lwork, &iwq, &liwork, &info);
+	lwork = (blasint)wq;
+	liwork = iwq;
+	work  = (double *)malloc(sizeof(double) * lwork);
+	iwork = (blasint *)malloc(sizeof(blasint) * liwork);
+
+	BLASFUNC(dstedc)(&compz, &n, d, e, z, &n, work, &lwork, iwork, &liwork, &info);
+	if (info != 0) return 1.0;
+	BLASFUNC(dsterf)(&n, d2, e2, &info);
+
+	for (i = 0; i < n; i++) err = MAX(err, fabs(d[i] - d2[i]));
+
+	for (j = 0; j < n; j++) {
+		for (i = 0; i < n; i++) {
+			r = a[i] * z[i + j * n] - d[j] * z[i + j * n];
+			if (i > 0)     r += t[i - 1] * z[i - 1 + j * n];
+			if (i < n - 1) r += t[i] * z[i + 1 + j * n];
+			err = MAX(err, fabs(r));
+		}
+	}
+
+	for (j = 0; j < n; j++) {
+		for (i = 0; i <= j; i++) {
+			r = (i == j) ? -1.0 : 0.0;
+			for (l = 0; l < n; l++) r += z[l + i * n] * z[l + j * n];
+			err = MAX(err, fabs(r));
+		}
+	}
+
+	free(d); free(e); free(d2); free(e2); free(a); free(t); free(z); free(work); free(iwork);
+	return err;
+}
+
+CTEST(stedc, dstedc_merge)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dstedc(300), 1e-12);
+}
+
+CTEST(stedc, dstedc_small_merge)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dstedc(40), 1e-13);
+}
+
+CTEST(stedc, sstedc_merge)
+{
+	blasint n = 120, lwork = 1 + 4 * 120 + 120 * 120, liwork = 3 + 5 * 120, info, i;
+	unsigned int seed = 5u;
+	float d[120], e[120], d2[120], e2[120], err = 0.0f;
+	float *z = (float *)malloc(sizeof(float) * n * n);
+	float *work = (float *)malloc(sizeof(float) * lwork);
+	blasint iwork[3 + 5 * 120];
+	char compz = 'I', compn = 'N';
+
+	for (i = 0; i < n; i++) d[i] = d2[i] = (float)fill_value(&seed);
+	for (i = 0; i < n - 1; i++) e[i] = e2[i] = (float)fill_value(&seed);
+
+	BLASFUNC(sstedc)(&compz, &n, d, e, z, &n, work, &lwork, iwork, &liwork, &info);
+	ASSERT_EQUAL(0, info);
+	BLASFUNC(sstedc)(&compn, &n, d2, e2, z, &n, work, &lwork, iwork, &liwork, &info);
+	ASSERT_EQUAL(0, info);
+
+	for (i = 0; i < n; i++) err = MAX(err, fabsf(d[i] - d2[i]));
+
+	free(z); free(work);
+	ASSERT_DBL_NEAR_TOL(0.0, err, 1e-4);
+}
+
+/*
+ * dsyevd on a random symmetric matrix, large enough for several panels of
+ * the band reduction: returns the worst of the eigenvalue difference
+ * between JOBZ = 'N' and 'V', the residual A * Z - Z * W and the loss of
+ * orthogonality, relative to the norm of A
+ */
+static double check_dsyevd(char uplo, blasint n)
+{
+	blasint info, lwork = 1 + 6 * n + 2 * n * n, liwork = 3 + 5 * n, i, j, l;
+	unsigned int seed = 7u + n;
+	double *a  = (double *)malloc(sizeof(double) * n * n);
+	double *a0 = (double *)malloc(sizeof(double) * n * n);
+	double *a1 = (double *)malloc(sizeof(double) * n * n);
+	double *w  = (double *)malloc(sizeof(double) * n);
+	double *w1 = (double *)malloc(sizeof(double) * n);
+	double *work = (double *)malloc(sizeof(double) * lwork);
+	blasint *iwork = (blasint *)malloc(sizeof(blasint) * liwork);
+	double r, anrm = 0.0, err = 0.0;
+	char jobv = 'V', jobn = 'N';
+
+	for (j = 0; j < n; j++) {
+		for (i = j; i < n; i++) {
+			a0[i + j * n] = a0[j + i * n] = fill_value(&seed);
+			anrm = MAX(anrm, fabs(a0[i + j * n]));
+		}
+	}
+	anrm *= n;
+	for (i = 0; i < n * n; i++) a[i] = a1[i] = a0[i];
+
+	BLASFUNC(dsyevd)(&jobv, &uplo, &n, a, &n, w, work, &lwork, iwork, &liwork, &info);
+	if (info != 0) return 1.0;
+	BLASFUNC(dsyevd)(&jobn, &uplo, &n, a1, &n, w1, work, &lwork, iwork, &liwork, &info);
+	if (info != 0) return 1.0;
+
+	for (i = 0; i < n; i++) err = MAX(err, fabs(w[i] - w1[i]) / anrm);
+
+	for (j = 0; j < n; j++) {
+		for (i = 0; i < n; i++) {
+			r = -w[j] * a[i + j * n];
+			for (l = 0; l < n; l++) r += a0[i + l * n] * a[l + j * n];
+			err = MAX(err, fabs(r) / anrm);
+		}
+	}
+
+	for (j = 0; j < n; j++) {
+		for (i = 0; i <= j; i++) {
+			r = (i == j) ? -1.0 : 0.0;
+			for (l = 0; l < n; l++) r += a[l + i * n] * a[l + j * n];
+			err = MAX(err, fabs(r) / n);
+		}
+	}
+
+	free(a); free(a0); free(a1); free(w); free(w1); free(work); free(iwork);
+	return err;
+}
+
+CTEST(stedc, dsyevd_lower)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dsyevd('L', 200), 1e-13);
+}
+
+CTEST(stedc, dsyevd_upper)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dsyevd('U', 150), 1e-13);
+}
+
+CTEST(stedc, dsyevd_xerbla_jobz)
+{
+	blasint n = 4, lwork = 100, liwork = 100, info;
+	double a[16], w[4], work[100];
+	blasint iwork[100];
+	char jobz = 'X', uplo = 'L';
+
+	BLASFUNC(dsyevd)(&jobz, &uplo, &n, a, &n, w, work, &lwork, iwork, &liwork, &info);
+	ASSERT_EQUAL(-1, info);
+}
@@ -0,0 +1,204 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+
+/*
+ * Rank-k updates with several threads, for a k that fits in one GEMM_Q
+ * panel (column panels handed out by syrk_thread) and for a deep k (shared
+ * packed panels).  The selected triangle must match GEMM, the other one
+ * must be left alone.
+ */
+
+static double fill_value(unsigned int *seed)
+{
+	*seed = *seed * 1103515245u + 12345u;
+	return (double)((*seed >> 8) & 0xffff) / 32768.0 - 1.0;
+}
+
+static double *fill_matrix(blasint len, int cplx, unsigned int seed)
+{
+	blasint i;
+	double *x = (double *)malloc(sizeof(double) * len * (cplx ? 2 : 1));
+
+	for (i = 0; i < len * (cplx ? 2 : 1); i++) x[i] = fill_value(&seed);
+
+	return x;
+}
+
+/* largest error inside the triangle, or -1 if anything outside it changed */
+static double triangle_diff(char uplo, blasint n, blasint ldc, int cplx,
+			    double *c, double *ref, double *orig)
+{
+	blasint i, j, l, cs = cplx ? 2 : 1;
+	double d = 0.0;
+
+	for (j = 0; j < n; j++) {
+		for (i = 0; i < n; i++) {
+			for (l = 0; l < cs; l++) {
+				blasint p = (i + j * ldc) * cs + l;
+
+				if ((uplo == 'U') ? (i <= j) : (i >= j))
+					d = MAX(d, fabs(c[p] - ref[p]));
+				else if (c[p] != orig[p])
+					return -1.0;
+			}
+		}
+	}
+
+	return d;
+}
+
+static void set_threads(int nthreads)
+{
+#ifdef SMP
+	goto_set_num_threads(nthreads);
+#endif
+}
+
+static int get_threads(void)
+{
+#ifdef SMP
+	return blas_cpu_number;
+#else
+	return 1;
+#endif
+}
+
+#ifdef BUILD_DOUBLE
+static double check_dsyrk(char uplo, char trans, blasint n, blasint k, int two)
+{
+	char transb = (trans == 'N') ? 'T' : 'N';
+	blasint lda = ((trans == 'N') ? n : k) + 1;
+	blasint ldc = n + 3;
+	double alpha = 1.5, beta = -0.5, one = 1.0, d;
+	double *a    = fill_matrix(lda * ((trans == 'N') ? k : n), 0, 11u);
+	double *b    = fill_matrix(lda * ((trans == 'N') ? k : n), 0, 13u);
+	double *c    = fill_matrix(ldc * n, 0, 17u);
+	double *ref  = fill_matrix(ldc * n, 0, 17u);
+	double *orig = fill_matrix(ldc * n, 0, 17u);
+
+	if (two) {
+		BLASFUNC(dsyr2k)(&uplo, &trans, &n, &k, &alpha, a, &lda, b, &lda, &beta, c, &ldc);
+		BLASFUNC(dgemm)(&trans, &transb, &n, &n, &k, &alpha, a, &lda, b, &lda, &beta, ref, &ldc);
+		BLASFUNC(dgemm)(&trans, &transb, &n, &n, &k, &alpha, b, &lda, a, &lda, &one, ref, &ldc);
+	} else {
+		BLASFUNC(dsyrk)(&uplo, &trans, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
+		BLASFUNC(dgemm)(&trans, &transb, &n, &n, &k, &alpha, a, &lda, a, &lda, &beta, ref, &ldc);
+	}
+
+	d = triangle_diff(uplo, n, ldc, 0, c, ref, orig);
+
+	free(a);
+	free(b);
+	free(c);
+	free(ref);
+	free(orig);
+
+	return d;
+}
+
+CTEST(syrk, dsyrk_threaded)
+{
+	static const char trans[] = { 'N', 'T' };
+	int nthreads = get_threads(), u, t, two;
+
+	set_threads(4);
+
+	for (u = 0; u < 2; u++)
+		for (t = 0; t < 2; t++)
+			for (two = 0; two < 2; two++) {
+				double d = check_dsyrk(u ? 'L' : 'U', trans[t], 517, 64, two);
+				ASSERT_TRUE(d >= 0.0);
+				ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS * 100);
+
+				d = check_dsyrk(u ? 'L' : 'U', trans[t], 301, 700, two);
+				ASSERT_TRUE(d >= 0.0);
+				ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS * 1000);
+			}
+
+	set_threads(nthreads);
+}
+#endif
+
+#ifdef BUILD_COMPLEX16
+static double check_zherk(char uplo, char trans, blasint n, blasint k)
+{
+	char transb = (trans == 'N') ? 'C' : 'N';
+	blasint lda = ((trans == 'N') ? n : k) + 1;
+	blasint ldc = n + 3, j;
+	double alpha = 1.5, beta = -0.5, d;
+	double zalpha[2] = { 1.5, 0.0 }, zbeta[2] = { -0.5, 0.0 };
+	double *a    = fill_matrix(lda * ((trans == 'N') ? k : n), 1, 11u);
+	double *c    = fill_matrix(ldc * n, 1, 17u);
+	double *ref  = fill_matrix(ldc * n, 1, 17u);
+	double *orig = fill_matrix(ldc * n, 1, 17u);
+
+	/* a Hermitian C has a real diagonal */
+	for (j = 0; j < n; j++)
+		c[(j + j * ldc) * 2 + 1] = ref[(j + j * ldc) * 2 + 1] = orig[(j + j * ldc) * 2 + 1] = 0.0;
+
+	BLASFUNC(zherk)(&uplo, &trans, &n, &k, &alpha, a, &lda, &beta, c, &ldc);
+	BLASFUNC(zgemm)(&trans, &transb, &n, &n, &k, zalpha, a, &lda, a, &lda, zbeta, ref, &ldc);
+
+	d = triangle_diff(uplo, n, ldc, 1, c, ref, orig);
+
+	free(a);
+	free(c);
+	free(ref);
+	free(orig);
+
+	return d;
+}
+
+CTEST(syrk, zherk_threaded)
+{
+	static const char trans[] = { 'N', 'C' };
+	int nthreads = get_threads(), u, t;
+
+	set_threads(4);
+
+	for (u = 0; u < 2; u++)
+		for (t = 0; t < 2; t++) {
+			double d = check_zherk(u ? 'L' : 'U', trans[t], 293, 64);
+			ASSERT_TRUE(d >= 0.0);
+			ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS * 100);
+
+			d = check_zherk(u ? 'L' : 'U', trans[t], 211, 400);
+			ASSERT_TRUE(d >= 0.0);
+			ASSERT_DBL_NEAR_TOL(0.0, d, DOUBLE_EPS * 1000);
+		}
+
+	set_threads(nthreads);
+}
+#endif
@@ -0,0 +1,142 @@
+/*****************************************************************************
+Copyright (c) 2024, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "openblas_utest.h"
+
+void BLASFUNC(ssytrs)(char *, blasint *, blasint *, float  *, blasint *, blasint *, float  *, blasint *, blasint *);
+void BLASFUNC(dsytrs)(char *, blasint *, blasint *, double *, blasint *, blasint *, double *, blasint *, blasint *);
+
+static double fill_value(unsigned int *seed)
+{
+	*seed = *seed * 1103515245u + 12345u;
+	return (double)((*seed >> 8) & 0xffff) / 32768.0 - 1.0;
+}
+
+/* factor a random symmetric matrix, solve with dsytrs and return the relative residual */
+static double check_dsytrf(char uplo, blasint n, blasint lda)
+{
+	blasint info, lwork, one = 1, i, j;
+	unsigned int seed = 4321u + n * 13u;
+	double *a = (double *)malloc(sizeof(double) * lda * n);
+	double *s = (double *)malloc(sizeof(double) * n * n);
+	double *x = (double *)malloc(sizeof(double) * n);
+	double *b = (double *)malloc(sizeof(double) * n);
+	blasint *ipiv = (blasint *)malloc(sizeof(blasint) * n);
+	double wq, *work, r, res = 0.0, nrm = 0.0;
+
+	for (j = 0; j < n; j++)
+		for (i = j; i < n; i++)
+			s[i + j * n] = s[j + i * n] = fill_value(&seed);
+	for (j = 0; j < n; j++) {
+		for (i = 0; i < n; i++) a[i + j * lda] = s[i + j * n];
+		x[j] = b[j] = fill_value(&seed);
+	}
+
+	lwork = -1;
+	BLASFUNC(dsytrf)(&uplo, &n, a, &lda, ipiv, &wq, &lwork, &info);
+	lwork = MAX(1, (blasint)wq);
+	work = (double *)malloc(sizeof(double) * lwork);
+	BLASFUNC(dsytrf)(&uplo, &n, a, &lda, ipiv, work, &lwork, &info);
+	if (info != 0) return 1.0;
+	BLASFUNC(dsytrs)(&uplo, &n, &one, a, &lda, ipiv, x, &n, &info);
+
+	for (i = 0; i < n; i++) {
+		r = -b[i];
+		for (j = 0; j < n; j++) {
+			r += s[i + j * n] * x[j];
+			nrm = MAX(nrm, fabs(s[i + j * n] * x[j]));
+		}
+		res = MAX(res, fabs(r));
+	}
+
+	free(a); free(s); free(x); free(b); free(ipiv); free(work);
+	return res / nrm;
+}
+
+CTEST(sytrf, dsytrf_lower)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dsytrf('L', 300, 310), 1e-10);
+}
+
+CTEST(sytrf, dsytrf_upper)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dsytrf('U', 300, 310), 1e-10);
+}
+
+/* smaller than one panel, handled by a single lasyf call */
+CTEST(sytrf, dsytrf_small)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dsytrf('L', 37, 37), 1e-12);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dsytrf('U', 37, 37), 1e-12);
+}
+
+CTEST(sytrf, ssytrf_lower)
+{
+	blasint n = 130, lda = 130, lwork = 1, one = 1, info, i, j;
+	unsigned int seed = 77u;
+	float *a = (float *)malloc(sizeof(float) * lda * n);
+	float *s = (float *)malloc(sizeof(float) * lda * n);
+	float x[130], b[130], work[1], r, res = 0.0f;
+	blasint ipiv[130];
+	char uplo = 'L';
+
+	for (j = 0; j < n; j++)
+		for (i = j; i < n; i++)
+			a[i + j * lda] = a[j + i * lda] = s[i + j * lda] = s[j + i * lda] = (float)fill_value(&seed);
+	for (i = 0; i < n; i++) x[i] = b[i] = (float)fill_value(&seed);
+
+	BLASFUNC(ssytrf)(&uplo, &n, a, &lda, ipiv, work, &lwork, &info);
+	ASSERT_EQUAL(0, info);
+	BLASFUNC(ssytrs)(&uplo, &n, &one, a, &lda, ipiv, x, &n, &info);
+
+	for (i = 0; i < n; i++) {
+		r = -b[i];
+		for (j = 0; j < n; j++) r += s[i + j * lda] * x[j];
+		res = MAX(res, fabsf(r));
+	}
+
+	free(a); free(s);
+	ASSERT_DBL_NEAR_TOL(0.0, res, 1e-2);
+}
+
+CTEST(sytrf, xerbla_uplo_invalid)
+{
+	blasint n = 10, lda = 10, lwork = 10, info;
+	double a[100], work[10];
+	blasint ipiv[10];
+	char uplo = 'X';
+
+	BLASFUNC(dsytrf)(&uplo, &n, a, &lda, ipiv, work, &lwork, &info);
+	ASSERT_EQUAL(-1, info);
+}